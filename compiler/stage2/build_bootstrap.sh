@@ -36,10 +36,14 @@ gcc -c "$C_HELPERS/parser/parser_impl.c" -o "$C_HELPERS/parser/parser_impl.o" -O
 gcc -c "$C_HELPERS/semantic/symbol_table.c" -o "$C_HELPERS/semantic/symbol_table.o" -O2 -Wall -I"$STAGE2_DIR"
 gcc -c "$C_HELPERS/semantic/type_checker.c" -o "$C_HELPERS/semantic/type_checker.o" -O2 -Wall -I"$STAGE2_DIR"
 gcc -c "$C_HELPERS/semantic/semantic_analyzer.c" -o "$C_HELPERS/semantic/semantic_analyzer.o" -O2 -Wall -I"$STAGE2_DIR" 2>&1 | grep -v "strncpy.*truncation" || true
+gcc -c "$C_HELPERS/semantic/escape_analysis.c" -o "$C_HELPERS/semantic/escape_analysis.o" -O2 -Wall -I"$STAGE2_DIR"
 
 # Codegen
 gcc -c "$C_HELPERS/codegen/codegen.c" -o "$C_HELPERS/codegen/codegen.o" -O2 -Wall -I"$STAGE2_DIR" 2>&1 | grep -v "strncpy.*truncation" || true
 
+# Server (persistent compile server / thin client)
+gcc -c "$C_HELPERS/server/compile_server.c" -o "$C_HELPERS/server/compile_server.o" -O2 -Wall -pthread -I"$STAGE2_DIR"
+
 echo -e "${GREEN}✅ All components compiled${NC}"
 
 # Step 2: Link unified compiler
@@ -54,8 +58,10 @@ gcc -o "$OUTPUT_BINARY" \
     "$C_HELPERS/semantic/symbol_table.o" \
     "$C_HELPERS/semantic/type_checker.o" \
     "$C_HELPERS/semantic/semantic_analyzer.o" \
+    "$C_HELPERS/semantic/escape_analysis.o" \
     "$C_HELPERS/codegen/codegen.o" \
-    -O2 -Wall -I"$STAGE2_DIR"
+    "$C_HELPERS/server/compile_server.o" \
+    -O2 -Wall -pthread -I"$STAGE2_DIR"
 
 if [ $? -eq 0 ]; then
     echo -e "${GREEN}✅ Unified compiler linked successfully${NC}"
@@ -94,4 +100,5 @@ echo "  ✓ Forward declarations"
 echo "  ✓ Multi-function programs"
 echo "  ✓ Modular architecture"
 echo "  ✓ Clean error reporting"
+echo "  ✓ Compile server mode (--server / --client)"
 echo ""
@@ -18,20 +18,39 @@
  * - Expressions (arithmetic, logical, comparison)
  * - Control flow (if-then-else, while loops)
  * - Function calls
+ * - Builtin calls (lowered to runtime/stdlib functions)
+ * - Strings (runtime/stdlib mlp_string.c, mlp_string_builder.c; temporaries
+ *   in mlp_region.c)
  * 
  * Type Mapping:
  * - int → i64
  * - bool → i1
+ * - string → %MelpStr = { i8*, i64 } (data, length; runtime/stdlib mlp_string.h)
+ *   Passed to the runtime as two scalars (i8* data, i64 length), the way
+ *   the C ABI lowers a by-value MelpStr; literals come from a deduplicated
+ *   pool of private constants and are never copied at run time. A string
+ *   variable owns its buffer (see STRING OWNERSHIP).
+ * - numeric[] / boolean[] / string[] → %MelpList.i64* / .i1* / .str*
+ *   (runtime/stdlib mlp_list.h: { elements, length, capacity, element_size,
+ *   refcount } with the element pointer typed per list, so element access
+ *   is a GEP)
  * - void → void
  */
 
+/* For strdup() on POSIX systems */
+#define _POSIX_C_SOURCE 200809L
+
 #include "codegen.h"
+#include <ctype.h>
 #include <stdlib.h>
 #include <string.h>
 
 /* Global error state */
 static char g_error_message[512] = "";
 
+/* Reference counting of the last generated module (get_codegen_rc_stats) */
+static CodegenRcStats g_rc_stats;
+
 /* Static buffers for generated names (thread-unsafe but simple) */
 static char g_register_buffer[32];
 static char g_label_buffer[32];
@@ -42,14 +61,12 @@ static char g_expr_result_buffer[32];
  * ============================================================================ */
 
 /* Clean identifier name (workaround for parser lexeme issue)
- * Extracts first word before space/newline/parenthesis
+ * Extracts the identifier at the start of the lexeme (letters, digits, _)
  */
 static const char* clean_identifier(const char* raw_name) {
     static char clean_name[256];
     int i = 0;
-    while (raw_name[i] != '\0' && raw_name[i] != ' ' && 
-           raw_name[i] != '\n' && raw_name[i] != '(' && 
-           raw_name[i] != ')' && raw_name[i] != ';' && i < 255) {
+    while ((isalnum((unsigned char)raw_name[i]) || raw_name[i] == '_') && i < 255) {
         clean_name[i] = raw_name[i];
         i++;
     }
@@ -63,6 +80,8 @@ const char* get_llvm_type(const char* melp_type) {
         return "i64";
     } else if (strcmp(melp_type, "boolean") == 0 || strcmp(melp_type, "bool") == 0) {
         return "i1";
+    } else if (strcmp(melp_type, "string") == 0) {
+        return "%MelpStr";
     } else if (strcmp(melp_type, "void") == 0) {
         return "void";
     }
@@ -75,11 +94,24 @@ const char* get_llvm_type_from_ast(ASTNode* type_node) {
         return "i64"; // Default
     }
     
+    if (type_node->data.type.is_list) {
+        switch (type_node->data.type.type_token) {
+            case TOKEN_BOOLEAN:
+                return "%MelpList.i1*";
+            case TOKEN_STRING_TYPE:
+                return "%MelpList.str*";
+            default:
+                return "%MelpList.i64*";
+        }
+    }
+    
     switch (type_node->data.type.type_token) {
         case TOKEN_NUMERIC:
             return "i64";
         case TOKEN_BOOLEAN:
             return "i1";
+        case TOKEN_STRING_TYPE:
+            return "%MelpStr";
         default:
             return "i64";
     }
@@ -156,19 +188,318 @@ static void set_error(CodegenContext* ctx, const char* message) {
     g_error_message[sizeof(g_error_message) - 1] = '\0';
 }
 
+/* ============================================================================
+ * TYPES AND SYMBOLS
+ * ============================================================================ */
+
+/* LLVM type for a TypeKind */
+static const char* llvm_type_for_kind(TypeKind kind) {
+    switch (kind) {
+        case TYPE_BOOL:   return "i1";
+        case TYPE_STRING: return "%MelpStr";
+        case TYPE_INT_LIST:    return "%MelpList.i64*";
+        case TYPE_BOOL_LIST:   return "%MelpList.i1*";
+        case TYPE_STRING_LIST: return "%MelpList.str*";
+        case TYPE_VOID:   return "void";
+        default:          return "i64";
+    }
+}
+
+static bool is_list_kind(TypeKind kind) {
+    return kind == TYPE_INT_LIST || kind == TYPE_BOOL_LIST || kind == TYPE_STRING_LIST;
+}
+
+/* Element TypeKind of a list kind */
+static TypeKind list_element_kind(TypeKind kind) {
+    switch (kind) {
+        case TYPE_BOOL_LIST:   return TYPE_BOOL;
+        case TYPE_STRING_LIST: return TYPE_STRING;
+        default:               return TYPE_INT;
+    }
+}
+
+/* List kind holding element kind */
+static TypeKind list_kind_of(TypeKind element) {
+    switch (element) {
+        case TYPE_BOOL:   return TYPE_BOOL_LIST;
+        case TYPE_STRING: return TYPE_STRING_LIST;
+        default:          return TYPE_INT_LIST;
+    }
+}
+
+/* Struct type of a list kind (llvm_type_for_kind without the '*') */
+static const char* list_struct_type(TypeKind kind) {
+    switch (kind) {
+        case TYPE_BOOL_LIST:   return "%MelpList.i1";
+        case TYPE_STRING_LIST: return "%MelpList.str";
+        default:               return "%MelpList.i64";
+    }
+}
+
+/* Bytes per element (MelpList.element_size): LLVM stores i1 in one byte */
+static int list_element_size(TypeKind kind) {
+    switch (kind) {
+        case TYPE_BOOL_LIST:   return 1;
+        case TYPE_STRING_LIST: return 16;
+        default:               return 8;
+    }
+}
+
+/* TypeKind of an AST_TYPE node */
+static TypeKind ast_type_kind(ASTNode* type_node) {
+    TypeKind kind = ast_type_to_type(type_node)->kind;
+    return (kind == TYPE_UNKNOWN) ? TYPE_INT : kind;
+}
+
+/* Does the (possibly non-terminated) identifier spell name? */
+static bool identifier_equals(const char* raw_name, const char* name) {
+    return strcmp(clean_identifier(raw_name), name) == 0;
+}
+
+/* User function definition, or NULL */
+static ASTNode* find_function(CodegenContext* ctx, const char* raw_name) {
+    if (!ctx->program) {
+        return NULL;
+    }
+    
+    char name[256];
+    strncpy(name, clean_identifier(raw_name), sizeof(name) - 1);
+    name[sizeof(name) - 1] = '\0';
+    
+    for (int i = 0; i < ctx->program->data.program.function_count; i++) {
+        ASTNode* func = ctx->program->data.program.functions[i];
+        if (identifier_equals(func->data.function.name, name)) {
+            return func;
+        }
+    }
+    return NULL;
+}
+
+/* Builtin for this call, unless a user function shadows it */
+static const BuiltinFunction* find_builtin(ASTNode* call, CodegenContext* ctx) {
+    const BuiltinFunction* builtin = lookup_builtin_function(call->data.call.name);
+    if (!builtin || find_function(ctx, builtin->name)) {
+        return NULL;
+    }
+    return builtin;
+}
+
+static TypeKind expression_type(ASTNode* expr, CodegenContext* ctx);
+
+/* Overload of builtin matching the call's argument types (e.g. print(string)) */
+static const BuiltinFunction* resolve_builtin_overload(ASTNode* call, const BuiltinFunction* builtin,
+                                                       CodegenContext* ctx) {
+    int arg_count = call->data.call.argument_count;
+    if (arg_count > BUILTIN_MAX_PARAMS) {
+        return builtin;
+    }
+    
+    TypeKind arg_types[BUILTIN_MAX_PARAMS];
+    for (int i = 0; i < arg_count; i++) {
+        arg_types[i] = expression_type(call->data.call.arguments[i], ctx);
+    }
+    const BuiltinFunction* overload = lookup_builtin_overload(builtin->name, arg_types, arg_count);
+    return overload ? overload : builtin;
+}
+
+/* Record a parameter/local of the current function */
+static void declare_variable(CodegenContext* ctx, const char* raw_name, TypeKind type) {
+    if (ctx->variable_count >= CODEGEN_MAX_VARIABLES) {
+        set_error(ctx, "Too many variables in function");
+        return;
+    }
+    
+    CodegenVariable* var = &ctx->variables[ctx->variable_count++];
+    strncpy(var->name, clean_identifier(raw_name), sizeof(var->name) - 1);
+    var->name[sizeof(var->name) - 1] = '\0';
+    var->type = type;
+    var->owned = false;
+    var->unique = false;
+    var->live = false;
+}
+
+/* Variable of the current function, or NULL */
+static CodegenVariable* find_variable(CodegenContext* ctx, const char* raw_name) {
+    const char* name = clean_identifier(raw_name);
+    for (int i = ctx->variable_count - 1; i >= 0; i--) {
+        if (strcmp(ctx->variables[i].name, name) == 0) {
+            return &ctx->variables[i];
+        }
+    }
+    return NULL;
+}
+
+/* Type of a variable of the current function (numeric if unknown) */
+static TypeKind variable_type(CodegenContext* ctx, const char* raw_name) {
+    const CodegenVariable* var = find_variable(ctx, raw_name);
+    return var ? var->type : TYPE_INT;
+}
+
+/* Type of an expression (the program already passed semantic analysis) */
+static TypeKind expression_type(ASTNode* expr, CodegenContext* ctx) {
+    if (!expr) {
+        return TYPE_INT;
+    }
+    
+    switch (expr->type) {
+        case AST_LITERAL:
+            switch (expr->data.literal.literal_type) {
+                case TOKEN_TRUE:
+                case TOKEN_FALSE:  return TYPE_BOOL;
+                case TOKEN_STRING: return TYPE_STRING;
+                default:           return TYPE_INT;
+            }
+            
+        case AST_IDENTIFIER:
+            return variable_type(ctx, expr->data.identifier.name);
+            
+        case AST_BINARY_OP:
+            switch (expr->data.binary_op.op) {
+                case TOKEN_PLUS:
+                    return expression_type(expr->data.binary_op.left, ctx);
+                case TOKEN_MINUS:
+                case TOKEN_STAR:
+                case TOKEN_SLASH:
+                case TOKEN_MOD:
+                    return TYPE_INT;
+                default:
+                    return TYPE_BOOL;
+            }
+            
+        case AST_UNARY_OP:
+            return (expr->data.unary_op.op == TOKEN_NOT) ? TYPE_BOOL : TYPE_INT;
+            
+        case AST_FUNCTION_CALL: {
+            const BuiltinFunction* builtin = find_builtin(expr, ctx);
+            if (builtin) {
+                return resolve_builtin_overload(expr, builtin, ctx)->return_type;
+            }
+            ASTNode* func = find_function(ctx, expr->data.call.name);
+            return func ? ast_type_kind(func->data.function.return_type) : TYPE_INT;
+        }
+        
+        case AST_INDEX:
+            return list_element_kind(expression_type(expr->data.index.list, ctx));
+            
+        case AST_LIST_LITERAL:
+            // [] is typed by its context (see codegen_value)
+            if (expr->data.list_literal.element_count == 0) {
+                return TYPE_INT_LIST;
+            }
+            return list_kind_of(expression_type(expr->data.list_literal.elements[0], ctx));
+        
+        default:
+            return TYPE_INT;
+    }
+}
+
+/* Intern a string literal; returns N for its @.str.N global
+ * Equal texts share one global, so a literal used in many places (or
+ * produced by folding) is emitted once.
+ */
+static int add_string_literal(CodegenContext* ctx, const char* text) {
+    for (int i = 0; i < ctx->string_literal_count; i++) {
+        if (strcmp(ctx->string_literals[i], text) == 0) {
+            return i;
+        }
+    }
+    
+    if (ctx->string_literal_count >= ctx->string_literal_capacity) {
+        int capacity = ctx->string_literal_capacity ? ctx->string_literal_capacity * 2 : 8;
+        char** literals = realloc(ctx->string_literals, sizeof(char*) * capacity);
+        if (!literals) {
+            set_error(ctx, "Out of memory recording string literals");
+            return 0;
+        }
+        ctx->string_literals = literals;
+        ctx->string_literal_capacity = capacity;
+    }
+    
+    char* copy = strdup(text);
+    if (!copy) {
+        set_error(ctx, "Out of memory recording string literals");
+        return 0;
+    }
+    ctx->string_literals[ctx->string_literal_count] = copy;
+    return ctx->string_literal_count++;
+}
+
+/* Room for runtime call argument text: "i8* %d, i64 %l" for a string (two
+ * registers), "<type> <value>" otherwise (a value is at most a register long)
+ */
+#define RUNTIME_ARGUMENT_SIZE (sizeof("%MelpList.str* , i64 ") + 2 * sizeof(g_register_buffer))
+
+/* Argument text that did not fit is a codegen error (never truncated IR) */
+static void check_argument_fits(CodegenContext* ctx, int written, size_t out_size) {
+    if (written < 0 || (size_t)written >= out_size) {
+        set_error(ctx, "Runtime call argument too long");
+    }
+}
+
+/* Split a %MelpStr value into the runtime's (i8* data, i64 length) arguments
+ * Writes "i8* %d, i64 %l" to out.
+ */
+static void string_arguments(CodegenContext* ctx, const char* value, char* out, size_t out_size) {
+    char data_reg[32];
+    strncpy(data_reg, next_register(ctx), sizeof(data_reg) - 1);
+    data_reg[sizeof(data_reg) - 1] = '\0';
+    fprintf(ctx->output, "  %s = extractvalue %%MelpStr %s, 0\n", data_reg, value);
+    const char* length_reg = next_register(ctx);
+    fprintf(ctx->output, "  %s = extractvalue %%MelpStr %s, 1\n", length_reg, value);
+    check_argument_fits(ctx, snprintf(out, out_size, "i8* %s, i64 %s", data_reg, length_reg), out_size);
+}
+
+/* Argument text for a runtime call: strings expand to (data, length) */
+static void runtime_argument(CodegenContext* ctx, TypeKind type, const char* value,
+                             char* out, size_t out_size) {
+    if (type == TYPE_STRING) {
+        string_arguments(ctx, value, out, out_size);
+    } else {
+        check_argument_fits(ctx, snprintf(out, out_size, "%s %s", llvm_type_for_kind(type), value), out_size);
+    }
+}
+
 /* ============================================================================
  * CODE GENERATION - EXPRESSIONS
  * ============================================================================ */
 
 /* Forward declaration */
 const char* codegen_expression(ASTNode* expr, CodegenContext* ctx);
+static const char* codegen_temporary(ASTNode* expr, CodegenContext* ctx);
+
+/* Constant i8* to pooled text (e.g. "getelementptr inbounds (... @.str.2 ...)") */
+static void string_constant_pointer(CodegenContext* ctx, const char* text, char* out, size_t out_size) {
+    size_t length = strlen(text);
+    int index = add_string_literal(ctx, text);
+    snprintf(out, out_size, "getelementptr inbounds ([%zu x i8], [%zu x i8]* @.str.%d, i64 0, i64 0)",
+             length + 1, length + 1, index);
+}
+
+/* Emit a %MelpStr for constant text: (pointer to its pool global,
+ * length known at compile time). Nothing is copied at run time.
+ */
+static const char* codegen_string_constant(CodegenContext* ctx, const char* text) {
+    size_t length = strlen(text);
+    char pointer[128];
+    string_constant_pointer(ctx, text, pointer, sizeof(pointer));
+    char data_reg[32];
+    strncpy(data_reg, next_register(ctx), sizeof(data_reg) - 1);
+    data_reg[sizeof(data_reg) - 1] = '\0';
+    fprintf(ctx->output, "  %s = insertvalue %%MelpStr undef, i8* %s, 0\n", data_reg, pointer);
+    const char* result_reg = next_register(ctx);
+    fprintf(ctx->output, "  %s = insertvalue %%MelpStr %s, i64 %zu, 1\n",
+            result_reg, data_reg, length);
+    strncpy(g_expr_result_buffer, result_reg, sizeof(g_expr_result_buffer) - 1);
+    return g_expr_result_buffer;
+}
 
 /* Generate code for literal */
 static const char* codegen_literal(ASTNode* literal, CodegenContext* ctx) {
-    (void)ctx; // Literals don't need context
     static char literal_buffer[32];
     
     switch (literal->data.literal.literal_type) {
+        case TOKEN_STRING:
+            return codegen_string_constant(ctx, literal->data.literal.value.string_value);
         case TOKEN_NUMBER:
             snprintf(literal_buffer, sizeof(literal_buffer), "%lld", 
                      literal->data.literal.value.int_value);
@@ -182,166 +513,1547 @@ static const char* codegen_literal(ASTNode* literal, CodegenContext* ctx) {
         default:
             snprintf(literal_buffer, sizeof(literal_buffer), "0");
     }
-    
-    return literal_buffer;
+    
+    return literal_buffer;
+}
+
+/* Generate code for identifier (variable reference) */
+static const char* codegen_identifier(ASTNode* identifier, CodegenContext* ctx) {
+    const char* llvm_type = llvm_type_for_kind(variable_type(ctx, identifier->data.identifier.name));
+    const char* var_name = clean_identifier(identifier->data.identifier.name);
+    
+    // Load variable from memory
+    const char* result_reg = next_register(ctx);
+    fprintf(ctx->output, "  %s = load %s, %s* %%%s\n", result_reg, llvm_type, llvm_type, var_name);
+    
+    // Return register name (stored in static buffer for reuse)
+    strncpy(g_expr_result_buffer, result_reg, sizeof(g_expr_result_buffer) - 1);
+    return g_expr_result_buffer;
+}
+
+/* Operand of a flattened string + chain
+ * Adjacent literals are folded at compile time into one text piece, so
+ * "a" + "b" costs nothing at run time and s + "x" + "y" appends "xy" once.
+ */
+typedef struct ConcatPiece {
+    ASTNode* expr;   // Operand to evaluate, or NULL for folded text
+    char* text;      // Folded literal text (owned)
+} ConcatPiece;
+
+typedef struct ConcatPieces {
+    ConcatPiece* items;
+    int count;
+    int capacity;
+} ConcatPieces;
+
+static bool push_concat_piece(ConcatPieces* pieces, ASTNode* expr, char* text) {
+    if (pieces->count >= pieces->capacity) {
+        int capacity = pieces->capacity ? pieces->capacity * 2 : 8;
+        ConcatPiece* items = realloc(pieces->items, sizeof(ConcatPiece) * capacity);
+        if (!items) {
+            return false;
+        }
+        pieces->items = items;
+        pieces->capacity = capacity;
+    }
+    pieces->items[pieces->count].expr = expr;
+    pieces->items[pieces->count].text = text;
+    pieces->count++;
+    return true;
+}
+
+/* Flatten node's string + chain (either nesting) into pieces, left to right */
+static bool flatten_concat(ASTNode* node, ConcatPieces* pieces, CodegenContext* ctx) {
+    if (node->type == AST_BINARY_OP && node->data.binary_op.op == TOKEN_PLUS &&
+        expression_type(node->data.binary_op.left, ctx) == TYPE_STRING) {
+        return flatten_concat(node->data.binary_op.left, pieces, ctx) &&
+               flatten_concat(node->data.binary_op.right, pieces, ctx);
+    }
+    
+    if (node->type != AST_LITERAL || node->data.literal.literal_type != TOKEN_STRING) {
+        return push_concat_piece(pieces, node, NULL);
+    }
+    
+    const char* text = node->data.literal.value.string_value;
+    ConcatPiece* last = pieces->count ? &pieces->items[pieces->count - 1] : NULL;
+    if (last && !last->expr) {
+        size_t used = strlen(last->text);
+        char* joined = realloc(last->text, used + strlen(text) + 1);
+        if (!joined) {
+            return false;
+        }
+        strcpy(joined + used, text);
+        last->text = joined;
+        return true;
+    }
+    
+    char* copy = strdup(text);
+    if (!copy) {
+        return false;
+    }
+    if (!push_concat_piece(pieces, NULL, copy)) {
+        free(copy);
+        return false;
+    }
+    return true;
+}
+
+static void free_concat_pieces(ConcatPieces* pieces) {
+    for (int i = 0; i < pieces->count; i++) {
+        free(pieces->items[i].text);
+    }
+    free(pieces->items);
+}
+
+/* Evaluate one piece to a %MelpStr value (copied to out)
+ * Its bytes are copied by the concatenation, so it may be a temporary.
+ */
+static void codegen_concat_piece(const ConcatPiece* piece, CodegenContext* ctx,
+                                 char* out, size_t out_size) {
+    const char* value = piece->expr ? codegen_temporary(piece->expr, ctx)
+                                    : codegen_string_constant(ctx, piece->text);
+    strncpy(out, value, out_size - 1);
+    out[out_size - 1] = '\0';
+}
+
+/* Generate code for string concatenation
+ * The chain is flattened and its literals folded; what is left is joined
+ * left to right, three operands per mlp_str_concat3 call, so a + b + c
+ * never materializes a + b. A chain of literals is a single constant.
+ * Partial results, and the result itself when it is temporary, go to the
+ * temporaries region (the *_tmp calls).
+ */
+static const char* codegen_string_concat(ASTNode* concat, bool temporary, CodegenContext* ctx) {
+    ConcatPieces pieces = { NULL, 0, 0 };
+    if (!flatten_concat(concat, &pieces, ctx)) {
+        free_concat_pieces(&pieces);
+        set_error(ctx, "Out of memory folding string concatenation");
+        return "zeroinitializer";
+    }
+    
+    char result[32];
+    codegen_concat_piece(&pieces.items[0], ctx, result, sizeof(result));
+    for (int i = 1; i < pieces.count; ) {
+        int take = pieces.count - i >= 2 ? 2 : 1;
+        char args[3][RUNTIME_ARGUMENT_SIZE];
+        string_arguments(ctx, result, args[0], sizeof(args[0]));
+        for (int j = 0; j < take; j++) {
+            char value[32];
+            codegen_concat_piece(&pieces.items[i + j], ctx, value, sizeof(value));
+            string_arguments(ctx, value, args[j + 1], sizeof(args[j + 1]));
+        }
+        
+        bool partial = i + take < pieces.count;
+        const char* suffix = (partial || temporary) ? "_tmp" : "";
+        ctx->made_temporaries |= partial || temporary;
+        
+        const char* result_reg = next_register(ctx);
+        if (take == 2) {
+            fprintf(ctx->output, "  %s = call %%MelpStr @mlp_str_concat3%s(%s, %s, %s)\n",
+                    result_reg, suffix, args[0], args[1], args[2]);
+        } else {
+            fprintf(ctx->output, "  %s = call %%MelpStr @mlp_str_concat%s(%s, %s)\n",
+                    result_reg, suffix, args[0], args[1]);
+        }
+        strncpy(result, result_reg, sizeof(result) - 1);
+        i += take;
+    }
+    free_concat_pieces(&pieces);
+    
+    strncpy(g_expr_result_buffer, result, sizeof(g_expr_result_buffer) - 1);
+    return g_expr_result_buffer;
+}
+
+/* Generate code for string == / != (lengths first, then bytes; both
+ * operands are temporaries)
+ */
+static const char* codegen_string_equality(ASTNode* binary_op, CodegenContext* ctx) {
+    char left_copy[32], right_copy[32], cmp_reg[32];
+    char left_args[RUNTIME_ARGUMENT_SIZE], right_args[RUNTIME_ARGUMENT_SIZE];
+    strncpy(left_copy, codegen_temporary(binary_op->data.binary_op.left, ctx), sizeof(left_copy) - 1);
+    left_copy[sizeof(left_copy) - 1] = '\0';
+    strncpy(right_copy, codegen_temporary(binary_op->data.binary_op.right, ctx), sizeof(right_copy) - 1);
+    right_copy[sizeof(right_copy) - 1] = '\0';
+    string_arguments(ctx, left_copy, left_args, sizeof(left_args));
+    string_arguments(ctx, right_copy, right_args, sizeof(right_args));
+    
+    strncpy(cmp_reg, next_register(ctx), sizeof(cmp_reg) - 1);
+    cmp_reg[sizeof(cmp_reg) - 1] = '\0';
+    fprintf(ctx->output, "  %s = call i32 @mlp_str_equals(%s, %s)\n",
+            cmp_reg, left_args, right_args);
+    
+    const char* result_reg = next_register(ctx);
+    fprintf(ctx->output, "  %s = icmp %s i32 %s, 0\n", result_reg,
+            binary_op->data.binary_op.op == TOKEN_EQUAL_EQUAL ? "ne" : "eq", cmp_reg);
+    
+    strncpy(g_expr_result_buffer, result_reg, sizeof(g_expr_result_buffer) - 1);
+    return g_expr_result_buffer;
+}
+
+/* Generate code for binary operation */
+static const char* codegen_binary_op(ASTNode* binary_op, bool temporary, CodegenContext* ctx) {
+    TokenType op = binary_op->data.binary_op.op;
+    TypeKind operand_type = expression_type(binary_op->data.binary_op.left, ctx);
+    
+    if (operand_type == TYPE_STRING) {
+        if (op == TOKEN_PLUS) {
+            return codegen_string_concat(binary_op, temporary, ctx);
+        }
+        if (op == TOKEN_EQUAL_EQUAL || op == TOKEN_NOT_EQUAL) {
+            return codegen_string_equality(binary_op, ctx);
+        }
+    }
+    
+    // Generate left and right operands
+    const char* left = codegen_expression(binary_op->data.binary_op.left, ctx);
+    char left_copy[32];
+    strncpy(left_copy, left, sizeof(left_copy) - 1);
+    
+    const char* right = codegen_expression(binary_op->data.binary_op.right, ctx);
+    char right_copy[32];
+    strncpy(right_copy, right, sizeof(right_copy) - 1);
+    
+    const char* op_str = token_type_to_op_string(binary_op->data.binary_op.op);
+    const char* result_reg = next_register(ctx);
+    
+    // Determine operation type
+    switch (binary_op->data.binary_op.op) {
+        case TOKEN_PLUS:
+        case TOKEN_MINUS:
+        case TOKEN_STAR:
+        case TOKEN_SLASH:
+        case TOKEN_MOD: {
+            // Arithmetic operations
+            const char* llvm_op = get_llvm_binary_op(op_str, "i64");
+            fprintf(ctx->output, "  %s = %s i64 %s, %s\n", 
+                    result_reg, llvm_op, left_copy, right_copy);
+            break;
+        }
+        
+        case TOKEN_LESS:
+        case TOKEN_GREATER:
+        case TOKEN_LESS_EQUAL:
+        case TOKEN_GREATER_EQUAL:
+        case TOKEN_EQUAL_EQUAL:
+        case TOKEN_NOT_EQUAL: {
+            // Comparison operations (result is i1; == and != also on i1)
+            const char* pred = get_llvm_icmp_pred(op_str);
+            fprintf(ctx->output, "  %s = icmp %s %s %s, %s\n", 
+                    result_reg, pred, llvm_type_for_kind(operand_type), left_copy, right_copy);
+            break;
+        }
+        
+        case TOKEN_AND:
+        case TOKEN_OR: {
+            // Logical operations (operands are i1)
+            const char* llvm_op = get_llvm_binary_op(op_str, "i1");
+            fprintf(ctx->output, "  %s = %s i1 %s, %s\n", 
+                    result_reg, llvm_op, left_copy, right_copy);
+            break;
+        }
+        
+        default:
+            fprintf(ctx->output, "  %s = add i64 %s, %s\n", 
+                    result_reg, left_copy, right_copy);
+    }
+    
+    strncpy(g_expr_result_buffer, result_reg, sizeof(g_expr_result_buffer) - 1);
+    return g_expr_result_buffer;
+}
+
+/* Generate code for unary operation */
+static const char* codegen_unary_op(ASTNode* unary_op, CodegenContext* ctx) {
+    const char* operand = codegen_expression(unary_op->data.unary_op.operand, ctx);
+    char operand_copy[32];
+    strncpy(operand_copy, operand, sizeof(operand_copy) - 1);
+    
+    const char* result_reg = next_register(ctx);
+    
+    switch (unary_op->data.unary_op.op) {
+        case TOKEN_MINUS:
+            // Negate: 0 - operand
+            fprintf(ctx->output, "  %s = sub i64 0, %s\n", result_reg, operand_copy);
+            break;
+            
+        case TOKEN_NOT:
+            // Logical not: xor operand, true
+            fprintf(ctx->output, "  %s = xor i1 %s, true\n", result_reg, operand_copy);
+            break;
+            
+        default:
+            fprintf(ctx->output, "  %s = sub i64 0, %s\n", result_reg, operand_copy);
+    }
+    
+    strncpy(g_expr_result_buffer, result_reg, sizeof(g_expr_result_buffer) - 1);
+    return g_expr_result_buffer;
+}
+
+/* ============================================================================
+ * LIST LOWERING (typed MelpList access)
+ * ============================================================================
+ * A numeric[] is a %MelpList.i64*, so element i is a GEP off the elements
+ * field behind one unsigned bounds check against the length field:
+ *
+ *   xs[i]:  %len = load xs->length
+ *           br (i <u %len), inboundsN, oobN   ; oobN: mlp_panic_array_bounds
+ *           %data = load xs->elements
+ *           load i64, i64* (getelementptr i64, i64* %data, i64 i)
+ *
+ * Only allocation, growth and free call into the runtime (mlp_list.c).
+ * Inside a loop that cannot resize xs, %data and %len are loaded once
+ * before the loop instead, which leaves the check loop-invariant.
+ */
+
+static const char* codegen_value(ASTNode* expr, TypeKind type, CodegenContext* ctx);
+static const char* codegen_owned_string(ASTNode* expr, CodegenContext* ctx);
+
+/* List operand of an element access */
+typedef struct ListAccess {
+    TypeKind type;                       // List kind (TYPE_INT_LIST, ...)
+    char list_reg[32];                   // %MelpList.X* value (unless hoisted)
+    char name[64];                       // Reported on a bounds error
+    const CodegenHoistedList* hoisted;   // Bounds loaded before the loop, or NULL
+    ASTNode* temporary;                  // List temporary dropped after the access, or NULL
+} ListAccess;
+
+/* Bounds of list variable name hoisted by an enclosing loop, or NULL */
+static const CodegenHoistedList* hoisted_list(CodegenContext* ctx, const char* name) {
+    for (int i = ctx->hoisted_list_count - 1; i >= 0; i--) {
+        if (strcmp(ctx->hoisted_lists[i].variable, name) == 0) {
+            return &ctx->hoisted_lists[i];
+        }
+    }
+    return NULL;
+}
+
+/* Load field (0 elements, 1 length, 2 capacity) of a list into out */
+static void load_list_field(CodegenContext* ctx, TypeKind type, const char* list_reg, int field,
+                            char* out, size_t out_size) {
+    const char* struct_type = list_struct_type(type);
+    char field_type[32];
+    if (field == 0) {
+        snprintf(field_type, sizeof(field_type), "%s*", llvm_type_for_kind(list_element_kind(type)));
+    } else {
+        snprintf(field_type, sizeof(field_type), "i64");
+    }
+    
+    char address_reg[32];
+    strncpy(address_reg, next_register(ctx), sizeof(address_reg) - 1);
+    address_reg[sizeof(address_reg) - 1] = '\0';
+    fprintf(ctx->output, "  %s = getelementptr inbounds %s, %s* %s, i32 0, i32 %d\n",
+            address_reg, struct_type, struct_type, list_reg, field);
+    const char* value_reg = next_register(ctx);
+    fprintf(ctx->output, "  %s = load %s, %s* %s\n", value_reg, field_type, field_type, address_reg);
+    strncpy(out, value_reg, out_size - 1);
+    out[out_size - 1] = '\0';
+}
+
+/* Reference counting entry points of the list runtime */
+typedef enum ListRcOp {
+    LIST_RETAIN,
+    LIST_RELEASE,
+    LIST_FREE            // Release of a reference known to be the last
+} ListRcOp;
+
+/* Emit a retain, release or free of the list in list_reg (a string[]
+ * owns its elements' text, which its release and free let go of too)
+ */
+static void emit_list_rc(CodegenContext* ctx, ListRcOp op, TypeKind type, const char* list_reg) {
+    static const char* const functions[] = { "melp_list_retain", "melp_list_release", "melp_list_free" };
+    static const char* const string_functions[] = {
+        "melp_list_retain", "melp_list_release_strings", "melp_list_free_strings"
+    };
+    const char* raw_reg = next_register(ctx);
+    fprintf(ctx->output, "  %s = bitcast %s %s to i8*\n", raw_reg, llvm_type_for_kind(type), list_reg);
+    fprintf(ctx->output, "  call void @%s(i8* %s)\n",
+            type == TYPE_STRING_LIST ? string_functions[op] : functions[op], raw_reg);
+    
+    switch (op) {
+        case LIST_RETAIN:  ctx->rc_stats.retains++; break;
+        case LIST_RELEASE: ctx->rc_stats.releases++; break;
+        case LIST_FREE:    ctx->rc_stats.frees_in_place++; break;
+    }
+}
+
+/* Is expr a list literal built in the stack frame (escape analysis)? */
+static bool is_stack_list(ASTNode* expr) {
+    return expr->type == AST_LIST_LITERAL &&
+           expr->data.list_literal.mem_location == MEM_LOCATION_STACK;
+}
+
+/* Does a list expression hand its statement a reference of its own (a
+ * literal or a call result) rather than a variable's list?
+ */
+static bool is_list_temporary(ASTNode* expr) {
+    return expr && expr->type != AST_IDENTIFIER;
+}
+
+/* Drop a list temporary once its statement has used it. A literal nobody
+ * could keep is the only reference, so it is freed in place; a call result
+ * may be shared (the callee can return its argument).
+ */
+static void drop_list_temporary(ASTNode* expr, TypeKind type, const char* list_reg, bool may_be_kept,
+                                CodegenContext* ctx) {
+    if (is_stack_list(expr) && type != TYPE_STRING_LIST) {
+        return;  // Its frame slot is reused: only a string[]'s text is freed
+    }
+    bool unique = expr->type == AST_LIST_LITERAL && (!may_be_kept || is_stack_list(expr));
+    emit_list_rc(ctx, unique ? LIST_FREE : LIST_RELEASE, type, list_reg);
+}
+
+/* Start an access to the list variable name */
+static void begin_variable_access(const char* raw_name, CodegenContext* ctx, ListAccess* access) {
+    strncpy(access->name, clean_identifier(raw_name), sizeof(access->name) - 1);
+    access->name[sizeof(access->name) - 1] = '\0';
+    access->type = variable_type(ctx, access->name);
+    access->hoisted = hoisted_list(ctx, access->name);
+    access->temporary = NULL;
+    access->list_reg[0] = '\0';
+    if (!access->hoisted) {
+        const char* llvm_type = llvm_type_for_kind(access->type);
+        const char* list_reg = next_register(ctx);
+        fprintf(ctx->output, "  %s = load %s, %s* %%%s\n", list_reg, llvm_type, llvm_type, access->name);
+        strncpy(access->list_reg, list_reg, sizeof(access->list_reg) - 1);
+        access->list_reg[sizeof(access->list_reg) - 1] = '\0';
+    }
+}
+
+/* Start an access to the list an expression evaluates to */
+static void begin_list_access(ASTNode* list_expr, CodegenContext* ctx, ListAccess* access) {
+    if (list_expr->type == AST_IDENTIFIER) {
+        begin_variable_access(list_expr->data.identifier.name, ctx, access);
+        return;
+    }
+    
+    access->type = expression_type(list_expr, ctx);
+    access->hoisted = NULL;
+    access->temporary = list_expr;
+    snprintf(access->name, sizeof(access->name), "list");
+    const char* list_reg = codegen_value(list_expr, access->type, ctx);
+    strncpy(access->list_reg, list_reg, sizeof(access->list_reg) - 1);
+    access->list_reg[sizeof(access->list_reg) - 1] = '\0';
+}
+
+/* Finish an access: drop the list if it was a temporary ([1; 2][i]) */
+static void end_list_access(const ListAccess* access, CodegenContext* ctx) {
+    if (access->temporary) {
+        drop_list_temporary(access->temporary, access->type, access->list_reg, false, ctx);
+    }
+}
+
+/* Length of the accessed list (the hoisted register inside a loop) */
+static void list_length(const ListAccess* access, CodegenContext* ctx, char* out, size_t out_size) {
+    if (access->hoisted) {
+        strncpy(out, access->hoisted->length_reg, out_size - 1);
+        out[out_size - 1] = '\0';
+    } else {
+        load_list_field(ctx, access->type, access->list_reg, 1, out, out_size);
+    }
+}
+
+/* Panic unless 0 <= index < length, then compute the element's address */
+static void codegen_element_address(const ListAccess* access, const char* index,
+                                    CodegenContext* ctx, char* out, size_t out_size) {
+    char length_reg[96];
+    list_length(access, ctx, length_reg, sizeof(length_reg));
+    
+    // One unsigned compare also rejects negative indexes
+    int check_id = ctx->label_counter++;
+    const char* in_bounds = next_register(ctx);
+    fprintf(ctx->output, "  %s = icmp ult i64 %s, %s\n", in_bounds, index, length_reg);
+    fprintf(ctx->output, "  br i1 %s, label %%inbounds%d, label %%oob%d\n",
+            in_bounds, check_id, check_id);
+    
+    char name_pointer[128];
+    string_constant_pointer(ctx, access->name, name_pointer, sizeof(name_pointer));
+    fprintf(ctx->output, "\noob%d:\n", check_id);
+    fprintf(ctx->output, "  call void @mlp_panic_array_bounds(i64 %s, i64 %s, i8* %s)\n",
+            index, length_reg, name_pointer);
+    fprintf(ctx->output, "  unreachable\n");
+    fprintf(ctx->output, "\ninbounds%d:\n", check_id);
+    
+    char data_reg[96];
+    if (access->hoisted) {
+        strncpy(data_reg, access->hoisted->data_reg, sizeof(data_reg) - 1);
+        data_reg[sizeof(data_reg) - 1] = '\0';
+    } else {
+        load_list_field(ctx, access->type, access->list_reg, 0, data_reg, sizeof(data_reg));
+    }
+    
+    const char* element_type = llvm_type_for_kind(list_element_kind(access->type));
+    const char* address_reg = next_register(ctx);
+    fprintf(ctx->output, "  %s = getelementptr inbounds %s, %s* %s, i64 %s\n",
+            address_reg, element_type, element_type, data_reg, index);
+    strncpy(out, address_reg, out_size - 1);
+    out[out_size - 1] = '\0';
+}
+
+/* Generate code for xs[i] */
+static const char* codegen_index(ASTNode* index_expr, CodegenContext* ctx) {
+    ListAccess access;
+    begin_list_access(index_expr->data.index.list, ctx, &access);
+    
+    char index[32];
+    strncpy(index, codegen_expression(index_expr->data.index.index, ctx), sizeof(index) - 1);
+    index[sizeof(index) - 1] = '\0';
+    
+    char address[32];
+    codegen_element_address(&access, index, ctx, address, sizeof(address));
+    
+    const char* element_type = llvm_type_for_kind(list_element_kind(access.type));
+    const char* result_reg = next_register(ctx);
+    fprintf(ctx->output, "  %s = load %s, %s* %s\n", result_reg, element_type, element_type, address);
+    strncpy(g_expr_result_buffer, result_reg, sizeof(g_expr_result_buffer) - 1);
+    end_list_access(&access, ctx);
+    return g_expr_result_buffer;
+}
+
+/* Allocate a stack list of count elements in the entry block, header
+ * filled in once (its length never changes); names the list and its
+ * element pointer in list_reg / data_reg. Entry-block values are named,
+ * not numbered: the body's registers are numbered before the entry
+ * block is complete.
+ */
+static void alloca_stack_list(TypeKind type, int count, CodegenContext* ctx,
+                              char* list_reg, char* data_reg, size_t reg_size) {
+    const char* struct_type = list_struct_type(type);
+    const char* element_type = llvm_type_for_kind(list_element_kind(type));
+    int id = ctx->label_counter++;
+    snprintf(list_reg, reg_size, "%%stacklist%d", id);
+    snprintf(data_reg, reg_size, "%%stacklist%d.elements", id);
+    
+    fprintf(ctx->entry, "  %s = alloca %s\n", list_reg, struct_type);
+    fprintf(ctx->entry, "  %%stacklist%d.buffer = alloca [%d x %s]\n", id, count, element_type);
+    fprintf(ctx->entry, "  %s = getelementptr inbounds [%d x %s], [%d x %s]* %%stacklist%d.buffer, i64 0, i64 0\n",
+            data_reg, count, element_type, count, element_type, id);
+    fprintf(ctx->entry, "  %%stacklist%d.header = insertvalue %s { %s* null, i64 %d, i64 %d, i64 %d, i64 -1 }, "
+            "%s* %s, 0\n", id, struct_type, element_type, count, count, list_element_size(type),
+            element_type, data_reg);
+    fprintf(ctx->entry, "  store %s %%stacklist%d.header, %s* %s\n", struct_type, id, struct_type, list_reg);
+    ctx->rc_stats.stack_lists++;
+}
+
+/* Generate code for a list literal of the given list kind: one runtime
+ * allocation of the final length (or a stack slot, if escape analysis
+ * placed it there), then a store per element (a string[] stores its own
+ * copy of each string, see STRING OWNERSHIP)
+ */
+static const char* codegen_list_literal(ASTNode* literal, TypeKind type, CodegenContext* ctx) {
+    int count = literal->data.list_literal.element_count;
+    const char* struct_type = list_struct_type(type);
+    char list_reg[32];
+    char data_reg[32] = "";
+    
+    if (is_stack_list(literal) && ctx->entry) {
+        alloca_stack_list(type, count, ctx, list_reg, data_reg, sizeof(list_reg));
+    } else {
+        char raw_reg[32];
+        strncpy(raw_reg, next_register(ctx), sizeof(raw_reg) - 1);
+        raw_reg[sizeof(raw_reg) - 1] = '\0';
+        fprintf(ctx->output, "  %s = call i8* @melp_list_create_zeroed(i64 %d, i64 %d)\n",
+                raw_reg, list_element_size(type), count);
+        strncpy(list_reg, next_register(ctx), sizeof(list_reg) - 1);
+        list_reg[sizeof(list_reg) - 1] = '\0';
+        fprintf(ctx->output, "  %s = bitcast i8* %s to %s*\n", list_reg, raw_reg, struct_type);
+    }
+    
+    if (count > 0) {
+        const char* element_type = llvm_type_for_kind(list_element_kind(type));
+        if (!data_reg[0]) {
+            load_list_field(ctx, type, list_reg, 0, data_reg, sizeof(data_reg));
+        }
+        for (int i = 0; i < count; i++) {
+            ASTNode* element = literal->data.list_literal.elements[i];
+            char value[32];
+            strncpy(value, type == TYPE_STRING_LIST ? codegen_owned_string(element, ctx)
+                                                    : codegen_expression(element, ctx),
+                    sizeof(value) - 1);
+            value[sizeof(value) - 1] = '\0';
+            const char* address_reg = next_register(ctx);
+            fprintf(ctx->output, "  %s = getelementptr inbounds %s, %s* %s, i64 %d\n",
+                    address_reg, element_type, element_type, data_reg, i);
+            fprintf(ctx->output, "  store %s %s, %s* %s\n",
+                    element_type, value, element_type, address_reg);
+        }
+    }
+    
+    strncpy(g_expr_result_buffer, list_reg, sizeof(g_expr_result_buffer) - 1);
+    return g_expr_result_buffer;
+}
+
+/* Generate code for an expression whose type the context fixes, so [] gets
+ * the declared list type
+ */
+static const char* codegen_value(ASTNode* expr, TypeKind type, CodegenContext* ctx) {
+    if (expr && expr->type == AST_LIST_LITERAL) {
+        return codegen_list_literal(expr, is_list_kind(type) ? type : expression_type(expr, ctx), ctx);
+    }
+    return codegen_expression(expr, ctx);
+}
+
+/* Generate code for append(xs; v): store in place, growing through the
+ * runtime only when the buffer is full (a string is stored as the list's
+ * own copy)
+ */
+static void codegen_list_append(ASTNode* call, CodegenContext* ctx) {
+    ListAccess access;
+    begin_list_access(call->data.call.arguments[0], ctx, &access);
+    
+    ASTNode* element = call->data.call.arguments[1];
+    char value[32];
+    strncpy(value, access.type == TYPE_STRING_LIST ? codegen_owned_string(element, ctx)
+                                                   : codegen_expression(element, ctx), sizeof(value) - 1);
+    value[sizeof(value) - 1] = '\0';
+    
+    char length_reg[32], capacity_reg[32];
+    load_list_field(ctx, access.type, access.list_reg, 1, length_reg, sizeof(length_reg));
+    load_list_field(ctx, access.type, access.list_reg, 2, capacity_reg, sizeof(capacity_reg));
+    
+    int append_id = ctx->label_counter++;
+    const char* full_reg = next_register(ctx);
+    fprintf(ctx->output, "  %s = icmp eq i64 %s, %s\n", full_reg, length_reg, capacity_reg);
+    fprintf(ctx->output, "  br i1 %s, label %%grow%d, label %%append%d\n",
+            full_reg, append_id, append_id);
+    
+    fprintf(ctx->output, "\ngrow%d:\n", append_id);
+    const char* raw_reg = next_register(ctx);
+    fprintf(ctx->output, "  %s = bitcast %s* %s to i8*\n",
+            raw_reg, list_struct_type(access.type), access.list_reg);
+    fprintf(ctx->output, "  call void @melp_list_grow_checked(i8* %s)\n", raw_reg);
+    fprintf(ctx->output, "  br label %%append%d\n", append_id);
+    fprintf(ctx->output, "\nappend%d:\n", append_id);
+    
+    const char* element_type = llvm_type_for_kind(list_element_kind(access.type));
+    char data_reg[32];
+    load_list_field(ctx, access.type, access.list_reg, 0, data_reg, sizeof(data_reg));
+    char address_reg[32];
+    strncpy(address_reg, next_register(ctx), sizeof(address_reg) - 1);
+    address_reg[sizeof(address_reg) - 1] = '\0';
+    fprintf(ctx->output, "  %s = getelementptr inbounds %s, %s* %s, i64 %s\n",
+            address_reg, element_type, element_type, data_reg, length_reg);
+    fprintf(ctx->output, "  store %s %s, %s* %s\n", element_type, value, element_type, address_reg);
+    
+    char next_length[32];
+    strncpy(next_length, next_register(ctx), sizeof(next_length) - 1);
+    next_length[sizeof(next_length) - 1] = '\0';
+    fprintf(ctx->output, "  %s = add i64 %s, 1\n", next_length, length_reg);
+    const char* length_address = next_register(ctx);
+    fprintf(ctx->output, "  %s = getelementptr inbounds %s, %s* %s, i32 0, i32 1\n",
+            length_address, list_struct_type(access.type), list_struct_type(access.type),
+            access.list_reg);
+    fprintf(ctx->output, "  store i64 %s, i64* %s\n", next_length, length_address);
+    end_list_access(&access, ctx);
+}
+
+/* Generate code for a builtin without a runtime symbol (list length/append) */
+static const char* codegen_list_builtin(ASTNode* call, const BuiltinFunction* builtin,
+                                        CodegenContext* ctx) {
+    if (strcmp(builtin->name, "append") == 0) {
+        codegen_list_append(call, ctx);
+        return "0";
+    }
+    
+    ListAccess access;
+    begin_list_access(call->data.call.arguments[0], ctx, &access);
+    list_length(&access, ctx, g_expr_result_buffer, sizeof(g_expr_result_buffer));
+    end_list_access(&access, ctx);
+    return g_expr_result_buffer;
+}
+
+/* Generate code for builtin call (direct call into the runtime)
+ * Builtins only read their string arguments, so those are temporaries; a
+ * string result may be a view of them (substring), which is copied
+ * wherever it is kept (codegen_owned_string). List arguments are borrowed
+ * (no builtin keeps one): a list temporary is dropped after the call.
+ */
+static const char* codegen_builtin_call(ASTNode* call, const BuiltinFunction* builtin,
+                                        CodegenContext* ctx) {
+    builtin = resolve_builtin_overload(call, builtin, ctx);
+    if (!builtin->runtime_symbol) {
+        return codegen_list_builtin(call, builtin, ctx);
+    }
+    
+    // Evaluate arguments (copy each register: the result buffer is reused)
+    char args[BUILTIN_MAX_PARAMS][RUNTIME_ARGUMENT_SIZE];
+    char values[BUILTIN_MAX_PARAMS][32];
+    for (int i = 0; i < builtin->param_count; i++) {
+        ASTNode* argument = call->data.call.arguments[i];
+        strncpy(values[i], codegen_temporary(argument, ctx), sizeof(values[i]) - 1);
+        values[i][sizeof(values[i]) - 1] = '\0';
+        runtime_argument(ctx, builtin->param_types[i], values[i], args[i], sizeof(args[i]));
+        if (is_list_kind(builtin->param_types[i]) && !is_list_temporary(argument)) {
+            ctx->rc_stats.elided_by_borrows += 2;
+        }
+    }
+    
+    if (builtin->return_type == TYPE_VOID) {
+        // No result register: void calls must not consume an SSA number
+        fprintf(ctx->output, "  call void @%s(", builtin->runtime_symbol);
+    } else {
+        const char* result_reg = next_register(ctx);
+        strncpy(g_expr_result_buffer, result_reg, sizeof(g_expr_result_buffer) - 1);
+        fprintf(ctx->output, "  %s = call %s @%s(", g_expr_result_buffer,
+                llvm_type_for_kind(builtin->return_type), builtin->runtime_symbol);
+    }
+    for (int i = 0; i < builtin->param_count; i++) {
+        fprintf(ctx->output, "%s%s", i > 0 ? ", " : "", args[i]);
+    }
+    fprintf(ctx->output, ")\n");
+    
+    for (int i = 0; i < builtin->param_count; i++) {
+        ASTNode* argument = call->data.call.arguments[i];
+        if (is_list_kind(builtin->param_types[i]) && is_list_temporary(argument)) {
+            drop_list_temporary(argument, builtin->param_types[i], values[i], false, ctx);
+        }
+    }
+    
+    return builtin->return_type == TYPE_VOID ? "0" : g_expr_result_buffer;
+}
+
+/* Generate code for function call
+ * List arguments are borrowed for the call: the caller's reference keeps
+ * the list alive, and a list temporary is dropped after the call (freed
+ * in place unless the callee returns a list, which may be that one).
+ * String arguments are borrowed too (the callee copies what it keeps), so
+ * they may be temporaries. A string result is the caller's own buffer; a
+ * temporary one is moved into the temporaries region.
+ */
+static const char* codegen_function_call(ASTNode* call, bool temporary, CodegenContext* ctx) {
+    const BuiltinFunction* builtin = find_builtin(call, ctx);
+    if (builtin) {
+        return codegen_builtin_call(call, builtin, ctx);
+    }
+    
+    // Copy name: evaluating arguments reuses clean_identifier's buffer
+    char func_name[256];
+    strncpy(func_name, clean_identifier(call->data.call.name), sizeof(func_name) - 1);
+    func_name[sizeof(func_name) - 1] = '\0';
+    ASTNode* func = find_function(ctx, func_name);
+    
+    // Evaluate arguments
+    char* arg_regs[64];
+    TypeKind param_types[64];
+    for (int i = 0; i < call->data.call.argument_count; i++) {
+        TypeKind param_type = TYPE_INT;
+        if (func && i < func->data.function.parameter_count) {
+            param_type = ast_type_kind(func->data.function.parameters[i]->data.parameter.type);
+        }
+        param_types[i] = param_type;
+        ASTNode* argument = call->data.call.arguments[i];
+        const char* arg_reg = param_type == TYPE_STRING ? codegen_temporary(argument, ctx)
+                                                        : codegen_value(argument, param_type, ctx);
+        arg_regs[i] = malloc(32);
+        strncpy(arg_regs[i], arg_reg, 31);
+        arg_regs[i][31] = '\0';
+        if (is_list_kind(param_type) && !is_list_temporary(argument)) {
+            ctx->rc_stats.elided_by_borrows += 2;
+        }
+    }
+    
+    // Generate call instruction
+    const char* result_reg = next_register(ctx);
+    fprintf(ctx->output, "  %s = call %s @%s(", result_reg,
+            func ? get_llvm_type_from_ast(func->data.function.return_type) : "i64", func_name);
+    
+    for (int i = 0; i < call->data.call.argument_count; i++) {
+        if (i > 0) fprintf(ctx->output, ", ");
+        const char* arg_type = "i64";
+        if (func && i < func->data.function.parameter_count) {
+            arg_type = get_llvm_type_from_ast(func->data.function.parameters[i]->data.parameter.type);
+        }
+        fprintf(ctx->output, "%s %s", arg_type, arg_regs[i]);
+    }
+    
+    fprintf(ctx->output, ")\n");
+    strncpy(g_expr_result_buffer, result_reg, sizeof(g_expr_result_buffer) - 1);
+    
+    // Drop list temporaries, then free argument register buffers
+    bool returns_list = func && is_list_kind(ast_type_kind(func->data.function.return_type));
+    for (int i = 0; i < call->data.call.argument_count; i++) {
+        ASTNode* argument = call->data.call.arguments[i];
+        if (is_list_kind(param_types[i]) && is_list_temporary(argument)) {
+            drop_list_temporary(argument, param_types[i], arg_regs[i], returns_list, ctx);
+        }
+        free(arg_regs[i]);
+    }
+    
+    if (temporary && func && ast_type_kind(func->data.function.return_type) == TYPE_STRING) {
+        char owned_reg[32], args[RUNTIME_ARGUMENT_SIZE];
+        strncpy(owned_reg, g_expr_result_buffer, sizeof(owned_reg) - 1);
+        owned_reg[sizeof(owned_reg) - 1] = '\0';
+        string_arguments(ctx, owned_reg, args, sizeof(args));
+        const char* tmp_reg = next_register(ctx);
+        fprintf(ctx->output, "  %s = call %%MelpStr @mlp_str_to_tmp(%s)\n", tmp_reg, args);
+        strncpy(g_expr_result_buffer, tmp_reg, sizeof(g_expr_result_buffer) - 1);
+        ctx->made_temporaries = true;
+    }
+    return g_expr_result_buffer;
+}
+
+/* Generate code for expression (main entry point) */
+const char* codegen_expression(ASTNode* expr, CodegenContext* ctx) {
+    // A temporary request covers this node only, not its operands
+    bool temporary = ctx->temporary_string;
+    ctx->temporary_string = false;
+    if (!expr) {
+        return "0";
+    }
+    
+    switch (expr->type) {
+        case AST_LITERAL:
+            return codegen_literal(expr, ctx);
+            
+        case AST_IDENTIFIER:
+            return codegen_identifier(expr, ctx);
+            
+        case AST_BINARY_OP:
+            return codegen_binary_op(expr, temporary, ctx);
+            
+        case AST_UNARY_OP:
+            return codegen_unary_op(expr, ctx);
+            
+        case AST_FUNCTION_CALL:
+            return codegen_function_call(expr, temporary, ctx);
+            
+        case AST_INDEX:
+            return codegen_index(expr, ctx);
+            
+        case AST_LIST_LITERAL:
+            return codegen_list_literal(expr, expression_type(expr, ctx), ctx);
+            
+        default:
+            return "0";
+    }
+}
+
+/* Generate code for an expression whose string value is only read before
+ * its statement ends, so it may live in the temporaries region
+ */
+static const char* codegen_temporary(ASTNode* expr, CodegenContext* ctx) {
+    ctx->temporary_string = true;
+    return codegen_expression(expr, ctx);
+}
+
+/* ============================================================================
+ * STRING OWNERSHIP
+ * ============================================================================
+ * A string variable owns its buffer: storing a new value frees the old
+ * one, and every ret frees what the function's variables still hold. What
+ * a variable, a list element or a return value keeps is owned text:
+ * - A concatenation or a user function's result is a new buffer: moved in
+ * - A literal (or a chain of them, folded into one) is read-only: kept as is
+ * - Anything else (another variable, a parameter, an element, a substring
+ *   view) is copied with mlp_str_own, so nothing kept points into a buffer
+ *   that someone else frees
+ * String arguments are borrowed; a parameter the callee reassigns is
+ * copied on entry. `t = s` at s's last use moves the buffer (as it moves a
+ * list's reference).
+ */
+
+/* Is expr a string literal or a + chain of literals (one read-only constant)? */
+static bool is_string_constant(ASTNode* expr, CodegenContext* ctx) {
+    if (expr->type == AST_LITERAL) {
+        return expr->data.literal.literal_type == TOKEN_STRING;
+    }
+    return expr->type == AST_BINARY_OP && expr->data.binary_op.op == TOKEN_PLUS &&
+           expression_type(expr->data.binary_op.left, ctx) == TYPE_STRING &&
+           is_string_constant(expr->data.binary_op.left, ctx) &&
+           is_string_constant(expr->data.binary_op.right, ctx);
+}
+
+/* Does string expr evaluate to a new buffer of its own (a concatenation or
+ * a user function's result, unless asked for as a temporary)?
+ */
+static bool is_owned_string(ASTNode* expr, CodegenContext* ctx) {
+    if (expr->type == AST_BINARY_OP && expr->data.binary_op.op == TOKEN_PLUS) {
+        return !is_string_constant(expr, ctx);
+    }
+    return expr->type == AST_FUNCTION_CALL && !find_builtin(expr, ctx);
+}
+
+/* Free the buffer of the %MelpStr value in value (a literal is left alone) */
+static void free_string(CodegenContext* ctx, const char* value) {
+    char args[RUNTIME_ARGUMENT_SIZE];
+    string_arguments(ctx, value, args, sizeof(args));
+    fprintf(ctx->output, "  call void @mlp_str_free(%s)\n", args);
+}
+
+/* Generate code for a string to keep: owned and constant values as they
+ * are, anything else copied
+ */
+static const char* codegen_owned_string(ASTNode* expr, CodegenContext* ctx) {
+    const char* value = codegen_expression(expr, ctx);
+    if (is_owned_string(expr, ctx) || is_string_constant(expr, ctx)) {
+        return value;
+    }
+    
+    char value_reg[32], args[RUNTIME_ARGUMENT_SIZE];
+    strncpy(value_reg, value, sizeof(value_reg) - 1);
+    value_reg[sizeof(value_reg) - 1] = '\0';
+    string_arguments(ctx, value_reg, args, sizeof(args));
+    const char* result_reg = next_register(ctx);
+    fprintf(ctx->output, "  %s = call %%MelpStr @mlp_str_own(%s)\n", result_reg, args);
+    strncpy(g_expr_result_buffer, result_reg, sizeof(g_expr_result_buffer) - 1);
+    return g_expr_result_buffer;
+}
+
+/* ============================================================================
+ * STRING BUILDER LOWERING (accumulate-in-loop concatenation)
+ * ============================================================================
+ * `s = s + x` rebuilds s on every iteration, so a loop of n appends copies
+ * O(n²) bytes. When a while loop mentions a string variable only in such
+ * statements (and cannot return early), s lives in an MlpStringBuilder for
+ * the duration of the loop:
+ *
+ *   before the loop:  %s.sbN = mlp_string_builder_from(s)
+ *   s = s + a + b:    mlp_string_builder_append(%s.sbN, a), then b
+ *   after the loop:   s = mlp_string_builder_build(%s.sbN)
+ */
+
+/* Is node a left-nested + chain starting at name (name + a + b ...)? */
+static bool is_concat_chain_of(ASTNode* node, const char* name) {
+    if (!node || node->type != AST_BINARY_OP || node->data.binary_op.op != TOKEN_PLUS) {
+        return false;
+    }
+    while (node->type == AST_BINARY_OP && node->data.binary_op.op == TOKEN_PLUS) {
+        node = node->data.binary_op.left;
+    }
+    return node->type == AST_IDENTIFIER && identifier_equals(node->data.identifier.name, name);
+}
+
+/* Is stmt an accumulation `name = name + ...`? */
+static bool is_accumulate(ASTNode* stmt, const char* name) {
+    return stmt->type == AST_ASSIGNMENT &&
+           identifier_equals(stmt->data.assignment.name, name) &&
+           is_concat_chain_of(stmt->data.assignment.value, name);
+}
+
+static int count_mentions(ASTNode* node, const char* name);
+
+static int count_mentions_in(ASTNode** nodes, int count, const char* name) {
+    int mentions = 0;
+    for (int i = 0; i < count; i++) {
+        mentions += count_mentions(nodes[i], name);
+    }
+    return mentions;
+}
+
+/* Mentions of name: reads, assignment targets and declarations */
+static int count_mentions(ASTNode* node, const char* name) {
+    if (!node) {
+        return 0;
+    }
+    
+    switch (node->type) {
+        case AST_IDENTIFIER:
+            return identifier_equals(node->data.identifier.name, name) ? 1 : 0;
+        case AST_BINARY_OP:
+            return count_mentions(node->data.binary_op.left, name) +
+                   count_mentions(node->data.binary_op.right, name);
+        case AST_UNARY_OP:
+            return count_mentions(node->data.unary_op.operand, name);
+        case AST_FUNCTION_CALL:
+            return count_mentions_in(node->data.call.arguments, node->data.call.argument_count, name);
+        case AST_INDEX:
+            return count_mentions(node->data.index.list, name) +
+                   count_mentions(node->data.index.index, name);
+        case AST_LIST_LITERAL:
+            return count_mentions_in(node->data.list_literal.elements,
+                                     node->data.list_literal.element_count, name);
+        case AST_ASSIGNMENT:
+            return (identifier_equals(node->data.assignment.name, name) ? 1 : 0) +
+                   count_mentions(node->data.assignment.value, name);
+        case AST_INDEX_ASSIGNMENT:
+            return (identifier_equals(node->data.index_assignment.name, name) ? 1 : 0) +
+                   count_mentions(node->data.index_assignment.index, name) +
+                   count_mentions(node->data.index_assignment.value, name);
+        case AST_VAR_DECL:
+            return (identifier_equals(node->data.var_decl.name, name) ? 1 : 0) +
+                   count_mentions(node->data.var_decl.initializer, name);
+        case AST_RETURN:
+        case AST_EXPR_STMT:
+            return count_mentions(node->data.return_stmt.expression, name);
+        case AST_IF:
+            return count_mentions(node->data.if_stmt.condition, name) +
+                   count_mentions_in(node->data.if_stmt.then_body, node->data.if_stmt.then_count, name) +
+                   count_mentions_in(node->data.if_stmt.else_body, node->data.if_stmt.else_count, name);
+        case AST_WHILE:
+            return count_mentions(node->data.while_stmt.condition, name) +
+                   count_mentions_in(node->data.while_stmt.body, node->data.while_stmt.body_count, name);
+        default:
+            return 0;
+    }
+}
+
+/* Accumulations of name in a block (including nested blocks) */
+static int count_accumulates(ASTNode** stmts, int count, const char* name) {
+    int accumulates = 0;
+    for (int i = 0; i < count; i++) {
+        ASTNode* stmt = stmts[i];
+        if (is_accumulate(stmt, name)) {
+            accumulates++;
+        } else if (stmt->type == AST_IF) {
+            accumulates += count_accumulates(stmt->data.if_stmt.then_body, stmt->data.if_stmt.then_count, name);
+            accumulates += count_accumulates(stmt->data.if_stmt.else_body, stmt->data.if_stmt.else_count, name);
+        } else if (stmt->type == AST_WHILE) {
+            accumulates += count_accumulates(stmt->data.while_stmt.body, stmt->data.while_stmt.body_count, name);
+        }
+    }
+    return accumulates;
+}
+
+static bool contains_return(ASTNode** stmts, int count) {
+    for (int i = 0; i < count; i++) {
+        ASTNode* stmt = stmts[i];
+        if (stmt->type == AST_RETURN) {
+            return true;
+        }
+        if (stmt->type == AST_IF &&
+            (contains_return(stmt->data.if_stmt.then_body, stmt->data.if_stmt.then_count) ||
+             contains_return(stmt->data.if_stmt.else_body, stmt->data.if_stmt.else_count))) {
+            return true;
+        }
+        if (stmt->type == AST_WHILE &&
+            contains_return(stmt->data.while_stmt.body, stmt->data.while_stmt.body_count)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Builder currently holding name, or NULL */
+static const CodegenBuilder* active_builder(CodegenContext* ctx, const char* name) {
+    for (int i = ctx->builder_count - 1; i >= 0; i--) {
+        if (strcmp(ctx->builders[i].variable, name) == 0) {
+            return &ctx->builders[i];
+        }
+    }
+    return NULL;
+}
+
+/* Can name be built in place for the whole loop? Every mention inside the
+ * loop must be the target or leftmost operand of an accumulation, and the
+ * loop must always exit through its end (where build() runs).
+ */
+static bool can_build_in_loop(ASTNode* loop, const char* name, CodegenContext* ctx) {
+    if (variable_type(ctx, name) != TYPE_STRING || active_builder(ctx, name)) {
+        return false;
+    }
+    
+    ASTNode** body = loop->data.while_stmt.body;
+    int body_count = loop->data.while_stmt.body_count;
+    int accumulates = count_accumulates(body, body_count, name);
+    int mentions = count_mentions(loop->data.while_stmt.condition, name) +
+                   count_mentions_in(body, body_count, name);
+    
+    return accumulates > 0 && mentions == 2 * accumulates && !contains_return(body, body_count);
+}
+
+/* Move name into a new builder (emitted before the loop header) */
+static void begin_builder(CodegenContext* ctx, const char* name, int loop_id) {
+    if (ctx->builder_count >= CODEGEN_MAX_BUILDERS) {
+        return;  // Plain concatenation is still correct
+    }
+    
+    CodegenBuilder* builder = &ctx->builders[ctx->builder_count++];
+    strncpy(builder->variable, name, sizeof(builder->variable) - 1);
+    builder->variable[sizeof(builder->variable) - 1] = '\0';
+    snprintf(builder->builder_reg, sizeof(builder->builder_reg), "%%%s.sb%d", name, loop_id);
+    
+    char value_reg[32], args[RUNTIME_ARGUMENT_SIZE];
+    strncpy(value_reg, next_register(ctx), sizeof(value_reg) - 1);
+    value_reg[sizeof(value_reg) - 1] = '\0';
+    fprintf(ctx->output, "  %s = load %%MelpStr, %%MelpStr* %%%s\n", value_reg, name);
+    string_arguments(ctx, value_reg, args, sizeof(args));
+    fprintf(ctx->output, "  %s = call i8* @mlp_string_builder_from_str(%s)\n",
+            builder->builder_reg, args);
+}
+
+/* Start builders for the strings a loop accumulates */
+static void begin_loop_builders(ASTNode* loop, ASTNode** stmts, int count,
+                                int loop_id, CodegenContext* ctx) {
+    for (int i = 0; i < count; i++) {
+        ASTNode* stmt = stmts[i];
+        if (stmt->type == AST_ASSIGNMENT) {
+            char name[64];
+            strncpy(name, clean_identifier(stmt->data.assignment.name), sizeof(name) - 1);
+            name[sizeof(name) - 1] = '\0';
+            if (is_accumulate(stmt, name) && can_build_in_loop(loop, name, ctx)) {
+                begin_builder(ctx, name, loop_id);
+            }
+        } else if (stmt->type == AST_IF) {
+            begin_loop_builders(loop, stmt->data.if_stmt.then_body, stmt->data.if_stmt.then_count,
+                                loop_id, ctx);
+            begin_loop_builders(loop, stmt->data.if_stmt.else_body, stmt->data.if_stmt.else_count,
+                                loop_id, ctx);
+        } else if (stmt->type == AST_WHILE) {
+            begin_loop_builders(loop, stmt->data.while_stmt.body, stmt->data.while_stmt.body_count,
+                                loop_id, ctx);
+        }
+    }
+}
+
+/* Store the built strings back (emitted after the loop exit label) over
+ * the values the builders started from
+ */
+static void end_loop_builders(CodegenContext* ctx, int first_builder, int loop_id) {
+    while (ctx->builder_count > first_builder) {
+        const CodegenBuilder* builder = &ctx->builders[--ctx->builder_count];
+        const CodegenVariable* var = find_variable(ctx, builder->variable);
+        if (var && var->owned) {
+            char old_reg[32];
+            strncpy(old_reg, next_register(ctx), sizeof(old_reg) - 1);
+            old_reg[sizeof(old_reg) - 1] = '\0';
+            fprintf(ctx->output, "  %s = load %%MelpStr, %%MelpStr* %%%s\n", old_reg, builder->variable);
+            free_string(ctx, old_reg);
+        }
+        fprintf(ctx->output, "  %%%s.built%d = call %%MelpStr @mlp_string_builder_build_str(i8* %s)\n",
+                builder->variable, loop_id, builder->builder_reg);
+        fprintf(ctx->output, "  store %%MelpStr %%%s.built%d, %%MelpStr* %%%s\n",
+                builder->variable, loop_id, builder->variable);
+    }
+}
+
+/* Append the pieces of `name + a + b ...` to the builder, left to right
+ * (adjacent literals folded into one append)
+ */
+static void codegen_builder_append(ASTNode* chain, const CodegenBuilder* builder,
+                                   CodegenContext* ctx) {
+    ConcatPieces pieces = { NULL, 0, 0 };
+    if (!flatten_concat(chain, &pieces, ctx)) {
+        free_concat_pieces(&pieces);
+        set_error(ctx, "Out of memory folding string concatenation");
+        return;
+    }
+    
+    // Piece 0 is the leading `name`: already in the builder
+    for (int i = 1; i < pieces.count; i++) {
+        char piece[32], args[RUNTIME_ARGUMENT_SIZE];
+        codegen_concat_piece(&pieces.items[i], ctx, piece, sizeof(piece));
+        string_arguments(ctx, piece, args, sizeof(args));
+        fprintf(ctx->output, "  call void @mlp_string_builder_append_str(i8* %s, %s)\n",
+                builder->builder_reg, args);
+    }
+    free_concat_pieces(&pieces);
+}
+
+/* ============================================================================
+ * LIST BOUNDS HOISTING AND OWNERSHIP
+ * ============================================================================
+ * Element stores never move a list's buffer or change its length; only
+ * append (directly, or in a user function that receives a list) does. In
+ * a loop without either, each list it mentions but never reassigns has
+ * its elements pointer and length loaded once in the preheader, so the
+ * per-access bounds check compares against a loop-invariant value and
+ * LLVM can drop or vectorize it (stage2_bootstrap --runtime-bc runs opt).
+ *
+ * Lists are reference counted, and the compiler avoids most of the
+ * updates a retain-per-copy scheme would make:
+ * - Every list variable holds one reference, released before each ret;
+ *   storing a literal or a call result takes over its reference, storing
+ *   another variable's list retains it
+ * - Last use: `ys = xs` or `return xs` where xs is never mentioned again
+ *   (outside a loop) moves the reference, no retain and no release
+ * - Borrowing: list arguments are passed without a retain, and a list
+ *   parameter the callee never reassigns lives in the caller's reference
+ *   (a reassigned one is retained on entry)
+ * - A list declared at the top of a function and initialized with a
+ *   literal (or nothing) that never escapes (every mention is the list of
+ *   an index, index store or builtin) has refcount 1 at each ret, so it
+ *   is freed in place; so is a literal temporary after a call that cannot
+ *   return it
+ */
+
+static bool may_resize_lists(ASTNode* node, CodegenContext* ctx);
+
+static bool may_resize_lists_in(ASTNode** nodes, int count, CodegenContext* ctx) {
+    for (int i = 0; i < count; i++) {
+        if (may_resize_lists(nodes[i], ctx)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Can node change the length or buffer of some list? */
+static bool may_resize_lists(ASTNode* node, CodegenContext* ctx) {
+    if (!node) {
+        return false;
+    }
+    
+    switch (node->type) {
+        case AST_FUNCTION_CALL: {
+            const BuiltinFunction* builtin = find_builtin(node, ctx);
+            if (builtin && strcmp(builtin->name, "append") == 0) {
+                return true;
+            }
+            for (int i = 0; !builtin && i < node->data.call.argument_count; i++) {
+                if (is_list_kind(expression_type(node->data.call.arguments[i], ctx))) {
+                    return true;
+                }
+            }
+            return may_resize_lists_in(node->data.call.arguments, node->data.call.argument_count, ctx);
+        }
+        case AST_BINARY_OP:
+            return may_resize_lists(node->data.binary_op.left, ctx) ||
+                   may_resize_lists(node->data.binary_op.right, ctx);
+        case AST_UNARY_OP:
+            return may_resize_lists(node->data.unary_op.operand, ctx);
+        case AST_INDEX:
+            return may_resize_lists(node->data.index.list, ctx) ||
+                   may_resize_lists(node->data.index.index, ctx);
+        case AST_LIST_LITERAL:
+            return may_resize_lists_in(node->data.list_literal.elements,
+                                       node->data.list_literal.element_count, ctx);
+        case AST_ASSIGNMENT:
+            return may_resize_lists(node->data.assignment.value, ctx);
+        case AST_INDEX_ASSIGNMENT:
+            return may_resize_lists(node->data.index_assignment.index, ctx) ||
+                   may_resize_lists(node->data.index_assignment.value, ctx);
+        case AST_VAR_DECL:
+            return may_resize_lists(node->data.var_decl.initializer, ctx);
+        case AST_RETURN:
+        case AST_EXPR_STMT:
+            return may_resize_lists(node->data.return_stmt.expression, ctx);
+        case AST_IF:
+            return may_resize_lists(node->data.if_stmt.condition, ctx) ||
+                   may_resize_lists_in(node->data.if_stmt.then_body, node->data.if_stmt.then_count, ctx) ||
+                   may_resize_lists_in(node->data.if_stmt.else_body, node->data.if_stmt.else_count, ctx);
+        case AST_WHILE:
+            return may_resize_lists(node->data.while_stmt.condition, ctx) ||
+                   may_resize_lists_in(node->data.while_stmt.body, node->data.while_stmt.body_count, ctx);
+        default:
+            return false;
+    }
+}
+
+/* Is name assigned or declared anywhere in a block (including nested blocks)? */
+static bool assigns_variable(ASTNode** stmts, int count, const char* name) {
+    for (int i = 0; i < count; i++) {
+        ASTNode* stmt = stmts[i];
+        if ((stmt->type == AST_ASSIGNMENT && identifier_equals(stmt->data.assignment.name, name)) ||
+            (stmt->type == AST_VAR_DECL && identifier_equals(stmt->data.var_decl.name, name))) {
+            return true;
+        }
+        if (stmt->type == AST_IF &&
+            (assigns_variable(stmt->data.if_stmt.then_body, stmt->data.if_stmt.then_count, name) ||
+             assigns_variable(stmt->data.if_stmt.else_body, stmt->data.if_stmt.else_count, name))) {
+            return true;
+        }
+        if (stmt->type == AST_WHILE &&
+            assigns_variable(stmt->data.while_stmt.body, stmt->data.while_stmt.body_count, name)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Load the bounds of the lists a loop reads but cannot resize (emitted
+ * before the loop header; popped after its exit label)
+ */
+static void hoist_loop_lists(ASTNode* loop, CodegenContext* ctx) {
+    ASTNode* condition = loop->data.while_stmt.condition;
+    ASTNode** body = loop->data.while_stmt.body;
+    int body_count = loop->data.while_stmt.body_count;
+    if (may_resize_lists(condition, ctx) || may_resize_lists_in(body, body_count, ctx)) {
+        return;
+    }
+    
+    for (int i = 0; i < ctx->variable_count; i++) {
+        const CodegenVariable* var = &ctx->variables[i];
+        if (!is_list_kind(var->type) || hoisted_list(ctx, var->name) ||
+            ctx->hoisted_list_count >= CODEGEN_MAX_HOISTED_LISTS ||
+            count_mentions(condition, var->name) + count_mentions_in(body, body_count, var->name) == 0 ||
+            assigns_variable(body, body_count, var->name)) {
+            continue;
+        }
+        
+        CodegenHoistedList* hoisted = &ctx->hoisted_lists[ctx->hoisted_list_count++];
+        strncpy(hoisted->variable, var->name, sizeof(hoisted->variable) - 1);
+        hoisted->variable[sizeof(hoisted->variable) - 1] = '\0';
+        
+        const char* llvm_type = llvm_type_for_kind(var->type);
+        char list_reg[32];
+        strncpy(list_reg, next_register(ctx), sizeof(list_reg) - 1);
+        list_reg[sizeof(list_reg) - 1] = '\0';
+        fprintf(ctx->output, "  %s = load %s, %s* %%%s\n", list_reg, llvm_type, llvm_type, var->name);
+        load_list_field(ctx, var->type, list_reg, 0, hoisted->data_reg, sizeof(hoisted->data_reg));
+        load_list_field(ctx, var->type, list_reg, 1, hoisted->length_reg, sizeof(hoisted->length_reg));
+    }
+}
+
+static bool list_escapes(ASTNode* node, const char* name, CodegenContext* ctx);
+
+static bool list_escapes_in(ASTNode** nodes, int count, const char* name, CodegenContext* ctx) {
+    for (int i = 0; i < count; i++) {
+        if (list_escapes(nodes[i], name, ctx)) {
+            return true;
+        }
+    }
+    return false;
 }
 
-/* Generate code for identifier (variable reference) */
-static const char* codegen_identifier(ASTNode* identifier, CodegenContext* ctx) {
-    const char* var_name = clean_identifier(identifier->data.identifier.name);
-    
-    // Load variable from memory
-    const char* result_reg = next_register(ctx);
-    fprintf(ctx->output, "  %s = load i64, i64* %%%s\n", result_reg, var_name);
+/* Is list variable name used other than as the list of an index, index
+ * store or builtin call (returned, passed, aliased or reassigned)?
+ */
+static bool list_escapes(ASTNode* node, const char* name, CodegenContext* ctx) {
+    if (!node) {
+        return false;
+    }
     
-    // Return register name (stored in static buffer for reuse)
-    strncpy(g_expr_result_buffer, result_reg, sizeof(g_expr_result_buffer) - 1);
-    return g_expr_result_buffer;
+    switch (node->type) {
+        case AST_IDENTIFIER:
+            return identifier_equals(node->data.identifier.name, name);
+        case AST_INDEX: {
+            ASTNode* list = node->data.index.list;
+            bool is_name = list->type == AST_IDENTIFIER && identifier_equals(list->data.identifier.name, name);
+            return (!is_name && list_escapes(list, name, ctx)) ||
+                   list_escapes(node->data.index.index, name, ctx);
+        }
+        case AST_FUNCTION_CALL: {
+            // Builtins only borrow their list arguments (none keeps a pointer)
+            const BuiltinFunction* builtin = find_builtin(node, ctx);
+            for (int i = 0; i < node->data.call.argument_count; i++) {
+                ASTNode* arg = node->data.call.arguments[i];
+                bool borrowed = builtin && arg->type == AST_IDENTIFIER &&
+                                identifier_equals(arg->data.identifier.name, name);
+                if (!borrowed && list_escapes(arg, name, ctx)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+        case AST_BINARY_OP:
+            return list_escapes(node->data.binary_op.left, name, ctx) ||
+                   list_escapes(node->data.binary_op.right, name, ctx);
+        case AST_UNARY_OP:
+            return list_escapes(node->data.unary_op.operand, name, ctx);
+        case AST_LIST_LITERAL:
+            return list_escapes_in(node->data.list_literal.elements,
+                                   node->data.list_literal.element_count, name, ctx);
+        case AST_ASSIGNMENT:
+            return identifier_equals(node->data.assignment.name, name) ||
+                   list_escapes(node->data.assignment.value, name, ctx);
+        case AST_INDEX_ASSIGNMENT:
+            return list_escapes(node->data.index_assignment.index, name, ctx) ||
+                   list_escapes(node->data.index_assignment.value, name, ctx);
+        case AST_VAR_DECL:
+            return list_escapes(node->data.var_decl.initializer, name, ctx);
+        case AST_RETURN:
+        case AST_EXPR_STMT:
+            return list_escapes(node->data.return_stmt.expression, name, ctx);
+        case AST_IF:
+            return list_escapes(node->data.if_stmt.condition, name, ctx) ||
+                   list_escapes_in(node->data.if_stmt.then_body, node->data.if_stmt.then_count, name, ctx) ||
+                   list_escapes_in(node->data.if_stmt.else_body, node->data.if_stmt.else_count, name, ctx);
+        case AST_WHILE:
+            return list_escapes(node->data.while_stmt.condition, name, ctx) ||
+                   list_escapes_in(node->data.while_stmt.body, node->data.while_stmt.body_count, name, ctx);
+        default:
+            return false;
+    }
 }
 
-/* Generate code for binary operation */
-static const char* codegen_binary_op(ASTNode* binary_op, CodegenContext* ctx) {
-    // Generate left and right operands
-    const char* left = codegen_expression(binary_op->data.binary_op.left, ctx);
-    char left_copy[32];
-    strncpy(left_copy, left, sizeof(left_copy) - 1);
-    
-    const char* right = codegen_expression(binary_op->data.binary_op.right, ctx);
-    char right_copy[32];
-    strncpy(right_copy, right, sizeof(right_copy) - 1);
-    
-    const char* op_str = token_type_to_op_string(binary_op->data.binary_op.op);
-    const char* result_reg = next_register(ctx);
+/* Does the function own the list a top-level declaration creates? */
+static bool owns_declared_list(ASTNode* func, ASTNode* var_decl, CodegenContext* ctx) {
+    ASTNode* initializer = var_decl->data.var_decl.initializer;
+    if (!is_list_kind(ast_type_kind(var_decl->data.var_decl.type)) ||
+        (initializer && initializer->type != AST_LIST_LITERAL)) {
+        return false;
+    }
     
-    // Determine operation type
-    switch (binary_op->data.binary_op.op) {
-        case TOKEN_PLUS:
-        case TOKEN_MINUS:
-        case TOKEN_STAR:
-        case TOKEN_SLASH:
-        case TOKEN_MOD: {
-            // Arithmetic operations
-            const char* llvm_op = get_llvm_binary_op(op_str, "i64");
-            fprintf(ctx->output, "  %s = %s i64 %s, %s\n", 
-                    result_reg, llvm_op, left_copy, right_copy);
-            break;
+    char name[64];
+    strncpy(name, clean_identifier(var_decl->data.var_decl.name), sizeof(name) - 1);
+    name[sizeof(name) - 1] = '\0';
+    return !list_escapes_in(func->data.function.body, func->data.function.body_count, name, ctx);
+}
+
+/* Value of an empty slot of type (no list, the empty string) */
+static const char* empty_value(TypeKind type) {
+    return type == TYPE_STRING ? "zeroinitializer" : "null";
+}
+
+/* Allocate the list and string variables a block declares (nested blocks
+ * included) in the entry block, empty: a declaration inside a loop then
+ * lets go of the previous iteration's value, and every ret can let go of
+ * them
+ */
+static void declare_owned_variables(ASTNode* func, ASTNode** stmts, int count, bool top_level,
+                                    CodegenContext* ctx) {
+    for (int i = 0; i < count; i++) {
+        ASTNode* stmt = stmts[i];
+        if (stmt->type == AST_IF) {
+            declare_owned_variables(func, stmt->data.if_stmt.then_body, stmt->data.if_stmt.then_count, false, ctx);
+            declare_owned_variables(func, stmt->data.if_stmt.else_body, stmt->data.if_stmt.else_count, false, ctx);
+            continue;
         }
-        
-        case TOKEN_LESS:
-        case TOKEN_GREATER:
-        case TOKEN_LESS_EQUAL:
-        case TOKEN_GREATER_EQUAL:
-        case TOKEN_EQUAL_EQUAL:
-        case TOKEN_NOT_EQUAL: {
-            // Comparison operations (result is i1)
-            const char* pred = get_llvm_icmp_pred(op_str);
-            fprintf(ctx->output, "  %s = icmp %s i64 %s, %s\n", 
-                    result_reg, pred, left_copy, right_copy);
-            break;
+        if (stmt->type == AST_WHILE) {
+            declare_owned_variables(func, stmt->data.while_stmt.body, stmt->data.while_stmt.body_count, false, ctx);
+            continue;
         }
-        
-        case TOKEN_AND:
-        case TOKEN_OR: {
-            // Logical operations (operands are i1)
-            const char* llvm_op = get_llvm_binary_op(op_str, "i1");
-            fprintf(ctx->output, "  %s = %s i1 %s, %s\n", 
-                    result_reg, llvm_op, left_copy, right_copy);
-            break;
+        TypeKind type = stmt->type == AST_VAR_DECL ? ast_type_kind(stmt->data.var_decl.type) : TYPE_INT;
+        if ((!is_list_kind(type) && type != TYPE_STRING) || find_variable(ctx, stmt->data.var_decl.name)) {
+            continue;
         }
         
-        default:
-            fprintf(ctx->output, "  %s = add i64 %s, %s\n", 
-                    result_reg, left_copy, right_copy);
+        declare_variable(ctx, stmt->data.var_decl.name, type);
+        if (ctx->has_error) {
+            return;
+        }
+        CodegenVariable* var = &ctx->variables[ctx->variable_count - 1];
+        if (type == TYPE_STRING) {
+            var->owned = true;
+        } else if (stmt->data.var_decl.mem_location == MEM_LOCATION_STACK) {
+            // A stack declaration holds no reference: only a string[]'s text
+            // is freed (in place, the list itself stays in the frame)
+            var->owned = type == TYPE_STRING_LIST;
+            var->unique = var->owned;
+        } else {
+            var->owned = true;
+            var->unique = top_level && owns_declared_list(func, stmt, ctx);
+        }
+        const char* llvm_type = llvm_type_for_kind(type);
+        fprintf(ctx->output, "  %%%s = alloca %s\n", var->name, llvm_type);
+        fprintf(ctx->output, "  store %s %s, %s* %%%s\n", llvm_type, empty_value(type), llvm_type, var->name);
     }
-    
-    strncpy(g_expr_result_buffer, result_reg, sizeof(g_expr_result_buffer) - 1);
-    return g_expr_result_buffer;
 }
 
-/* Generate code for unary operation */
-static const char* codegen_unary_op(ASTNode* unary_op, CodegenContext* ctx) {
-    const char* operand = codegen_expression(unary_op->data.unary_op.operand, ctx);
-    char operand_copy[32];
-    strncpy(operand_copy, operand, sizeof(operand_copy) - 1);
-    
-    const char* result_reg = next_register(ctx);
-    
-    switch (unary_op->data.unary_op.op) {
-        case TOKEN_MINUS:
-            // Negate: 0 - operand
-            fprintf(ctx->output, "  %s = sub i64 0, %s\n", result_reg, operand_copy);
-            break;
-            
-        case TOKEN_NOT:
-            // Logical not: xor operand, true
-            fprintf(ctx->output, "  %s = xor i1 %s, true\n", result_reg, operand_copy);
-            break;
-            
-        default:
-            fprintf(ctx->output, "  %s = sub i64 0, %s\n", result_reg, operand_copy);
+/* Can `... = name` / `return name` take over name's value? Only at its
+ * last use: name holds its own list reference or buffer, is mentioned
+ * once in the current top-level statement and never after it, and no
+ * loop may read it again.
+ */
+static bool can_move_variable(const CodegenVariable* var, CodegenContext* ctx) {
+    ASTNode* func = ctx->function;
+    if (!var || !var->owned || var->unique || ctx->loop_depth > 0 || !func ||
+        ctx->statement_index >= func->data.function.body_count) {
+        return false;
     }
     
-    strncpy(g_expr_result_buffer, result_reg, sizeof(g_expr_result_buffer) - 1);
-    return g_expr_result_buffer;
+    ASTNode** body = func->data.function.body;
+    int rest = ctx->statement_index + 1;
+    return count_mentions(body[ctx->statement_index], var->name) == 1 &&
+           count_mentions_in(body + rest, func->data.function.body_count - rest, var->name) == 0;
 }
 
-/* Generate code for function call */
-static const char* codegen_function_call(ASTNode* call, CodegenContext* ctx) {
-    const char* func_name = clean_identifier(call->data.call.name);
-    
-    // Evaluate arguments
-    char* arg_regs[64];
-    for (int i = 0; i < call->data.call.argument_count; i++) {
-        const char* arg_reg = codegen_expression(call->data.call.arguments[i], ctx);
-        arg_regs[i] = malloc(32);
-        strncpy(arg_regs[i], arg_reg, 31);
-        arg_regs[i][31] = '\0';
+/* Empty source after stmt moved its value out. Directly at the top level
+ * the source is simply dead from here on; inside an if, a later ret must
+ * find it empty.
+ */
+static void move_out_of(CodegenVariable* source, ASTNode* stmt, CodegenContext* ctx) {
+    if (ctx->function->data.function.body[ctx->statement_index] == stmt) {
+        source->live = false;
+    } else {
+        const char* llvm_type = llvm_type_for_kind(source->type);
+        fprintf(ctx->output, "  store %s %s, %s* %%%s\n",
+                llvm_type, empty_value(source->type), llvm_type, source->name);
     }
-    
-    // Generate call instruction
-    const char* result_reg = next_register(ctx);
-    fprintf(ctx->output, "  %s = call i64 @%s(", result_reg, func_name);
-    
-    for (int i = 0; i < call->data.call.argument_count; i++) {
-        if (i > 0) fprintf(ctx->output, ", ");
-        fprintf(ctx->output, "i64 %s", arg_regs[i]);
+}
+
+/* May var hold a value when declaration stmt runs? Not directly in the
+ * function body, which runs it once on the empty slot.
+ */
+static bool may_hold_value(ASTNode* stmt, CodegenContext* ctx) {
+    return ctx->function->data.function.body[ctx->statement_index] != stmt;
+}
+
+/* Load var's current value and let go of it (release a list, free a string) */
+static void drop_variable_value(const CodegenVariable* var, ListRcOp op, CodegenContext* ctx) {
+    const char* llvm_type = llvm_type_for_kind(var->type);
+    char old_reg[32];
+    strncpy(old_reg, next_register(ctx), sizeof(old_reg) - 1);
+    old_reg[sizeof(old_reg) - 1] = '\0';
+    fprintf(ctx->output, "  %s = load %s, %s* %%%s\n", old_reg, llvm_type, llvm_type, var->name);
+    if (var->type == TYPE_STRING) {
+        free_string(ctx, old_reg);
+    } else {
+        emit_list_rc(ctx, op, var->type, old_reg);
+    }
+}
+
+/* Store the list value evaluates to into var (a declaration or assignment
+ * stmt). A temporary's reference is taken over; a variable's is moved at
+ * its last use and retained otherwise. The list var held before is
+ * released unless var is known to be empty (may_hold_list false); a stack
+ * string[] refills its frame slot, so the old text is freed first.
+ */
+static void store_list_variable(CodegenVariable* var, ASTNode* value, ASTNode* stmt, bool may_hold_list,
+                                CodegenContext* ctx) {
+    if (may_hold_list && var->unique) {
+        drop_variable_value(var, LIST_FREE, ctx);
     }
     
-    fprintf(ctx->output, ")\n");
+    const char* llvm_type = llvm_type_for_kind(var->type);
+    char value_reg[32];
+    strncpy(value_reg, codegen_value(value, var->type, ctx), sizeof(value_reg) - 1);
+    value_reg[sizeof(value_reg) - 1] = '\0';
     
-    // Free argument register buffers
-    for (int i = 0; i < call->data.call.argument_count; i++) {
-        free(arg_regs[i]);
+    if (!is_list_temporary(value)) {
+        CodegenVariable* source = find_variable(ctx, value->data.identifier.name);
+        if (source != var && can_move_variable(source, ctx)) {
+            move_out_of(source, stmt, ctx);
+            ctx->rc_stats.elided_by_moves += 2;
+        } else {
+            emit_list_rc(ctx, LIST_RETAIN, var->type, value_reg);
+        }
     }
     
-    strncpy(g_expr_result_buffer, result_reg, sizeof(g_expr_result_buffer) - 1);
-    return g_expr_result_buffer;
+    if (may_hold_list && var->owned && !var->unique) {
+        drop_variable_value(var, LIST_RELEASE, ctx);
+    }
+    fprintf(ctx->output, "  store %s %s, %s* %%%s\n", llvm_type, value_reg, llvm_type, var->name);
+    var->live = true;
 }
 
-/* Generate code for expression (main entry point) */
-const char* codegen_expression(ASTNode* expr, CodegenContext* ctx) {
-    if (!expr) {
-        return "0";
+/* Store the string value evaluates to (NULL: the empty string) into var
+ * (a declaration or assignment stmt). Owned text is moved in, as is a
+ * variable's buffer at its last use; anything else is copied. The string
+ * var held before is freed afterwards (the value may be computed from it)
+ * unless var is known to be empty (may_hold_string false).
+ */
+static void store_string_variable(CodegenVariable* var, ASTNode* value, ASTNode* stmt, bool may_hold_string,
+                                  CodegenContext* ctx) {
+    char value_reg[32] = "zeroinitializer";
+    if (value) {
+        CodegenVariable* source = value->type == AST_IDENTIFIER
+                                  ? find_variable(ctx, value->data.identifier.name) : NULL;
+        bool move = source && source != var && can_move_variable(source, ctx);
+        strncpy(value_reg, move ? codegen_expression(value, ctx) : codegen_owned_string(value, ctx),
+                sizeof(value_reg) - 1);
+        value_reg[sizeof(value_reg) - 1] = '\0';
+        if (move) {
+            move_out_of(source, stmt, ctx);
+        }
     }
     
-    switch (expr->type) {
-        case AST_LITERAL:
-            return codegen_literal(expr, ctx);
-            
-        case AST_IDENTIFIER:
-            return codegen_identifier(expr, ctx);
-            
-        case AST_BINARY_OP:
-            return codegen_binary_op(expr, ctx);
-            
-        case AST_UNARY_OP:
-            return codegen_unary_op(expr, ctx);
-            
-        case AST_FUNCTION_CALL:
-            return codegen_function_call(expr, ctx);
-            
-        default:
-            return "0";
+    if (may_hold_string && var->owned) {
+        drop_variable_value(var, LIST_RELEASE, ctx);
+    }
+    fprintf(ctx->output, "  store %%MelpStr %s, %%MelpStr* %%%s\n", value_reg, var->name);
+    var->live = true;
+}
+
+/* Let go of what the function's variables may hold (emitted before a ret):
+ * lists are released (freed in place when unique), strings freed;
+ * returned is the variable whose value the ret moves out, if any
+ */
+static void release_variables(CodegenContext* ctx, const CodegenVariable* returned) {
+    for (int i = 0; i < ctx->variable_count; i++) {
+        const CodegenVariable* var = &ctx->variables[i];
+        if (!var->owned || !var->live || var == returned) {
+            continue;
+        }
+        drop_variable_value(var, var->unique ? LIST_FREE : LIST_RELEASE, ctx);
+    }
+}
+
+/* Release this activation's string temporaries (end of a loop iteration,
+ * before ret). No temporary outlives its statement, so every statement
+ * boundary may release down to the function's entry mark.
+ */
+static void release_temporaries(CodegenContext* ctx) {
+    if (ctx->made_temporaries) {
+        fprintf(ctx->output, "  call void @mlp_region_leave(i64 %%region.mark)\n");
     }
 }
 
@@ -352,27 +2064,83 @@ const char* codegen_expression(ASTNode* expr, CodegenContext* ctx) {
 /* Forward declaration */
 void codegen_statement(ASTNode* stmt, CodegenContext* ctx);
 
-/* Generate code for return statement */
+/* Generate code for return statement
+ * A returned list is a new reference for the caller: a variable's is moved
+ * out of it, a borrowed parameter's is retained. A returned string is the
+ * caller's own text: a variable's buffer is moved out, other values are
+ * kept as for a store (see STRING OWNERSHIP).
+ */
 static void codegen_return(ASTNode* return_stmt, CodegenContext* ctx) {
-    if (return_stmt->data.return_stmt.expression) {
-        const char* result = codegen_expression(return_stmt->data.return_stmt.expression, ctx);
-        fprintf(ctx->output, "  ret i64 %s\n", result);
+    ASTNode* expression = return_stmt->data.return_stmt.expression;
+    if (expression && ctx->return_type == TYPE_STRING) {
+        const CodegenVariable* returned = expression->type == AST_IDENTIFIER
+                                          ? find_variable(ctx, expression->data.identifier.name) : NULL;
+        if (returned && !returned->owned) {
+            returned = NULL;
+        }
+        char result[32];
+        strncpy(result, returned ? codegen_expression(expression, ctx) : codegen_owned_string(expression, ctx),
+                sizeof(result) - 1);
+        result[sizeof(result) - 1] = '\0';
+        release_variables(ctx, returned);
+        release_temporaries(ctx);
+        fprintf(ctx->output, "  ret %%MelpStr %s\n", result);
+    } else if (expression) {
+        char result[32];
+        strncpy(result, codegen_value(expression, ctx->return_type, ctx), sizeof(result) - 1);
+        result[sizeof(result) - 1] = '\0';
+        
+        const CodegenVariable* returned = NULL;
+        if (is_list_kind(ctx->return_type) && !is_list_temporary(expression)) {
+            returned = find_variable(ctx, expression->data.identifier.name);
+            if (returned && returned->owned) {
+                ctx->rc_stats.elided_by_moves += 2;
+            } else {
+                returned = NULL;
+                emit_list_rc(ctx, LIST_RETAIN, ctx->return_type, result);
+            }
+        }
+        release_variables(ctx, returned);
+        release_temporaries(ctx);
+        fprintf(ctx->output, "  ret %s %s\n", llvm_type_for_kind(ctx->return_type), result);
     } else {
+        release_variables(ctx, NULL);
+        release_temporaries(ctx);
         fprintf(ctx->output, "  ret void\n");
     }
 }
 
 /* Generate code for variable declaration */
 static void codegen_var_decl(ASTNode* var_decl, CodegenContext* ctx) {
-    const char* var_name = clean_identifier(var_decl->data.var_decl.name);
+    char var_name[256];
+    strncpy(var_name, clean_identifier(var_decl->data.var_decl.name), sizeof(var_name) - 1);
+    var_name[sizeof(var_name) - 1] = '\0';
     const char* llvm_type = get_llvm_type_from_ast(var_decl->data.var_decl.type);
+    TypeKind type = ast_type_kind(var_decl->data.var_decl.type);
+    
+    // Lists and strings live in entry-block slots (declare_owned_variables):
+    // a list always starts as a list, a string as the empty string; a slot
+    // may hold a value from an earlier iteration or branch
+    ASTNode* initializer = var_decl->data.var_decl.initializer;
+    CodegenVariable* slot = is_list_kind(type) || type == TYPE_STRING ? find_variable(ctx, var_name) : NULL;
+    if (slot && type == TYPE_STRING) {
+        store_string_variable(slot, initializer, var_decl, may_hold_value(var_decl, ctx), ctx);
+        return;
+    }
+    if (slot) {
+        ASTNode empty = { .type = AST_LIST_LITERAL, .line = var_decl->line, .column = var_decl->column };
+        store_list_variable(slot, initializer ? initializer : &empty, var_decl,
+                            may_hold_value(var_decl, ctx), ctx);
+        return;
+    }
+    declare_variable(ctx, var_name, type);
     
     // Allocate variable on stack
     fprintf(ctx->output, "  %%%s = alloca %s\n", var_name, llvm_type);
     
     // Initialize if initializer provided
     if (var_decl->data.var_decl.initializer) {
-        const char* init_value = codegen_expression(var_decl->data.var_decl.initializer, ctx);
+        const char* init_value = codegen_value(var_decl->data.var_decl.initializer, type, ctx);
         fprintf(ctx->output, "  store %s %s, %s* %%%s\n", 
                 llvm_type, init_value, llvm_type, var_name);
     }
@@ -380,11 +2148,75 @@ static void codegen_var_decl(ASTNode* var_decl, CodegenContext* ctx) {
 
 /* Generate code for assignment */
 static void codegen_assignment(ASTNode* assignment, CodegenContext* ctx) {
-    const char* var_name = clean_identifier(assignment->data.assignment.name);
-    const char* value = codegen_expression(assignment->data.assignment.value, ctx);
+    // Copy name: evaluating the value reuses clean_identifier's buffer
+    char var_name[256];
+    strncpy(var_name, clean_identifier(assignment->data.assignment.name), sizeof(var_name) - 1);
+    var_name[sizeof(var_name) - 1] = '\0';
+    
+    // Accumulation in a loop that builds var_name in place
+    const CodegenBuilder* builder = active_builder(ctx, var_name);
+    if (builder && is_accumulate(assignment, var_name)) {
+        codegen_builder_append(assignment->data.assignment.value, builder, ctx);
+        return;
+    }
+    
+    TypeKind type = variable_type(ctx, var_name);
+    if (is_list_kind(type)) {
+        store_list_variable(find_variable(ctx, var_name), assignment->data.assignment.value,
+                            assignment, true, ctx);
+        return;
+    }
+    if (type == TYPE_STRING) {
+        store_string_variable(find_variable(ctx, var_name), assignment->data.assignment.value,
+                              assignment, true, ctx);
+        return;
+    }
+    const char* llvm_type = llvm_type_for_kind(type);
+    const char* value = codegen_value(assignment->data.assignment.value, type, ctx);
     
     // Store value to variable
-    fprintf(ctx->output, "  store i64 %s, i64* %%%s\n", value, var_name);
+    fprintf(ctx->output, "  store %s %s, %s* %%%s\n", llvm_type, value, llvm_type, var_name);
+}
+
+/* Generate code for xs[i] = value (bounds-checked store in place; a
+ * string[] keeps its own copy of the text and frees the one it replaces)
+ */
+static void codegen_index_assignment(ASTNode* assignment, CodegenContext* ctx) {
+    ListAccess access;
+    begin_variable_access(assignment->data.index_assignment.name, ctx, &access);
+    
+    char index[32];
+    strncpy(index, codegen_expression(assignment->data.index_assignment.index, ctx), sizeof(index) - 1);
+    index[sizeof(index) - 1] = '\0';
+    ASTNode* element = assignment->data.index_assignment.value;
+    bool strings = access.type == TYPE_STRING_LIST;
+    char value[32];
+    strncpy(value, strings ? codegen_owned_string(element, ctx) : codegen_expression(element, ctx),
+            sizeof(value) - 1);
+    value[sizeof(value) - 1] = '\0';
+    
+    // Length and buffer are read after the value: evaluating it may append
+    char address[32];
+    codegen_element_address(&access, index, ctx, address, sizeof(address));
+    
+    const char* element_type = llvm_type_for_kind(list_element_kind(access.type));
+    char old_reg[32] = "";
+    if (strings) {
+        strncpy(old_reg, next_register(ctx), sizeof(old_reg) - 1);
+        old_reg[sizeof(old_reg) - 1] = '\0';
+        fprintf(ctx->output, "  %s = load %%MelpStr, %%MelpStr* %s\n", old_reg, address);
+    }
+    fprintf(ctx->output, "  store %s %s, %s* %s\n", element_type, value, element_type, address);
+    if (strings) {
+        free_string(ctx, old_reg);
+    }
+}
+
+/* Does a block end in a ret? Nothing may follow it in its basic block (an
+ * instruction there would open an unnamed block, taking an SSA number)
+ */
+static bool ends_with_return(ASTNode** stmts, int count) {
+    return count > 0 && stmts[count - 1]->type == AST_RETURN;
 }
 
 /* Generate code for if statement */
@@ -413,7 +2245,9 @@ static void codegen_if(ASTNode* if_stmt, CodegenContext* ctx) {
     for (int i = 0; i < if_stmt->data.if_stmt.then_count; i++) {
         codegen_statement(if_stmt->data.if_stmt.then_body[i], ctx);
     }
-    fprintf(ctx->output, "  br label %%%s\n", endif_label);
+    if (!ends_with_return(if_stmt->data.if_stmt.then_body, if_stmt->data.if_stmt.then_count)) {
+        fprintf(ctx->output, "  br label %%%s\n", endif_label);
+    }
     
     // Else block (if exists)
     if (if_stmt->data.if_stmt.else_count > 0) {
@@ -421,21 +2255,43 @@ static void codegen_if(ASTNode* if_stmt, CodegenContext* ctx) {
         for (int i = 0; i < if_stmt->data.if_stmt.else_count; i++) {
             codegen_statement(if_stmt->data.if_stmt.else_body[i], ctx);
         }
-        fprintf(ctx->output, "  br label %%%s\n", endif_label);
+        if (!ends_with_return(if_stmt->data.if_stmt.else_body, if_stmt->data.if_stmt.else_count)) {
+            fprintf(ctx->output, "  br label %%%s\n", endif_label);
+        }
     }
     
     // End if block
     fprintf(ctx->output, "\n%s:\n", endif_label);
 }
 
-/* Generate code for while statement */
+/* Generate code for while statement
+ * Strings accumulated with `s = s + x` are built in place, and the bounds
+ * of lists the loop cannot resize are loaded once (see above). Each
+ * iteration ends by releasing its string temporaries.
+ */
 static void codegen_while(ASTNode* while_stmt, CodegenContext* ctx) {
     // Generate unique labels
+    int loop_id = ctx->label_counter++;
     char loop_label[32], body_label[32], endloop_label[32];
-    snprintf(loop_label, sizeof(loop_label), "loop%d", ctx->label_counter);
-    snprintf(body_label, sizeof(body_label), "body%d", ctx->label_counter);
-    snprintf(endloop_label, sizeof(endloop_label), "endloop%d", ctx->label_counter);
-    ctx->label_counter++;
+    snprintf(loop_label, sizeof(loop_label), "loop%d", loop_id);
+    snprintf(body_label, sizeof(body_label), "body%d", loop_id);
+    snprintf(endloop_label, sizeof(endloop_label), "endloop%d", loop_id);
+    
+    int first_builder = ctx->builder_count;
+    begin_loop_builders(while_stmt, while_stmt->data.while_stmt.body,
+                        while_stmt->data.while_stmt.body_count, loop_id, ctx);
+    int first_hoisted = ctx->hoisted_list_count;
+    hoist_loop_lists(while_stmt, ctx);
+    
+    // A ret in the body may follow a list stored by an earlier iteration
+    for (int i = 0; i < ctx->variable_count; i++) {
+        CodegenVariable* var = &ctx->variables[i];
+        if (var->owned && assigns_variable(while_stmt->data.while_stmt.body,
+                                           while_stmt->data.while_stmt.body_count, var->name)) {
+            var->live = true;
+        }
+    }
+    ctx->loop_depth++;
     
     // Jump to loop header
     fprintf(ctx->output, "  br label %%%s\n", loop_label);
@@ -451,16 +2307,43 @@ static void codegen_while(ASTNode* while_stmt, CodegenContext* ctx) {
     for (int i = 0; i < while_stmt->data.while_stmt.body_count; i++) {
         codegen_statement(while_stmt->data.while_stmt.body[i], ctx);
     }
-    fprintf(ctx->output, "  br label %%%s\n", loop_label);
+    if (!ends_with_return(while_stmt->data.while_stmt.body, while_stmt->data.while_stmt.body_count)) {
+        release_temporaries(ctx);
+        fprintf(ctx->output, "  br label %%%s\n", loop_label);
+    }
     
     // End loop
     fprintf(ctx->output, "\n%s:\n", endloop_label);
+    ctx->loop_depth--;
+    ctx->hoisted_list_count = first_hoisted;
+    end_loop_builders(ctx, first_builder, loop_id);
 }
 
 /* Generate code for expression statement */
 static void codegen_expr_stmt(ASTNode* expr_stmt, CodegenContext* ctx) {
-    // Just evaluate expression (e.g., function call)
-    codegen_expression(expr_stmt->data.return_stmt.expression, ctx);
+    // Just evaluate expression (e.g., function call); a list result is
+    // unused, and so is a string: a call's buffer is freed, anything else
+    // is a temporary
+    ASTNode* expression = expr_stmt->data.return_stmt.expression;
+    TypeKind type = expression_type(expression, ctx);
+    if (type == TYPE_STRING) {
+        if (expression->type != AST_FUNCTION_CALL || !is_owned_string(expression, ctx)) {
+            codegen_temporary(expression, ctx);
+            return;
+        }
+        char string_reg[32];
+        strncpy(string_reg, codegen_expression(expression, ctx), sizeof(string_reg) - 1);
+        string_reg[sizeof(string_reg) - 1] = '\0';
+        free_string(ctx, string_reg);
+        return;
+    }
+    const char* value = codegen_expression(expression, ctx);
+    if (is_list_kind(type) && is_list_temporary(expression)) {
+        char list_reg[32];
+        strncpy(list_reg, value, sizeof(list_reg) - 1);
+        list_reg[sizeof(list_reg) - 1] = '\0';
+        drop_list_temporary(expression, type, list_reg, true, ctx);
+    }
 }
 
 /* Generate code for statement (main entry point) */
@@ -480,6 +2363,10 @@ void codegen_statement(ASTNode* stmt, CodegenContext* ctx) {
             codegen_assignment(stmt, ctx);
             break;
             
+        case AST_INDEX_ASSIGNMENT:
+            codegen_index_assignment(stmt, ctx);
+            break;
+            
         case AST_IF:
             codegen_if(stmt, ctx);
             break;
@@ -508,6 +2395,15 @@ void codegen_function(ASTNode* func, CodegenContext* ctx) {
     
     // Reset register counter for each function (SSA numbering starts fresh)
     ctx->register_counter = func->data.function.parameter_count;
+    ctx->return_type = ast_type_kind(func->data.function.return_type);
+    ctx->variable_count = 0;
+    ctx->function = func;
+    ctx->statement_index = 0;
+    ctx->loop_depth = 0;
+    ctx->builder_count = 0;
+    ctx->hoisted_list_count = 0;
+    ctx->temporary_string = false;
+    ctx->made_temporaries = false;
     
     // Function signature
     fprintf(ctx->output, "define %s @%s(", return_type, func_name);
@@ -524,32 +2420,92 @@ void codegen_function(ASTNode* func, CodegenContext* ctx) {
     fprintf(ctx->output, "entry:\n");
     
     // Allocate and store parameters
+    ASTNode** body_stmts = func->data.function.body;
+    int body_count = func->data.function.body_count;
     for (int i = 0; i < func->data.function.parameter_count; i++) {
         ASTNode* param = func->data.function.parameters[i];
         const char* param_name = clean_identifier(param->data.parameter.name);
         const char* param_type = get_llvm_type_from_ast(param->data.parameter.type);
         
         fprintf(ctx->output, "  %%%s = alloca %s\n", param_name, param_type);
-        fprintf(ctx->output, "  store %s %%%d, %s* %%%s\n", 
-                param_type, i, param_type, param_name);
+        TypeKind type = ast_type_kind(param->data.parameter.type);
+        declare_variable(ctx, param_name, type);
+        
+        // A string parameter is borrowed too: one the body reassigns frees
+        // its old values, so it starts as a copy of its own
+        char param_reg[32];
+        snprintf(param_reg, sizeof(param_reg), "%%%d", i);
+        CodegenVariable* var = &ctx->variables[ctx->variable_count - 1];
+        if (type == TYPE_STRING && !ctx->has_error &&
+            assigns_variable(body_stmts, body_count, var->name)) {
+            char args[RUNTIME_ARGUMENT_SIZE];
+            string_arguments(ctx, param_reg, args, sizeof(args));
+            strncpy(param_reg, next_register(ctx), sizeof(param_reg) - 1);
+            param_reg[sizeof(param_reg) - 1] = '\0';
+            fprintf(ctx->output, "  %s = call %%MelpStr @mlp_str_own(%s)\n", param_reg, args);
+            var->owned = true;
+            var->live = true;
+        }
+        fprintf(ctx->output, "  store %s %s, %s* %%%s\n",
+                param_type, param_reg, param_type, var->name);
+        
+        // A list parameter is borrowed unless the body reassigns it
+        if (is_list_kind(type) && !ctx->has_error) {
+            if (assigns_variable(body_stmts, body_count, var->name)) {
+                emit_list_rc(ctx, LIST_RETAIN, type, param_reg);
+                var->owned = true;
+                var->live = true;
+            } else {
+                ctx->rc_stats.elided_by_borrows += 2;
+            }
+        }
+    }
+    declare_owned_variables(func, body_stmts, body_count, true, ctx);
+    
+    // The body goes to a buffer first: the entry mark of the temporaries
+    // region is only taken if the body turns out to make temporaries
+    FILE* function_output = ctx->output;
+    char* body_text = NULL;
+    size_t body_size = 0;
+    FILE* body = open_memstream(&body_text, &body_size);
+    if (!body) {
+        set_error(ctx, "Out of memory generating function body");
+        return;
     }
+    ctx->output = body;
+    ctx->entry = function_output;
     
     // Generate function body
-    for (int i = 0; i < func->data.function.body_count; i++) {
-        codegen_statement(func->data.function.body[i], ctx);
+    for (int i = 0; i < body_count; i++) {
+        ctx->statement_index = i;
+        codegen_statement(body_stmts[i], ctx);
     }
     
     // Ensure function ends with return (if not already present)
     // This is a safety measure - semantic analysis should ensure returns exist
     if (func->data.function.body_count == 0 || 
         func->data.function.body[func->data.function.body_count - 1]->type != AST_RETURN) {
+        release_variables(ctx, NULL);
+        release_temporaries(ctx);
         if (strcmp(return_type, "void") == 0) {
             fprintf(ctx->output, "  ret void\n");
+        } else if (ctx->return_type == TYPE_STRING) {
+            fprintf(ctx->output, "  ret %s zeroinitializer\n", return_type);
+        } else if (is_list_kind(ctx->return_type)) {
+            fprintf(ctx->output, "  ret %s null\n", return_type);
         } else {
             fprintf(ctx->output, "  ret %s 0\n", return_type);
         }
     }
     
+    fclose(body);
+    ctx->output = function_output;
+    ctx->entry = NULL;
+    if (ctx->made_temporaries) {
+        fprintf(ctx->output, "  %%region.mark = call i64 @mlp_region_enter()\n");
+    }
+    fwrite(body_text, 1, body_size, ctx->output);
+    free(body_text);
     fprintf(ctx->output, "}\n\n");
 }
 
@@ -568,10 +2524,85 @@ static void generate_module_header(CodegenContext* ctx) {
         "i64:64-f80:128-n8:16:32:64-S128\"\n");
     fprintf(ctx->output, "target triple = \"x86_64-pc-linux-gnu\"\n\n");
     
+    // string: (data, length) - MelpStr in runtime/stdlib/mlp_string.h
+    fprintf(ctx->output, "%%MelpStr = type { i8*, i64 }\n");
+    
+    // Lists: MelpList in runtime/stdlib/mlp_list.h, elements pointer typed
+    fprintf(ctx->output, "%%MelpList.i64 = type { i64*, i64, i64, i64, i64 }\n");
+    fprintf(ctx->output, "%%MelpList.i1 = type { i1*, i64, i64, i64, i64 }\n");
+    fprintf(ctx->output, "%%MelpList.str = type { %%MelpStr*, i64, i64, i64, i64 }\n\n");
+    
     // External declarations (for standard library functions if needed)
     fprintf(ctx->output, "; External declarations\n");
     fprintf(ctx->output, "declare i32 @printf(i8*, ...)\n");
-    fprintf(ctx->output, "declare i32 @scanf(i8*, ...)\n\n");
+    fprintf(ctx->output, "declare i32 @scanf(i8*, ...)\n");
+    
+    // Runtime functions backing builtins (runtime/stdlib)
+    for (int i = 0; i < get_builtin_function_count(); i++) {
+        const BuiltinFunction* builtin = get_builtin_function(i);
+        if (!builtin->runtime_symbol) {
+            continue;  // Emitted inline
+        }
+        fprintf(ctx->output, "declare %s @%s(",
+                llvm_type_for_kind(builtin->return_type), builtin->runtime_symbol);
+        for (int j = 0; j < builtin->param_count; j++) {
+            TypeKind param_type = builtin->param_types[j];
+            fprintf(ctx->output, "%s%s", j > 0 ? ", " : "",
+                    param_type == TYPE_STRING ? "i8*, i64" : llvm_type_for_kind(param_type));
+        }
+        fprintf(ctx->output, ")\n");
+    }
+    
+    // String runtime (runtime/stdlib/mlp_string.c, mlp_string_builder.c, mlp_region.c)
+    fprintf(ctx->output, "declare %%MelpStr @mlp_str_concat(i8*, i64, i8*, i64)\n");
+    fprintf(ctx->output, "declare %%MelpStr @mlp_str_concat3(i8*, i64, i8*, i64, i8*, i64)\n");
+    fprintf(ctx->output, "declare %%MelpStr @mlp_str_concat_tmp(i8*, i64, i8*, i64)\n");
+    fprintf(ctx->output, "declare %%MelpStr @mlp_str_concat3_tmp(i8*, i64, i8*, i64, i8*, i64)\n");
+    fprintf(ctx->output, "declare %%MelpStr @mlp_str_own(i8*, i64)\n");
+    fprintf(ctx->output, "declare %%MelpStr @mlp_str_to_tmp(i8*, i64)\n");
+    fprintf(ctx->output, "declare void @mlp_str_free(i8*, i64)\n");
+    fprintf(ctx->output, "declare i64 @mlp_region_enter()\n");
+    fprintf(ctx->output, "declare void @mlp_region_leave(i64)\n");
+    fprintf(ctx->output, "declare i32 @mlp_str_equals(i8*, i64, i8*, i64)\n");
+    fprintf(ctx->output, "declare i8* @mlp_string_builder_from_str(i8*, i64)\n");
+    fprintf(ctx->output, "declare void @mlp_string_builder_append_str(i8*, i8*, i64)\n");
+    fprintf(ctx->output, "declare %%MelpStr @mlp_string_builder_build_str(i8*)\n");
+    
+    // List runtime (runtime/stdlib/mlp_list.c, mlp_panic.c)
+    fprintf(ctx->output, "declare i8* @melp_list_create_zeroed(i64, i64)\n");
+    fprintf(ctx->output, "declare void @melp_list_grow_checked(i8*)\n");
+    fprintf(ctx->output, "declare void @melp_list_free(i8*)\n");
+    fprintf(ctx->output, "declare void @melp_list_retain(i8*)\n");
+    fprintf(ctx->output, "declare void @melp_list_release(i8*)\n");
+    fprintf(ctx->output, "declare void @melp_list_free_strings(i8*)\n");
+    fprintf(ctx->output, "declare void @melp_list_release_strings(i8*)\n");
+    fprintf(ctx->output, "declare void @mlp_panic_array_bounds(i64, i64, i8*) cold noreturn\n");
+    fprintf(ctx->output, "\n");
+}
+
+/* Emit the literal pool: one private, read-only NUL-terminated constant
+ * per distinct text. The runtime recognizes these addresses as rodata
+ * (sto_is_rodata) and uses them in place instead of copying or freeing.
+ */
+static void generate_string_literals(CodegenContext* ctx) {
+    if (ctx->string_literal_count == 0) {
+        return;
+    }
+    
+    fprintf(ctx->output, "; String literal pool\n");
+    for (int i = 0; i < ctx->string_literal_count; i++) {
+        const unsigned char* text = (const unsigned char*)ctx->string_literals[i];
+        fprintf(ctx->output, "@.str.%d = private unnamed_addr constant [%zu x i8] c\"",
+                i, strlen((const char*)text) + 1);
+        for (; *text; text++) {
+            if (*text >= 0x20 && *text < 0x7f && *text != '"' && *text != '\\') {
+                fputc(*text, ctx->output);
+            } else {
+                fprintf(ctx->output, "\\%02X", *text);
+            }
+        }
+        fprintf(ctx->output, "\\00\"\n");
+    }
 }
 
 /* Generate forward declarations for all functions
@@ -609,6 +2640,8 @@ void codegen_program(ASTNode* program, CodegenContext* ctx) {
         return;
     }
     
+    ctx->program = program;
+    
     // Generate module header
     generate_module_header(ctx);
     
@@ -619,6 +2652,20 @@ void codegen_program(ASTNode* program, CodegenContext* ctx) {
     for (int i = 0; i < program->data.program.function_count; i++) {
         codegen_function(program->data.program.functions[i], ctx);
     }
+    
+    generate_string_literals(ctx);
+    
+    const CodegenRcStats* rc = &ctx->rc_stats;
+    if (rc->retains + rc->releases + rc->frees_in_place + rc->elided_by_moves + rc->elided_by_borrows > 0) {
+        fprintf(ctx->output, "\n; Reference counting: %d retains, %d releases, %d frees in place; "
+                "%d operations elided (%d by moves, %d by borrows)\n",
+                rc->retains, rc->releases, rc->frees_in_place,
+                rc->elided_by_moves + rc->elided_by_borrows, rc->elided_by_moves, rc->elided_by_borrows);
+    }
+    if (rc->stack_lists > 0) {
+        fprintf(ctx->output, "; Escape analysis: %d list literals on the stack (heap allocations removed)\n",
+                rc->stack_lists);
+    }
 }
 
 /* ============================================================================
@@ -651,12 +2698,25 @@ bool generate_code(ASTNode* ast, const char* output_file) {
         .symbols = NULL,
         .register_counter = 0,
         .label_counter = 1,
-        .has_error = false
+        .has_error = false,
+        .program = NULL,
+        .return_type = TYPE_INT,
+        .variable_count = 0,
+        .builder_count = 0,
+        .hoisted_list_count = 0,
+        .string_literals = NULL,
+        .string_literal_count = 0,
+        .string_literal_capacity = 0
     };
     ctx.error_message[0] = '\0';
     
     // Generate code
     codegen_program(ast, &ctx);
+    g_rc_stats = ctx.rc_stats;
+    for (int i = 0; i < ctx.string_literal_count; i++) {
+        free(ctx.string_literals[i]);
+    }
+    free(ctx.string_literals);
     
     // Close output file
     fclose(output);
@@ -702,3 +2762,8 @@ bool generate_code_from_source(const char* source, const char* output_file) {
 const char* get_codegen_error(void) {
     return g_error_message;
 }
+
+/* Get the reference counting operations of the last generated module */
+CodegenRcStats get_codegen_rc_stats(void) {
+    return g_rc_stats;
+}
@@ -24,6 +24,45 @@
  * CODE GENERATOR CONTEXT
  * ============================================================================ */
 
+#define CODEGEN_MAX_VARIABLES 256
+#define CODEGEN_MAX_BUILDERS 16
+#define CODEGEN_MAX_HOISTED_LISTS 16
+
+/* Local variable (parameter or declaration) of the current function */
+typedef struct CodegenVariable {
+    char name[64];
+    TypeKind type;
+    bool owned;                  // Holds a list reference or a string's buffer, let go before ret
+    bool unique;                 // Only reference to its list (never escapes): freed in place
+    bool live;                   // May hold a value to let go of here (stored above or in an enclosing loop)
+} CodegenVariable;
+
+/* Reference counting operations on lists, per compiled module
+ * A naive scheme retains on every copy of a list pointer and releases
+ * when the copy dies; elided counts what moves and borrows save of that.
+ */
+typedef struct CodegenRcStats {
+    int retains;                 // melp_list_retain calls emitted
+    int releases;                // melp_list_release calls emitted
+    int frees_in_place;          // Last references freed directly (melp_list_free)
+    int elided_by_moves;         // Retain/release pairs dropped at a variable's last use
+    int elided_by_borrows;       // Pairs dropped for parameters and call arguments
+    int stack_lists;             // Literals built in the stack frame (escape analysis): no allocation
+} CodegenRcStats;
+
+/* List whose data pointer and length are loaded once before a loop */
+typedef struct CodegenHoistedList {
+    char variable[64];           // MELP variable (e.g. "xs")
+    char data_reg[96];           // Register holding the element pointer (e.g. "%xs.data3")
+    char length_reg[96];         // Register holding the length (e.g. "%xs.len3")
+} CodegenHoistedList;
+
+/* String variable accumulated through a string builder in a loop */
+typedef struct CodegenBuilder {
+    char variable[64];           // MELP variable (e.g. "s")
+    char builder_reg[96];        // Register holding the builder (e.g. "%s.sb3")
+} CodegenBuilder;
+
 /* Code generation context - maintains state during IR generation */
 typedef struct CodegenContext {
     FILE* output;                // LLVM IR output file
@@ -32,6 +71,37 @@ typedef struct CodegenContext {
     int label_counter;           // Next available label number (label1, label2, ...)
     char error_message[512];     // Last error message
     bool has_error;              // Error flag
+    ASTNode* program;            // Program being generated (builtin shadowing)
+    
+    // Current function
+    TypeKind return_type;
+    CodegenVariable variables[CODEGEN_MAX_VARIABLES];
+    int variable_count;
+    ASTNode* function;           // Function being generated
+    int statement_index;         // Its top-level statement being generated
+    int loop_depth;              // Enclosing while loops
+    FILE* entry;                 // Entry block, for allocas made while the body is buffered
+    
+    // Loops currently building a string in place (innermost last)
+    CodegenBuilder builders[CODEGEN_MAX_BUILDERS];
+    int builder_count;
+    
+    // Lists whose bounds are loop-invariant in the loops being generated
+    CodegenHoistedList hoisted_lists[CODEGEN_MAX_HOISTED_LISTS];
+    int hoisted_list_count;
+    
+    // String temporaries (runtime/stdlib mlp_region.h)
+    bool temporary_string;       // Next expression's string dies with its statement
+    bool made_temporaries;       // Function has allocated a temporary so far
+    
+    // List reference counting (see get_codegen_rc_stats)
+    CodegenRcStats rc_stats;
+    
+    // String literal pool: distinct texts (owned copies), emitted once each
+    // as @.str.N read-only globals after the functions
+    char** string_literals;
+    int string_literal_count;
+    int string_literal_capacity;
 } CodegenContext;
 
 /* ============================================================================
@@ -62,7 +132,29 @@ typedef struct CodegenContext {
  *   - SSA form (single static assignment)
  *   - Virtual registers (%0, %1, %2, ...)
  *   - Basic blocks (entry, then, else, loop, etc.)
- *   - Type system (i64 for int, i1 for bool)
+ *   - Type system (i64 for int, i1 for bool, i8* for string,
+ *     %MelpList.<elem>* for lists)
+ *   - Strings: literals become private constants; + calls
+ *     mlp_string_concat, and `s = s + x` inside a while loop appends to
+ *     an MlpStringBuilder instead (see codegen_while). A string only read
+ *     by its statement (print(a + b), a + b == c) is a temporary: it is
+ *     allocated in the thread's region and released in bulk at the end of
+ *     each loop iteration and before ret
+ *   - String lifetimes: a variable, string[] element or return value owns
+ *     its text (a concatenation or call result is moved in, anything else
+ *     copied with mlp_str_own); a store frees the value it replaces and
+ *     every ret frees what the variables still hold
+ *   - Lists: xs[i], xs[i] = v, length(xs) and append(xs; v) are inline
+ *     loads/stores on the MelpList fields with a bounds check; inside a
+ *     loop that cannot resize xs, its data pointer and length are loaded
+ *     once before the loop (see codegen_while)
+ *   - List lifetimes: lists are reference counted (melp_list_retain /
+ *     melp_list_release). A list parameter the callee never reassigns is
+ *     borrowed, as is every list argument; a variable's last use moves
+ *     its reference instead of sharing it; a list that never escapes is
+ *     freed in place before ret (see get_codegen_rc_stats); a literal
+ *     escape analysis placed on the stack (semantic/escape_analysis.h) is
+ *     built in entry-block allocas and never counted or freed
  * 
  * Error Handling:
  *   - File I/O errors
@@ -120,6 +212,20 @@ bool generate_code_from_source(const char* source, const char* output_file);
  */
 const char* get_codegen_error(void);
 
+/* Get the reference counting operations of the last generated module
+ * 
+ * Returns:
+ *   Retains/releases emitted, lists freed in place, the operations a
+ *   naive scheme would have emitted that moves and borrows removed, and
+ *   the list literals built on the stack instead of allocated (the same
+ *   counts end the .ll file as comments)
+ * 
+ * Example:
+ *   CodegenRcStats rc = get_codegen_rc_stats();
+ *   printf("%d RC operations removed\n", rc.elided_by_moves + rc.elided_by_borrows);
+ */
+CodegenRcStats get_codegen_rc_stats(void);
+
 /* ============================================================================
  * INTERNAL CODE GENERATION FUNCTIONS
  * (Used by codegen.c, exposed for modularity/testing)
@@ -147,6 +253,7 @@ const char* codegen_expression(ASTNode* expr, CodegenContext* ctx);
 /* Convert MELP type to LLVM type string
  * int -> "i64"
  * bool -> "i1"
+ * string -> "%MelpStr" ({ i8* data, i64 length }: MelpStr in runtime/stdlib/mlp_string.h)
  * void -> "void"
  */
 const char* get_llvm_type(const char* melp_type);
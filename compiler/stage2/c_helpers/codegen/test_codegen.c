@@ -107,6 +107,57 @@ static int compile_and_run(const char* source, const char* test_name) {
     return exit_code;
 }
 
+/* Generate IR and check it contains needle (and still assembles with llc) */
+static int generate_ir_contains(const char* source, const char* test_name, const char* needle) {
+    char ll_file[512];
+    char command[2048];
+    
+    snprintf(ll_file, sizeof(ll_file), "/tmp/%s.ll", test_name);
+    if (!generate_code_from_source(source, ll_file)) {
+        printf("  Codegen error: %s\n", get_codegen_error());
+        return 0;
+    }
+    
+    snprintf(command, sizeof(command), "llc %s -o /dev/null 2>/dev/null", ll_file);
+    int llc_ok = (execute_command(command) == 0);
+    
+    snprintf(command, sizeof(command), "grep -qF '%s' %s", needle, ll_file);
+    int found = (execute_command(command) == 0);
+    
+    remove(ll_file);
+    return llc_ok && found;
+}
+
+/* Helper: Generate IR (must pass llc) and count lines containing needle
+ * Returns -1 if codegen or llc fails.
+ */
+static int generate_ir_count(const char* source, const char* test_name, const char* needle) {
+    char ll_file[512];
+    char command[2048];
+    
+    snprintf(ll_file, sizeof(ll_file), "/tmp/%s.ll", test_name);
+    if (!generate_code_from_source(source, ll_file)) {
+        printf("  Codegen error: %s\n", get_codegen_error());
+        return -1;
+    }
+    
+    snprintf(command, sizeof(command), "llc %s -o /dev/null 2>/dev/null", ll_file);
+    int llc_ok = (execute_command(command) == 0);
+    
+    int count = 0;
+    FILE* ll = fopen(ll_file, "r");
+    char line[1024];
+    while (ll && fgets(line, sizeof(line), ll)) {
+        if (strstr(line, needle)) {
+            count++;
+        }
+    }
+    if (ll) fclose(ll);
+    
+    remove(ll_file);
+    return llc_ok ? count : -1;
+}
+
 /* ============================================================================
  * TEST CASES - BASIC PROGRAMS
  * ============================================================================ */
@@ -592,6 +643,449 @@ void test_multiple_variables() {
     assert_test(result == 0, "test_multiple_variables", "Expected 10 + 20 - 30 = 0");
 }
 
+/* Test 32: print builtin lowers to a direct runtime call */
+void test_builtin_print() {
+    const char* source = 
+        "function main() as numeric\n"
+        "    numeric x = 41\n"
+        "    print(x + 1)\n"
+        "    return 0\n"
+        "end_function";
+    
+    int ok = generate_ir_contains(source, "test_builtin_print",
+                                  "call void @mlp_println_numeric_simple(i64 %");
+    assert_test(ok, "test_builtin_print", "Expected call to mlp_println_numeric_simple");
+}
+
+/* Test 33: user function named print shadows the builtin */
+void test_builtin_shadowed() {
+    const char* source = 
+        "function print(numeric x) as numeric\n"
+        "    return x + 1\n"
+        "end_function\n"
+        "function main() as numeric\n"
+        "    return print(6)\n"
+        "end_function";
+    
+    int result = compile_and_run(source, "test_builtin_shadowed");
+    assert_test(result == 7, "test_builtin_shadowed", "Expected user print() = 7");
+}
+
+/* ============================================================================
+ * TEST CASES - STRINGS
+ * ============================================================================ */
+
+/* Test 34: string + string calls the runtime concat */
+void test_string_concat() {
+    const char* source = 
+        "function main() as numeric\n"
+        "    string a = \"ab\"\n"
+        "    string s = a + \"cd\"\n"
+        "    print(s)\n"
+        "    return 0\n"
+        "end_function";
+    
+    int ok = generate_ir_contains(source, "test_string_concat",
+                                  "call %MelpStr @mlp_str_concat(i8* %");
+    assert_test(ok, "test_string_concat", "Expected call to mlp_str_concat");
+}
+
+/* Test 35: print(string) picks the string overload */
+void test_string_print() {
+    const char* source = 
+        "function main() as numeric\n"
+        "    print(\"hello\")\n"
+        "    return 0\n"
+        "end_function";
+    
+    int ok = generate_ir_contains(source, "test_string_print",
+                                  "call void @mlp_println_str(i8* %");
+    assert_test(ok, "test_string_print", "Expected call to mlp_println_str");
+}
+
+/* Test 36: s = s + x in a loop appends to a string builder */
+void test_string_loop_builder() {
+    const char* source = 
+        "function main() as numeric\n"
+        "    string s = \"\"\n"
+        "    numeric i = 0\n"
+        "    while i < 100\n"
+        "        s = s + \"ab\" + \"c\"\n"
+        "        i = i + 1\n"
+        "    end_while\n"
+        "    print(s)\n"
+        "    return 0\n"
+        "end_function";
+    
+    int ok = generate_ir_contains(source, "test_string_loop_builder",
+                                  "call void @mlp_string_builder_append_str(i8* %s.sb");
+    assert_test(ok, "test_string_loop_builder", "Expected builder appends in the loop");
+}
+
+/* Test 37: a loop that also reads s keeps plain concatenation */
+void test_string_loop_read() {
+    const char* source = 
+        "function main() as numeric\n"
+        "    string s = \"\"\n"
+        "    numeric i = 0\n"
+        "    while i < 3\n"
+        "        s = s + \"x\"\n"
+        "        print(s)\n"
+        "        i = i + 1\n"
+        "    end_while\n"
+        "    return 0\n"
+        "end_function";
+    
+    int ok = generate_ir_contains(source, "test_string_loop_read",
+                                  "call %MelpStr @mlp_str_concat(i8* %");
+    assert_test(ok, "test_string_loop_read", "Expected mlp_str_concat when s is read");
+}
+
+/* Test 38: char_at / substring / length call the zero-copy view runtime */
+void test_string_views() {
+    const char* source = 
+        "function main() as numeric\n"
+        "    string s = \"hello\"\n"
+        "    print(char_at(s; 1))\n"
+        "    print(substring(s; 1; 3))\n"
+        "    return length(s)\n"
+        "end_function";
+    
+    int ok = generate_ir_contains(source, "test_string_views",
+                                  "call %MelpStr @mlp_str_char_at(i8* %") &&
+             generate_ir_contains(source, "test_string_views",
+                                  "call %MelpStr @mlp_str_substring(i8* %") &&
+             generate_ir_contains(source, "test_string_views",
+                                  "declare %MelpStr @mlp_str_substring(i8*, i64, i64, i64)");
+    assert_test(ok, "test_string_views", "Expected calls into the string view runtime");
+}
+
+/* Test 39: string == compares (data, length) pairs; literal lengths are constants */
+void test_string_equality_abi() {
+    const char* source = 
+        "function main() as numeric\n"
+        "    string s = \"melp\"\n"
+        "    if s == \"melp\" then\n"
+        "        return 1\n"
+        "    end_if\n"
+        "    return 0\n"
+        "end_function";
+    
+    int ok = generate_ir_contains(source, "test_string_equality_abi",
+                                  "call i32 @mlp_str_equals(i8* %") &&
+             generate_ir_contains(source, "test_string_equality_abi", ", i64 4, 1") &&
+             generate_ir_contains(source, "test_string_equality_abi",
+                                  "%MelpStr = type { i8*, i64 }");
+    assert_test(ok, "test_string_equality_abi", "Expected MelpStr literals and mlp_str_equals");
+}
+
+/* Test 40: literal + literal is folded into one pooled constant */
+void test_string_concat_folded() {
+    const char* source = 
+        "function main() as numeric\n"
+        "    string s = \"ab\" + \"cd\" + \"ef\"\n"
+        "    print(s)\n"
+        "    return 0\n"
+        "end_function";
+    
+    int calls = generate_ir_count(source, "test_string_concat_folded", "call %MelpStr @mlp_str_concat");
+    int ok = calls == 0 &&
+             generate_ir_contains(source, "test_string_concat_folded", "c\"abcdef\\00\"") &&
+             generate_ir_contains(source, "test_string_concat_folded", ", i64 6, 1");
+    assert_test(ok, "test_string_concat_folded", "Expected \"abcdef\" constant, no concat call");
+}
+
+/* Test 41: equal literals share one read-only global */
+void test_string_literal_pool() {
+    const char* source = 
+        "function greet() as string\n"
+        "    return \"melp\"\n"
+        "end_function\n"
+        "\n"
+        "function main() as numeric\n"
+        "    string s = \"melp\"\n"
+        "    print(\"melp\")\n"
+        "    if s == greet() then\n"
+        "        print(\"me\" + \"lp\")\n"
+        "    end_if\n"
+        "    return 0\n"
+        "end_function";
+    
+    int globals = generate_ir_count(source, "test_string_literal_pool",
+                                    "private unnamed_addr constant");
+    assert_test(globals == 1, "test_string_literal_pool", "Expected one @.str global for \"melp\"");
+}
+
+/* Test 42: strings only read by their statement live in the region and
+ * are released at the end of each iteration and before ret
+ */
+void test_string_temporaries() {
+    const char* source = 
+        "function main() as numeric\n"
+        "    string s = \"ab\"\n"
+        "    numeric i = 0\n"
+        "    while i < 3\n"
+        "        print(s + \"-\" + s + \"!\")\n"
+        "        i = i + length(s + s) - 3\n"
+        "    end_while\n"
+        "    return 0\n"
+        "end_function";
+    
+    int ok = generate_ir_count(source, "test_string_temporaries",
+                               "%region.mark = call i64 @mlp_region_enter()") == 1 &&
+             generate_ir_count(source, "test_string_temporaries",
+                               "call void @mlp_region_leave(i64 %region.mark)") == 2 &&
+             generate_ir_count(source, "test_string_temporaries", "_tmp(i8* %") == 3 &&
+             generate_ir_count(source, "test_string_temporaries", "call %MelpStr @mlp_str_concat(") == 0;
+    assert_test(ok, "test_string_temporaries", "Expected region concats, one mark, two leaves");
+}
+
+/* Test 43: a stored substring view is copied out of its temporary, a
+ * returned concatenation goes to the caller, which moves a result it only
+ * prints into the region; the argument is borrowed (a temporary), and
+ * main frees its variables before ret
+ */
+void test_string_escaping() {
+    const char* source = 
+        "function wrap(string s) as string\n"
+        "    return \"[\" + s + \"]\"\n"
+        "end_function\n"
+        "\n"
+        "function main() as numeric\n"
+        "    string s = \"ab\"\n"
+        "    string t = substring(s + \"cd\"; 1; 2)\n"
+        "    print(wrap(s + t))\n"
+        "    return 0\n"
+        "end_function";
+    
+    int ok = generate_ir_count(source, "test_string_escaping", "call %MelpStr @mlp_str_concat3(") == 1 &&
+             generate_ir_count(source, "test_string_escaping", "call %MelpStr @mlp_str_concat_tmp(") == 2 &&
+             generate_ir_count(source, "test_string_escaping", "call %MelpStr @mlp_str_own(") == 1 &&
+             generate_ir_count(source, "test_string_escaping", "call %MelpStr @mlp_str_to_tmp(") == 1 &&
+             generate_ir_count(source, "test_string_escaping", "call void @mlp_str_free(") == 2 &&
+             generate_ir_count(source, "test_string_escaping", "%region.mark = call") == 1;
+    assert_test(ok, "test_string_escaping", "Expected a copied view, a moved result and two frees");
+}
+
+/* ============================================================================
+ * TEST CASES - LISTS
+ * ============================================================================ */
+
+/* Test 44: xs[i] is a bounds check and a GEP, not a runtime call
+ * (3 literal stores, 2 loads, 1 store)
+ */
+void test_list_inline_access() {
+    const char* source = 
+        "function main() as numeric\n"
+        "    numeric[] xs = [4; 5; 6]\n"
+        "    xs[0] = xs[2] + 1\n"
+        "    return xs[0]\n"
+        "end_function";
+    
+    int geps = generate_ir_count(source, "test_list_inline_access",
+                                 "= getelementptr inbounds i64, i64* %");
+    int ok = geps == 6 &&
+             generate_ir_contains(source, "test_list_inline_access",
+                                  "call void @mlp_panic_array_bounds(i64 ") &&
+             generate_ir_count(source, "test_list_inline_access", "@melp_list_get") == 0;
+    assert_test(ok, "test_list_inline_access", "Expected inline bounds-checked GEPs");
+}
+
+/* Test 45: a loop that cannot resize xs loads its length once */
+void test_list_hoisted_bounds() {
+    const char* source = 
+        "function sum(numeric[] xs) as numeric\n"
+        "    numeric total = 0\n"
+        "    numeric i = 0\n"
+        "    while i < length(xs)\n"
+        "        total = total + xs[i]\n"
+        "        i = i + 1\n"
+        "    end_while\n"
+        "    return total\n"
+        "end_function\n"
+        "\n"
+        "function main() as numeric\n"
+        "    return sum([1; 2; 3])\n"
+        "end_function";
+    
+    // Length: one load of field 1, before the loop
+    int length_loads = generate_ir_count(source, "test_list_hoisted_bounds",
+                                         "%MelpList.i64* %1, i32 0, i32 1");
+    int ok = length_loads == 1 &&
+             generate_ir_contains(source, "test_list_hoisted_bounds", "icmp ult i64 %9, %5");
+    assert_test(ok, "test_list_hoisted_bounds", "Expected the length loaded in the preheader");
+}
+
+/* Test 46: append stores inline and grows through the runtime; an owned
+ * list is freed before ret
+ */
+void test_list_append_and_free() {
+    const char* source = 
+        "function main() as numeric\n"
+        "    numeric[] xs\n"
+        "    numeric i = 0\n"
+        "    while i < 10\n"
+        "        append(xs; i)\n"
+        "        i = i + 1\n"
+        "    end_while\n"
+        "    return length(xs)\n"
+        "end_function";
+    
+    int ok = generate_ir_contains(source, "test_list_append_and_free",
+                                  "call void @melp_list_grow_checked(i8* %") &&
+             generate_ir_count(source, "test_list_append_and_free", "call void @melp_list_free") == 1;
+    assert_test(ok, "test_list_append_and_free", "Expected inline append and one free");
+}
+
+/* Test 47: numeric[] bulk builtins call the vectorized runtime kernels on
+ * the list itself; a literal only passed to builtins lives on the stack
+ */
+void test_list_bulk_builtins() {
+    const char* source = 
+        "function main() as numeric\n"
+        "    numeric[] xs = [3; 1; 2]\n"
+        "    scale(xs; 2)\n"
+        "    prefix_sum(xs)\n"
+        "    return dot(xs; xs) + sum(xs)\n"
+        "end_function";
+    
+    int ok = generate_ir_contains(source, "test_list_bulk_builtins",
+                                  "declare i64 @mlp_array_dot(%MelpList.i64*, %MelpList.i64*)") &&
+             generate_ir_contains(source, "test_list_bulk_builtins",
+                                  "call void @mlp_array_scale(%MelpList.i64* %") &&
+             generate_ir_contains(source, "test_list_bulk_builtins",
+                                  "call void @mlp_array_prefix_sum(%MelpList.i64* %") &&
+             generate_ir_contains(source, "test_list_bulk_builtins",
+                                  "call i64 @mlp_array_sum(%MelpList.i64* %") &&
+             generate_ir_contains(source, "test_list_bulk_builtins",
+                                  "= alloca [3 x i64]") &&
+             generate_ir_count(source, "test_list_bulk_builtins", "call void @melp_list_free") == 0;
+    assert_test(ok, "test_list_bulk_builtins", "Expected kernel calls on a stack list");
+}
+
+/* Test 48: a returned local and a variable's last use move their list,
+ * list parameters and arguments are borrowed: one release in total
+ */
+void test_list_rc_moves_and_borrows() {
+    const char* source = 
+        "function make(numeric n) as numeric[]\n"
+        "    numeric[] xs\n"
+        "    append(xs; n)\n"
+        "    return xs\n"
+        "end_function\n"
+        "\n"
+        "function total(numeric[] xs) as numeric\n"
+        "    return sum(xs)\n"
+        "end_function\n"
+        "\n"
+        "function main() as numeric\n"
+        "    numeric[] a = make(1)\n"
+        "    numeric[] b = a\n"
+        "    return total(b)\n"
+        "end_function";
+    
+    int ok = generate_ir_count(source, "test_list_rc_moves_and_borrows",
+                               "call void @melp_list_retain") == 0 &&
+             generate_ir_count(source, "test_list_rc_moves_and_borrows",
+                               "call void @melp_list_release") == 1;
+    CodegenRcStats rc = get_codegen_rc_stats();
+    ok = ok && rc.elided_by_moves == 4 && rc.elided_by_borrows == 6;
+    printf("  %d retains, %d releases; elided: %d by moves, %d by borrows\n",
+           rc.retains, rc.releases, rc.elided_by_moves, rc.elided_by_borrows);
+    assert_test(ok, "test_list_rc_moves_and_borrows", "Expected moves and borrows, one release");
+}
+
+/* Test 49: a shared list is retained and released by both holders; the
+ * loop-local list and the literal only a builtin saw are stack lists,
+ * with no reference counting at all
+ */
+void test_list_rc_shared() {
+    const char* source = 
+        "function keep(numeric[] xs) as numeric[]\n"
+        "    return xs\n"
+        "end_function\n"
+        "\n"
+        "function main() as numeric\n"
+        "    numeric[] a = [1; 2]\n"
+        "    numeric[] b = keep(a)\n"
+        "    numeric i = 0\n"
+        "    while i < 3\n"
+        "        numeric[] row = [i]\n"
+        "        i = i + length(row) + sum([0])\n"
+        "    end_while\n"
+        "    return a[0] + b[0]\n"
+        "end_function";
+    
+    int ok = generate_ir_count(source, "test_list_rc_shared", "call void @melp_list_retain") == 1 &&
+             generate_ir_count(source, "test_list_rc_shared", "call void @melp_list_release") == 2 &&
+             generate_ir_count(source, "test_list_rc_shared", "call void @melp_list_free") == 0 &&
+             generate_ir_contains(source, "test_list_rc_shared", "; Reference counting: 1 retains");
+    assert_test(ok, "test_list_rc_shared", "Expected one retain, two releases and no free");
+}
+
+/* Test 50: escape analysis puts literals that cannot outlive main or grow
+ * in entry-block allocas (one per site, even inside a loop); appended and
+ * possibly returned ones stay on the heap
+ */
+void test_escape_stack_lists() {
+    const char* source = 
+        "function total(numeric[] xs) as numeric\n"
+        "    return sum(xs) + xs[0]\n"
+        "end_function\n"
+        "\n"
+        "function keep(numeric[] xs) as numeric[]\n"
+        "    return xs\n"
+        "end_function\n"
+        "\n"
+        "function main() as numeric\n"
+        "    numeric[] a = [1; 2; 3]\n"
+        "    numeric[] b = [4]\n"
+        "    append(b; 5)\n"
+        "    numeric i = 0\n"
+        "    while i < 3\n"
+        "        i = i + total([i; 1])\n"
+        "    end_while\n"
+        "    return total(a) + length(keep([6])) + b[1]\n"
+        "end_function";
+    
+    int ok = generate_ir_count(source, "test_escape_stack_lists", "= alloca [3 x i64]") == 1 &&
+             generate_ir_count(source, "test_escape_stack_lists", "= alloca [2 x i64]") == 1 &&
+             generate_ir_count(source, "test_escape_stack_lists", "call i8* @melp_list_create_zeroed") == 2 &&
+             generate_ir_contains(source, "test_escape_stack_lists",
+                                  "; Escape analysis: 2 list literals on the stack");
+    CodegenRcStats rc = get_codegen_rc_stats();
+    EscapeStats escapes = get_escape_stats();
+    ok = ok && rc.stack_lists == 2 && escapes.list_literals == 4 && escapes.stack_variables == 1;
+    printf("  %d of %d list literals on the stack\n", rc.stack_lists, escapes.list_literals);
+    assert_test(ok, "test_escape_stack_lists", "Expected [1; 2; 3] and [i; 1] on the stack");
+}
+
+/* Test 51: a reassigned string frees its old buffer (the concatenation
+ * that replaces it is moved in); a string[] keeps copies of the text,
+ * frees an element it overwrites and its text before ret
+ */
+void test_string_ownership() {
+    const char* source = 
+        "function main() as numeric\n"
+        "    string u = \"\"\n"
+        "    numeric i = 0\n"
+        "    while i < 3\n"
+        "        u = u + \"q\"\n"
+        "        print(u)\n"
+        "        i = i + 1\n"
+        "    end_while\n"
+        "    string[] words = [\"a\"; u]\n"
+        "    words[0] = u\n"
+        "    return length(u)\n"
+        "end_function";
+    
+    int ok = generate_ir_count(source, "test_string_ownership", "call %MelpStr @mlp_str_concat(") == 1 &&
+             generate_ir_count(source, "test_string_ownership", "call %MelpStr @mlp_str_own(") == 2 &&
+             generate_ir_count(source, "test_string_ownership", "call void @mlp_str_free(") == 3 &&
+             generate_ir_count(source, "test_string_ownership", "call void @melp_list_free_strings(") == 1;
+    assert_test(ok, "test_string_ownership", "Expected frees on reassignment, element store and ret");
+}
+
 /* ============================================================================
  * MAIN TEST RUNNER
  * ============================================================================ */
@@ -650,6 +1144,32 @@ int main() {
     test_complex_calculation();
     test_multiple_variables();
     
+    printf("\nRunning builtin tests...\n");
+    test_builtin_print();
+    test_builtin_shadowed();
+    
+    printf("\nRunning string tests...\n");
+    test_string_concat();
+    test_string_print();
+    test_string_loop_builder();
+    test_string_loop_read();
+    test_string_views();
+    test_string_equality_abi();
+    test_string_concat_folded();
+    test_string_literal_pool();
+    test_string_temporaries();
+    test_string_escaping();
+    
+    printf("\nRunning list tests...\n");
+    test_list_inline_access();
+    test_list_hoisted_bounds();
+    test_list_append_and_free();
+    test_list_bulk_builtins();
+    test_list_rc_moves_and_borrows();
+    test_list_rc_shared();
+    test_escape_stack_lists();
+    test_string_ownership();
+    
     // Print summary
     printf("\n");
     printf(COLOR_BLUE "================================================\n" COLOR_RESET);
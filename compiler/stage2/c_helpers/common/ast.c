@@ -6,6 +6,7 @@
  * Implementation of AST node creation and management functions.
  */
 
+#define _POSIX_C_SOURCE 200809L
 #include "ast.h"
 #include <stdio.h>
 #include <stdlib.h>
@@ -74,6 +75,7 @@ ASTNode* create_var_decl_node(const char* name, ASTNode* type, ASTNode* initiali
     node->data.var_decl.name = name;
     node->data.var_decl.type = type;
     node->data.var_decl.initializer = initializer;
+    node->data.var_decl.mem_location = MEM_LOCATION_HEAP;
     
     return node;
 }
@@ -184,6 +186,24 @@ ASTNode* create_literal_node(TokenType literal_type, long long int_value,
     return node;
 }
 
+/* Create string literal node (copies text: tokens are freed after parsing) */
+ASTNode* create_string_literal_node(const char* text, int line, int column) {
+    ASTNode* node = malloc(sizeof(ASTNode));
+    if (!node) return NULL;
+    
+    node->type = AST_LITERAL;
+    node->line = line;
+    node->column = column;
+    node->data.literal.literal_type = TOKEN_STRING;
+    node->data.literal.value.string_value = strdup(text ? text : "");
+    if (!node->data.literal.value.string_value) {
+        free(node);
+        return NULL;
+    }
+    
+    return node;
+}
+
 /* Create identifier node */
 ASTNode* create_identifier_node(const char* name, int line, int column) {
     ASTNode* node = malloc(sizeof(ASTNode));
@@ -197,6 +217,22 @@ ASTNode* create_identifier_node(const char* name, int line, int column) {
     return node;
 }
 
+/* Create index assignment node */
+ASTNode* create_index_assignment_node(const char* name, ASTNode* index, ASTNode* value,
+                                      int line, int column) {
+    ASTNode* node = malloc(sizeof(ASTNode));
+    if (!node) return NULL;
+    
+    node->type = AST_INDEX_ASSIGNMENT;
+    node->line = line;
+    node->column = column;
+    node->data.index_assignment.name = name;
+    node->data.index_assignment.index = index;
+    node->data.index_assignment.value = value;
+    
+    return node;
+}
+
 /* Create function call node */
 ASTNode* create_call_node(const char* name, ASTNode** arguments, int arg_count,
                           int line, int column) {
@@ -213,6 +249,36 @@ ASTNode* create_call_node(const char* name, ASTNode** arguments, int arg_count,
     return node;
 }
 
+/* Create index node */
+ASTNode* create_index_node(ASTNode* list, ASTNode* index, int line, int column) {
+    ASTNode* node = malloc(sizeof(ASTNode));
+    if (!node) return NULL;
+    
+    node->type = AST_INDEX;
+    node->line = line;
+    node->column = column;
+    node->data.index.list = list;
+    node->data.index.index = index;
+    
+    return node;
+}
+
+/* Create list literal node */
+ASTNode* create_list_literal_node(ASTNode** elements, int element_count,
+                                  int line, int column) {
+    ASTNode* node = malloc(sizeof(ASTNode));
+    if (!node) return NULL;
+    
+    node->type = AST_LIST_LITERAL;
+    node->line = line;
+    node->column = column;
+    node->data.list_literal.elements = elements;
+    node->data.list_literal.element_count = element_count;
+    node->data.list_literal.mem_location = MEM_LOCATION_HEAP;
+    
+    return node;
+}
+
 /* Create type node */
 ASTNode* create_type_node(TokenType type_token, int line, int column) {
     ASTNode* node = malloc(sizeof(ASTNode));
@@ -222,6 +288,17 @@ ASTNode* create_type_node(TokenType type_token, int line, int column) {
     node->line = line;
     node->column = column;
     node->data.type.type_token = type_token;
+    node->data.type.is_list = 0;
+    
+    return node;
+}
+
+/* Create list type node (element_token[]) */
+ASTNode* create_list_type_node(TokenType element_token, int line, int column) {
+    ASTNode* node = create_type_node(element_token, line, column);
+    if (!node) return NULL;
+    
+    node->data.type.is_list = 1;
     
     return node;
 }
@@ -282,6 +359,11 @@ void free_ast(ASTNode* node) {
             free_ast(node->data.assignment.value);
             break;
             
+        case AST_INDEX_ASSIGNMENT:
+            free_ast(node->data.index_assignment.index);
+            free_ast(node->data.index_assignment.value);
+            break;
+            
         case AST_IF:
             free_ast(node->data.if_stmt.condition);
             for (int i = 0; i < node->data.if_stmt.then_count; i++) {
@@ -312,7 +394,10 @@ void free_ast(ASTNode* node) {
             break;
             
         case AST_LITERAL:
-            /* Nothing to free (no dynamically allocated data) */
+            /* Only string literals own data */
+            if (node->data.literal.literal_type == TOKEN_STRING) {
+                free(node->data.literal.value.string_value);
+            }
             break;
             
         case AST_IDENTIFIER:
@@ -326,6 +411,18 @@ void free_ast(ASTNode* node) {
             free(node->data.call.arguments);
             break;
             
+        case AST_INDEX:
+            free_ast(node->data.index.list);
+            free_ast(node->data.index.index);
+            break;
+            
+        case AST_LIST_LITERAL:
+            for (int i = 0; i < node->data.list_literal.element_count; i++) {
+                free_ast(node->data.list_literal.elements[i]);
+            }
+            free(node->data.list_literal.elements);
+            break;
+            
         case AST_TYPE:
             /* Nothing to free */
             break;
@@ -350,6 +447,7 @@ const char* ast_node_type_name(ASTNodeType type) {
         case AST_RETURN: return "RETURN";
         case AST_VAR_DECL: return "VAR_DECL";
         case AST_ASSIGNMENT: return "ASSIGNMENT";
+        case AST_INDEX_ASSIGNMENT: return "INDEX_ASSIGNMENT";
         case AST_IF: return "IF";
         case AST_WHILE: return "WHILE";
         case AST_EXPR_STMT: return "EXPR_STMT";
@@ -358,6 +456,8 @@ const char* ast_node_type_name(ASTNodeType type) {
         case AST_LITERAL: return "LITERAL";
         case AST_IDENTIFIER: return "IDENTIFIER";
         case AST_FUNCTION_CALL: return "FUNCTION_CALL";
+        case AST_INDEX: return "INDEX";
+        case AST_LIST_LITERAL: return "LIST_LITERAL";
         case AST_TYPE: return "TYPE";
         case AST_PARAMETER: return "PARAMETER";
         default: return "UNKNOWN";
@@ -416,6 +516,14 @@ void print_ast(ASTNode* node, int indent) {
             print_ast(node->data.assignment.value, indent + 4);
             break;
             
+        case AST_INDEX_ASSIGNMENT:
+            printf("%*sname: %s\n", indent + 2, "", node->data.index_assignment.name);
+            printf("%*sindex:\n", indent + 2, "");
+            print_ast(node->data.index_assignment.index, indent + 4);
+            printf("%*svalue:\n", indent + 2, "");
+            print_ast(node->data.index_assignment.value, indent + 4);
+            break;
+            
         case AST_IF:
             printf("%*scondition:\n", indent + 2, "");
             print_ast(node->data.if_stmt.condition, indent + 4);
@@ -465,6 +573,9 @@ void print_ast(ASTNode* node, int indent) {
             if (node->data.literal.literal_type == TOKEN_NUMBER) {
                 printf("%*svalue: %lld\n", indent + 2, "",
                        node->data.literal.value.int_value);
+            } else if (node->data.literal.literal_type == TOKEN_STRING) {
+                printf("%*svalue: \"%s\"\n", indent + 2, "",
+                       node->data.literal.value.string_value);
             }
             break;
             
@@ -480,9 +591,24 @@ void print_ast(ASTNode* node, int indent) {
             }
             break;
             
+        case AST_INDEX:
+            printf("%*slist:\n", indent + 2, "");
+            print_ast(node->data.index.list, indent + 4);
+            printf("%*sindex:\n", indent + 2, "");
+            print_ast(node->data.index.index, indent + 4);
+            break;
+            
+        case AST_LIST_LITERAL:
+            printf("%*selements:\n", indent + 2, "");
+            for (int i = 0; i < node->data.list_literal.element_count; i++) {
+                print_ast(node->data.list_literal.elements[i], indent + 4);
+            }
+            break;
+            
         case AST_TYPE:
-            printf("%*stype: %s\n", indent + 2, "",
-                   token_type_name(node->data.type.type_token));
+            printf("%*stype: %s%s\n", indent + 2, "",
+                   token_type_name(node->data.type.type_token),
+                   node->data.type.is_list ? "[]" : "");
             break;
             
         case AST_PARAMETER:
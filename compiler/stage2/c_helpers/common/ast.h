@@ -25,8 +25,10 @@
  * 
  * Categories:
  * - Program Structure: PROGRAM, FUNCTION
- * - Statements: RETURN, VAR_DECL, ASSIGNMENT, IF, WHILE, EXPR_STMT
- * - Expressions: BINARY_OP, UNARY_OP, LITERAL, IDENTIFIER, FUNCTION_CALL
+ * - Statements: RETURN, VAR_DECL, ASSIGNMENT, INDEX_ASSIGNMENT, IF, WHILE,
+ *   EXPR_STMT
+ * - Expressions: BINARY_OP, UNARY_OP, LITERAL, IDENTIFIER, FUNCTION_CALL,
+ *   INDEX, LIST_LITERAL
  * - Types: TYPE
  * - Parameters: PARAMETER
  */
@@ -39,6 +41,7 @@ typedef enum {
     AST_RETURN,               /* return expression */
     AST_VAR_DECL,             /* numeric x = expr (with type) */
     AST_ASSIGNMENT,           /* x = expr (without type) */
+    AST_INDEX_ASSIGNMENT,     /* xs[i] = expr */
     AST_IF,                   /* if-then-else-end_if */
     AST_WHILE,                /* while-end_while */
     AST_EXPR_STMT,            /* Expression statement (function call) */
@@ -49,14 +52,26 @@ typedef enum {
     AST_LITERAL,              /* 42, true, false */
     AST_IDENTIFIER,           /* variable reference */
     AST_FUNCTION_CALL,        /* func(arg1; arg2; arg3) */
+    AST_INDEX,                /* xs[i] */
+    AST_LIST_LITERAL,         /* [1; 2; 3] */
     
     /* Types */
-    AST_TYPE,                 /* numeric, boolean */
+    AST_TYPE,                 /* numeric, boolean, numeric[] */
     
     /* Parameters & Arguments */
     AST_PARAMETER             /* name as type (in function declaration) */
 } ASTNodeType;
 
+/* Where a list's storage lives (mirrors STOTypeInfo.mem_location in
+ * runtime/sto/sto_types.h). The parser leaves every site on the heap;
+ * escape analysis (semantic/escape_analysis.h) moves the ones that cannot
+ * outlive their function to the stack.
+ */
+typedef enum {
+    MEM_LOCATION_HEAP = 0,    /* Runtime allocation (melp_list_create_zeroed) */
+    MEM_LOCATION_STACK        /* alloca in the function's entry block */
+} MemLocation;
+
 /* Forward declaration for self-referential structure */
 typedef struct ASTNode ASTNode;
 
@@ -126,6 +141,7 @@ struct ASTNode {
             const char* name;         /* Variable name (points to token) */
             ASTNode* type;            /* AST_TYPE node */
             ASTNode* initializer;     /* Expression (can be NULL) */
+            MemLocation mem_location; /* STACK: only ever holds its stack initializer */
         } var_decl;
         
         /* AST_ASSIGNMENT
@@ -138,6 +154,17 @@ struct ASTNode {
             ASTNode* value;           /* Expression */
         } assignment;
         
+        /* AST_INDEX_ASSIGNMENT
+         * Store into a list element.
+         * 
+         * Example: xs[i] = 100
+         */
+        struct {
+            const char* name;         /* List variable name (points to token) */
+            ASTNode* index;           /* Numeric expression */
+            ASTNode* value;           /* Expression (element type) */
+        } index_assignment;
+        
         /* AST_IF
          * If-then-else statement.
          * 
@@ -190,14 +217,15 @@ struct ASTNode {
         } unary_op;
         
         /* AST_LITERAL
-         * Literal value (number, boolean).
+         * Literal value (number, boolean, string).
          * 
-         * Example: 42, true, false
+         * Example: 42, true, false, "hello"
          */
         struct {
-            TokenType literal_type;   /* TOKEN_NUMBER, TOKEN_TRUE, TOKEN_FALSE */
+            TokenType literal_type;   /* TOKEN_NUMBER, TOKEN_TRUE, TOKEN_FALSE, TOKEN_STRING */
             union {
                 long long int_value;  /* For TOKEN_NUMBER */
+                char* string_value;   /* For TOKEN_STRING (owned copy, no quotes) */
             } value;
         } literal;
         
@@ -221,13 +249,35 @@ struct ASTNode {
             int argument_count;
         } call;
         
+        /* AST_INDEX
+         * List element read.
+         * 
+         * Example: xs[i], make_list()[0]
+         */
+        struct {
+            ASTNode* list;            /* List-typed expression */
+            ASTNode* index;           /* Numeric expression */
+        } index;
+        
+        /* AST_LIST_LITERAL
+         * List of elements (all of one type); [] takes the declared type.
+         * 
+         * Example: [1; 2; 3], []
+         */
+        struct {
+            ASTNode** elements;       /* Array of expression nodes */
+            int element_count;
+            MemLocation mem_location; /* Set by escape analysis (default HEAP) */
+        } list_literal;
+        
         /* AST_TYPE
-         * Type specifier.
+         * Type specifier; is_list marks a list of that element type.
          * 
-         * Example: numeric, boolean
+         * Example: numeric, boolean, string, numeric[]
          */
         struct {
-            TokenType type_token;     /* TOKEN_NUMERIC, TOKEN_BOOLEAN */
+            TokenType type_token;     /* TOKEN_NUMERIC, TOKEN_BOOLEAN, TOKEN_STRING_TYPE */
+            int is_list;              /* 1 for type_token[] */
         } type;
         
         /* AST_PARAMETER
@@ -259,6 +309,8 @@ ASTNode* create_return_node(ASTNode* expression, int line, int column);
 ASTNode* create_var_decl_node(const char* name, ASTNode* type, ASTNode* initializer,
                                int line, int column);
 ASTNode* create_assignment_node(const char* name, ASTNode* value, int line, int column);
+ASTNode* create_index_assignment_node(const char* name, ASTNode* index, ASTNode* value,
+                                      int line, int column);
 ASTNode* create_if_node(ASTNode* condition, ASTNode** then_body, int then_count,
                         ASTNode** else_body, int else_count, int line, int column);
 ASTNode* create_while_node(ASTNode* condition, ASTNode** body, int body_count,
@@ -271,12 +323,17 @@ ASTNode* create_binary_op_node(TokenType op, ASTNode* left, ASTNode* right,
 ASTNode* create_unary_op_node(TokenType op, ASTNode* operand, int line, int column);
 ASTNode* create_literal_node(TokenType literal_type, long long int_value,
                               int line, int column);
+ASTNode* create_string_literal_node(const char* text, int line, int column);
 ASTNode* create_identifier_node(const char* name, int line, int column);
 ASTNode* create_call_node(const char* name, ASTNode** arguments, int arg_count,
                           int line, int column);
+ASTNode* create_index_node(ASTNode* list, ASTNode* index, int line, int column);
+ASTNode* create_list_literal_node(ASTNode** elements, int element_count,
+                                  int line, int column);
 
 /* Create type and parameter nodes */
 ASTNode* create_type_node(TokenType type_token, int line, int column);
+ASTNode* create_list_type_node(TokenType element_token, int line, int column);
 ASTNode* create_parameter_node(const char* name, ASTNode* type, int line, int column);
 
 /* ============================================================================
@@ -42,6 +42,7 @@ typedef enum {
     TOKEN_VAR,              /* var (deprecated, use type directly) */
     TOKEN_NUMERIC,          /* numeric (type keyword) */
     TOKEN_BOOLEAN,          /* boolean (type keyword) */
+    TOKEN_STRING_TYPE,      /* string (type keyword) */
     
     /* === OPERATORS - Arithmetic === */
     TOKEN_PLUS,             /* + (addition) */
@@ -207,6 +207,9 @@ static TokenType identifier_type() {
         case 'r':
             if (length == 6) return check_keyword(1, 5, "eturn", TOKEN_RETURN);
             break;
+        case 's':
+            if (length == 6) return check_keyword(1, 5, "tring", TOKEN_STRING_TYPE);
+            break;
         case 't':
             if (length == 4) {
                 if (memcmp(scanner.start + 1, "hen", 3) == 0) return TOKEN_THEN;
@@ -519,6 +522,7 @@ const char* token_type_name(TokenType type) {
         case TOKEN_VAR: return "VAR";
         case TOKEN_NUMERIC: return "NUMERIC";
         case TOKEN_BOOLEAN: return "BOOLEAN";
+        case TOKEN_STRING_TYPE: return "STRING_TYPE";
         case TOKEN_PLUS: return "+";
         case TOKEN_MINUS: return "-";
         case TOKEN_STAR: return "*";
@@ -57,6 +57,9 @@ static ASTNode* parse_factor(void);
 static ASTNode* parse_unary(void);
 static ASTNode* parse_primary(void);
 static ASTNode* parse_call(const char* name, int line, int column);
+static ASTNode* parse_index_suffix(ASTNode* expr);
+static ASTNode* parse_list_literal(void);
+static ASTNode* parse_type(void);
 
 /* ============================================================================
  * UTILITY FUNCTIONS
@@ -102,6 +105,11 @@ static int match(TokenType type) {
     return 0;
 }
 
+/* Check if token type is a type keyword (numeric, boolean, string) */
+static int is_type_token(TokenType type) {
+    return type == TOKEN_NUMERIC || type == TOKEN_BOOLEAN || type == TOKEN_STRING_TYPE;
+}
+
 /* Skip newline tokens */
 static void skip_newlines(void) {
     while (match(TOKEN_NEWLINE)) {
@@ -191,6 +199,18 @@ static ASTNode* parse_program(void) {
     return create_program_node(functions, function_count, 1, 1);
 }
 
+/* Parse type: type_keyword ("[" "]")?  (current token is a type keyword) */
+static ASTNode* parse_type(void) {
+    Token* type_tok = advance();
+    if (match(TOKEN_LEFT_BRACKET)) {
+        if (!expect(TOKEN_RIGHT_BRACKET, "Expected ']' after '[' in list type")) {
+            return NULL;
+        }
+        return create_list_type_node(type_tok->type, type_tok->line, type_tok->column);
+    }
+    return create_type_node(type_tok->type, type_tok->line, type_tok->column);
+}
+
 /* Parse function: "function" IDENT "(" params? ")" "as" type statement* "end_function" */
 static ASTNode* parse_function(void) {
     Token* func_token = expect(TOKEN_FUNCTION, "Expected 'function'");
@@ -218,14 +238,18 @@ static ASTNode* parse_function(void) {
         do {
             /* Parse: type IDENT */
             TokenType type_token = current_token()->type;
-            if (type_token != TOKEN_NUMERIC && type_token != TOKEN_BOOLEAN) {
+            if (!is_type_token(type_token)) {
+                for (int i = 0; i < param_count; i++) free_ast(parameters[i]);
+                free(parameters);
+                expect(TOKEN_NUMERIC, "Expected parameter type (numeric, boolean or string)");
+                return NULL;
+            }
+            ASTNode* type_node = parse_type();
+            if (!type_node) {
                 for (int i = 0; i < param_count; i++) free_ast(parameters[i]);
                 free(parameters);
-                expect(TOKEN_NUMERIC, "Expected parameter type (numeric or boolean)");
                 return NULL;
             }
-            Token* type_tok = advance();
-            ASTNode* type_node = create_type_node(type_token, type_tok->line, type_tok->column);
             
             Token* param_name = expect(TOKEN_IDENTIFIER, "Expected parameter name");
             if (!param_name) {
@@ -271,14 +295,19 @@ static ASTNode* parse_function(void) {
     
     /* Parse return type */
     TokenType ret_type_token = current_token()->type;
-    if (ret_type_token != TOKEN_NUMERIC && ret_type_token != TOKEN_BOOLEAN) {
+    if (!is_type_token(ret_type_token)) {
+        for (int i = 0; i < param_count; i++) free_ast(parameters[i]);
+        free(parameters);
+        expect(TOKEN_NUMERIC, "Expected return type (numeric, boolean or string)");
+        return NULL;
+    }
+    Token* ret_type_tok = current_token();
+    ASTNode* return_type = parse_type();
+    if (!return_type) {
         for (int i = 0; i < param_count; i++) free_ast(parameters[i]);
         free(parameters);
-        expect(TOKEN_NUMERIC, "Expected return type (numeric or boolean)");
         return NULL;
     }
-    Token* ret_type_tok = advance();
-    ASTNode* return_type = create_type_node(ret_type_token, ret_type_tok->line, ret_type_tok->column);
     
     skip_newlines();
     
@@ -368,7 +397,7 @@ static ASTNode* parse_statement(void) {
     }
     
     /* Variable declaration (type IDENT ...) */
-    if (check(TOKEN_NUMERIC) || check(TOKEN_BOOLEAN)) {
+    if (is_type_token(current_token()->type)) {
         return parse_var_decl();
     }
     
@@ -393,13 +422,15 @@ static ASTNode* parse_statement(void) {
 
 /* Parse variable declaration: type IDENT ("=" expression)? NEWLINE */
 static ASTNode* parse_var_decl(void) {
-    TokenType type_token = current_token()->type;
-    Token* type_tok = advance();
+    ASTNode* type_node = parse_type();
+    if (!type_node) return NULL;
     
     Token* name_token = expect(TOKEN_IDENTIFIER, "Expected variable name");
-    if (!name_token) return NULL;
+    if (!name_token) {
+        free_ast(type_node);
+        return NULL;
+    }
     
-    ASTNode* type_node = create_type_node(type_token, type_tok->line, type_tok->column);
     ASTNode* initializer = NULL;
     
     /* Optional initializer */
@@ -421,10 +452,41 @@ static ASTNode* parse_var_decl(void) {
                                 name_token->line, name_token->column);
 }
 
-/* Parse assignment or expression statement: IDENT = expression | expression */
+/* Parse assignment or expression statement:
+ * IDENT = expression | IDENT "[" expression "]" = expression | expression
+ */
 static ASTNode* parse_assignment_or_expr(void) {
     Token* name_token = advance();  /* IDENTIFIER */
     
+    /* Check if element assignment (IDENT[index] = ...) */
+    if (check(TOKEN_LEFT_BRACKET)) {
+        int start = parser.current;
+        advance();  /* [ */
+        ASTNode* index = parse_expression();
+        if (!index) return NULL;
+        
+        if (match(TOKEN_RIGHT_BRACKET) && match(TOKEN_EQUAL)) {
+            ASTNode* value = parse_expression();
+            if (!value) {
+                free_ast(index);
+                return NULL;
+            }
+            
+            if (!expect(TOKEN_NEWLINE, "Expected newline after assignment")) {
+                free_ast(index);
+                free_ast(value);
+                return NULL;
+            }
+            
+            return create_index_assignment_node(name_token->lexeme, index, value,
+                                                name_token->line, name_token->column);
+        }
+        
+        /* An index expression: reparse the statement as an expression */
+        free_ast(index);
+        parser.current = start;
+    }
+    
     /* Check if assignment (IDENT = ...) */
     if (match(TOKEN_EQUAL)) {
         ASTNode* value = parse_expression();
@@ -802,7 +864,9 @@ static ASTNode* parse_unary(void) {
     return parse_primary();
 }
 
-/* Parse primary: NUMBER | "true" | "false" | IDENT | call | "(" expression ")" */
+/* Parse primary: NUMBER | STRING | "true" | "false" | IDENT | call | list
+ *                | "(" expression ")", the last four optionally indexed
+ */
 static ASTNode* parse_primary(void) {
     /* Number literal */
     if (match(TOKEN_NUMBER)) {
@@ -811,6 +875,12 @@ static ASTNode* parse_primary(void) {
                                    tok->line, tok->column);
     }
     
+    /* String literal */
+    if (match(TOKEN_STRING)) {
+        Token* tok = previous_token();
+        return create_string_literal_node(tok->value.str_value, tok->line, tok->column);
+    }
+    
     /* Boolean literals */
     if (match(TOKEN_TRUE)) {
         Token* tok = previous_token();
@@ -828,11 +898,18 @@ static ASTNode* parse_primary(void) {
         
         /* Check for function call */
         if (check(TOKEN_LEFT_PAREN)) {
-            return parse_call(name_token->lexeme, name_token->line, name_token->column);
+            return parse_index_suffix(parse_call(name_token->lexeme, name_token->line,
+                                                 name_token->column));
         }
         
-        /* Just an identifier */
-        return create_identifier_node(name_token->lexeme, name_token->line, name_token->column);
+        /* Just an identifier (possibly indexed) */
+        return parse_index_suffix(create_identifier_node(name_token->lexeme, name_token->line,
+                                                         name_token->column));
+    }
+    
+    /* List literal */
+    if (check(TOKEN_LEFT_BRACKET)) {
+        return parse_index_suffix(parse_list_literal());
     }
     
     /* Grouped expression */
@@ -845,7 +922,7 @@ static ASTNode* parse_primary(void) {
             return NULL;
         }
         
-        return expr;
+        return parse_index_suffix(expr);
     }
     
     /* Error: unexpected token */
@@ -911,6 +988,81 @@ static ASTNode* parse_call(const char* name, int line, int column) {
     return create_call_node(name, arguments, arg_count, line, column);
 }
 
+/* Parse index suffix: expr ("[" expression "]")* */
+static ASTNode* parse_index_suffix(ASTNode* expr) {
+    if (!expr) return NULL;
+    
+    while (check(TOKEN_LEFT_BRACKET)) {
+        Token* bracket = advance();
+        ASTNode* index = parse_expression();
+        if (!index) {
+            free_ast(expr);
+            return NULL;
+        }
+        
+        if (!expect(TOKEN_RIGHT_BRACKET, "Expected ']' after index")) {
+            free_ast(index);
+            free_ast(expr);
+            return NULL;
+        }
+        
+        expr = create_index_node(expr, index, bracket->line, bracket->column);
+    }
+    
+    return expr;
+}
+
+/* Parse list literal: "[" (expression (";" expression)*)? "]" */
+static ASTNode* parse_list_literal(void) {
+    Token* open = advance();  /* [ */
+    
+    ASTNode** elements = NULL;
+    int element_count = 0;
+    int element_capacity = 4;
+    
+    if (!check(TOKEN_RIGHT_BRACKET)) {
+        elements = malloc(sizeof(ASTNode*) * element_capacity);
+        if (!elements) {
+            error_at(open, "Out of memory allocating list elements");
+            return NULL;
+        }
+        
+        do {
+            ASTNode* element = parse_expression();
+            if (!element) {
+                for (int i = 0; i < element_count; i++) free_ast(elements[i]);
+                free(elements);
+                return NULL;
+            }
+            
+            /* Expand array if needed */
+            if (element_count >= element_capacity) {
+                element_capacity *= 2;
+                ASTNode** new_elements = realloc(elements, sizeof(ASTNode*) * element_capacity);
+                if (!new_elements) {
+                    free_ast(element);
+                    for (int i = 0; i < element_count; i++) free_ast(elements[i]);
+                    free(elements);
+                    error_at(current_token(), "Out of memory expanding list elements");
+                    return NULL;
+                }
+                elements = new_elements;
+            }
+            
+            elements[element_count++] = element;
+            
+        } while (match(TOKEN_SEMICOLON));
+    }
+    
+    if (!expect(TOKEN_RIGHT_BRACKET, "Expected ']' after list elements")) {
+        for (int i = 0; i < element_count; i++) free_ast(elements[i]);
+        free(elements);
+        return NULL;
+    }
+    
+    return create_list_literal_node(elements, element_count, open->line, open->column);
+}
+
 /* ============================================================================
  * PUBLIC API
  * ============================================================================ */
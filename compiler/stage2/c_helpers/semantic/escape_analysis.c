@@ -0,0 +1,421 @@
+/* MELP Stage 2 - Escape Analysis Implementation
+ * Date: 18 Ekim 2026
+ *
+ * A list variable is only tracked by name within its function. Any use of
+ * it other than as the list of an index, an index store or a call
+ * argument (a bare `return xs`, `ys = xs`, ...) counts as an escape.
+ */
+
+#include "escape_analysis.h"
+#include "semantic_analyzer.h"
+#include <ctype.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Parameters beyond the summary bits are assumed to escape and resize */
+#define ESCAPE_MAX_PARAMS 64
+
+/* What a function may do with the lists its callers pass */
+typedef struct FunctionSummary {
+    ASTNode* function;
+    uint64_t escapes;             /* Bit i: list parameter i may outlive the call */
+    uint64_t resizes;             /* Bit i: list parameter i may be appended to */
+} FunctionSummary;
+
+typedef struct EscapeContext {
+    FunctionSummary* summaries;   /* One per function, program order */
+    int function_count;
+    EscapeStats stats;
+} EscapeContext;
+
+/* Uses of one list variable in a function body */
+typedef struct VariableUses {
+    bool escapes;
+    bool resizes;
+    int declarations;
+    int assignments;
+} VariableUses;
+
+static EscapeStats g_escape_stats = {0};
+
+/* ============================================================================
+ * HELPERS
+ * ============================================================================ */
+
+/* Length of an identifier (parser names may not be NUL-terminated) */
+static size_t identifier_length(const char* name) {
+    size_t len = 0;
+    while (name && (isalnum((unsigned char)name[len]) || name[len] == '_')) {
+        len++;
+    }
+    return len;
+}
+
+static bool same_identifier(const char* a, const char* b) {
+    size_t len = identifier_length(a);
+    return len > 0 && len == identifier_length(b) && memcmp(a, b, len) == 0;
+}
+
+static bool is_variable(ASTNode* expr, const char* name) {
+    return expr && expr->type == AST_IDENTIFIER && same_identifier(expr->data.identifier.name, name);
+}
+
+/* Summary of the user function a call resolves to (NULL: a builtin) */
+static FunctionSummary* find_summary(EscapeContext* ctx, const char* name) {
+    for (int i = 0; i < ctx->function_count; i++) {
+        if (same_identifier(ctx->summaries[i].function->data.function.name, name)) {
+            return &ctx->summaries[i];
+        }
+    }
+    return NULL;
+}
+
+static bool is_append(ASTNode* call, EscapeContext* ctx) {
+    const BuiltinFunction* builtin = find_summary(ctx, call->data.call.name)
+                                     ? NULL : lookup_builtin_function(call->data.call.name);
+    return builtin && strcmp(builtin->name, "append") == 0;
+}
+
+static bool param_escapes(const FunctionSummary* summary, int index) {
+    return index >= ESCAPE_MAX_PARAMS || (summary->escapes >> index) & 1;
+}
+
+static bool param_resizes(const FunctionSummary* summary, int index) {
+    return index >= ESCAPE_MAX_PARAMS || (summary->resizes >> index) & 1;
+}
+
+/* ============================================================================
+ * VARIABLE USES
+ * ============================================================================ */
+
+static void scan_uses(ASTNode* node, const char* name, EscapeContext* ctx, VariableUses* uses);
+
+static void scan_uses_in(ASTNode** nodes, int count, const char* name, EscapeContext* ctx,
+                         VariableUses* uses) {
+    for (int i = 0; i < count; i++) {
+        scan_uses(nodes[i], name, ctx, uses);
+    }
+}
+
+/* Record what node does with list variable name */
+static void scan_uses(ASTNode* node, const char* name, EscapeContext* ctx, VariableUses* uses) {
+    if (!node) {
+        return;
+    }
+
+    switch (node->type) {
+        case AST_IDENTIFIER:
+            // Reached only where the list itself is the value
+            if (same_identifier(node->data.identifier.name, name)) {
+                uses->escapes = true;
+            }
+            break;
+        case AST_INDEX:
+            if (!is_variable(node->data.index.list, name)) {
+                scan_uses(node->data.index.list, name, ctx, uses);
+            }
+            scan_uses(node->data.index.index, name, ctx, uses);
+            break;
+        case AST_FUNCTION_CALL: {
+            FunctionSummary* callee = find_summary(ctx, node->data.call.name);
+            for (int i = 0; i < node->data.call.argument_count; i++) {
+                ASTNode* arg = node->data.call.arguments[i];
+                if (!is_variable(arg, name)) {
+                    scan_uses(arg, name, ctx, uses);
+                } else if (callee) {
+                    uses->escapes = uses->escapes || param_escapes(callee, i);
+                    uses->resizes = uses->resizes || param_resizes(callee, i);
+                } else if (i == 0 && is_append(node, ctx)) {
+                    uses->resizes = true;
+                }
+                // Other builtins only borrow their lists
+            }
+            break;
+        }
+        case AST_BINARY_OP:
+            scan_uses(node->data.binary_op.left, name, ctx, uses);
+            scan_uses(node->data.binary_op.right, name, ctx, uses);
+            break;
+        case AST_UNARY_OP:
+            scan_uses(node->data.unary_op.operand, name, ctx, uses);
+            break;
+        case AST_LIST_LITERAL:
+            scan_uses_in(node->data.list_literal.elements, node->data.list_literal.element_count,
+                         name, ctx, uses);
+            break;
+        case AST_VAR_DECL:
+            if (same_identifier(node->data.var_decl.name, name)) {
+                uses->declarations++;
+            }
+            scan_uses(node->data.var_decl.initializer, name, ctx, uses);
+            break;
+        case AST_ASSIGNMENT:
+            if (same_identifier(node->data.assignment.name, name)) {
+                uses->assignments++;
+            }
+            scan_uses(node->data.assignment.value, name, ctx, uses);
+            break;
+        case AST_INDEX_ASSIGNMENT:
+            scan_uses(node->data.index_assignment.index, name, ctx, uses);
+            scan_uses(node->data.index_assignment.value, name, ctx, uses);
+            break;
+        case AST_RETURN:
+        case AST_EXPR_STMT:
+            scan_uses(node->data.return_stmt.expression, name, ctx, uses);
+            break;
+        case AST_IF:
+            scan_uses(node->data.if_stmt.condition, name, ctx, uses);
+            scan_uses_in(node->data.if_stmt.then_body, node->data.if_stmt.then_count, name, ctx, uses);
+            scan_uses_in(node->data.if_stmt.else_body, node->data.if_stmt.else_count, name, ctx, uses);
+            break;
+        case AST_WHILE:
+            scan_uses(node->data.while_stmt.condition, name, ctx, uses);
+            scan_uses_in(node->data.while_stmt.body, node->data.while_stmt.body_count, name, ctx, uses);
+            break;
+        default:
+            break;
+    }
+}
+
+static VariableUses variable_uses(ASTNode* func, const char* name, EscapeContext* ctx) {
+    VariableUses uses = {0};
+    scan_uses_in(func->data.function.body, func->data.function.body_count, name, ctx, &uses);
+    return uses;
+}
+
+/* ============================================================================
+ * PARAMETER SUMMARIES
+ * ============================================================================ */
+
+/* Recompute one function's summary; returns true if it grew */
+static bool summarize_function(FunctionSummary* summary, EscapeContext* ctx) {
+    ASTNode* func = summary->function;
+    uint64_t escapes = summary->escapes;
+    uint64_t resizes = summary->resizes;
+
+    for (int i = 0; i < func->data.function.parameter_count && i < ESCAPE_MAX_PARAMS; i++) {
+        ASTNode* param = func->data.function.parameters[i];
+        if (!param->data.parameter.type->data.type.is_list) {
+            continue;
+        }
+        VariableUses uses = variable_uses(func, param->data.parameter.name, ctx);
+        if (uses.escapes) {
+            escapes |= (uint64_t)1 << i;
+        }
+        if (uses.resizes) {
+            resizes |= (uint64_t)1 << i;
+        }
+    }
+
+    bool grew = escapes != summary->escapes || resizes != summary->resizes;
+    summary->escapes = escapes;
+    summary->resizes = resizes;
+    return grew;
+}
+
+/* Start from "nothing escapes" and widen until no summary changes; flags
+ * only ever get set, so this terminates
+ */
+static void summarize_program(EscapeContext* ctx) {
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        ctx->stats.summary_passes++;
+        for (int i = 0; i < ctx->function_count; i++) {
+            if (summarize_function(&ctx->summaries[i], ctx)) {
+                changed = true;
+            }
+        }
+    }
+}
+
+/* ============================================================================
+ * PLACEMENT
+ * ============================================================================ */
+
+static void place_expression(ASTNode* expr, bool may_stack, EscapeContext* ctx);
+
+/* Type node of the stmts' declaration of name (nested blocks included), or NULL */
+static ASTNode* declared_type_in(ASTNode** stmts, int count, const char* name) {
+    for (int i = 0; i < count; i++) {
+        ASTNode* stmt = stmts[i];
+        ASTNode* type = NULL;
+        if (stmt->type == AST_VAR_DECL && same_identifier(stmt->data.var_decl.name, name)) {
+            type = stmt->data.var_decl.type;
+        } else if (stmt->type == AST_IF) {
+            type = declared_type_in(stmt->data.if_stmt.then_body, stmt->data.if_stmt.then_count, name);
+            if (!type) {
+                type = declared_type_in(stmt->data.if_stmt.else_body, stmt->data.if_stmt.else_count, name);
+            }
+        } else if (stmt->type == AST_WHILE) {
+            type = declared_type_in(stmt->data.while_stmt.body, stmt->data.while_stmt.body_count, name);
+        }
+        if (type) {
+            return type;
+        }
+    }
+    return NULL;
+}
+
+/* Is name a string[] parameter or variable of func? Such a list owns its
+ * elements' text, which codegen only frees for a stack list where it
+ * would free the list: at a stack variable's ret or after a temporary's
+ * use, never when a reassignment drops the list
+ */
+static bool is_string_list(ASTNode* func, const char* name) {
+    ASTNode* type = NULL;
+    for (int i = 0; i < func->data.function.parameter_count && !type; i++) {
+        ASTNode* param = func->data.function.parameters[i];
+        if (same_identifier(param->data.parameter.name, name)) {
+            type = param->data.parameter.type;
+        }
+    }
+    if (!type) {
+        type = declared_type_in(func->data.function.body, func->data.function.body_count, name);
+    }
+    return type && type->data.type.is_list && type->data.type.type_token == TOKEN_STRING_TYPE;
+}
+
+/* Can the list variable name of func hold a stack literal? */
+static bool variable_stays_local(ASTNode* func, const char* name, EscapeContext* ctx) {
+    VariableUses uses = variable_uses(func, name, ctx);
+    return !uses.escapes && !uses.resizes;
+}
+
+/* Place the literal expr if may_stack allows, then its subexpressions */
+static void place_expression(ASTNode* expr, bool may_stack, EscapeContext* ctx) {
+    if (!expr) {
+        return;
+    }
+
+    switch (expr->type) {
+        case AST_LIST_LITERAL:
+            ctx->stats.list_literals++;
+            if (may_stack && expr->data.list_literal.element_count <= ESCAPE_STACK_MAX_ELEMENTS) {
+                expr->data.list_literal.mem_location = MEM_LOCATION_STACK;
+                ctx->stats.stack_literals++;
+            }
+            for (int i = 0; i < expr->data.list_literal.element_count; i++) {
+                place_expression(expr->data.list_literal.elements[i], false, ctx);
+            }
+            break;
+        case AST_INDEX:
+            place_expression(expr->data.index.list, true, ctx);
+            place_expression(expr->data.index.index, false, ctx);
+            break;
+        case AST_FUNCTION_CALL: {
+            FunctionSummary* callee = find_summary(ctx, expr->data.call.name);
+            bool append = !callee && is_append(expr, ctx);
+            for (int i = 0; i < expr->data.call.argument_count; i++) {
+                bool borrowed = callee ? !param_escapes(callee, i) && !param_resizes(callee, i)
+                                       : !(append && i == 0);
+                place_expression(expr->data.call.arguments[i], borrowed, ctx);
+            }
+            break;
+        }
+        case AST_BINARY_OP:
+            place_expression(expr->data.binary_op.left, false, ctx);
+            place_expression(expr->data.binary_op.right, false, ctx);
+            break;
+        case AST_UNARY_OP:
+            place_expression(expr->data.unary_op.operand, false, ctx);
+            break;
+        default:
+            break;
+    }
+}
+
+static void place_statements(ASTNode* func, ASTNode** stmts, int count, EscapeContext* ctx);
+
+static void place_statement(ASTNode* func, ASTNode* stmt, EscapeContext* ctx) {
+    switch (stmt->type) {
+        case AST_VAR_DECL: {
+            ASTNode* initializer = stmt->data.var_decl.initializer;
+            const char* name = stmt->data.var_decl.name;
+            if (!stmt->data.var_decl.type->data.type.is_list) {
+                place_expression(initializer, false, ctx);
+                break;
+            }
+            // A string[] literal only goes on the stack as a stack variable
+            VariableUses uses = variable_uses(func, name, ctx);
+            bool only_value = uses.declarations == 1 && uses.assignments == 0;
+            place_expression(initializer, !uses.escapes && !uses.resizes &&
+                                          (only_value || !is_string_list(func, name)), ctx);
+
+            if (initializer && initializer->type == AST_LIST_LITERAL &&
+                initializer->data.list_literal.mem_location == MEM_LOCATION_STACK &&
+                uses.declarations == 1 && uses.assignments == 0) {
+                stmt->data.var_decl.mem_location = MEM_LOCATION_STACK;
+                ctx->stats.stack_variables++;
+            }
+            break;
+        }
+        case AST_ASSIGNMENT: {
+            // Only a list variable can take a list literal; an assigned
+            // string[] literal stays on the heap (see is_string_list)
+            ASTNode* value = stmt->data.assignment.value;
+            const char* name = stmt->data.assignment.name;
+            bool may_stack = value && value->type == AST_LIST_LITERAL &&
+                             variable_stays_local(func, name, ctx) && !is_string_list(func, name);
+            place_expression(value, may_stack, ctx);
+            break;
+        }
+        case AST_INDEX_ASSIGNMENT:
+            place_expression(stmt->data.index_assignment.index, false, ctx);
+            place_expression(stmt->data.index_assignment.value, false, ctx);
+            break;
+        case AST_RETURN:
+        case AST_EXPR_STMT:
+            place_expression(stmt->data.return_stmt.expression, false, ctx);
+            break;
+        case AST_IF:
+            place_expression(stmt->data.if_stmt.condition, false, ctx);
+            place_statements(func, stmt->data.if_stmt.then_body, stmt->data.if_stmt.then_count, ctx);
+            place_statements(func, stmt->data.if_stmt.else_body, stmt->data.if_stmt.else_count, ctx);
+            break;
+        case AST_WHILE:
+            place_expression(stmt->data.while_stmt.condition, false, ctx);
+            place_statements(func, stmt->data.while_stmt.body, stmt->data.while_stmt.body_count, ctx);
+            break;
+        default:
+            break;
+    }
+}
+
+static void place_statements(ASTNode* func, ASTNode** stmts, int count, EscapeContext* ctx) {
+    for (int i = 0; i < count; i++) {
+        place_statement(func, stmts[i], ctx);
+    }
+}
+
+/* ============================================================================
+ * MAIN API
+ * ============================================================================ */
+
+void analyze_escapes(ASTNode* program) {
+    EscapeContext ctx = {0};
+    ctx.function_count = program->data.program.function_count;
+    ctx.summaries = (FunctionSummary*)calloc(ctx.function_count ? ctx.function_count : 1,
+                                             sizeof(FunctionSummary));
+    if (!ctx.summaries) {
+        g_escape_stats = ctx.stats;
+        return;  // Everything stays on the heap
+    }
+    for (int i = 0; i < ctx.function_count; i++) {
+        ctx.summaries[i].function = program->data.program.functions[i];
+    }
+
+    summarize_program(&ctx);
+    for (int i = 0; i < ctx.function_count; i++) {
+        ASTNode* func = ctx.summaries[i].function;
+        place_statements(func, func->data.function.body, func->data.function.body_count, &ctx);
+    }
+
+    free(ctx.summaries);
+    g_escape_stats = ctx.stats;
+}
+
+EscapeStats get_escape_stats(void) {
+    return g_escape_stats;
+}
@@ -0,0 +1,65 @@
+#ifndef ESCAPE_ANALYSIS_H
+#define ESCAPE_ANALYSIS_H
+
+/* MELP Stage 2 - Escape Analysis
+ * Date: 18 Ekim 2026
+ *
+ * Decides which list literals can live in their function's stack frame
+ * instead of the heap (ASTNode mem_location, see common/ast.h).
+ *
+ * Design Principles:
+ * - Runs after a successful analysis: the program is well typed, every
+ *   call resolves to a user function or a builtin
+ * - Conservative: a list is only placed on the stack if no path can keep
+ *   it past its function's ret or grow its buffer
+ * - Interprocedural through summaries: one escapes/resizes flag per list
+ *   parameter, iterated to a fixed point (recursion included)
+ */
+
+#include "../common/ast.h"
+#include <stdbool.h>
+
+/* Largest list literal placed on the stack (elements); 256 strings are 4 KiB */
+#define ESCAPE_STACK_MAX_ELEMENTS 256
+
+/* Escape analysis results for the last analyzed program */
+typedef struct EscapeStats {
+    int list_literals;            /* List literal sites */
+    int stack_literals;           /* Sites placed on the stack (heap allocations removed) */
+    int stack_variables;          /* Declarations only ever holding their stack literal */
+    int summary_passes;           /* Passes until the parameter summaries were stable */
+} EscapeStats;
+
+/* Place the program's list literals
+ *
+ * Parameters:
+ *   program - Root AST node (AST_PROGRAM), semantically valid
+ *
+ * Behavior:
+ *   1. Summarizes every list parameter: escapes (returned, copied into
+ *      another variable, passed on to an escaping parameter) and resizes
+ *      (appended to, passed on to a resizing parameter)
+ *   2. Marks a literal MEM_LOCATION_STACK when at most
+ *      ESCAPE_STACK_MAX_ELEMENTS long and only used where it cannot
+ *      outlive the frame or grow: the list of an index, a builtin argument
+ *      other than append's list, an argument for a parameter that neither
+ *      escapes nor resizes, or the value of a variable that does neither
+ *      (a string[] variable only through a declaration that becomes a
+ *      stack variable: its elements' text is freed where the list would
+ *      be, which a reassignment never does)
+ *   3. Marks a list declaration MEM_LOCATION_STACK when its initializer is
+ *      on the stack and the variable is never assigned again (codegen then
+ *      has no reference to release)
+ *
+ * Example:
+ *   function main() as numeric
+ *       numeric[] weights = [3; 1; 2]     -- stack: only indexed and summed
+ *       return sum(weights) + weights[0]
+ *   end_function
+ */
+void analyze_escapes(ASTNode* program);
+
+/* Get the results of the last analyze_escapes call */
+EscapeStats get_escape_stats(void);
+
+#endif /* ESCAPE_ANALYSIS_H */
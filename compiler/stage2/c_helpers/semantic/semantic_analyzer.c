@@ -29,6 +29,108 @@ static void extract_clean_name(const char* name, char* buffer, size_t bufsize) {
     buffer[len] = '\0';
 }
 
+/* ============================================================================
+ * BUILTIN FUNCTIONS
+ * ============================================================================ */
+
+/* Builtin table (runtime/stdlib/mlp_io.c simple wrappers, string views)
+ * Rows sharing a name are overloads, chosen by argument types.
+ * char_at/substring return views into their argument where possible
+ * (mlp_string_view.c), so text loops do not allocate per character.
+ * split has no builtin: mlp_string_view_split's parts share one buffer,
+ * while each string[] element owns (and frees) its own text.
+ * List length/append have no runtime symbol: codegen inlines them.
+ * numeric[] bulk operations (sum, dot, fill, add, ...) call the vectorized
+ * kernels in runtime/stdlib/mlp_array.c; add/mul/scale update their first
+ * list in place.
+ */
+static const BuiltinFunction g_builtins[] = {
+    { "print", "mlp_println_numeric_simple", 1, { TYPE_INT }, TYPE_VOID },
+    { "print", "mlp_println_str", 1, { TYPE_STRING }, TYPE_VOID },
+    { "length", "mlp_str_length", 1, { TYPE_STRING }, TYPE_INT },
+    { "char_at", "mlp_str_char_at", 2, { TYPE_STRING, TYPE_INT }, TYPE_STRING },
+    { "substring", "mlp_str_substring", 3, { TYPE_STRING, TYPE_INT, TYPE_INT }, TYPE_STRING },
+    { "length", NULL, 1, { TYPE_INT_LIST }, TYPE_INT },
+    { "length", NULL, 1, { TYPE_BOOL_LIST }, TYPE_INT },
+    { "length", NULL, 1, { TYPE_STRING_LIST }, TYPE_INT },
+    { "append", NULL, 2, { TYPE_INT_LIST, TYPE_INT }, TYPE_VOID },
+    { "append", NULL, 2, { TYPE_BOOL_LIST, TYPE_BOOL }, TYPE_VOID },
+    { "append", NULL, 2, { TYPE_STRING_LIST, TYPE_STRING }, TYPE_VOID },
+    { "sum", "mlp_array_sum", 1, { TYPE_INT_LIST }, TYPE_INT },
+    { "min", "mlp_array_min", 1, { TYPE_INT_LIST }, TYPE_INT },
+    { "max", "mlp_array_max", 1, { TYPE_INT_LIST }, TYPE_INT },
+    { "dot", "mlp_array_dot", 2, { TYPE_INT_LIST, TYPE_INT_LIST }, TYPE_INT },
+    { "count_less", "mlp_array_count_less", 2, { TYPE_INT_LIST, TYPE_INT }, TYPE_INT },
+    { "count_equal", "mlp_array_count_equal", 2, { TYPE_INT_LIST, TYPE_INT }, TYPE_INT },
+    { "count_greater", "mlp_array_count_greater", 2, { TYPE_INT_LIST, TYPE_INT }, TYPE_INT },
+    { "fill", "mlp_array_fill", 2, { TYPE_INT_LIST, TYPE_INT }, TYPE_VOID },
+    { "copy", "mlp_array_copy", 2, { TYPE_INT_LIST, TYPE_INT_LIST }, TYPE_VOID },
+    { "scale", "mlp_array_scale", 2, { TYPE_INT_LIST, TYPE_INT }, TYPE_VOID },
+    { "add", "mlp_array_add", 2, { TYPE_INT_LIST, TYPE_INT_LIST }, TYPE_VOID },
+    { "mul", "mlp_array_mul", 2, { TYPE_INT_LIST, TYPE_INT_LIST }, TYPE_VOID },
+    { "prefix_sum", "mlp_array_prefix_sum", 1, { TYPE_INT_LIST }, TYPE_VOID },
+};
+
+#define BUILTIN_COUNT ((int)(sizeof(g_builtins) / sizeof(g_builtins[0])))
+
+const BuiltinFunction* lookup_builtin_function(const char* name) {
+    char clean_name[256];
+    extract_clean_name(name, clean_name, sizeof(clean_name));
+    
+    for (int i = 0; i < BUILTIN_COUNT; i++) {
+        if (strcmp(g_builtins[i].name, clean_name) == 0) {
+            return &g_builtins[i];
+        }
+    }
+    return NULL;
+}
+
+const BuiltinFunction* lookup_builtin_overload(const char* name, const TypeKind* arg_types,
+                                               int arg_count) {
+    char clean_name[256];
+    extract_clean_name(name, clean_name, sizeof(clean_name));
+    
+    for (int i = 0; i < BUILTIN_COUNT; i++) {
+        if (strcmp(g_builtins[i].name, clean_name) != 0 ||
+            g_builtins[i].param_count != arg_count) {
+            continue;
+        }
+        int matches = 1;
+        for (int j = 0; j < arg_count && matches; j++) {
+            matches = (g_builtins[i].param_types[j] == arg_types[j]);
+        }
+        if (matches) {
+            return &g_builtins[i];
+        }
+    }
+    return NULL;
+}
+
+int get_builtin_function_count(void) {
+    return BUILTIN_COUNT;
+}
+
+const BuiltinFunction* get_builtin_function(int index) {
+    if (index < 0 || index >= BUILTIN_COUNT) {
+        return NULL;
+    }
+    return &g_builtins[index];
+}
+
+/* Type singleton for a builtin's TypeKind */
+static Type* builtin_type(TypeKind kind) {
+    switch (kind) {
+        case TYPE_INT:  return create_int_type();
+        case TYPE_BOOL: return create_bool_type();
+        case TYPE_STRING: return create_string_type();
+        case TYPE_INT_LIST: return create_list_type(create_int_type());
+        case TYPE_BOOL_LIST: return create_list_type(create_bool_type());
+        case TYPE_STRING_LIST: return create_list_type(create_string_type());
+        case TYPE_VOID: return create_void_type();
+        default:        return create_unknown_type();
+    }
+}
+
 /* ============================================================================
  * SEMANTIC CONTEXT
  * ============================================================================ */
@@ -70,7 +172,10 @@ static void set_error(SemanticContext* ctx, const char* format, ...) {
 static bool analyze_function(ASTNode* func, SemanticContext* ctx);
 static bool analyze_statement(ASTNode* stmt, SemanticContext* ctx);
 static Type* analyze_expression(ASTNode* expr, SemanticContext* ctx);
+static Type* analyze_expression_as(ASTNode* expr, Type* expected, SemanticContext* ctx);
 static bool analyze_function_call(ASTNode* call, SemanticContext* ctx);
+static bool analyze_builtin_call(ASTNode* call, const BuiltinFunction* builtin,
+                                 SemanticContext* ctx);
 
 /* ============================================================================
  * EXPRESSION ANALYSIS
@@ -122,20 +227,32 @@ static Type* analyze_expression(ASTNode* expr, SemanticContext* ctx) {
             /* Special case: equality operators */
             if (expr->data.binary_op.op == TOKEN_EQUAL_EQUAL ||
                 expr->data.binary_op.op == TOKEN_NOT_EQUAL) {
-                /* Both operands must be same type (int or bool) */
+                /* Both operands must be same type (int, bool or string) */
                 if (!types_compatible(left_type, right_type)) {
                     set_error(ctx, "Line %d: equality operator expects same types, got %s and %s",
                              expr->line, type_to_string(left_type), type_to_string(right_type));
                     return create_error_type();
                 }
-                if (!is_numeric_type(left_type) && !is_boolean_type(left_type)) {
-                    set_error(ctx, "Line %d: equality operator expects numeric or boolean, got %s",
+                if (!is_numeric_type(left_type) && !is_boolean_type(left_type) &&
+                    !is_string_type(left_type)) {
+                    set_error(ctx, "Line %d: equality operator expects numeric, boolean or string, got %s",
                              expr->line, type_to_string(left_type));
                     return create_error_type();
                 }
                 return create_bool_type();
             }
             
+            /* Special case: string + string is concatenation */
+            if (expr->data.binary_op.op == TOKEN_PLUS &&
+                (is_string_type(left_type) || is_string_type(right_type))) {
+                if (!is_string_type(left_type) || !is_string_type(right_type)) {
+                    set_error(ctx, "Line %d: string concatenation expects string operands, got %s and %s",
+                             expr->line, type_to_string(left_type), type_to_string(right_type));
+                    return create_error_type();
+                }
+                return create_string_type();
+            }
+            
             /* Check operand types */
             if (!types_compatible(left_type, expected_type)) {
                 set_error(ctx, "Line %d: binary operator expects %s operands, got %s (left)",
@@ -183,7 +300,79 @@ static Type* analyze_expression(ASTNode* expr, SemanticContext* ctx) {
             return result_type;
         }
         
+        case AST_INDEX: {
+            /* xs[i]: list indexed by a number */
+            Type* list_type = analyze_expression(expr->data.index.list, ctx);
+            if (is_error_type(list_type)) {
+                return create_error_type();
+            }
+            if (!is_list_type(list_type)) {
+                set_error(ctx, "Line %d: cannot index %s (not a list)",
+                         expr->line, type_to_string(list_type));
+                return create_error_type();
+            }
+            
+            Type* index_type = analyze_expression(expr->data.index.index, ctx);
+            if (is_error_type(index_type)) {
+                return create_error_type();
+            }
+            if (!is_numeric_type(index_type)) {
+                set_error(ctx, "Line %d: list index must be numeric, got %s",
+                         expr->line, type_to_string(index_type));
+                return create_error_type();
+            }
+            
+            return list_element_type(list_type);
+        }
+        
+        case AST_LIST_LITERAL: {
+            /* [a; b; ...]: elements share the first element's type */
+            if (expr->data.list_literal.element_count == 0) {
+                set_error(ctx, "Line %d: cannot infer the element type of [] here",
+                         expr->line);
+                return create_error_type();
+            }
+            
+            Type* element_type = analyze_expression(expr->data.list_literal.elements[0], ctx);
+            if (is_error_type(element_type)) {
+                return create_error_type();
+            }
+            Type* list_type = create_list_type(element_type);
+            if (!is_list_type(list_type)) {
+                set_error(ctx, "Line %d: list elements must be numeric, boolean or string, got %s",
+                         expr->line, type_to_string(element_type));
+                return create_error_type();
+            }
+            
+            for (int i = 1; i < expr->data.list_literal.element_count; i++) {
+                Type* other = analyze_expression(expr->data.list_literal.elements[i], ctx);
+                if (is_error_type(other)) {
+                    return create_error_type();
+                }
+                if (!types_compatible(element_type, other)) {
+                    set_error(ctx, "Line %d: list element %d expects %s, got %s",
+                             expr->line, i + 1, type_to_string(element_type),
+                             type_to_string(other));
+                    return create_error_type();
+                }
+            }
+            
+            return list_type;
+        }
+        
         case AST_FUNCTION_CALL: {
+            /* Builtins (unless shadowed by a user function) */
+            const BuiltinFunction* builtin = NULL;
+            if (!lookup_symbol(ctx->current_table, expr->data.call.name)) {
+                builtin = lookup_builtin_function(expr->data.call.name);
+            }
+            if (builtin) {
+                if (!analyze_builtin_call(expr, builtin, ctx)) {
+                    return create_error_type();
+                }
+                return builtin_type(builtin->return_type);
+            }
+            
             /* Analyze function call (includes arg checking) */
             if (!analyze_function_call(expr, ctx)) {
                 return create_error_type();
@@ -205,6 +394,18 @@ static Type* analyze_expression(ASTNode* expr, SemanticContext* ctx) {
     }
 }
 
+/* Analyze an expression whose type the context fixes (initializer,
+ * assigned value, return value, argument): an empty list literal takes
+ * the expected list type.
+ */
+static Type* analyze_expression_as(ASTNode* expr, Type* expected, SemanticContext* ctx) {
+    if (expr && expr->type == AST_LIST_LITERAL &&
+        expr->data.list_literal.element_count == 0 && is_list_type(expected)) {
+        return expected;
+    }
+    return analyze_expression(expr, ctx);
+}
+
 /* ============================================================================
  * FUNCTION CALL ANALYSIS
  * ============================================================================ */
@@ -239,16 +440,16 @@ static bool analyze_function_call(ASTNode* call, SemanticContext* ctx) {
     
     /* Check argument types */
     for (int i = 0; i < call->data.call.argument_count; i++) {
-        Type* arg_type = analyze_expression(call->data.call.arguments[i], ctx);
+        /* Get parameter type */
+        Type* param_type = ast_type_to_type(func->parameters[i]->type_node);
+        
+        Type* arg_type = analyze_expression_as(call->data.call.arguments[i], param_type, ctx);
         
         /* Propagate error */
         if (is_error_type(arg_type)) {
             return false;
         }
         
-        /* Get parameter type */
-        Type* param_type = ast_type_to_type(func->parameters[i]->type_node);
-        
         /* Check compatibility */
         if (!types_compatible(arg_type, param_type)) {
             set_error(ctx, "Line %d: function '%s' argument %d expects %s, got %s",
@@ -261,6 +462,42 @@ static bool analyze_function_call(ASTNode* call, SemanticContext* ctx) {
     return true;
 }
 
+static bool analyze_builtin_call(ASTNode* call, const BuiltinFunction* builtin,
+                                 SemanticContext* ctx) {
+    int arg_count = call->data.call.argument_count;
+    if (arg_count != builtin->param_count) {
+        set_error(ctx, "Line %d: builtin '%s' expects %d argument%s, got %d",
+                 call->line, builtin->name, builtin->param_count,
+                 builtin->param_count == 1 ? "" : "s", arg_count);
+        return false;
+    }
+    
+    TypeKind arg_kinds[BUILTIN_MAX_PARAMS];
+    Type* arg_types[BUILTIN_MAX_PARAMS];
+    for (int i = 0; i < arg_count; i++) {
+        arg_types[i] = analyze_expression(call->data.call.arguments[i], ctx);
+        if (is_error_type(arg_types[i])) {
+            return false;
+        }
+        arg_kinds[i] = arg_types[i]->kind;
+    }
+    
+    /* Overload for the argument types (first row names the expected types) */
+    if (!lookup_builtin_overload(builtin->name, arg_kinds, arg_count)) {
+        int bad = 0;
+        while (bad < arg_count - 1 && builtin->param_types[bad] == arg_kinds[bad]) {
+            bad++;
+        }
+        set_error(ctx, "Line %d: builtin '%s' argument %d expects %s, got %s",
+                 call->line, builtin->name, bad + 1,
+                 type_to_string(builtin_type(builtin->param_types[bad])),
+                 type_to_string(arg_types[bad]));
+        return false;
+    }
+    
+    return true;
+}
+
 /* ============================================================================
  * STATEMENT ANALYSIS
  * ============================================================================ */
@@ -293,8 +530,9 @@ static bool analyze_statement(ASTNode* stmt, SemanticContext* ctx) {
             
             /* Check initializer type (if present) */
             if (stmt->data.var_decl.initializer) {
-                Type* init_type = analyze_expression(stmt->data.var_decl.initializer, ctx);
                 Type* var_type = ast_type_to_type(stmt->data.var_decl.type);
+                Type* init_type = analyze_expression_as(stmt->data.var_decl.initializer,
+                                                        var_type, ctx);
                 
                 if (is_error_type(init_type)) {
                     return false;
@@ -321,8 +559,8 @@ static bool analyze_statement(ASTNode* stmt, SemanticContext* ctx) {
             }
             
             /* Check assignment type compatibility */
-            Type* value_type = analyze_expression(stmt->data.assignment.value, ctx);
             Type* var_type = ast_type_to_type(var->type_node);
+            Type* value_type = analyze_expression_as(stmt->data.assignment.value, var_type, ctx);
             
             if (is_error_type(value_type)) {
                 return false;
@@ -338,6 +576,50 @@ static bool analyze_statement(ASTNode* stmt, SemanticContext* ctx) {
             return true;
         }
         
+        case AST_INDEX_ASSIGNMENT: {
+            /* xs[i] = value: xs must be a list variable */
+            char clean_name[256];
+            extract_clean_name(stmt->data.index_assignment.name, clean_name, sizeof(clean_name));
+            
+            Symbol* var = lookup_symbol(ctx->current_table, clean_name);
+            if (!var) {
+                set_error(ctx, "Line %d, column %d: undefined variable '%s'",
+                         stmt->line, stmt->column, clean_name);
+                return false;
+            }
+            
+            Type* list_type = ast_type_to_type(var->type_node);
+            if (!is_list_type(list_type)) {
+                set_error(ctx, "Line %d: cannot index %s variable '%s' (not a list)",
+                         stmt->line, type_to_string(list_type), clean_name);
+                return false;
+            }
+            
+            Type* index_type = analyze_expression(stmt->data.index_assignment.index, ctx);
+            if (is_error_type(index_type)) {
+                return false;
+            }
+            if (!is_numeric_type(index_type)) {
+                set_error(ctx, "Line %d: list index must be numeric, got %s",
+                         stmt->line, type_to_string(index_type));
+                return false;
+            }
+            
+            Type* element_type = list_element_type(list_type);
+            Type* value_type = analyze_expression(stmt->data.index_assignment.value, ctx);
+            if (is_error_type(value_type)) {
+                return false;
+            }
+            if (!types_compatible(element_type, value_type)) {
+                set_error(ctx, "Line %d: cannot store %s in %s '%s'",
+                         stmt->line, type_to_string(value_type),
+                         type_to_string(list_type), clean_name);
+                return false;
+            }
+            
+            return true;
+        }
+        
         case AST_IF: {
             /* Check condition type */
             Type* cond_type = analyze_expression(stmt->data.if_stmt.condition, ctx);
@@ -406,7 +688,8 @@ static bool analyze_statement(ASTNode* stmt, SemanticContext* ctx) {
             /* Check return value */
             if (stmt->data.return_stmt.expression) {
                 /* Return with value */
-                Type* return_type = analyze_expression(stmt->data.return_stmt.expression, ctx);
+                Type* return_type = analyze_expression_as(stmt->data.return_stmt.expression,
+                                                          func_return_type, ctx);
                 
                 if (is_error_type(return_type)) {
                     return false;
@@ -599,6 +882,9 @@ bool analyze_program(ASTNode* ast) {
         }
     }
     
+    /* Storage placement (needs the whole, valid program) */
+    analyze_escapes(ast);
+    
     /* Cleanup */
     free_symbol_table(ctx.global_table);
     
@@ -19,6 +19,7 @@
 #include "../parser/parser_impl.h"
 #include "symbol_table.h"
 #include "type_checker.h"
+#include "escape_analysis.h"
 #include <stdbool.h>
 
 /* ============================================================================
@@ -44,6 +45,8 @@
  *      - Type mismatches (operators, assignments, returns)
  *      - Function call validation (arg count, arg types)
  *      - Control flow type checking (if/while conditions)
+ *   5. Places list literals that cannot escape their function on the
+ *      stack (analyze_escapes, see escape_analysis.h)
  * 
  * Error Handling:
  *   - First error is recorded in error_message
@@ -84,6 +87,52 @@ bool analyze_program(ASTNode* ast);
  */
 bool analyze_program_from_source(const char* source);
 
+/* ============================================================================
+ * BUILTIN FUNCTIONS
+ * ============================================================================ */
+
+/* Builtin function provided by the runtime (runtime/stdlib)
+ *
+ * Builtins need no MLP declaration. A user function with the same name
+ * shadows the builtin. Codegen lowers a builtin call to a direct call of
+ * runtime_symbol, so the runtime can be linked (or inlined, see
+ * stage2_bootstrap --whole-program) like any other module. A NULL
+ * runtime_symbol means codegen emits the operation inline (list length
+ * and append work on the MelpList fields directly).
+ *
+ * Example: print(x)  →  call void @mlp_println_numeric_simple(i64 %x)
+ */
+#define BUILTIN_MAX_PARAMS 3
+
+typedef struct BuiltinFunction {
+    const char* name;             /* MLP name (e.g. "print") */
+    const char* runtime_symbol;   /* Runtime function called by codegen (NULL: inline) */
+    int param_count;
+    TypeKind param_types[BUILTIN_MAX_PARAMS];
+    TypeKind return_type;         /* TYPE_VOID for statements */
+} BuiltinFunction;
+
+/* Lookup builtin by (possibly non-terminated) identifier
+ *
+ * Returns:
+ *   Builtin descriptor, or NULL if name is not a builtin
+ */
+const BuiltinFunction* lookup_builtin_function(const char* name);
+
+/* Lookup the overload of a builtin taking exactly these argument types
+ *
+ * Returns:
+ *   Builtin descriptor, or NULL if no overload accepts them
+ *
+ * Example: print("hi")  →  call void @mlp_println_str(i8* %d, i64 %n)
+ */
+const BuiltinFunction* lookup_builtin_overload(const char* name, const TypeKind* arg_types,
+                                               int arg_count);
+
+/* Number of builtins and indexed access (for codegen declarations) */
+int get_builtin_function_count(void);
+const BuiltinFunction* get_builtin_function(int index);
+
 /* ============================================================================
  * ERROR REPORTING
  * ============================================================================ */
@@ -552,6 +552,298 @@ void test_equality_operators(void) {
     PASS();
 }
 
+void test_builtin_print(void) {
+    TEST("test_builtin_print");
+    
+    const char* source =
+        "function main() as numeric\n"
+        "  numeric x = 41\n"
+        "  print(x + 1)\n"
+        "  return 0\n"
+        "end_function\n";
+    
+    bool result = analyze_program_from_source(source);
+    ASSERT_TRUE(result, "print(numeric) builtin should be valid");
+    PASS();
+}
+
+void test_builtin_print_wrong_type(void) {
+    TEST("test_builtin_print_wrong_type");
+    
+    const char* source =
+        "function main() as numeric\n"
+        "  numeric x = print(1)\n"
+        "  return x\n"
+        "end_function\n";
+    
+    bool result = analyze_program_from_source(source);
+    ASSERT_FALSE(result, "print() has no value and cannot initialize numeric");
+    ASSERT_ERROR_CONTAINS("cannot initialize");
+    PASS();
+}
+
+void test_string_concat(void) {
+    TEST("test_string_concat");
+    
+    const char* source =
+        "function main() as numeric\n"
+        "  string s = \"a\"\n"
+        "  s = s + \"b\" + \"c\"\n"
+        "  print(s)\n"
+        "  return 0\n"
+        "end_function\n";
+    
+    bool result = analyze_program_from_source(source);
+    ASSERT_TRUE(result, "string + string and print(string) should be valid");
+    PASS();
+}
+
+void test_string_concat_wrong_type(void) {
+    TEST("test_string_concat_wrong_type");
+    
+    const char* source =
+        "function main() as numeric\n"
+        "  string s = \"a\" + 1\n"
+        "  return 0\n"
+        "end_function\n";
+    
+    bool result = analyze_program_from_source(source);
+    ASSERT_FALSE(result, "string + numeric should fail");
+    ASSERT_ERROR_CONTAINS("string concatenation");
+    PASS();
+}
+
+void test_string_view_builtins(void) {
+    TEST("test_string_view_builtins");
+    
+    const char* source =
+        "function main() as numeric\n"
+        "  string s = \"hello\"\n"
+        "  string t = substring(s; 1; 3) + char_at(s; 0)\n"
+        "  return length(t)\n"
+        "end_function\n";
+    
+    bool result = analyze_program_from_source(source);
+    ASSERT_TRUE(result, "substring/char_at/length should be valid");
+    PASS();
+}
+
+void test_string_view_builtins_wrong_args(void) {
+    TEST("test_string_view_builtins_wrong_args");
+    
+    const char* source =
+        "function main() as numeric\n"
+        "  string s = substring(\"hello\"; 1)\n"
+        "  return 0\n"
+        "end_function\n";
+    
+    bool result = analyze_program_from_source(source);
+    ASSERT_FALSE(result, "substring() with two arguments should fail");
+    ASSERT_ERROR_CONTAINS("expects 3 arguments");
+    
+    source =
+        "function main() as numeric\n"
+        "  string s = char_at(1; \"x\")\n"
+        "  return 0\n"
+        "end_function\n";
+    
+    result = analyze_program_from_source(source);
+    ASSERT_FALSE(result, "char_at(numeric; string) should fail");
+    ASSERT_ERROR_CONTAINS("argument 1 expects string");
+    PASS();
+}
+
+void test_typed_lists(void) {
+    TEST("test_typed_lists");
+    
+    const char* source =
+        "function first(string[] names) as string\n"
+        "  return names[0]\n"
+        "end_function\n"
+        "\n"
+        "function main() as numeric\n"
+        "  numeric[] xs = [1; 2; 3]\n"
+        "  boolean[] flags = []\n"
+        "  string[] names\n"
+        "  append(names; first([\"a\"; \"b\"]))\n"
+        "  append(flags; xs[0] < xs[1])\n"
+        "  xs[2] = xs[0] + length(xs)\n"
+        "  return xs[2] + length(names)\n"
+        "end_function\n";
+    
+    bool result = analyze_program_from_source(source);
+    ASSERT_TRUE(result, "list literals, indexing, length and append should be valid");
+    PASS();
+}
+
+void test_typed_lists_wrong_types(void) {
+    TEST("test_typed_lists_wrong_types");
+    
+    const char* source =
+        "function main() as numeric\n"
+        "  numeric[] xs = [1; true]\n"
+        "  return 0\n"
+        "end_function\n";
+    
+    bool result = analyze_program_from_source(source);
+    ASSERT_FALSE(result, "mixed list literal should fail");
+    ASSERT_ERROR_CONTAINS("list element 2 expects numeric");
+    
+    source =
+        "function main() as numeric\n"
+        "  numeric[] xs = []\n"
+        "  xs[0] = \"a\"\n"
+        "  return 0\n"
+        "end_function\n";
+    
+    result = analyze_program_from_source(source);
+    ASSERT_FALSE(result, "storing a string in numeric[] should fail");
+    ASSERT_ERROR_CONTAINS("cannot store string in numeric[] 'xs'");
+    
+    source =
+        "function main() as numeric\n"
+        "  numeric x = 1\n"
+        "  return x[0]\n"
+        "end_function\n";
+    
+    result = analyze_program_from_source(source);
+    ASSERT_FALSE(result, "indexing a number should fail");
+    ASSERT_ERROR_CONTAINS("cannot index numeric");
+    
+    source =
+        "function main() as numeric\n"
+        "  return length([])\n"
+        "end_function\n";
+    
+    result = analyze_program_from_source(source);
+    ASSERT_FALSE(result, "[] without a declared type should fail");
+    ASSERT_ERROR_CONTAINS("element type of []");
+    PASS();
+}
+
+void test_list_bulk_builtins(void) {
+    TEST("test_list_bulk_builtins");
+    
+    /* A user function named like a builtin (add) shadows it */
+    const char* source =
+        "function add(numeric a; numeric b) as numeric\n"
+        "  return a + b\n"
+        "end_function\n"
+        "\n"
+        "function main() as numeric\n"
+        "  numeric[] xs = [3; 1; 2]\n"
+        "  numeric[] ys = [1; 1; 1]\n"
+        "  scale(xs; 2)\n"
+        "  mul(xs; ys)\n"
+        "  prefix_sum(ys)\n"
+        "  fill(ys; 0)\n"
+        "  copy(ys; xs)\n"
+        "  return add(sum(xs) + dot(xs; ys); max(xs) - min(xs) + count_less(xs; 3))\n"
+        "end_function\n";
+    
+    bool result = analyze_program_from_source(source);
+    ASSERT_TRUE(result, "numeric[] bulk builtins should be valid");
+    
+    source =
+        "function main() as numeric\n"
+        "  boolean[] flags = [true]\n"
+        "  return sum(flags)\n"
+        "end_function\n";
+    
+    result = analyze_program_from_source(source);
+    ASSERT_FALSE(result, "sum(boolean[]) should fail");
+    ASSERT_ERROR_CONTAINS("argument 1 expects numeric[], got boolean[]");
+    
+    source =
+        "function main() as numeric\n"
+        "  numeric[] xs = [1]\n"
+        "  return dot(xs; 2)\n"
+        "end_function\n";
+    
+    result = analyze_program_from_source(source);
+    ASSERT_FALSE(result, "dot(numeric[]; numeric) should fail");
+    ASSERT_ERROR_CONTAINS("argument 2 expects numeric[], got numeric");
+    PASS();
+}
+
+void test_escape_analysis(void) {
+    TEST("test_escape_analysis");
+    
+    /* relay comes before keep: its summary needs a second pass */
+    const char* source =
+        "function relay(numeric[] xs) as numeric[]\n"
+        "  return keep(xs)\n"
+        "end_function\n"
+        "\n"
+        "function keep(numeric[] xs) as numeric[]\n"
+        "  return xs\n"
+        "end_function\n"
+        "\n"
+        "function grow(numeric[] xs) as numeric\n"
+        "  append(xs; 1)\n"
+        "  return length(xs)\n"
+        "end_function\n"
+        "\n"
+        "function total(numeric[] xs) as numeric\n"
+        "  return sum(xs) + xs[0]\n"
+        "end_function\n"
+        "\n"
+        "function main() as numeric\n"
+        "  numeric[] a = [1; 2; 3]\n"
+        "  numeric[] b = [4; 5]\n"
+        "  numeric[] c = [6]\n"
+        "  numeric t = total([7; 8]) + grow(b) + length(relay(c)) + a[0] + [9; 10][1]\n"
+        "  return t + length(keep([11]))\n"
+        "end_function\n";
+    
+    ASTNode* ast = parse(source);
+    ASSERT_TRUE(ast && analyze_program(ast), "program should be valid");
+    
+    ASTNode** body = ast->data.program.functions[4]->data.function.body;
+    EscapeStats stats = get_escape_stats();
+    bool placed = body[0]->data.var_decl.mem_location == MEM_LOCATION_STACK &&
+                  body[0]->data.var_decl.initializer->data.list_literal.mem_location == MEM_LOCATION_STACK &&
+                  body[1]->data.var_decl.initializer->data.list_literal.mem_location == MEM_LOCATION_HEAP &&
+                  body[2]->data.var_decl.initializer->data.list_literal.mem_location == MEM_LOCATION_HEAP &&
+                  body[2]->data.var_decl.mem_location == MEM_LOCATION_HEAP;
+    free_ast(ast);
+    
+    ASSERT_TRUE(placed, "a's literal should be on the stack, b's (appended) and c's (returned) on the heap");
+    ASSERT_TRUE(stats.list_literals == 6 && stats.stack_literals == 3 && stats.stack_variables == 1,
+                "[1; 2; 3], [7; 8] and [9; 10] should be the stack literals");
+    ASSERT_TRUE(stats.summary_passes >= 2, "relay's summary should need keep's");
+    
+    /* A string[] literal reaches the stack as a stack variable or a
+     * temporary, never as a value a reassignment drops
+     */
+    source =
+        "function main() as numeric\n"
+        "  string[] kept = [\"a\"]\n"
+        "  string[] w = [\"b\"]\n"
+        "  numeric i = 0\n"
+        "  while i < 3\n"
+        "    w = [\"c\"]\n"
+        "    i = i + length([\"d\"][0]) + length(kept[0])\n"
+        "  end_while\n"
+        "  return length(w[0])\n"
+        "end_function\n";
+    
+    ast = parse(source);
+    ASSERT_TRUE(ast && analyze_program(ast), "string[] program should be valid");
+    body = ast->data.program.functions[0]->data.function.body;
+    ASTNode* reassignment = body[3]->data.while_stmt.body[0];
+    placed = body[0]->data.var_decl.mem_location == MEM_LOCATION_STACK &&
+             body[1]->data.var_decl.initializer->data.list_literal.mem_location == MEM_LOCATION_HEAP &&
+             reassignment->data.assignment.value->data.list_literal.mem_location == MEM_LOCATION_HEAP;
+    stats = get_escape_stats();
+    free_ast(ast);
+    
+    ASSERT_TRUE(placed, "kept should be a stack variable, w's literals should stay on the heap");
+    ASSERT_TRUE(stats.list_literals == 4 && stats.stack_literals == 2 && stats.stack_variables == 1,
+                "[\"a\"] and [\"d\"] should be the stack literals");
+    PASS();
+}
+
 /* ============================================================================
  * MAIN TEST RUNNER
  * ============================================================================ */
@@ -598,6 +890,16 @@ int main(void) {
     test_multiple_functions();
     test_nested_control_flow();
     test_equality_operators();
+    test_builtin_print();
+    test_builtin_print_wrong_type();
+    test_string_concat();
+    test_string_concat_wrong_type();
+    test_string_view_builtins();
+    test_string_view_builtins_wrong_args();
+    test_typed_lists();
+    test_typed_lists_wrong_types();
+    test_list_bulk_builtins();
+    test_escape_analysis();
     
     /* Summary */
     printf("\n================================================================================\n");
@@ -14,6 +14,10 @@
 
 static Type type_int = { TYPE_INT };
 static Type type_bool = { TYPE_BOOL };
+static Type type_string = { TYPE_STRING };
+static Type type_int_list = { TYPE_INT_LIST };
+static Type type_bool_list = { TYPE_BOOL_LIST };
+static Type type_string_list = { TYPE_STRING_LIST };
 static Type type_void = { TYPE_VOID };
 static Type type_error = { TYPE_ERROR };
 static Type type_unknown = { TYPE_UNKNOWN };
@@ -30,6 +34,10 @@ Type* create_bool_type(void) {
     return &type_bool;
 }
 
+Type* create_string_type(void) {
+    return &type_string;
+}
+
 Type* create_void_type(void) {
     return &type_void;
 }
@@ -42,19 +50,53 @@ Type* create_unknown_type(void) {
     return &type_unknown;
 }
 
+Type* create_list_type(Type* element) {
+    if (!element) {
+        return create_unknown_type();
+    }
+    
+    switch (element->kind) {
+        case TYPE_INT:    return &type_int_list;
+        case TYPE_BOOL:   return &type_bool_list;
+        case TYPE_STRING: return &type_string_list;
+        default:          return create_unknown_type();
+    }
+}
+
+Type* list_element_type(Type* t) {
+    if (!t) {
+        return create_unknown_type();
+    }
+    
+    switch (t->kind) {
+        case TYPE_INT_LIST:    return create_int_type();
+        case TYPE_BOOL_LIST:   return create_bool_type();
+        case TYPE_STRING_LIST: return create_string_type();
+        default:               return create_unknown_type();
+    }
+}
+
 Type* ast_type_to_type(ASTNode* ast_type) {
     if (!ast_type || ast_type->type != AST_TYPE) {
         return create_unknown_type();
     }
     
+    Type* type;
     switch (ast_type->data.type.type_token) {
         case TOKEN_NUMERIC:
-            return create_int_type();
+            type = create_int_type();
+            break;
         case TOKEN_BOOLEAN:
-            return create_bool_type();
+            type = create_bool_type();
+            break;
+        case TOKEN_STRING_TYPE:
+            type = create_string_type();
+            break;
         default:
             return create_unknown_type();
     }
+    
+    return ast_type->data.type.is_list ? create_list_type(type) : type;
 }
 
 /* ============================================================================
@@ -75,6 +117,8 @@ Type* get_expression_type(ASTNode* expr, SymbolTable* table) {
                 case TOKEN_TRUE:
                 case TOKEN_FALSE:
                     return create_bool_type();
+                case TOKEN_STRING:
+                    return create_string_type();
                 default:
                     return create_error_type();
             }
@@ -114,18 +158,25 @@ Type* get_expression_type(ASTNode* expr, SymbolTable* table) {
                 return create_error_type();
             }
             
-            /* Special case: equality operators accept int OR bool */
+            /* Special case: equality operators accept int, bool OR string */
             if (expr->data.binary_op.op == TOKEN_EQUAL_EQUAL ||
                 expr->data.binary_op.op == TOKEN_NOT_EQUAL) {
-                /* Both operands must be same type (int or bool) */
+                /* Both operands must be same type */
                 if (types_compatible(left_type, right_type)) {
-                    if (is_numeric_type(left_type) || is_boolean_type(left_type)) {
+                    if (is_numeric_type(left_type) || is_boolean_type(left_type) ||
+                        is_string_type(left_type)) {
                         return create_bool_type();
                     }
                 }
                 return create_error_type();
             }
             
+            /* Special case: + on strings is concatenation */
+            if (expr->data.binary_op.op == TOKEN_PLUS &&
+                is_string_type(left_type) && is_string_type(right_type)) {
+                return create_string_type();
+            }
+            
             /* Check operand types match expected type */
             if (!types_compatible(left_type, expected_type) ||
                 !types_compatible(right_type, expected_type)) {
@@ -163,6 +214,32 @@ Type* get_expression_type(ASTNode* expr, SymbolTable* table) {
             return result_type;
         }
         
+        case AST_INDEX: {
+            /* Element type of the indexed list */
+            Type* list_type = get_expression_type(expr->data.index.list, table);
+            Type* index_type = get_expression_type(expr->data.index.index, table);
+            if (!is_list_type(list_type) || !is_numeric_type(index_type)) {
+                return create_error_type();
+            }
+            return list_element_type(list_type);
+        }
+        
+        case AST_LIST_LITERAL: {
+            /* Every element has the first element's type ([] is untyped) */
+            if (expr->data.list_literal.element_count == 0) {
+                return create_error_type();
+            }
+            Type* element_type = get_expression_type(expr->data.list_literal.elements[0], table);
+            for (int i = 1; i < expr->data.list_literal.element_count; i++) {
+                Type* other = get_expression_type(expr->data.list_literal.elements[i], table);
+                if (other->kind != element_type->kind) {
+                    return create_error_type();
+                }
+            }
+            Type* list_type = create_list_type(element_type);
+            return list_type->kind == TYPE_UNKNOWN ? create_error_type() : list_type;
+        }
+        
         case AST_FUNCTION_CALL: {
             /* Lookup function in symbol table */
             Symbol* func = lookup_symbol(table, expr->data.call.name);
@@ -203,6 +280,15 @@ bool is_boolean_type(Type* t) {
     return t && t->kind == TYPE_BOOL;
 }
 
+bool is_string_type(Type* t) {
+    return t && t->kind == TYPE_STRING;
+}
+
+bool is_list_type(Type* t) {
+    return t && (t->kind == TYPE_INT_LIST || t->kind == TYPE_BOOL_LIST ||
+                 t->kind == TYPE_STRING_LIST);
+}
+
 bool is_void_type(Type* t) {
     return t && t->kind == TYPE_VOID;
 }
@@ -223,6 +309,10 @@ const char* type_to_string(Type* t) {
     switch (t->kind) {
         case TYPE_INT:     return "numeric";
         case TYPE_BOOL:    return "boolean";
+        case TYPE_STRING:  return "string";
+        case TYPE_INT_LIST:    return "numeric[]";
+        case TYPE_BOOL_LIST:   return "boolean[]";
+        case TYPE_STRING_LIST: return "string[]";
         case TYPE_VOID:    return "void";
         case TYPE_ERROR:   return "error";
         case TYPE_UNKNOWN: return "unknown";
@@ -9,7 +9,7 @@
  * This header defines the type system and type checking functions.
  * 
  * Design Principles:
- * - Simple type representation (numeric, boolean, void)
+ * - Simple type representation (numeric, boolean, string, void)
  * - Type compatibility checking
  * - Type inference from expressions
  * - Clear error propagation
@@ -27,6 +27,10 @@
  * 
  * TYPE_INT     - 64-bit signed integer (PMLP: "numeric")
  * TYPE_BOOL    - Boolean true/false (PMLP: "boolean")
+ * TYPE_STRING  - Immutable text (PMLP: "string"), a C string at runtime
+ * TYPE_INT_LIST, TYPE_BOOL_LIST, TYPE_STRING_LIST
+ *              - Growable list of one element type (PMLP: "numeric[]" ...),
+ *                a MelpList at runtime; shared by reference
  * TYPE_VOID    - No value (function return only)
  * TYPE_ERROR   - Error sentinel (for error propagation)
  * TYPE_UNKNOWN - Unresolved type (should not appear in final analysis)
@@ -34,6 +38,10 @@
 typedef enum {
     TYPE_INT,
     TYPE_BOOL,
+    TYPE_STRING,
+    TYPE_INT_LIST,
+    TYPE_BOOL_LIST,
+    TYPE_STRING_LIST,
     TYPE_VOID,
     TYPE_ERROR,
     TYPE_UNKNOWN
@@ -56,14 +64,22 @@ typedef struct Type {
 /* Create type instances (returns static singletons for efficiency) */
 Type* create_int_type(void);
 Type* create_bool_type(void);
+Type* create_string_type(void);
 Type* create_void_type(void);
 Type* create_error_type(void);
 Type* create_unknown_type(void);
 
+/* List of element (numeric, boolean or string); TYPE_UNKNOWN otherwise */
+Type* create_list_type(Type* element);
+
+/* Element type of a list type; TYPE_UNKNOWN if t is not a list */
+Type* list_element_type(Type* t);
+
 /* Convert AST type node to Type
  * 
  * Parameters:
- *   ast_type - AST_TYPE node (TOKEN_NUMERIC or TOKEN_BOOLEAN)
+ *   ast_type - AST_TYPE node (TOKEN_NUMERIC, TOKEN_BOOLEAN or TOKEN_STRING_TYPE,
+ *              a list of it if is_list)
  * 
  * Returns:
  *   Type* - Corresponding type
@@ -86,8 +102,10 @@ Type* ast_type_to_type(ASTNode* ast_type);
  *   TYPE_ERROR if expression is invalid (undefined variable, type mismatch, etc.)
  * 
  * Behavior:
- *   - Literals: 42 → TYPE_INT, true → TYPE_BOOL
+ *   - Literals: 42 → TYPE_INT, true → TYPE_BOOL, "hi" → TYPE_STRING
+ *   - List literals: [1; 2] → TYPE_INT_LIST ([] has no type: TYPE_ERROR)
  *   - Variables: Lookup in symbol table
+ *   - Indexing: xs[i] → element type of xs
  *   - Binary ops: Check operand types, compute result type
  *   - Unary ops: Check operand type, compute result type
  *   - Function calls: Check argument types, return function's return type
@@ -108,6 +126,7 @@ Type* get_expression_type(ASTNode* expr, SymbolTable* table);
  * Compatibility rules:
  *   - TYPE_INT == TYPE_INT
  *   - TYPE_BOOL == TYPE_BOOL
+ *   - TYPE_STRING == TYPE_STRING
  *   - TYPE_VOID == TYPE_VOID
  *   - TYPE_ERROR is compatible with anything (error propagation)
  *   - All other combinations are incompatible
@@ -120,6 +139,12 @@ bool is_numeric_type(Type* t);
 /* Check if type is boolean */
 bool is_boolean_type(Type* t);
 
+/* Check if type is string */
+bool is_string_type(Type* t);
+
+/* Check if type is a list (numeric[], boolean[] or string[]) */
+bool is_list_type(Type* t);
+
 /* Check if type is void */
 bool is_void_type(Type* t);
 
@@ -145,8 +170,10 @@ const char* type_to_string(Type* t);
  * 
  * Operator Type Rules:
  *   - Arithmetic (+, -, *, /, mod): int × int → int
+ *     (+ also concatenates: string × string → string, see
+ *      get_expression_type)
  *   - Comparison (<, >, <=, >=):    int × int → bool
- *   - Equality (==, !=):            int × int → bool OR bool × bool → bool
+ *   - Equality (==, !=):            same type (int, bool or string) → bool
  *   - Logical (and, or):            bool × bool → bool
  */
 Type* get_binary_op_expected_type(TokenType op, Type** result_type);
@@ -0,0 +1,753 @@
+/* MELP Stage 2 - Persistent Compile Server Implementation
+ * Date: 18 Ekim 2026
+ *
+ * Keeps one compiler process alive across build-system invocations:
+ * - Unix socket listener with a fixed worker pool (accept() per worker)
+ * - Warm result cache: generated IR keyed by (input path, source hash)
+ * - Per-request latency statistics (min/max/mean + p50/p90/p99 window)
+ *
+ * The compile pipeline is reached only through the CompileServerFn callback,
+ * so this module stays a peer of lexer/parser/semantic/codegen.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "compile_server.h"
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Largest accepted request (paths + keywords) */
+#define MAX_REQUEST_SIZE 8192
+
+/* Hash buckets for the result cache (power of two) */
+#define CACHE_BUCKETS 1024
+
+/* FNV-1a constants (same hash as the runtime map) */
+#define FNV_OFFSET_BASIS 14695981039346656037ULL
+#define FNV_PRIME 1099511628211ULL
+
+/* ============================================================================
+ * SERVER STATE
+ * ============================================================================ */
+
+/* Cached compilation result for one input path */
+typedef struct CacheEntry {
+    char* input_path;            /* Owned copy of absolute input path */
+    uint64_t source_hash;        /* FNV-1a hash of the source text */
+    char* ir;                    /* Generated LLVM IR */
+    size_t ir_length;
+    uint64_t last_used;          /* LRU tick */
+    struct CacheEntry* next;     /* Bucket chain */
+} CacheEntry;
+
+typedef struct CompileServer {
+    const CompileServerConfig* config;
+    CompileServerFn compile_fn;
+    int listen_fd;
+    atomic_bool stopping;
+
+    /* Pipeline has global state (parser, codegen buffers): one at a time */
+    pthread_mutex_t pipeline_lock;
+    atomic_uint_fast64_t next_ir_file;   /* Names private IR files */
+
+    /* Warm cache */
+    pthread_mutex_t cache_lock;
+    CacheEntry* buckets[CACHE_BUCKETS];
+    size_t cache_count;
+    uint64_t cache_tick;
+
+    /* Statistics */
+    pthread_mutex_t stats_lock;
+    CompileServerStats stats;
+    uint64_t window[COMPILE_SERVER_LATENCY_WINDOW];
+    size_t window_count;
+    size_t window_pos;
+} CompileServer;
+
+/* ============================================================================
+ * UTILITY FUNCTIONS
+ * ============================================================================ */
+
+static uint64_t fnv1a(const char* data, size_t length) {
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (uint64_t)(unsigned char)data[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+static uint64_t now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000ULL;
+}
+
+/* Read whole file into a malloc'ed buffer */
+static char* read_whole_file(const char* path, size_t* out_length) {
+    FILE* file = fopen(path, "rb");
+    if (!file) return NULL;
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (size < 0) {
+        fclose(file);
+        return NULL;
+    }
+
+    char* buffer = malloc((size_t)size + 1);
+    if (!buffer) {
+        fclose(file);
+        return NULL;
+    }
+
+    size_t read_size = fread(buffer, 1, (size_t)size, file);
+    buffer[read_size] = '\0';
+    fclose(file);
+
+    *out_length = read_size;
+    return buffer;
+}
+
+static bool write_whole_file(const char* path, const char* data, size_t length) {
+    FILE* file = fopen(path, "wb");
+    if (!file) return false;
+    size_t written = fwrite(data, 1, length, file);
+    bool ok = (written == length);
+    if (fclose(file) != 0) ok = false;
+    return ok;
+}
+
+static bool send_all(int fd, const char* data, size_t length) {
+    while (length > 0) {
+        ssize_t n = send(fd, data, length, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        data += n;
+        length -= (size_t)n;
+    }
+    return true;
+}
+
+/* Receive until the request is complete (or peer closes)
+ * COMPILE requests end with "END\n", other commands with the first newline.
+ */
+static bool recv_request(int fd, char* buffer, size_t capacity) {
+    size_t length = 0;
+    buffer[0] = '\0';
+
+    while (length < capacity - 1) {
+        ssize_t n = recv(fd, buffer + length, capacity - 1 - length, 0);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        if (n == 0) break;
+        length += (size_t)n;
+        buffer[length] = '\0';
+
+        if (strncmp(buffer, "COMPILE\n", 8) == 0) {
+            if (strstr(buffer, "\nEND\n")) return true;
+        } else if (strchr(buffer, '\n')) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static int connect_to_server(const char* socket_path) {
+    struct sockaddr_un addr;
+    if (strlen(socket_path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "Error: socket path too long: %s\n", socket_path);
+        return -1;
+    }
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) return -1;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, socket_path);
+
+    if (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/* Receive everything until the peer closes the connection */
+static char* recv_all(int fd, size_t* out_length) {
+    size_t capacity = 4096;
+    size_t length = 0;
+    char* buffer = malloc(capacity);
+    if (!buffer) return NULL;
+
+    for (;;) {
+        if (length + 1 >= capacity) {
+            capacity *= 2;
+            char* grown = realloc(buffer, capacity);
+            if (!grown) {
+                free(buffer);
+                return NULL;
+            }
+            buffer = grown;
+        }
+        ssize_t n = recv(fd, buffer + length, capacity - 1 - length, 0);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            free(buffer);
+            return NULL;
+        }
+        if (n == 0) break;
+        length += (size_t)n;
+    }
+
+    buffer[length] = '\0';
+    *out_length = length;
+    return buffer;
+}
+
+/* ============================================================================
+ * WARM CACHE
+ * ============================================================================ */
+
+static CacheEntry** cache_slot(CompileServer* server, const char* input_path) {
+    uint64_t hash = fnv1a(input_path, strlen(input_path));
+    CacheEntry** slot = &server->buckets[hash & (CACHE_BUCKETS - 1)];
+    while (*slot && strcmp((*slot)->input_path, input_path) != 0) {
+        slot = &(*slot)->next;
+    }
+    return slot;
+}
+
+static void cache_free_entry(CacheEntry* entry) {
+    free(entry->input_path);
+    free(entry->ir);
+    free(entry);
+}
+
+/* Evict least recently used entry (caller holds cache_lock) */
+static void cache_evict_lru(CompileServer* server) {
+    CacheEntry** victim = NULL;
+    for (size_t i = 0; i < CACHE_BUCKETS; i++) {
+        for (CacheEntry** slot = &server->buckets[i]; *slot; slot = &(*slot)->next) {
+            if (!victim || (*slot)->last_used < (*victim)->last_used) {
+                victim = slot;
+            }
+        }
+    }
+    if (victim) {
+        CacheEntry* entry = *victim;
+        *victim = entry->next;
+        cache_free_entry(entry);
+        server->cache_count--;
+    }
+}
+
+/* Copy cached IR for (path, hash) into *out_ir. Returns true on hit. */
+static bool cache_lookup(CompileServer* server, const char* input_path,
+                         uint64_t source_hash, char** out_ir, size_t* out_length) {
+    bool hit = false;
+    pthread_mutex_lock(&server->cache_lock);
+
+    CacheEntry* entry = *cache_slot(server, input_path);
+    if (entry && entry->source_hash == source_hash) {
+        *out_ir = malloc(entry->ir_length + 1);
+        if (*out_ir) {
+            memcpy(*out_ir, entry->ir, entry->ir_length + 1);
+            *out_length = entry->ir_length;
+            entry->last_used = ++server->cache_tick;
+            hit = true;
+        }
+    }
+
+    pthread_mutex_unlock(&server->cache_lock);
+    return hit;
+}
+
+/* Insert or replace cached IR (takes ownership of ir) */
+static void cache_store(CompileServer* server, const char* input_path,
+                        uint64_t source_hash, char* ir, size_t ir_length) {
+    pthread_mutex_lock(&server->cache_lock);
+
+    CacheEntry** slot = cache_slot(server, input_path);
+    if (*slot) {
+        free((*slot)->ir);
+        (*slot)->ir = ir;
+        (*slot)->ir_length = ir_length;
+        (*slot)->source_hash = source_hash;
+        (*slot)->last_used = ++server->cache_tick;
+        pthread_mutex_unlock(&server->cache_lock);
+        return;
+    }
+
+    if (server->cache_count >= COMPILE_SERVER_CACHE_CAPACITY) {
+        cache_evict_lru(server);
+        slot = cache_slot(server, input_path);
+    }
+
+    CacheEntry* entry = malloc(sizeof(CacheEntry));
+    char* path_copy = strdup(input_path);
+    if (!entry || !path_copy) {
+        free(entry);
+        free(path_copy);
+        free(ir);
+        pthread_mutex_unlock(&server->cache_lock);
+        return;
+    }
+
+    entry->input_path = path_copy;
+    entry->source_hash = source_hash;
+    entry->ir = ir;
+    entry->ir_length = ir_length;
+    entry->last_used = ++server->cache_tick;
+    entry->next = NULL;
+    *slot = entry;
+    server->cache_count++;
+
+    pthread_mutex_unlock(&server->cache_lock);
+}
+
+static void cache_clear(CompileServer* server) {
+    for (size_t i = 0; i < CACHE_BUCKETS; i++) {
+        CacheEntry* entry = server->buckets[i];
+        while (entry) {
+            CacheEntry* next = entry->next;
+            cache_free_entry(entry);
+            entry = next;
+        }
+        server->buckets[i] = NULL;
+    }
+    server->cache_count = 0;
+}
+
+/* ============================================================================
+ * STATISTICS
+ * ============================================================================ */
+
+static void stats_record(CompileServer* server, uint64_t latency_us, bool hit, bool ok) {
+    pthread_mutex_lock(&server->stats_lock);
+
+    CompileServerStats* s = &server->stats;
+    s->requests++;
+    if (hit) s->cache_hits++; else s->cache_misses++;
+    if (!ok) s->failures++;
+    s->total_us += latency_us;
+    if (s->requests == 1 || latency_us < s->min_us) s->min_us = latency_us;
+    if (latency_us > s->max_us) s->max_us = latency_us;
+
+    server->window[server->window_pos] = latency_us;
+    server->window_pos = (server->window_pos + 1) % COMPILE_SERVER_LATENCY_WINDOW;
+    if (server->window_count < COMPILE_SERVER_LATENCY_WINDOW) server->window_count++;
+
+    pthread_mutex_unlock(&server->stats_lock);
+}
+
+static int compare_u64(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a;
+    uint64_t y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+/* Snapshot statistics with percentiles over the recent window */
+static CompileServerStats stats_snapshot(CompileServer* server) {
+    uint64_t sorted[COMPILE_SERVER_LATENCY_WINDOW];
+
+    pthread_mutex_lock(&server->stats_lock);
+    CompileServerStats snapshot = server->stats;
+    size_t count = server->window_count;
+    memcpy(sorted, server->window, count * sizeof(uint64_t));
+    pthread_mutex_unlock(&server->stats_lock);
+
+    if (count > 0) {
+        qsort(sorted, count, sizeof(uint64_t), compare_u64);
+        snapshot.p50_us = sorted[(count - 1) * 50 / 100];
+        snapshot.p90_us = sorted[(count - 1) * 90 / 100];
+        snapshot.p99_us = sorted[(count - 1) * 99 / 100];
+    }
+    return snapshot;
+}
+
+void compile_server_format_stats(const CompileServerStats* stats, FILE* out) {
+    uint64_t mean = stats->requests ? stats->total_us / stats->requests : 0;
+
+    fprintf(out, "=== MELP Compile Server Statistics ===\n");
+    fprintf(out, "Requests:     %llu\n", (unsigned long long)stats->requests);
+    fprintf(out, "Cache hits:   %llu\n", (unsigned long long)stats->cache_hits);
+    fprintf(out, "Cache misses: %llu\n", (unsigned long long)stats->cache_misses);
+    fprintf(out, "Failures:     %llu\n", (unsigned long long)stats->failures);
+    fprintf(out, "Latency (us): min %llu / mean %llu / max %llu\n",
+            (unsigned long long)stats->min_us, (unsigned long long)mean,
+            (unsigned long long)stats->max_us);
+    fprintf(out, "Percentiles:  p50 %llu / p90 %llu / p99 %llu\n",
+            (unsigned long long)stats->p50_us, (unsigned long long)stats->p90_us,
+            (unsigned long long)stats->p99_us);
+}
+
+/* ============================================================================
+ * REQUEST HANDLING
+ * ============================================================================ */
+
+/* Parse "KEY value\n" line value out of a COMPILE request */
+static const char* request_field(char* request, const char* key) {
+    size_t key_length = strlen(key);
+    char* line = request;
+    while (line && *line) {
+        char* end = strchr(line, '\n');
+        if (end) *end = '\0';
+        if (strncmp(line, key, key_length) == 0 && line[key_length] == ' ') {
+            return line + key_length + 1;
+        }
+        line = end ? end + 1 : NULL;
+    }
+    return NULL;
+}
+
+/* Run the pipeline on the source that was hashed, into a private IR file
+ * read back before the lock is released (the output path may be shared by
+ * other requests, and the input may change on disk meanwhile)
+ */
+static bool compile_miss(CompileServer* server, CompileRequest* req, const char* source,
+                         FILE* diag, char** out_ir, size_t* out_length) {
+    char ir_file[MAX_REQUEST_SIZE + 64];
+    snprintf(ir_file, sizeof(ir_file), "%s.%ld.%llu.tmp", req->output_file, (long)getpid(),
+             (unsigned long long)atomic_fetch_add(&server->next_ir_file, 1));
+    req->source = source;
+    req->ir_file = ir_file;
+
+    pthread_mutex_lock(&server->pipeline_lock);
+    bool ok = server->compile_fn(req, diag);
+    if (ok) {
+        *out_ir = read_whole_file(ir_file, out_length);
+        ok = *out_ir != NULL;
+        if (!ok) fprintf(diag, "Error: Cannot read generated IR '%s'\n", ir_file);
+    }
+    pthread_mutex_unlock(&server->pipeline_lock);
+
+    remove(ir_file);
+    return ok;
+}
+
+/* Serve one COMPILE request, write STATUS + diagnostics back */
+static void handle_compile(CompileServer* server, int fd, char* request) {
+    uint64_t start = now_us();
+
+    /* request_field() cuts lines in place, so search on separate copies */
+    char input_buf[MAX_REQUEST_SIZE], output_buf[MAX_REQUEST_SIZE], verbose_buf[MAX_REQUEST_SIZE];
+    strcpy(input_buf, request);
+    strcpy(output_buf, request);
+    strcpy(verbose_buf, request);
+    const char* input_file = request_field(input_buf, "INPUT");
+    const char* output_file = request_field(output_buf, "OUTPUT");
+    const char* verbose = request_field(verbose_buf, "VERBOSE");
+
+    char* diag_text = NULL;
+    size_t diag_length = 0;
+    FILE* diag = open_memstream(&diag_text, &diag_length);
+
+    bool ok = false;
+    bool hit = false;
+
+    if (!diag) {
+        send_all(fd, "STATUS 1 0 MISS\nError: out of memory\n", 37);
+        return;
+    }
+
+    if (!input_file || !output_file) {
+        fprintf(diag, "Error: malformed compile request\n");
+    } else {
+        CompileRequest req = {
+            .input_file = input_file,
+            .output_file = output_file,
+            .verbose = verbose && strcmp(verbose, "1") == 0
+        };
+
+        size_t source_length = 0;
+        char* source = read_whole_file(input_file, &source_length);
+        if (!source) {
+            fprintf(diag, "Error: Cannot open file '%s'\n", input_file);
+        } else {
+            uint64_t source_hash = fnv1a(source, source_length);
+
+            char* ir = NULL;
+            size_t ir_length = 0;
+            if (cache_lookup(server, input_file, source_hash, &ir, &ir_length)) {
+                hit = true;
+            } else {
+                ok = compile_miss(server, &req, source, diag, &ir, &ir_length);
+            }
+            free(source);
+
+            if (hit || ok) {
+                ok = write_whole_file(output_file, ir, ir_length);
+                if (!ok) {
+                    fprintf(diag, "Error: Failed to open output file: %s\n", output_file);
+                } else if (hit && req.verbose) {
+                    fprintf(diag, "  ✓ Warm cache hit, LLVM IR written to '%s'\n", output_file);
+                }
+                if (ok && !hit) {
+                    cache_store(server, input_file, source_hash, ir, ir_length);
+                } else {
+                    free(ir);
+                }
+            }
+        }
+    }
+
+    fclose(diag);
+    uint64_t latency = now_us() - start;
+    stats_record(server, latency, hit, ok);
+
+    if (server->config->verbose) {
+        fprintf(stderr, "[server] %s %s %lluus\n", input_file ? input_file : "(invalid)",
+                hit ? "HIT" : (ok ? "MISS" : "FAIL"), (unsigned long long)latency);
+    }
+
+    char header[96];
+    int header_length = snprintf(header, sizeof(header), "STATUS %d %llu %s\n",
+                                 ok ? 0 : 1, (unsigned long long)latency, hit ? "HIT" : "MISS");
+    send_all(fd, header, (size_t)header_length);
+    if (diag_text) {
+        send_all(fd, diag_text, diag_length);
+        free(diag_text);
+    }
+}
+
+static void handle_stats(CompileServer* server, int fd) {
+    CompileServerStats snapshot = stats_snapshot(server);
+
+    char* text = NULL;
+    size_t length = 0;
+    FILE* out = open_memstream(&text, &length);
+    if (!out) return;
+    fprintf(out, "STATUS 0 0 -\n");
+    compile_server_format_stats(&snapshot, out);
+    fclose(out);
+
+    send_all(fd, text, length);
+    free(text);
+}
+
+static void handle_connection(CompileServer* server, int fd) {
+    char request[MAX_REQUEST_SIZE];
+
+    if (!recv_request(fd, request, sizeof(request))) {
+        send_all(fd, "STATUS 1 0 MISS\nError: malformed request\n", 41);
+        return;
+    }
+
+    if (strncmp(request, "COMPILE\n", 8) == 0) {
+        handle_compile(server, fd, request);
+    } else if (strncmp(request, "STATS\n", 6) == 0) {
+        handle_stats(server, fd);
+    } else if (strncmp(request, "SHUTDOWN\n", 9) == 0) {
+        atomic_store(&server->stopping, true);
+        send_all(fd, "STATUS 0 0 -\n", 13);
+        /* Wake up workers blocked in accept() */
+        shutdown(server->listen_fd, SHUT_RDWR);
+    } else {
+        send_all(fd, "STATUS 1 0 MISS\nError: unknown command\n", 39);
+    }
+}
+
+static void* worker_main(void* arg) {
+    CompileServer* server = (CompileServer*)arg;
+
+    while (!atomic_load(&server->stopping)) {
+        int fd = accept(server->listen_fd, NULL, NULL);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            break;  /* Listener shut down */
+        }
+        handle_connection(server, fd);
+        close(fd);
+    }
+    return NULL;
+}
+
+/* ============================================================================
+ * MAIN API IMPLEMENTATION
+ * ============================================================================ */
+
+int compile_server_run(const CompileServerConfig* config, CompileServerFn compile_fn) {
+    if (!config || !config->socket_path || !compile_fn) return 1;
+
+    struct sockaddr_un addr;
+    if (strlen(config->socket_path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "Error: socket path too long: %s\n", config->socket_path);
+        return 1;
+    }
+
+    CompileServer* server = calloc(1, sizeof(CompileServer));
+    if (!server) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return 1;
+    }
+    server->config = config;
+    server->compile_fn = compile_fn;
+    atomic_init(&server->stopping, false);
+    atomic_init(&server->next_ir_file, 0);
+    pthread_mutex_init(&server->pipeline_lock, NULL);
+    pthread_mutex_init(&server->cache_lock, NULL);
+    pthread_mutex_init(&server->stats_lock, NULL);
+
+    server->listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (server->listen_fd < 0) {
+        perror("socket");
+        free(server);
+        return 1;
+    }
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, config->socket_path);
+    unlink(config->socket_path);  /* Stale socket from a previous run */
+
+    if (bind(server->listen_fd, (struct sockaddr*)&addr, sizeof(addr)) < 0 ||
+        listen(server->listen_fd, 64) < 0) {
+        perror("bind/listen");
+        close(server->listen_fd);
+        free(server);
+        return 1;
+    }
+
+    int worker_count = config->worker_count > 0 ? config->worker_count
+                                                : COMPILE_SERVER_DEFAULT_WORKERS;
+    pthread_t* workers = malloc(sizeof(pthread_t) * (size_t)worker_count);
+    int started = 0;
+    for (int i = 0; workers && i < worker_count; i++) {
+        if (pthread_create(&workers[i], NULL, worker_main, server) != 0) break;
+        started++;
+    }
+
+    if (config->verbose) {
+        fprintf(stderr, "[server] listening on %s (%d workers)\n",
+                config->socket_path, started);
+    }
+
+    if (started == 0) {
+        worker_main(server);  /* Degrade to single-threaded serving */
+    }
+    for (int i = 0; i < started; i++) {
+        pthread_join(workers[i], NULL);
+    }
+    free(workers);
+
+    CompileServerStats snapshot = stats_snapshot(server);
+    compile_server_format_stats(&snapshot, stderr);
+
+    close(server->listen_fd);
+    unlink(config->socket_path);
+    cache_clear(server);
+    pthread_mutex_destroy(&server->pipeline_lock);
+    pthread_mutex_destroy(&server->cache_lock);
+    pthread_mutex_destroy(&server->stats_lock);
+    free(server);
+    return 0;
+}
+
+/* ============================================================================
+ * CLIENT IMPLEMENTATION
+ * ============================================================================ */
+
+/* Make path absolute relative to the client's working directory */
+static bool absolute_path(const char* path, char* buffer, size_t size) {
+    if (path[0] == '/') {
+        return (size_t)snprintf(buffer, size, "%s", path) < size;
+    }
+    char cwd[4096];
+    if (!getcwd(cwd, sizeof(cwd))) return false;
+    return (size_t)snprintf(buffer, size, "%s/%s", cwd, path) < size;
+}
+
+/* Send a command, receive full reply; returns reply body after STATUS line */
+static char* client_roundtrip(const char* socket_path, const char* request,
+                              int* status, uint64_t* latency_us) {
+    int fd = connect_to_server(socket_path);
+    if (fd < 0) {
+        fprintf(stderr, "Error: Cannot connect to compile server at '%s'\n", socket_path);
+        return NULL;
+    }
+
+    if (!send_all(fd, request, strlen(request))) {
+        close(fd);
+        return NULL;
+    }
+
+    size_t length = 0;
+    char* reply = recv_all(fd, &length);
+    close(fd);
+    if (!reply) return NULL;
+
+    unsigned long long latency = 0;
+    if (sscanf(reply, "STATUS %d %llu", status, &latency) != 2) {
+        fprintf(stderr, "Error: Malformed reply from compile server\n");
+        free(reply);
+        return NULL;
+    }
+    if (latency_us) *latency_us = latency;
+
+    char* body = strchr(reply, '\n');
+    body = body ? body + 1 : reply + length;
+    memmove(reply, body, strlen(body) + 1);
+    return reply;
+}
+
+int compile_client_compile(const char* socket_path, const CompileRequest* req,
+                           FILE* out, uint64_t* latency_us) {
+    char input[4096], output[4096];
+    if (!absolute_path(req->input_file, input, sizeof(input)) ||
+        !absolute_path(req->output_file, output, sizeof(output))) {
+        fprintf(stderr, "Error: path too long\n");
+        return 2;
+    }
+    if (strchr(input, '\n') || strchr(output, '\n')) {
+        fprintf(stderr, "Error: paths with newlines are not supported\n");
+        return 2;
+    }
+
+    char request[MAX_REQUEST_SIZE];
+    int length = snprintf(request, sizeof(request),
+                          "COMPILE\nINPUT %s\nOUTPUT %s\nVERBOSE %d\nEND\n",
+                          input, output, req->verbose ? 1 : 0);
+    if (length < 0 || (size_t)length >= sizeof(request)) {
+        fprintf(stderr, "Error: request too large\n");
+        return 2;
+    }
+
+    int status = 1;
+    char* body = client_roundtrip(socket_path, request, &status, latency_us);
+    if (!body) return 2;
+
+    fputs(body, status == 0 ? out : stderr);
+    free(body);
+    return status == 0 ? 0 : 1;
+}
+
+int compile_client_stats(const char* socket_path, FILE* out) {
+    int status = 1;
+    char* body = client_roundtrip(socket_path, "STATS\n", &status, NULL);
+    if (!body) return 2;
+    fputs(body, out);
+    free(body);
+    return status == 0 ? 0 : 2;
+}
+
+int compile_client_shutdown(const char* socket_path) {
+    int status = 1;
+    char* body = client_roundtrip(socket_path, "SHUTDOWN\n", &status, NULL);
+    if (!body) return 2;
+    free(body);
+    return status == 0 ? 0 : 2;
+}
@@ -0,0 +1,156 @@
+#ifndef COMPILE_SERVER_H
+#define COMPILE_SERVER_H
+
+/* MELP Stage 2 - Persistent Compile Server
+ * Date: 18 Ekim 2026
+ *
+ * This header defines the compile server / thin client interface used by
+ * `stage2_bootstrap --server` and `stage2_bootstrap --client`.
+ *
+ * Design Principles (AUTONOMOUS):
+ * - Peer to the pipeline: the server does NOT import parser/semantic/codegen,
+ *   the driver hands it a compile callback (CompileServerFn)
+ * - Single responsibility: socket protocol, warm caches, latency statistics
+ * - Local only: AF_UNIX stream socket, one request per connection
+ *
+ * Protocol (line based, text):
+ *   Client → Server:
+ *     COMPILE\n
+ *     INPUT <absolute path>\n
+ *     OUTPUT <absolute path>\n
+ *     VERBOSE <0|1>\n
+ *     END\n
+ *   or: STATS\n      (latency statistics report)
+ *   or: SHUTDOWN\n   (stop the server after in-flight requests)
+ *
+ *   Server → Client:
+ *     STATUS <0|1> <latency_us> <HIT|MISS>\n
+ *     <diagnostic / verbose output until EOF>
+ *
+ * Concurrency:
+ *   - A fixed pool of worker threads blocks in accept() on the same socket
+ *   - Reading requests, hashing sources and serving cache hits run in parallel
+ *   - The compile pipeline itself keeps global state (parser, codegen
+ *     buffers), so cache misses are serialized behind one pipeline lock
+ *
+ * Compile flags:
+ *   Requests carry none. Flags that change the IR (--runtime-bc) are
+ *   server-wide, given to --server, so the cache key (input path, source
+ *   hash) never mixes IR built with different flags.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* ============================================================================
+ * REQUEST / CALLBACK
+ * ============================================================================ */
+
+/* One compile request as seen by the pipeline callback */
+typedef struct CompileRequest {
+    const char* input_file;      /* Absolute path to .mlp source */
+    const char* output_file;     /* Absolute path to .ll output */
+    bool verbose;                /* Print compilation steps into diag */
+    const char* source;          /* Source text already read from input_file (NULL: read it) */
+    const char* ir_file;         /* Where the pipeline writes the IR (NULL: output_file) */
+} CompileRequest;
+
+/* Pipeline callback (implemented by the driver)
+ *
+ * Parameters:
+ *   req  - Request to compile
+ *   diag - Stream for errors and verbose output (sent back to the client)
+ *
+ * The server passes the source text it hashed (so the cache key matches
+ * what was compiled) and a private ir_file, which it reads back before the
+ * next request can run the pipeline.
+ *
+ * Returns:
+ *   true if the IR file was written successfully
+ */
+typedef bool (*CompileServerFn)(const CompileRequest* req, FILE* diag);
+
+/* ============================================================================
+ * SERVER CONFIGURATION & STATISTICS
+ * ============================================================================ */
+
+/* Default number of worker threads */
+#define COMPILE_SERVER_DEFAULT_WORKERS 4
+
+/* Maximum number of cached compilation results (warm cache) */
+#define COMPILE_SERVER_CACHE_CAPACITY 256
+
+/* Number of recent latencies kept for percentile reporting */
+#define COMPILE_SERVER_LATENCY_WINDOW 4096
+
+typedef struct CompileServerConfig {
+    const char* socket_path;     /* Unix socket path (max 107 bytes) */
+    int worker_count;            /* Worker threads (<= 0: default) */
+    bool verbose;                /* Log each request to stderr */
+} CompileServerConfig;
+
+/* Per-server request latency statistics (microseconds) */
+typedef struct CompileServerStats {
+    uint64_t requests;           /* Total COMPILE requests */
+    uint64_t cache_hits;         /* Served from warm cache */
+    uint64_t cache_misses;       /* Ran the pipeline */
+    uint64_t failures;           /* Pipeline or I/O failures */
+    uint64_t total_us;           /* Sum of latencies */
+    uint64_t min_us;
+    uint64_t max_us;
+    uint64_t p50_us;             /* Percentiles over the recent window */
+    uint64_t p90_us;
+    uint64_t p99_us;
+} CompileServerStats;
+
+/* ============================================================================
+ * MAIN API
+ * ============================================================================ */
+
+/* Run compile server (blocks until a SHUTDOWN request arrives)
+ *
+ * Behavior:
+ *   1. Removes a stale socket file, binds and listens on socket_path
+ *   2. Starts worker_count threads accepting connections
+ *   3. Caches generated IR keyed by (input path, source hash); a cache hit
+ *      writes the cached IR to the requested output without recompiling.
+ *      A miss compiles the hashed source into a private file and writes
+ *      the IR from memory, so requests sharing an output path cannot
+ *      cache each other's IR.
+ *   4. On SHUTDOWN: joins workers, prints statistics to stderr, removes socket
+ *
+ * Returns:
+ *   0 on clean shutdown, 1 on setup error
+ */
+int compile_server_run(const CompileServerConfig* config, CompileServerFn compile_fn);
+
+/* Format statistics report (used by STATS request and at shutdown) */
+void compile_server_format_stats(const CompileServerStats* stats, FILE* out);
+
+/* ============================================================================
+ * CLIENT API
+ * ============================================================================ */
+
+/* Send COMPILE request to a running server
+ *
+ * Parameters:
+ *   socket_path - Server socket
+ *   req         - Request (relative paths are made absolute here)
+ *   out         - Where server diagnostics are written (stdout/stderr)
+ *   latency_us  - Out: server-side latency (may be NULL)
+ *
+ * Returns:
+ *   0 on success, 1 on compile failure, 2 on connection/protocol error
+ */
+int compile_client_compile(const char* socket_path, const CompileRequest* req,
+                           FILE* out, uint64_t* latency_us);
+
+/* Print server statistics report to out. Returns 0 on success, 2 on error. */
+int compile_client_stats(const char* socket_path, FILE* out);
+
+/* Ask server to shut down. Returns 0 on success, 2 on error. */
+int compile_client_shutdown(const char* socket_path);
+
+#endif /* COMPILE_SERVER_H */
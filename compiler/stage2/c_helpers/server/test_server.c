@@ -0,0 +1,491 @@
+/* MELP Stage 2 - Compile Server Unit Tests
+ * Date: 18 Ekim 2026
+ *
+ * Test suite for compile_server.c
+ * Uses a stub pipeline callback (no lexer/parser/codegen dependency) and a
+ * server thread listening on a temporary Unix socket.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "compile_server.h"
+#include <assert.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Test counter */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Stub pipeline: counts invocations, "fails" for sources containing "error"
+ * Sources containing "race" simulate what a concurrent request or editor
+ * could do while the pipeline runs: the input is edited on disk and
+ * another request's IR lands in the shared output path.
+ */
+static atomic_int stub_calls;
+
+static char socket_path[108];
+static char work_dir[64];
+
+static void write_file(const char* path, const char* text);
+
+static bool stub_compile(const CompileRequest* req, FILE* diag) {
+    atomic_fetch_add(&stub_calls, 1);
+
+    char source[256] = {0};
+    if (req->source) {
+        strncpy(source, req->source, sizeof(source) - 1);
+    } else {
+        FILE* in = fopen(req->input_file, "r");
+        if (!in) {
+            fprintf(diag, "Error: Cannot open file '%s'\n", req->input_file);
+            return false;
+        }
+        size_t n = fread(source, 1, sizeof(source) - 1, in);
+        fclose(in);
+        source[n] = '\0';
+    }
+
+    if (strstr(source, "error")) {
+        fprintf(diag, "Semantic error: stub failure\n");
+        return false;
+    }
+
+    FILE* out = fopen(req->ir_file ? req->ir_file : req->output_file, "w");
+    if (!out) return false;
+    fprintf(out, "; IR for: %s", source);
+    fclose(out);
+
+    if (strstr(source, "race")) {
+        write_file(req->input_file, "numeric edited = 1\n");
+        write_file(req->output_file, "; IR for: another request\n");
+    }
+
+    if (req->verbose) fprintf(diag, "stub compiled\n");
+    return true;
+}
+
+/* Helpers */
+static void write_file(const char* path, const char* text) {
+    FILE* f = fopen(path, "w");
+    assert(f != NULL);
+    fputs(text, f);
+    fclose(f);
+}
+
+static char* read_file(const char* path) {
+    static char buffer[512];
+    FILE* f = fopen(path, "r");
+    if (!f) return NULL;
+    size_t n = fread(buffer, 1, sizeof(buffer) - 1, f);
+    buffer[n] = '\0';
+    fclose(f);
+    return buffer;
+}
+
+static void path_in_work_dir(char* buffer, size_t size, const char* name) {
+    snprintf(buffer, size, "%s/%s", work_dir, name);
+}
+
+static void check(bool condition, const char* message) {
+    if (!condition) {
+        printf("  ❌ %s\n", message);
+        tests_failed++;
+    }
+}
+
+/* Server thread */
+static int server_exit_code = -1;
+
+static void* server_thread(void* arg) {
+    (void)arg;
+    CompileServerConfig config = {
+        .socket_path = socket_path,
+        .worker_count = 4,
+        .verbose = false
+    };
+    server_exit_code = compile_server_run(&config, stub_compile);
+    return NULL;
+}
+
+static void wait_for_server(void) {
+    struct timespec delay = {0, 10 * 1000 * 1000};
+    for (int i = 0; i < 200; i++) {
+        if (access(socket_path, F_OK) == 0) {
+            /* Socket file exists; make sure listen() completed too */
+            FILE* devnull = fopen("/dev/null", "w");
+            int rc = compile_client_stats(socket_path, devnull);
+            fclose(devnull);
+            if (rc == 0) return;
+        }
+        nanosleep(&delay, NULL);
+    }
+}
+
+/* Test 1: Cache miss runs pipeline and writes output */
+void test_compile_miss(void) {
+    printf("Test 1: Cache Miss Runs Pipeline\n");
+    int failed_before = tests_failed;
+
+    char input[128], output[128];
+    path_in_work_dir(input, sizeof(input), "a.mlp");
+    path_in_work_dir(output, sizeof(output), "a.ll");
+    write_file(input, "numeric x = 1\n");
+
+    CompileRequest req = {input, output, false, NULL, NULL};
+    int before = atomic_load(&stub_calls);
+    int rc = compile_client_compile(socket_path, &req, stdout, NULL);
+
+    check(rc == 0, "compile should succeed");
+    check(atomic_load(&stub_calls) == before + 1, "pipeline should run once");
+    char* ir = read_file(output);
+    check(ir && strstr(ir, "numeric x = 1"), "output should contain stub IR");
+
+    if (tests_failed == failed_before) {
+        tests_passed++;
+        printf("✅ Test 1 PASSED\n\n");
+    }
+}
+
+/* Test 2: Unchanged source is served from the warm cache */
+void test_compile_hit(void) {
+    printf("Test 2: Warm Cache Hit\n");
+    int failed_before = tests_failed;
+
+    char input[128], output[128];
+    path_in_work_dir(input, sizeof(input), "a.mlp");
+    path_in_work_dir(output, sizeof(output), "a_copy.ll");
+    unlink(output);
+
+    CompileRequest req = {input, output, false, NULL, NULL};
+    int before = atomic_load(&stub_calls);
+    int rc = compile_client_compile(socket_path, &req, stdout, NULL);
+
+    check(rc == 0, "compile should succeed");
+    check(atomic_load(&stub_calls) == before, "pipeline should not run on hit");
+    char* ir = read_file(output);
+    check(ir && strstr(ir, "numeric x = 1"), "cached IR should be written to new output");
+
+    if (tests_failed == failed_before) {
+        tests_passed++;
+        printf("✅ Test 2 PASSED\n\n");
+    }
+}
+
+/* Test 3: Changed source invalidates cached result */
+void test_source_change(void) {
+    printf("Test 3: Source Change Invalidates Cache\n");
+    int failed_before = tests_failed;
+
+    char input[128], output[128];
+    path_in_work_dir(input, sizeof(input), "a.mlp");
+    path_in_work_dir(output, sizeof(output), "a.ll");
+    write_file(input, "numeric y = 2\n");
+
+    CompileRequest req = {input, output, false, NULL, NULL};
+    int before = atomic_load(&stub_calls);
+    int rc = compile_client_compile(socket_path, &req, stdout, NULL);
+
+    check(rc == 0, "compile should succeed");
+    check(atomic_load(&stub_calls) == before + 1, "pipeline should rerun");
+    char* ir = read_file(output);
+    check(ir && strstr(ir, "numeric y = 2"), "output should reflect new source");
+
+    if (tests_failed == failed_before) {
+        tests_passed++;
+        printf("✅ Test 3 PASSED\n\n");
+    }
+}
+
+/* Test 4: Pipeline failure is reported, not cached */
+void test_compile_failure(void) {
+    printf("Test 4: Compile Failure\n");
+    int failed_before = tests_failed;
+
+    char input[128], output[128];
+    path_in_work_dir(input, sizeof(input), "bad.mlp");
+    path_in_work_dir(output, sizeof(output), "bad.ll");
+    write_file(input, "error\n");
+
+    CompileRequest req = {input, output, false, NULL, NULL};
+    FILE* devnull = fopen("/dev/null", "w");
+    int before = atomic_load(&stub_calls);
+    int rc1 = compile_client_compile(socket_path, &req, devnull, NULL);
+    int rc2 = compile_client_compile(socket_path, &req, devnull, NULL);
+    fclose(devnull);
+
+    check(rc1 == 1 && rc2 == 1, "failed compile should return 1");
+    check(atomic_load(&stub_calls) == before + 2, "failures should not be cached");
+
+    if (tests_failed == failed_before) {
+        tests_passed++;
+        printf("✅ Test 4 PASSED\n\n");
+    }
+}
+
+/* Test 5: Missing input file */
+void test_missing_input(void) {
+    printf("Test 5: Missing Input File\n");
+    int failed_before = tests_failed;
+
+    char input[128], output[128];
+    path_in_work_dir(input, sizeof(input), "missing.mlp");
+    path_in_work_dir(output, sizeof(output), "missing.ll");
+
+    CompileRequest req = {input, output, false, NULL, NULL};
+    FILE* devnull = fopen("/dev/null", "w");
+    int rc = compile_client_compile(socket_path, &req, devnull, NULL);
+    fclose(devnull);
+
+    check(rc == 1, "missing input should fail with 1");
+
+    if (tests_failed == failed_before) {
+        tests_passed++;
+        printf("✅ Test 5 PASSED\n\n");
+    }
+}
+
+/* Test 6: Concurrent clients */
+static void* concurrent_client(void* arg) {
+    int id = *(int*)arg;
+    char input[128], output[128], name[32];
+    snprintf(name, sizeof(name), "c%d.mlp", id);
+    path_in_work_dir(input, sizeof(input), name);
+    snprintf(name, sizeof(name), "c%d.ll", id);
+    path_in_work_dir(output, sizeof(output), name);
+
+    char source[64];
+    snprintf(source, sizeof(source), "numeric c%d = %d\n", id, id);
+    write_file(input, source);
+
+    CompileRequest req = {input, output, false, NULL, NULL};
+    intptr_t failures = 0;
+    for (int i = 0; i < 5; i++) {
+        if (compile_client_compile(socket_path, &req, stdout, NULL) != 0) failures++;
+    }
+    return (void*)failures;
+}
+
+void test_concurrent_clients(void) {
+    printf("Test 6: Concurrent Clients\n");
+    int failed_before = tests_failed;
+
+    pthread_t threads[8];
+    int ids[8];
+    for (int i = 0; i < 8; i++) {
+        ids[i] = i;
+        pthread_create(&threads[i], NULL, concurrent_client, &ids[i]);
+    }
+    intptr_t failures = 0;
+    for (int i = 0; i < 8; i++) {
+        void* result;
+        pthread_join(threads[i], &result);
+        failures += (intptr_t)result;
+    }
+
+    check(failures == 0, "all concurrent requests should succeed");
+    for (int i = 0; i < 8; i++) {
+        char output[128], name[32], expected[32];
+        snprintf(name, sizeof(name), "c%d.ll", i);
+        path_in_work_dir(output, sizeof(output), name);
+        snprintf(expected, sizeof(expected), "c%d = %d", i, i);
+        char* ir = read_file(output);
+        check(ir && strstr(ir, expected), "each client should get its own IR");
+    }
+
+    if (tests_failed == failed_before) {
+        tests_passed++;
+        printf("✅ Test 6 PASSED\n\n");
+    }
+}
+
+/* Test 7: Statistics report */
+void test_stats(void) {
+    printf("Test 7: Latency Statistics\n");
+    int failed_before = tests_failed;
+
+    char* text = NULL;
+    size_t length = 0;
+    FILE* out = open_memstream(&text, &length);
+    int rc = compile_client_stats(socket_path, out);
+    fclose(out);
+
+    check(rc == 0, "stats request should succeed");
+    check(text && strstr(text, "Requests:     46"), "should count 46 compile requests");
+    check(text && strstr(text, "Cache hits:   33"), "should count 33 cache hits");
+    check(text && strstr(text, "p99"), "should report percentiles");
+    free(text);
+
+    if (tests_failed == failed_before) {
+        tests_passed++;
+        printf("✅ Test 7 PASSED\n\n");
+    }
+}
+
+/* Test 8: Stats formatting */
+void test_format_stats(void) {
+    printf("Test 8: Stats Formatting\n");
+    int failed_before = tests_failed;
+
+    CompileServerStats stats = {0};
+    stats.requests = 4;
+    stats.total_us = 400;
+    stats.min_us = 10;
+    stats.max_us = 250;
+
+    char* text = NULL;
+    size_t length = 0;
+    FILE* out = open_memstream(&text, &length);
+    compile_server_format_stats(&stats, out);
+    fclose(out);
+
+    check(strstr(text, "mean 100") != NULL, "mean should be total/requests");
+    check(strstr(text, "min 10") != NULL, "min should be printed");
+    free(text);
+
+    if (tests_failed == failed_before) {
+        tests_passed++;
+        printf("✅ Test 8 PASSED\n\n");
+    }
+}
+
+/* Test 9: Cached IR is the IR of the source that was hashed */
+void test_compile_race(void) {
+    printf("Test 9: Input Edited / Output Shared During Compile\n");
+    int failed_before = tests_failed;
+
+    char input[128], output[128], copy[128];
+    path_in_work_dir(input, sizeof(input), "race.mlp");
+    path_in_work_dir(output, sizeof(output), "race.ll");
+    path_in_work_dir(copy, sizeof(copy), "race_copy.ll");
+    write_file(input, "numeric race = 1\n");
+
+    /* The stub edits race.mlp and overwrites race.ll mid-compile */
+    CompileRequest req = {input, output, false, NULL, NULL};
+    int rc = compile_client_compile(socket_path, &req, stdout, NULL);
+    check(rc == 0, "compile should succeed");
+    char* ir = read_file(output);
+    check(ir && strstr(ir, "numeric race = 1"), "output should hold this request's IR");
+
+    /* The original source hits, with its own IR */
+    write_file(input, "numeric race = 1\n");
+    CompileRequest hit_req = {input, copy, false, NULL, NULL};
+    int before = atomic_load(&stub_calls);
+    rc = compile_client_compile(socket_path, &hit_req, stdout, NULL);
+    check(rc == 0 && atomic_load(&stub_calls) == before, "original source should hit");
+    ir = read_file(copy);
+    check(ir && strstr(ir, "numeric race = 1"), "cache should not hold another request's IR");
+
+    /* The edit does not hit under the old hash */
+    write_file(input, "numeric edited = 1\n");
+    rc = compile_client_compile(socket_path, &hit_req, stdout, NULL);
+    check(rc == 0 && atomic_load(&stub_calls) == before + 1, "edited source should miss");
+    ir = read_file(copy);
+    check(ir && strstr(ir, "numeric edited = 1"), "edited source should get its own IR");
+
+    if (tests_failed == failed_before) {
+        tests_passed++;
+        printf("✅ Test 9 PASSED\n\n");
+    }
+}
+
+/* Test 10: No private IR files are left next to the output */
+void test_no_ir_files_left(void) {
+    printf("Test 10: Private IR Files Removed\n");
+    int failed_before = tests_failed;
+
+    char command[160];
+    snprintf(command, sizeof(command), "ls %s | grep -q '\\.tmp$'", work_dir);
+    check(system(command) != 0, "no .tmp files should remain");
+
+    if (tests_failed == failed_before) {
+        tests_passed++;
+        printf("✅ Test 10 PASSED\n\n");
+    }
+}
+
+/* Test 11: Shutdown */
+void test_shutdown(pthread_t server) {
+    printf("Test 11: Shutdown\n");
+    int failed_before = tests_failed;
+
+    int rc = compile_client_shutdown(socket_path);
+    pthread_join(server, NULL);
+
+    check(rc == 0, "shutdown should succeed");
+    check(server_exit_code == 0, "server should exit cleanly");
+    check(access(socket_path, F_OK) != 0, "socket file should be removed");
+
+    CompileRequest req = {"/nonexistent.mlp", "/nonexistent.ll", false, NULL, NULL};
+    FILE* devnull = fopen("/dev/null", "w");
+    int saved = dup(fileno(stderr));
+    freopen("/dev/null", "w", stderr);
+    int after = compile_client_compile(socket_path, &req, devnull, NULL);
+    fflush(stderr);
+    dup2(saved, fileno(stderr));
+    close(saved);
+    fclose(devnull);
+    check(after == 2, "connecting after shutdown should fail with 2");
+
+    if (tests_failed == failed_before) {
+        tests_passed++;
+        printf("✅ Test 11 PASSED\n\n");
+    }
+}
+
+/* ============================================================================
+ * MAIN TEST RUNNER
+ * ============================================================================ */
+
+int main(void) {
+    printf("╔═══════════════════════════════════════════════════════════╗\n");
+    printf("║  MELP Stage 2 - Compile Server Unit Tests                 ║\n");
+    printf("╚═══════════════════════════════════════════════════════════╝\n\n");
+
+    snprintf(work_dir, sizeof(work_dir), "/tmp/melp_server_test_XXXXXX");
+    if (!mkdtemp(work_dir)) {
+        perror("mkdtemp");
+        return 1;
+    }
+    snprintf(socket_path, sizeof(socket_path), "%s/server.sock", work_dir);
+
+    pthread_t server;
+    pthread_create(&server, NULL, server_thread, NULL);
+    wait_for_server();
+
+    test_compile_miss();
+    test_compile_hit();
+    test_source_change();
+    test_compile_failure();
+    test_missing_input();
+    test_concurrent_clients();
+    test_stats();
+    test_format_stats();
+    test_compile_race();
+    test_no_ir_files_left();
+    test_shutdown(server);
+
+    char command[128];
+    snprintf(command, sizeof(command), "rm -rf %s", work_dir);
+    if (system(command) != 0) printf("  (warning: could not remove %s)\n", work_dir);
+
+    /* Summary */
+    printf("═══════════════════════════════════════════════════════════\n");
+    printf("TEST SUMMARY:\n");
+    printf("  ✅ Passed: %d\n", tests_passed);
+    printf("  ❌ Failed: %d\n", tests_failed);
+    printf("  Total: %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n🎉 ALL TESTS PASSED! 🎉\n");
+        return 0;
+    } else {
+        printf("\n⚠️  SOME TESTS FAILED ⚠️\n");
+        return 1;
+    }
+}
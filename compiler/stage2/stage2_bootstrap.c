@@ -9,6 +9,7 @@
  * 
  * Pipeline:
  *   Source → Parser (includes Lexer) → Semantic → Codegen → LLVM IR
+ *   [--runtime-bc] → llvm-link with runtime bitcode → opt (internalize + O2)
  * 
  * AUTONOMOUS Compliance:
  *   - Minimal glue code (imports from c_helpers)
@@ -17,25 +18,30 @@
  *   - Clean resource management
  */
 
+#define _POSIX_C_SOURCE 200809L
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <spawn.h>
+#include <sys/wait.h>
 
 // Import modular components
 #include "c_helpers/parser/parser_impl.h"
 #include "c_helpers/semantic/semantic_analyzer.h"
 #include "c_helpers/codegen/codegen.h"
+#include "c_helpers/server/compile_server.h"
 
 /* ============================================================================
  * FILE I/O UTILITIES
  * ============================================================================ */
 
 /* Read source file into string */
-static char* read_source_file(const char* filename) {
+static char* read_source_file(const char* filename, FILE* err) {
     FILE* file = fopen(filename, "r");
     if (!file) {
-        fprintf(stderr, "Error: Cannot open file '%s'\n", filename);
+        fprintf(err, "Error: Cannot open file '%s'\n", filename);
         return NULL;
     }
     
@@ -47,7 +53,7 @@ static char* read_source_file(const char* filename) {
     // Allocate buffer
     char* buffer = malloc(size + 1);
     if (!buffer) {
-        fprintf(stderr, "Error: Memory allocation failed\n");
+        fprintf(err, "Error: Memory allocation failed\n");
         fclose(file);
         return NULL;
     }
@@ -60,96 +66,221 @@ static char* read_source_file(const char* filename) {
     return buffer;
 }
 
+/* ============================================================================
+ * WHOLE-PROGRAM MODE (runtime bitcode LTO)
+ * ============================================================================ */
+
+/* Maximum number of --runtime-bc inputs */
+#define MAX_RUNTIME_BITCODE 8
+
+/* Runtime bitcode linked into every module (empty: whole-program mode off)
+ * Built by `make bitcode` in runtime/sto and runtime/stdlib.
+ */
+static const char* g_runtime_bitcode[MAX_RUNTIME_BITCODE];
+static int g_runtime_bitcode_count = 0;
+
+extern char** environ;
+
+static bool add_runtime_bitcode(const char* path) {
+    if (g_runtime_bitcode_count >= MAX_RUNTIME_BITCODE) {
+        fprintf(stderr, "Error: too many --runtime-bc files (max %d)\n", MAX_RUNTIME_BITCODE);
+        return false;
+    }
+    g_runtime_bitcode[g_runtime_bitcode_count++] = path;
+    return true;
+}
+
+/* LLVM tool name, overridable via environment (e.g. MELP_OPT=opt-14) */
+static const char* llvm_tool(const char* env_name, const char* fallback) {
+    const char* tool = getenv(env_name);
+    return (tool && tool[0]) ? tool : fallback;
+}
+
+/* Run external tool (argv[0] looked up in PATH), returns true on exit 0 */
+static bool run_tool(char* const argv[], FILE* err) {
+    pid_t pid;
+    int status = posix_spawnp(&pid, argv[0], NULL, NULL, argv, environ);
+    if (status != 0) {
+        fprintf(err, "Error: cannot run '%s': %s\n", argv[0], strerror(status));
+        return false;
+    }
+    if (waitpid(pid, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        fprintf(err, "Error: '%s' failed\n", argv[0]);
+        return false;
+    }
+    return true;
+}
+
+/* Link runtime bitcode into the generated module and optimize it as one unit
+ *
+ * llvm-link output.ll runtime.bc... → output.ll.linked.bc
+ * opt internalize (keep only main) + default<O2> → output.ll
+ *
+ * Internalizing the runtime lets opt inline trivial helpers
+ * (mlp_println_numeric_simple, sto_safe_add_i64, ...) into MLP code and
+ * drop everything the program does not use.
+ */
+static bool link_runtime_bitcode(const char* output_file, FILE* err) {
+    char linked_file[4096];
+    snprintf(linked_file, sizeof(linked_file), "%s.linked.bc", output_file);
+    
+    char* link_argv[MAX_RUNTIME_BITCODE + 5];
+    int argc = 0;
+    link_argv[argc++] = (char*)llvm_tool("MELP_LLVM_LINK", "llvm-link");
+    link_argv[argc++] = (char*)output_file;
+    for (int i = 0; i < g_runtime_bitcode_count; i++) {
+        link_argv[argc++] = (char*)g_runtime_bitcode[i];
+    }
+    link_argv[argc++] = "-o";
+    link_argv[argc++] = linked_file;
+    link_argv[argc] = NULL;
+    
+    if (!run_tool(link_argv, err)) {
+        return false;
+    }
+    
+    char* opt_argv[] = {
+        (char*)llvm_tool("MELP_OPT", "opt"),
+        "-S", "-passes=internalize,default<O2>", "-internalize-public-api-list=main",
+        linked_file, "-o", (char*)output_file, NULL
+    };
+    bool ok = run_tool(opt_argv, err);
+    
+    remove(linked_file);
+    return ok;
+}
+
 /* ============================================================================
  * COMPILATION PIPELINE
  * ============================================================================ */
 
 /* Compile source to LLVM IR
+ * Verbose steps go to out, diagnostics to err (stdout/stderr from the
+ * command line, the client's reply stream in server mode). The server
+ * hands over the source it already read and a private IR file.
  * Returns: true on success, false on error
  */
-static bool compile(const char* input_file, const char* output_file, bool verbose) {
+static bool compile(const CompileRequest* req, FILE* out, FILE* err) {
+    const char* input_file = req->input_file;
+    const char* ir_file = req->ir_file ? req->ir_file : req->output_file;
+    bool verbose = req->verbose;
+    
     // Step 1: Read source file
     if (verbose) {
-        printf("Step 1/4: Reading source file '%s'...\n", input_file);
+        fprintf(out, "Step 1/4: Reading source file '%s'...\n", input_file);
     }
     
-    char* source = read_source_file(input_file);
+    char* owned_source = NULL;
+    const char* source = req->source;
     if (!source) {
-        return false;
+        owned_source = read_source_file(input_file, err);
+        if (!owned_source) {
+            return false;
+        }
+        source = owned_source;
     }
     
     // Step 2: Parse (includes lexing)
     if (verbose) {
-        printf("Step 2/4: Parsing (lexing + syntax analysis)...\n");
+        fprintf(out, "Step 2/4: Parsing (lexing + syntax analysis)...\n");
     }
     
     ASTNode* ast = parse(source);  // parse() does tokenize internally
     
     if (!ast) {
-        fprintf(stderr, "Error: Parse failed\n");
-        const char* err = get_parse_error();
-        if (err) {
-            fprintf(stderr, "%s\n", err);
+        fprintf(err, "Error: Parse failed\n");
+        const char* message = get_parse_error();
+        if (message) {
+            fprintf(err, "%s\n", message);
         }
-        free(source);
+        free(owned_source);
         return false;
     }
     
     if (verbose) {
         if (ast->type == AST_PROGRAM) {
-            printf("  ✓ AST generated (%d functions)\n", ast->data.program.function_count);
+            fprintf(out, "  ✓ AST generated (%d functions)\n", ast->data.program.function_count);
         } else {
-            printf("  ✓ AST generated\n");
+            fprintf(out, "  ✓ AST generated\n");
         }
     }
     
     // Step 3: Semantic analysis
     if (verbose) {
-        printf("Step 3/4: Semantic analysis...\n");
+        fprintf(out, "Step 3/4: Semantic analysis...\n");
     }
     
     if (!analyze_program(ast)) {
-        fprintf(stderr, "Error: Semantic analysis failed\n");
-        const char* err = get_semantic_error();
-        if (err) {
-            fprintf(stderr, "%s\n", err);
+        fprintf(err, "Error: Semantic analysis failed\n");
+        const char* message = get_semantic_error();
+        if (message) {
+            fprintf(err, "%s\n", message);
         }
         free_ast(ast);
-        free(source);
+        free(owned_source);
         return false;
     }
     
     if (verbose) {
-        printf("  ✓ Semantic validation complete\n");
+        fprintf(out, "  ✓ Semantic validation complete\n");
     }
     
     // Step 4: Code generation
     if (verbose) {
-        printf("Step 4/4: Code generation (LLVM IR)...\n");
+        fprintf(out, "Step 4/4: Code generation (LLVM IR)...\n");
     }
     
-    if (!generate_code(ast, output_file)) {
-        fprintf(stderr, "Error: Code generation failed\n");
-        const char* err = get_codegen_error();
-        if (err) {
-            fprintf(stderr, "%s\n", err);
+    if (!generate_code(ast, ir_file)) {
+        fprintf(err, "Error: Code generation failed\n");
+        const char* message = get_codegen_error();
+        if (message) {
+            fprintf(err, "%s\n", message);
         }
         free_ast(ast);
-        free(source);
+        free(owned_source);
         return false;
     }
     
     if (verbose) {
-        printf("  ✓ LLVM IR written to '%s'\n", output_file);
+        fprintf(out, "  ✓ LLVM IR written to '%s'\n", req->output_file);
+        CodegenRcStats rc = get_codegen_rc_stats();
+        fprintf(out, "  ✓ List reference counting: %d retains, %d releases, %d freed in place, "
+                "%d elided (%d moves, %d borrows)\n", rc.retains, rc.releases, rc.frees_in_place,
+                rc.elided_by_moves + rc.elided_by_borrows, rc.elided_by_moves, rc.elided_by_borrows);
+        EscapeStats escapes = get_escape_stats();
+        fprintf(out, "  ✓ Escape analysis: %d of %d list literals on the stack (heap allocations removed)\n",
+                rc.stack_lists, escapes.list_literals);
+    }
+    
+    // Whole-program mode: link runtime bitcode before optimization
+    if (g_runtime_bitcode_count > 0) {
+        if (verbose) {
+            fprintf(out, "Whole-program: linking %d runtime bitcode file(s)...\n",
+                    g_runtime_bitcode_count);
+        }
+        if (!link_runtime_bitcode(ir_file, err)) {
+            fprintf(err, "Error: Whole-program link failed\n");
+            free_ast(ast);
+            free(owned_source);
+            return false;
+        }
+        if (verbose) {
+            fprintf(out, "  ✓ Runtime linked and optimized into '%s'\n", req->output_file);
+        }
     }
     
     // Cleanup
     free_ast(ast);
-    free(source);
+    free(owned_source);
     
     return true;
 }
 
+/* Server pipeline callback (see c_helpers/server/compile_server.h) */
+static bool compile_request(const CompileRequest* req, FILE* diag) {
+    return compile(req, diag, diag);
+}
+
 /* ============================================================================
  * MAIN ENTRY POINT
  * ============================================================================ */
@@ -165,8 +296,14 @@ int main(int argc, char* argv[]) {
         fprintf(stderr, "Options:\n");
         fprintf(stderr, "  -o FILE    Output LLVM IR to FILE (default: output.ll)\n");
         fprintf(stderr, "  -v         Verbose mode (show compilation steps)\n");
+        fprintf(stderr, "  --runtime-bc FILE  Whole-program mode: link runtime bitcode (repeatable)\n");
         fprintf(stderr, "  --version  Show version information\n");
         fprintf(stderr, "  --help     Show this help message\n");
+        fprintf(stderr, "\n");
+        fprintf(stderr, "Server mode:\n");
+        fprintf(stderr, "  %s --server SOCKET [--workers N] [--runtime-bc FILE] [-v]\n", argv[0]);
+        fprintf(stderr, "  %s --client SOCKET <input.mlp> [-o <output.ll>] [-v]\n", argv[0]);
+        fprintf(stderr, "  %s --client SOCKET --stats | --shutdown\n", argv[0]);
         return 1;
     }
     
@@ -193,16 +330,93 @@ int main(int argc, char* argv[]) {
         printf("Options:\n");
         printf("  -o FILE    Output LLVM IR to FILE (default: output.ll)\n");
         printf("  -v         Verbose mode (show compilation steps)\n");
+        printf("  --runtime-bc FILE\n");
+        printf("             Whole-program mode: link runtime bitcode into the module\n");
+        printf("             and optimize it as one unit (repeatable; needs llvm-link\n");
+        printf("             and opt, override with MELP_LLVM_LINK / MELP_OPT)\n");
         printf("  --version  Show version information\n");
         printf("  --help     Show this help message\n");
         printf("\n");
+        printf("Server mode (persistent compiler, warm caches):\n");
+        printf("  --server SOCKET [--workers N] [--runtime-bc FILE] [-v]\n");
+        printf("             Serve compile requests on a Unix socket\n");
+        printf("  --client SOCKET <input.mlp> [-o <output.ll>] [-v]\n");
+        printf("             Compile through a running server\n");
+        printf("  --client SOCKET --stats      Show server latency statistics\n");
+        printf("  --client SOCKET --shutdown   Stop the server\n");
+        printf("\n");
         printf("Examples:\n");
         printf("  %s program.mlp                  # Compile to output.ll\n", argv[0]);
         printf("  %s program.mlp -o program.ll    # Compile to program.ll\n", argv[0]);
         printf("  %s program.mlp -o program.ll -v # Verbose compilation\n", argv[0]);
+        printf("  %s program.mlp -o program.ll --runtime-bc runtime/stdlib/libmlp_stdlib.bc \\\n"
+               "      --runtime-bc runtime/sto/libsto_runtime.bc  # Whole-program build\n", argv[0]);
+        printf("  %s --server /tmp/melp.sock &    # Start compile server\n", argv[0]);
+        printf("  %s --client /tmp/melp.sock program.mlp -o program.ll\n", argv[0]);
         return 0;
     }
     
+    // Handle server mode
+    if (strcmp(argv[1], "--server") == 0) {
+        if (argc < 3) {
+            fprintf(stderr, "Error: --server requires a socket path\n");
+            return 1;
+        }
+        CompileServerConfig config = {
+            .socket_path = argv[2],
+            .worker_count = COMPILE_SERVER_DEFAULT_WORKERS,
+            .verbose = false
+        };
+        for (int i = 3; i < argc; i++) {
+            if (strcmp(argv[i], "--workers") == 0 && i + 1 < argc) {
+                config.worker_count = atoi(argv[i + 1]);
+                i++;
+            } else if (strcmp(argv[i], "--runtime-bc") == 0 && i + 1 < argc) {
+                if (!add_runtime_bitcode(argv[i + 1])) return 1;
+                i++;
+            } else if (strcmp(argv[i], "-v") == 0 || strcmp(argv[i], "--verbose") == 0) {
+                config.verbose = true;
+            }
+        }
+        return compile_server_run(&config, compile_request);
+    }
+    
+    // Handle client mode
+    if (strcmp(argv[1], "--client") == 0) {
+        if (argc < 4) {
+            fprintf(stderr, "Error: --client requires a socket path and an input file\n");
+            return 1;
+        }
+        const char* socket_path = argv[2];
+        if (strcmp(argv[3], "--stats") == 0) {
+            return compile_client_stats(socket_path, stdout);
+        }
+        if (strcmp(argv[3], "--shutdown") == 0) {
+            return compile_client_shutdown(socket_path);
+        }
+        
+        CompileRequest req = { argv[3], "output.ll", false, NULL, NULL };
+        for (int i = 4; i < argc; i++) {
+            if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+                req.output_file = argv[i + 1];
+                i++;
+            } else if (strcmp(argv[i], "--runtime-bc") == 0) {
+                // Cached IR is keyed by (input, source) only: flags are server-wide
+                fprintf(stderr, "Error: --runtime-bc is a server setting (pass it to --server)\n");
+                return 1;
+            } else if (strcmp(argv[i], "-v") == 0 || strcmp(argv[i], "--verbose") == 0) {
+                req.verbose = true;
+            }
+        }
+        
+        uint64_t latency_us = 0;
+        int status = compile_client_compile(socket_path, &req, stdout, &latency_us);
+        if (req.verbose && status != 2) {
+            printf("Server latency: %llu us\n", (unsigned long long)latency_us);
+        }
+        return status;
+    }
+    
     // Parse arguments
     const char* input_file = argv[1];
     const char* output_file = "output.ll";  // Default output
@@ -212,6 +426,9 @@ int main(int argc, char* argv[]) {
         if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
             output_file = argv[i + 1];
             i++;
+        } else if (strcmp(argv[i], "--runtime-bc") == 0 && i + 1 < argc) {
+            if (!add_runtime_bitcode(argv[i + 1])) return 1;
+            i++;
         } else if (strcmp(argv[i], "-v") == 0 || strcmp(argv[i], "--verbose") == 0) {
             verbose = true;
         }
@@ -224,7 +441,8 @@ int main(int argc, char* argv[]) {
         printf("Output: %s\n\n", output_file);
     }
     
-    bool success = compile(input_file, output_file, verbose);
+    CompileRequest req = { input_file, output_file, verbose, NULL, NULL };
+    bool success = compile(&req, stdout, stderr);
     
     if (success) {
         if (verbose) {
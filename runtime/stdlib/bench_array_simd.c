@@ -0,0 +1,141 @@
+/**
+ * Numeric Array Kernel Benchmark
+ * ns per element of each bulk kernel (mlp_array_simd.c) with the scalar
+ * loops and with every vector kernel set this CPU supports, on 64-byte
+ * aligned MelpDenseArray buffers. Small sizes stay in cache and show the
+ * compute speedup; from ~1M elements the loops are bound by memory
+ * bandwidth and the kernel sets converge. Small sizes are repeated so each
+ * row covers at least ~10M elements.
+ *
+ * Usage: make bench   (or ./bench_array_simd [max_elements], default
+ *        100000000; needs 16 bytes per element)
+ */
+
+#define _POSIX_C_SOURCE 200809L  // clock_gettime
+
+#include "mlp_array_simd.h"
+#include "mlp_dense_array.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Sinks so the optimizer cannot drop results
+static volatile int64_t bench_sink;
+static volatile double bench_sink_f64;
+
+enum {
+    OP_FILL, OP_COPY,
+    OP_I64_SUM, OP_I64_MIN, OP_I64_DOT, OP_I64_SCALE, OP_I64_ADD, OP_I64_MUL,
+    OP_I64_PREFIX, OP_I64_COUNT,
+    OP_F64_SUM, OP_F64_MAX, OP_F64_DOT, OP_F64_SCALE, OP_F64_ADD, OP_F64_PREFIX,
+    OP_F64_COUNT,
+    OP_COUNT
+};
+
+static const char* op_names[OP_COUNT] = {
+    "fill", "copy",
+    "i64 sum", "i64 min", "i64 dot", "i64 scale", "i64 add", "i64 mul",
+    "i64 prefix", "i64 count",
+    "f64 sum", "f64 max", "f64 dot", "f64 scale", "f64 add", "f64 prefix",
+    "f64 count"
+};
+
+// One run of op over n elements; a/b hold n int64 or n double values
+static void run_op(int op, void* a, void* b, size_t n) {
+    int64_t* ia = a;
+    int64_t* ib = b;
+    double* fa = a;
+    double* fb = b;
+    switch (op) {
+        case OP_FILL: mlp_simd_fill64(a, n, 3); break;
+        case OP_COPY: mlp_simd_copy64(b, a, n); break;
+        case OP_I64_SUM: bench_sink += mlp_simd_i64_sum(ia, n); break;
+        case OP_I64_MIN: bench_sink += mlp_simd_i64_min(ia, n); break;
+        case OP_I64_DOT: bench_sink += mlp_simd_i64_dot(ia, ib, n); break;
+        case OP_I64_SCALE: mlp_simd_i64_scale(ib, ia, n, 3); break;
+        case OP_I64_ADD: mlp_simd_i64_add(ib, ia, ib, n); break;
+        case OP_I64_MUL: mlp_simd_i64_mul(ib, ia, ib, n); break;
+        case OP_I64_PREFIX: mlp_simd_i64_prefix_sum(ib, ia, n); break;
+        case OP_I64_COUNT: bench_sink += (int64_t)mlp_simd_i64_count_if(ia, n, MLP_CMP_LT, 50); break;
+        case OP_F64_SUM: bench_sink_f64 += mlp_simd_f64_sum(fa, n); break;
+        case OP_F64_MAX: bench_sink_f64 += mlp_simd_f64_max(fa, n); break;
+        case OP_F64_DOT: bench_sink_f64 += mlp_simd_f64_dot(fa, fb, n); break;
+        case OP_F64_SCALE: mlp_simd_f64_scale(fb, fa, n, 0.5); break;
+        case OP_F64_ADD: mlp_simd_f64_add(fb, fa, fb, n); break;
+        case OP_F64_PREFIX: mlp_simd_f64_prefix_sum(fb, fa, n); break;
+        case OP_F64_COUNT: bench_sink += (int64_t)mlp_simd_f64_count_if(fa, n, MLP_CMP_LT, 50.0); break;
+    }
+}
+
+static int is_f64_op(int op) {
+    return op >= OP_F64_SUM;
+}
+
+int main(int argc, char** argv) {
+    size_t max_elements = argc > 1 ? (size_t)atol(argv[1]) : 100000000;
+    if (max_elements < 1000) max_elements = 1000;
+
+    MelpDenseArray* ints[2] = {
+        melp_dense_create(MELP_DENSE_INT64, max_elements),
+        melp_dense_create(MELP_DENSE_INT64, max_elements)
+    };
+    if (!ints[0] || !ints[1]) {
+        fprintf(stderr, "bench_array_simd: cannot allocate %zu elements\n", max_elements);
+        return 1;
+    }
+    for (size_t i = 0; i < max_elements; i++) {
+        melp_dense_i64(ints[0])[i] = (int64_t)(i % 100);
+        melp_dense_i64(ints[1])[i] = (int64_t)(i % 7);
+    }
+    // Doubles reuse the buffers: same bytes, reinterpreted after the int64 rows
+    int max_level = (int)mlp_simd_max_level();
+
+    printf("Numeric array kernels: scalar loops vs vector kernels (ns/element)\n\n");
+    printf("%10s  %-11s", "elements", "op");
+    for (int level = MLP_SIMD_SCALAR; level <= max_level; level++) {
+        printf(" %8s", mlp_simd_level_name((MlpSimdLevel)level));
+    }
+    printf(" %8s\n", "speedup");
+
+    for (int pass = 0; pass < 2; pass++) {
+        if (pass == 1) {
+            for (size_t i = 0; i < max_elements; i++) {
+                ((double*)ints[0]->data)[i] = (double)(i % 100);
+                ((double*)ints[1]->data)[i] = (double)(i % 7) * 0.25;
+            }
+        }
+        for (size_t n = 1000; n <= max_elements; n *= 10) {
+            size_t rounds = n < 10000000 ? 10000000 / n : 1;
+            for (int op = 0; op < OP_COUNT; op++) {
+                if (is_f64_op(op) != pass) continue;
+
+                double ns[3] = { 0, 0, 0 };
+                for (int level = MLP_SIMD_SCALAR; level <= max_level; level++) {
+                    mlp_array_simd_set_level((MlpSimdLevel)level);
+                    run_op(op, ints[0]->data, ints[1]->data, n);  // warm up
+                    double t0 = now_seconds();
+                    for (size_t r = 0; r < rounds; r++) {
+                        run_op(op, ints[0]->data, ints[1]->data, n);
+                    }
+                    ns[level] = (now_seconds() - t0) * 1e9 / ((double)n * (double)rounds);
+                }
+
+                printf("%10zu  %-11s", n, op_names[op]);
+                for (int level = MLP_SIMD_SCALAR; level <= max_level; level++) {
+                    printf(" %8.3f", ns[level]);
+                }
+                printf(" %7.2fx\n", ns[MLP_SIMD_SCALAR] / ns[max_level]);
+            }
+        }
+    }
+
+    melp_dense_free(ints[0]);
+    melp_dense_free(ints[1]);
+    return 0;
+}
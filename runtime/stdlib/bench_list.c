@@ -0,0 +1,203 @@
+/**
+ * MelpList Benchmark
+ * ns per element of the inline-storage MelpList (mlp_list.c) against the
+ * pointer-per-element list it replaced (reproduced below: void** elements,
+ * one malloc'd element_size block per append/set):
+ * - append:     n int64 values into an empty list (growth included)
+ * - get random: melp_list_get at a scattered index, n times
+ * - iterate:    sum of all elements in order through melp_list_get
+ * - array set:  mlp_array_set over a mlp_array_create(n) array
+ * Small sizes are repeated so each row covers at least ~1M operations.
+ *
+ * Usage: make bench   (or ./bench_list [max_elements], default 10000000;
+ *        the old list needs ~40 bytes per element)
+ */
+
+#define _POSIX_C_SOURCE 200809L  // clock_gettime
+
+#include "mlp_list.h"
+#include "mlp_array.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Sink so the optimizer cannot drop results
+static volatile int64_t bench_sink;
+
+// -----------------------------------------------------------------------------
+// Baseline: the previous pointer-per-element MelpList
+// (noinline: it was a separate translation unit, like mlp_list.c is)
+// -----------------------------------------------------------------------------
+
+#define BASELINE __attribute__((noinline))
+
+typedef struct {
+    void** elements;
+    size_t length;
+    size_t capacity;
+    size_t element_size;
+} BoxedList;
+
+static BoxedList* boxed_create(size_t element_size) {
+    BoxedList* list = malloc(sizeof(BoxedList));
+    list->elements = malloc(sizeof(void*) * 4);
+    list->length = 0;
+    list->capacity = 4;
+    list->element_size = element_size;
+    return list;
+}
+
+static void boxed_free(BoxedList* list) {
+    for (size_t i = 0; i < list->length; i++) free(list->elements[i]);
+    free(list->elements);
+    free(list);
+}
+
+BASELINE static void* boxed_get(BoxedList* list, size_t index) {
+    return index < list->length ? list->elements[index] : NULL;
+}
+
+BASELINE static int boxed_set(BoxedList* list, size_t index, void* element) {
+    if (index >= list->length) return -1;
+    free(list->elements[index]);
+    list->elements[index] = malloc(list->element_size);
+    memcpy(list->elements[index], element, list->element_size);
+    return 0;
+}
+
+BASELINE static int boxed_append(BoxedList* list, void* element) {
+    if (list->length >= list->capacity) {
+        list->capacity *= 2;
+        list->elements = realloc(list->elements, sizeof(void*) * list->capacity);
+    }
+    list->elements[list->length] = malloc(list->element_size);
+    memcpy(list->elements[list->length], element, list->element_size);
+    list->length++;
+    return 0;
+}
+
+// Old mlp_array_create: n appends of zero
+static BoxedList* boxed_array_create(size_t size) {
+    BoxedList* list = boxed_create(sizeof(int64_t));
+    int64_t zero = 0;
+    for (size_t i = 0; i < size; i++) boxed_append(list, &zero);
+    return list;
+}
+
+// -----------------------------------------------------------------------------
+// Driver
+// -----------------------------------------------------------------------------
+
+enum { OP_APPEND, OP_GET, OP_ITERATE, OP_ARRAY_SET, OP_COUNT };
+static const char* op_names[OP_COUNT] = { "append", "get random", "iterate", "array set" };
+
+// Scattered visiting order: i * prime mod n (prime > any n, so a permutation)
+static size_t scatter(size_t i, size_t n) {
+    return (size_t)(((unsigned long long)i * 15485863ULL) % n);
+}
+
+static void run_inline(size_t n, double* seconds) {
+    MelpList* list = melp_list_create(sizeof(int64_t));
+    double t0 = now_seconds();
+    for (size_t i = 0; i < n; i++) {
+        int64_t value = (int64_t)i;
+        melp_list_append(list, &value);
+    }
+    double t1 = now_seconds();
+    int64_t sum = 0;
+    for (size_t i = 0; i < n; i++) {
+        sum += *(int64_t*)melp_list_get(list, scatter(i, n));
+    }
+    double t2 = now_seconds();
+    for (size_t i = 0; i < n; i++) {
+        sum += *(int64_t*)melp_list_get(list, i);
+    }
+    double t3 = now_seconds();
+    melp_list_free(list);
+
+    double t4 = now_seconds();
+    MelpList* arr = mlp_array_create(n);
+    for (size_t i = 0; i < n; i++) {
+        mlp_array_set(arr, i, (int64_t)i);
+    }
+    double t5 = now_seconds();
+    sum += mlp_array_get(arr, n - 1);
+    melp_list_free(arr);
+    bench_sink += sum;
+
+    seconds[OP_APPEND] += t1 - t0;
+    seconds[OP_GET] += t2 - t1;
+    seconds[OP_ITERATE] += t3 - t2;
+    seconds[OP_ARRAY_SET] += t5 - t4;
+}
+
+static void run_boxed(size_t n, double* seconds) {
+    BoxedList* list = boxed_create(sizeof(int64_t));
+    double t0 = now_seconds();
+    for (size_t i = 0; i < n; i++) {
+        int64_t value = (int64_t)i;
+        boxed_append(list, &value);
+    }
+    double t1 = now_seconds();
+    int64_t sum = 0;
+    for (size_t i = 0; i < n; i++) {
+        sum += *(int64_t*)boxed_get(list, scatter(i, n));
+    }
+    double t2 = now_seconds();
+    for (size_t i = 0; i < n; i++) {
+        sum += *(int64_t*)boxed_get(list, i);
+    }
+    double t3 = now_seconds();
+    boxed_free(list);
+
+    double t4 = now_seconds();
+    BoxedList* arr = boxed_array_create(n);
+    for (size_t i = 0; i < n; i++) {
+        int64_t value = (int64_t)i;
+        boxed_set(arr, i, &value);
+    }
+    double t5 = now_seconds();
+    sum += *(int64_t*)boxed_get(arr, n - 1);
+    boxed_free(arr);
+    bench_sink += sum;
+
+    seconds[OP_APPEND] += t1 - t0;
+    seconds[OP_GET] += t2 - t1;
+    seconds[OP_ITERATE] += t3 - t2;
+    seconds[OP_ARRAY_SET] += t5 - t4;
+}
+
+int main(int argc, char** argv) {
+    size_t max_elements = argc > 1 ? (size_t)atol(argv[1]) : 10000000;
+    if (max_elements < 1000) max_elements = 1000;
+
+    printf("MelpList: inline elements vs previous pointer per element (ns/element)\n");
+    printf("(array set includes mlp_array_create)\n\n");
+    printf("%10s  %-11s %10s %10s %8s\n", "elements", "op", "boxed", "inline", "speedup");
+
+    for (size_t n = 1000; n <= max_elements; n *= 10) {
+        size_t rounds = n < 1000000 ? 1000000 / n : 1;
+        double boxed_seconds[OP_COUNT] = {0}, inline_seconds[OP_COUNT] = {0};
+        for (size_t r = 0; r < rounds; r++) {
+            run_boxed(n, boxed_seconds);
+            run_inline(n, inline_seconds);
+        }
+
+        double ops = (double)n * (double)rounds;
+        for (int op = 0; op < OP_COUNT; op++) {
+            double boxed_ns = boxed_seconds[op] * 1e9 / ops;
+            double inline_ns = inline_seconds[op] * 1e9 / ops;
+            printf("%10zu  %-11s %10.2f %10.2f %7.2fx\n", n, op_names[op],
+                   boxed_ns, inline_ns, boxed_ns / inline_ns);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,251 @@
+/**
+ * MelpMap Benchmark
+ * ns per operation of the open-addressing MelpMap (mlp_map.c) against the
+ * chained table it replaced (reproduced below: node + strdup'd key + value
+ * allocation per entry, byte-wise FNV-1a, hash % capacity):
+ * - insert:     n new keys into an empty map (growth included)
+ * - get hit:    every key, in a scattered order
+ * - get miss:   n keys that are not present
+ * - remove:     every key, in a scattered order
+ * Keys are "key:<i>" strings built before timing. Small sizes are repeated
+ * so each row covers at least ~1M operations.
+ *
+ * Usage: make bench   (or ./bench_map [max_entries], default 10000000;
+ *        the chained table needs ~100 bytes per entry)
+ */
+
+#define _POSIX_C_SOURCE 200809L  // clock_gettime, strdup
+
+#include "mlp_map.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Sink so the optimizer cannot drop results
+static volatile size_t bench_sink;
+
+// -----------------------------------------------------------------------------
+// Baseline: the previous chained MelpMap
+// -----------------------------------------------------------------------------
+
+typedef struct ChainNode {
+    char* key;
+    void* value;
+    struct ChainNode* next;
+} ChainNode;
+
+typedef struct {
+    ChainNode** buckets;
+    size_t length;
+    size_t capacity;
+    size_t value_size;
+} ChainMap;
+
+static uint64_t chain_hash(const char* key) {
+    uint64_t hash = 14695981039346656037ULL;
+    while (*key) {
+        hash ^= (uint64_t)(unsigned char)(*key++);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static ChainMap* chain_create(size_t value_size) {
+    ChainMap* map = malloc(sizeof(ChainMap));
+    map->capacity = 16;
+    map->length = 0;
+    map->value_size = value_size;
+    map->buckets = calloc(map->capacity, sizeof(ChainNode*));
+    return map;
+}
+
+static void chain_free(ChainMap* map) {
+    for (size_t i = 0; i < map->capacity; i++) {
+        for (ChainNode* node = map->buckets[i]; node; ) {
+            ChainNode* next = node->next;
+            free(node->key);
+            free(node->value);
+            free(node);
+            node = next;
+        }
+    }
+    free(map->buckets);
+    free(map);
+}
+
+static void chain_resize(ChainMap* map, size_t new_capacity) {
+    ChainNode** buckets = calloc(new_capacity, sizeof(ChainNode*));
+    for (size_t i = 0; i < map->capacity; i++) {
+        for (ChainNode* node = map->buckets[i]; node; ) {
+            ChainNode* next = node->next;
+            size_t index = chain_hash(node->key) % new_capacity;
+            node->next = buckets[index];
+            buckets[index] = node;
+            node = next;
+        }
+    }
+    free(map->buckets);
+    map->buckets = buckets;
+    map->capacity = new_capacity;
+}
+
+static void chain_insert(ChainMap* map, const char* key, const void* value) {
+    if ((double)map->length / (double)map->capacity > 0.75) {
+        chain_resize(map, map->capacity * 2);
+    }
+    size_t index = chain_hash(key) % map->capacity;
+    for (ChainNode* node = map->buckets[index]; node; node = node->next) {
+        if (strcmp(node->key, key) == 0) {
+            memcpy(node->value, value, map->value_size);
+            return;
+        }
+    }
+    ChainNode* node = malloc(sizeof(ChainNode));
+    node->key = strdup(key);
+    node->value = malloc(map->value_size);
+    memcpy(node->value, value, map->value_size);
+    node->next = map->buckets[index];
+    map->buckets[index] = node;
+    map->length++;
+}
+
+static void* chain_get(ChainMap* map, const char* key) {
+    size_t index = chain_hash(key) % map->capacity;
+    for (ChainNode* node = map->buckets[index]; node; node = node->next) {
+        if (strcmp(node->key, key) == 0) return node->value;
+    }
+    return NULL;
+}
+
+static int chain_remove(ChainMap* map, const char* key) {
+    size_t index = chain_hash(key) % map->capacity;
+    ChainNode* prev = NULL;
+    for (ChainNode* node = map->buckets[index]; node; prev = node, node = node->next) {
+        if (strcmp(node->key, key) == 0) {
+            if (prev) prev->next = node->next; else map->buckets[index] = node->next;
+            free(node->key);
+            free(node->value);
+            free(node);
+            map->length--;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// -----------------------------------------------------------------------------
+// Driver
+// -----------------------------------------------------------------------------
+
+#define KEY_STRIDE 16  // "key:" / "mis:" + up to 8 digits + NUL
+
+enum { OP_INSERT, OP_HIT, OP_MISS, OP_REMOVE, OP_COUNT };
+static const char* op_names[OP_COUNT] = { "insert", "get hit", "get miss", "remove" };
+
+// Scattered visiting order: i * prime mod n (prime > any n, so a permutation)
+static size_t scatter(size_t i, size_t n) {
+    return (size_t)(((unsigned long long)i * 15485863ULL) % n);
+}
+
+static void run_swiss(const char* keys, const char* misses, size_t n, double* seconds) {
+    MelpMap* map = melp_map_create(sizeof(int64_t));
+    double t0 = now_seconds();
+    for (size_t i = 0; i < n; i++) {
+        int64_t value = (int64_t)i;
+        melp_map_insert(map, keys + i * KEY_STRIDE, &value);
+    }
+    double t1 = now_seconds();
+    for (size_t i = 0; i < n; i++) {
+        bench_sink += (size_t)melp_map_get(map, keys + scatter(i, n) * KEY_STRIDE);
+    }
+    double t2 = now_seconds();
+    for (size_t i = 0; i < n; i++) {
+        bench_sink += (size_t)melp_map_get(map, misses + scatter(i, n) * KEY_STRIDE);
+    }
+    double t3 = now_seconds();
+    for (size_t i = 0; i < n; i++) {
+        bench_sink += (size_t)melp_map_remove(map, keys + scatter(i, n) * KEY_STRIDE);
+    }
+    double t4 = now_seconds();
+    melp_map_free(map);
+
+    seconds[OP_INSERT] += t1 - t0;
+    seconds[OP_HIT] += t2 - t1;
+    seconds[OP_MISS] += t3 - t2;
+    seconds[OP_REMOVE] += t4 - t3;
+}
+
+static void run_chain(const char* keys, const char* misses, size_t n, double* seconds) {
+    ChainMap* map = chain_create(sizeof(int64_t));
+    double t0 = now_seconds();
+    for (size_t i = 0; i < n; i++) {
+        int64_t value = (int64_t)i;
+        chain_insert(map, keys + i * KEY_STRIDE, &value);
+    }
+    double t1 = now_seconds();
+    for (size_t i = 0; i < n; i++) {
+        bench_sink += (size_t)chain_get(map, keys + scatter(i, n) * KEY_STRIDE);
+    }
+    double t2 = now_seconds();
+    for (size_t i = 0; i < n; i++) {
+        bench_sink += (size_t)chain_get(map, misses + scatter(i, n) * KEY_STRIDE);
+    }
+    double t3 = now_seconds();
+    for (size_t i = 0; i < n; i++) {
+        bench_sink += (size_t)chain_remove(map, keys + scatter(i, n) * KEY_STRIDE);
+    }
+    double t4 = now_seconds();
+    chain_free(map);
+
+    seconds[OP_INSERT] += t1 - t0;
+    seconds[OP_HIT] += t2 - t1;
+    seconds[OP_MISS] += t3 - t2;
+    seconds[OP_REMOVE] += t4 - t3;
+}
+
+int main(int argc, char** argv) {
+    size_t max_entries = argc > 1 ? (size_t)atol(argv[1]) : 10000000;
+    if (max_entries < 1000) max_entries = 1000;
+
+    char* keys = malloc(max_entries * KEY_STRIDE);
+    char* misses = malloc(max_entries * KEY_STRIDE);
+    if (!keys || !misses) {
+        fprintf(stderr, "bench_map: cannot allocate %zu keys\n", max_entries);
+        return 1;
+    }
+    for (size_t i = 0; i < max_entries; i++) {
+        snprintf(keys + i * KEY_STRIDE, KEY_STRIDE, "key:%u", (unsigned)i);
+        snprintf(misses + i * KEY_STRIDE, KEY_STRIDE, "mis:%u", (unsigned)i);
+    }
+
+    printf("MelpMap: open addressing + wyhash vs previous chaining + FNV-1a (ns/op)\n\n");
+    printf("%10s  %-9s %10s %10s %8s\n", "entries", "op", "chained", "swiss", "speedup");
+
+    for (size_t n = 1000; n <= max_entries; n *= 10) {
+        size_t rounds = n < 1000000 ? 1000000 / n : 1;
+        double chain_seconds[OP_COUNT] = {0}, swiss_seconds[OP_COUNT] = {0};
+        for (size_t r = 0; r < rounds; r++) {
+            run_chain(keys, misses, n, chain_seconds);
+            run_swiss(keys, misses, n, swiss_seconds);
+        }
+
+        double ops = (double)n * (double)rounds;
+        for (int op = 0; op < OP_COUNT; op++) {
+            double chain_ns = chain_seconds[op] * 1e9 / ops;
+            double swiss_ns = swiss_seconds[op] * 1e9 / ops;
+            printf("%10zu  %-9s %10.1f %10.1f %7.2fx\n", n, op_names[op],
+                   chain_ns, swiss_ns, chain_ns / swiss_ns);
+        }
+    }
+
+    free(keys);
+    free(misses);
+    return 0;
+}
@@ -0,0 +1,301 @@
+/**
+ * State Manager Benchmark
+ * Throughput of mlp_state_get / mlp_state_set (mlp_state.c: sharded hash
+ * index, one read-write lock per shard):
+ * - vs the linked list it replaced (reproduced below: one pool entry per
+ *   key, strcmp scan from the head), single thread, ns per operation
+ * - vs key count and thread count: every thread gets (or updates) random
+ *   present keys; Mops/s over all threads, wall clock
+ * - persistence: json mode (save rewrites the whole file) vs log mode
+ *   (changes appended, save syncs the log), both with fsync=never, for
+ *   "change 100 keys + save" and for a restart (init + load), in ms
+ * Keys are "state:key:<i>" strings built before timing; values are short
+ * (inline) strings. get includes the copy the API returns.
+ *
+ * Usage: make bench   (or ./bench_state [max_keys], default 1000000)
+ */
+
+#define _POSIX_C_SOURCE 200809L  // clock_gettime, strdup
+
+#include "mlp_state.h"
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Sink so the optimizer cannot drop results
+static volatile size_t bench_sink;
+
+// -----------------------------------------------------------------------------
+// Baseline: the previous linked-list store
+// -----------------------------------------------------------------------------
+
+#define LIST_SSO_SIZE 24
+
+typedef struct ListEntry {
+    char* key;
+    union {
+        char sso_data[LIST_SSO_SIZE];
+        char* heap_ptr;
+    } value;
+    size_t value_len;
+    uint8_t is_heap;
+    struct ListEntry* next;
+} ListEntry;
+
+static ListEntry* list_head = NULL;
+
+static ListEntry* list_find(const char* key) {
+    for (ListEntry* entry = list_head; entry; entry = entry->next) {
+        if (strcmp(entry->key, key) == 0) return entry;
+    }
+    return NULL;
+}
+
+static void list_store(ListEntry* entry, const char* value) {
+    size_t len = strlen(value);
+    if (entry->is_heap) free(entry->value.heap_ptr);
+    if (len < LIST_SSO_SIZE) {
+        memcpy(entry->value.sso_data, value, len + 1);
+        entry->is_heap = 0;
+    } else {
+        entry->value.heap_ptr = strdup(value);
+        entry->is_heap = 1;
+    }
+    entry->value_len = len;
+}
+
+static void list_set(const char* key, const char* value) {
+    ListEntry* entry = list_find(key);
+    if (!entry) {
+        entry = calloc(1, sizeof(ListEntry));
+        entry->key = strdup(key);
+        entry->next = list_head;
+        list_head = entry;
+    }
+    list_store(entry, value);
+}
+
+static char* list_get(const char* key) {
+    ListEntry* entry = list_find(key);
+    if (!entry) return strdup("");
+    return strdup(entry->is_heap ? entry->value.heap_ptr : entry->value.sso_data);
+}
+
+// Populate without the scan: every key is new, so the list ends up the same
+static void list_fill(const char* keys, size_t n, size_t stride) {
+    for (size_t i = 0; i < n; i++) {
+        ListEntry* entry = calloc(1, sizeof(ListEntry));
+        entry->key = strdup(keys + i * stride);
+        entry->next = list_head;
+        list_head = entry;
+        list_store(entry, "value");
+    }
+}
+
+static void list_free(void) {
+    while (list_head) {
+        ListEntry* next = list_head->next;
+        if (list_head->is_heap) free(list_head->value.heap_ptr);
+        free(list_head->key);
+        free(list_head);
+        list_head = next;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Driver
+// -----------------------------------------------------------------------------
+
+#define KEY_STRIDE 24  // "state:key:" + up to 10 digits + NUL
+#define THREAD_OPS 500000
+#define MAX_THREADS 8
+#define PERSIST_BASE "bench_state_persist"
+
+static char* keys;
+
+// Scattered visiting order: i * prime mod n (prime > any n, so a permutation)
+static size_t scatter(size_t i, size_t n) {
+    return (size_t)(((unsigned long long)i * 15485863ULL) % n);
+}
+
+static void fill_state(size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        mlp_state_set(keys + i * KEY_STRIDE, "value");
+    }
+}
+
+typedef struct {
+    size_t n;
+    size_t seed;
+    int update;  // 0: get, 1: set (existing keys)
+} Worker;
+
+static void* run_worker(void* arg) {
+    Worker* worker = (Worker*)arg;
+    uint64_t x = 0x9E3779B97F4A7C15ULL * (worker->seed + 1);
+    size_t sink = 0;
+    for (size_t i = 0; i < THREAD_OPS; i++) {
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;  // xorshift64
+        const char* key = keys + (size_t)(x % worker->n) * KEY_STRIDE;
+        if (worker->update) {
+            sink += (size_t)mlp_state_set(key, (i & 1) ? "odd" : "even");
+        } else {
+            char* value = mlp_state_get(key);
+            sink += (size_t)value[0];
+            free(value);
+        }
+    }
+    bench_sink += sink;
+    return NULL;
+}
+
+// Mops/s of threads workers running THREAD_OPS operations each
+static double run_threads(size_t n, int threads, int update) {
+    pthread_t ids[MAX_THREADS];
+    Worker workers[MAX_THREADS];
+    double t0 = now_seconds();
+    for (int t = 0; t < threads; t++) {
+        workers[t] = (Worker){ n, (size_t)t, update };
+        pthread_create(&ids[t], NULL, run_worker, &workers[t]);
+    }
+    for (int t = 0; t < threads; t++) {
+        pthread_join(ids[t], NULL);
+    }
+    double seconds = now_seconds() - t0;
+    return (double)THREAD_OPS * threads / seconds / 1e6;
+}
+
+int main(int argc, char** argv) {
+    size_t max_keys = argc > 1 ? (size_t)atol(argv[1]) : 1000000;
+    if (max_keys < 1000) max_keys = 1000;
+
+    keys = malloc(max_keys * KEY_STRIDE);
+    if (!keys) {
+        fprintf(stderr, "bench_state: cannot allocate %zu keys\n", max_keys);
+        return 1;
+    }
+    for (size_t i = 0; i < max_keys; i++) {
+        snprintf(keys + i * KEY_STRIDE, KEY_STRIDE, "state:key:%u", (unsigned)i);
+    }
+
+    printf("State manager: sharded hash index vs previous linked list (ns/op, 1 thread)\n\n");
+    printf("%10s  %-9s %12s %10s %9s\n", "keys", "op", "linked list", "sharded", "speedup");
+
+    // The list scans half its length per hit: sample fewer operations as it grows
+    for (size_t n = 1000; n <= max_keys && n <= 100000; n *= 10) {
+        size_t ops = 200000000 / n;
+        if (ops > 1000000) ops = 1000000;
+
+        list_fill(keys, n, KEY_STRIDE);
+        double t0 = now_seconds();
+        for (size_t i = 0; i < ops; i++) {
+            char* value = list_get(keys + scatter(i, n) * KEY_STRIDE);
+            bench_sink += (size_t)value[0];
+            free(value);
+        }
+        double t1 = now_seconds();
+        for (size_t i = 0; i < ops; i++) {
+            list_set(keys + scatter(i, n) * KEY_STRIDE, (i & 1) ? "odd" : "even");
+        }
+        double t2 = now_seconds();
+        list_free();
+
+        mlp_state_init();
+        fill_state(n);
+        double t3 = now_seconds();
+        for (size_t i = 0; i < ops; i++) {
+            char* value = mlp_state_get(keys + scatter(i, n) * KEY_STRIDE);
+            bench_sink += (size_t)value[0];
+            free(value);
+        }
+        double t4 = now_seconds();
+        for (size_t i = 0; i < ops; i++) {
+            mlp_state_set(keys + scatter(i, n) * KEY_STRIDE, (i & 1) ? "odd" : "even");
+        }
+        double t5 = now_seconds();
+        mlp_state_close();
+
+        double list_get_ns = (t1 - t0) * 1e9 / (double)ops;
+        double list_set_ns = (t2 - t1) * 1e9 / (double)ops;
+        double get_ns = (t4 - t3) * 1e9 / (double)ops;
+        double set_ns = (t5 - t4) * 1e9 / (double)ops;
+        printf("%10zu  %-9s %12.1f %10.1f %8.1fx\n", n, "get", list_get_ns, get_ns, list_get_ns / get_ns);
+        printf("%10zu  %-9s %12.1f %10.1f %8.1fx\n", n, "set", list_set_ns, set_ns, list_set_ns / set_ns);
+    }
+
+    printf("\nThroughput vs threads (Mops/s, %d ops per thread, %ld CPUs online)\n\n",
+           THREAD_OPS, sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%10s  %7s %10s %10s\n", "keys", "threads", "get", "set");
+
+    for (size_t n = 1000; n <= max_keys; n *= 10) {
+        mlp_state_init();
+        double t0 = now_seconds();
+        fill_state(n);
+        double fill_ns = (now_seconds() - t0) * 1e9 / (double)n;
+
+        for (int threads = 1; threads <= MAX_THREADS; threads *= 2) {
+            double get_mops = run_threads(n, threads, 0);
+            double set_mops = run_threads(n, threads, 1);
+            printf("%10zu  %7d %10.2f %10.2f\n", n, threads, get_mops, set_mops);
+        }
+        printf("%10zu  (insert of every key: %.1f ns/op)\n", n, fill_ns);
+        mlp_state_close();
+    }
+
+    printf("\nPersistence: json vs log mode (ms, fsync=never)\n\n");
+    printf("%10s  %-22s %10s %10s %9s\n", "keys", "op", "json", "log", "speedup");
+
+    for (size_t n = 1000; n <= max_keys && n <= 100000; n *= 10) {
+        double seconds[2][2];  // [mode][0: 100 changes + save, 1: restart]
+        for (int mode = 0; mode < 2; mode++) {
+            mlp_state_init();
+            mlp_state_config_set("persist_file", PERSIST_BASE);
+            mlp_state_config_set("persist_mode", mode ? "log" : "json");
+            mlp_state_config_set("fsync", "never");
+            fill_state(n);
+            mlp_state_save();
+            if (mode) mlp_state_compact();  // Start from a snapshot and an empty log
+
+            // 10 rounds of 100 updates, each followed by a save
+            double t0 = now_seconds();
+            for (size_t round = 0; round < 10; round++) {
+                for (size_t i = 0; i < 100; i++) {
+                    mlp_state_set(keys + scatter(round * 100 + i, n) * KEY_STRIDE, "changed");
+                }
+                mlp_state_save();
+            }
+            seconds[mode][0] = (now_seconds() - t0) / 10;
+            mlp_state_close();
+
+            t0 = now_seconds();
+            mlp_state_init();
+            mlp_state_config_set("persist_file", PERSIST_BASE);
+            mlp_state_config_set("persist_mode", mode ? "log" : "json");
+            mlp_state_load();
+            seconds[mode][1] = now_seconds() - t0;
+            bench_sink += (size_t)mlp_state_has(keys);
+            mlp_state_close();
+        }
+        remove(PERSIST_BASE);
+        remove(PERSIST_BASE ".log");
+        remove(PERSIST_BASE ".snapshot");
+
+        printf("%10zu  %-22s %10.3f %10.3f %8.1fx\n", n, "100 changes + save",
+               seconds[0][0] * 1e3, seconds[1][0] * 1e3, seconds[0][0] / seconds[1][0]);
+        printf("%10zu  %-22s %10.3f %10.3f %8.1fx\n", n, "restart (init + load)",
+               seconds[0][1] * 1e3, seconds[1][1] * 1e3, seconds[0][1] / seconds[1][1]);
+    }
+
+    free(keys);
+    return 0;
+}
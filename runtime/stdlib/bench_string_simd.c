@@ -0,0 +1,125 @@
+/**
+ * SIMD String Kernel Benchmark
+ * Throughput (GB/s) of each kernel set on 1 KB - 100 MB inputs:
+ * - find:  substring that does not occur, in lower-case text with spaces
+ *          (first/last needle bytes are common, so filtering is exercised)
+ * - upper: case conversion of the same text
+ * - span:  leading whitespace run covering the whole input (trim)
+ * find also gets a libc memmem row as a reference point.
+ * Each case runs until it has used ~0.2s of wall clock.
+ *
+ * Usage: make bench   (or ./bench_string_simd [min_seconds] [max_mb])
+ */
+
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+#include "mlp_string_simd.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+void* memmem(const void* haystack, size_t haystack_len, const void* needle, size_t needle_len);
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Sink so the optimizer cannot drop results
+static volatile size_t bench_sink;
+
+typedef enum { OP_FIND, OP_MEMMEM, OP_UPPER, OP_SPAN } BenchOp;
+
+static const char* needle = "melp_runtime";
+
+static void run_op(BenchOp op, const char* text, const char* spaces, char* out, size_t length) {
+    switch (op) {
+        case OP_FIND:
+            bench_sink = (size_t)mlp_simd_find(text, length, needle, strlen(needle));
+            break;
+        case OP_MEMMEM:
+            bench_sink = (size_t)memmem(text, length, needle, strlen(needle));
+            break;
+        case OP_UPPER:
+            mlp_simd_case_map(out, text, length, 1);
+            bench_sink = (size_t)out[length - 1];
+            break;
+        case OP_SPAN:
+            bench_sink = mlp_simd_span_space(spaces, length);
+            break;
+    }
+}
+
+static void bench_op(BenchOp op, const char* name, const char* level_name,
+                     const char* text, const char* spaces, char* out,
+                     size_t length, double min_seconds) {
+    // Batches of ~1 MB between clock reads, so small inputs are not timing the clock
+    long batch = length < (1 << 20) ? (long)((1 << 20) / length) : 1;
+    long runs = 0;
+    double start = now_seconds();
+    double elapsed = 0.0;
+    do {
+        for (long i = 0; i < batch; i++) {
+            run_op(op, text, spaces, out, length);
+        }
+        runs += batch;
+        elapsed = now_seconds() - start;
+    } while (elapsed < min_seconds);
+
+    double gb_per_second = (double)length * (double)runs / elapsed / 1e9;
+    printf("%-6s %-7s %9zu KB %10.2f\n", name, level_name, length / 1024, gb_per_second);
+}
+
+int main(int argc, char** argv) {
+    double min_seconds = (argc > 1) ? atof(argv[1]) : 0.2;
+    size_t max_mb = (argc > 2) ? (size_t)atol(argv[2]) : 100;
+    size_t max_length = max_mb * 1024 * 1024;
+
+    const size_t sizes[] = {
+        1024, 64 * 1024, 1024 * 1024, 16 * 1024 * 1024, 100 * 1024 * 1024
+    };
+
+    char* text = malloc(max_length);
+    char* spaces = malloc(max_length);
+    char* out = malloc(max_length);
+    if (!text || !spaces || !out) {
+        fprintf(stderr, "Error: bench_string_simd - malloc failed\n");
+        return 1;
+    }
+
+    const char* alphabet = "abcdefghijklmnopqrstuvwxyz ";
+    unsigned seed = 12345;
+    for (size_t i = 0; i < max_length; i++) {
+        seed = seed * 1103515245u + 12345u;
+        text[i] = alphabet[(seed >> 16) % 27];
+    }
+    memset(spaces, ' ', max_length);
+
+    MlpSimdLevel max_level = mlp_simd_max_level();
+    printf("CPU kernel set: %s\n\n", mlp_simd_level_name(max_level));
+    printf("%-6s %-7s %12s %10s\n", "op", "kernels", "size", "GB/s");
+
+    const BenchOp ops[] = { OP_FIND, OP_UPPER, OP_SPAN };
+    const char* names[] = { "find", "upper", "span" };
+    for (size_t o = 0; o < sizeof(ops) / sizeof(ops[0]); o++) {
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+            if (sizes[s] > max_length) break;
+            for (int level = MLP_SIMD_SCALAR; level <= (int)max_level; level++) {
+                mlp_simd_set_level((MlpSimdLevel)level);
+                bench_op(ops[o], names[o], mlp_simd_level_name((MlpSimdLevel)level),
+                         text, spaces, out, sizes[s], min_seconds);
+            }
+            if (ops[o] == OP_FIND) {
+                bench_op(OP_MEMMEM, "find", "memmem", text, spaces, out, sizes[s], min_seconds);
+            }
+        }
+        printf("\n");
+    }
+
+    free(text);
+    free(spaces);
+    free(out);
+    return 0;
+}
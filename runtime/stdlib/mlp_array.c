@@ -3,28 +3,32 @@
  * 
  * Minimal array support for Stage 2 bridge
  * Wrapper around melp_list for fixed-size numeric arrays
+ * (int64_t elements read and written directly in the list buffer)
+ * Bulk numeric[] operations run the vector kernels in mlp_array_simd.c
  * 
  * Task 0.3 - Stage 2 Bridge
  * Date: 2 Ocak 2026
  */
 
 #include "mlp_array.h"
+#include "mlp_array_simd.h"
+#include "mlp_panic.h"
 #include <stdlib.h>
 #include <string.h>
 
 /**
  * Create a fixed-size numeric array
- * Pre-allocates space for 'size' int64_t elements
+ * Allocates 'size' zeroed int64_t elements in one buffer
  */
 MelpList* mlp_array_create(size_t size) {
     // Create list with element size = int64_t
     MelpList* arr = melp_list_create(sizeof(int64_t));
     if (!arr) return NULL;
     
-    // Pre-allocate space by appending zeros
-    int64_t zero = 0;
-    for (size_t i = 0; i < size; i++) {
-        melp_list_append(arr, &zero);
+    // One allocation for all elements, zero-filled
+    if (melp_list_resize(arr, size) != 0) {
+        melp_list_free(arr);
+        return NULL;
     }
     
     return arr;
@@ -37,18 +41,103 @@ MelpList* mlp_array_create(size_t size) {
 int64_t mlp_array_get(MelpList* arr, size_t index) {
     if (!arr) return 0;
     
-    void* ptr = melp_list_get(arr, index);
-    if (!ptr) return 0;  // Out of bounds
+    if (index >= arr->length) {
+        // Same bounds check failure as melp_list_get
+        mlp_runtime_error("List index out of bounds");
+        return 0;
+    }
     
-    // Dereference to get int64_t value
-    return *(int64_t*)ptr;
+    return ((int64_t*)arr->elements)[index];
 }
 
 /**
  * Set element in array
  */
 int mlp_array_set(MelpList* arr, size_t index, int64_t value) {
-    if (!arr) return -1;
+    if (!arr || index >= arr->length) return -1;
     
-    return melp_list_set(arr, index, &value);
+    ((int64_t*)arr->elements)[index] = value;
+    return 0;
+}
+
+// -----------------------------------------------------------------------------
+// Bulk Operations
+// -----------------------------------------------------------------------------
+
+// Element pointer and length (a NULL list is empty)
+static int64_t* array_data(MelpList* arr) {
+    return arr ? (int64_t*)arr->elements : NULL;
+}
+
+static size_t array_length(MelpList* arr) {
+    return arr ? arr->length : 0;
+}
+
+static size_t same_length(MelpList* a, MelpList* b, const char* message) {
+    if (array_length(a) != array_length(b)) {
+        mlp_runtime_error(message);
+    }
+    return array_length(a);
+}
+
+void mlp_array_fill(MelpList* arr, int64_t value) {
+    mlp_simd_fill64(array_data(arr), array_length(arr), (uint64_t)value);
+}
+
+void mlp_array_copy(MelpList* dst, MelpList* src) {
+    size_t length = same_length(dst, src, "copy: lists differ in length");
+    mlp_simd_copy64(array_data(dst), array_data(src), length);
+}
+
+int64_t mlp_array_sum(MelpList* arr) {
+    return mlp_simd_i64_sum(array_data(arr), array_length(arr));
+}
+
+int64_t mlp_array_min(MelpList* arr) {
+    if (array_length(arr) == 0) {
+        mlp_runtime_error("min of an empty list");
+    }
+    return mlp_simd_i64_min(array_data(arr), array_length(arr));
+}
+
+int64_t mlp_array_max(MelpList* arr) {
+    if (array_length(arr) == 0) {
+        mlp_runtime_error("max of an empty list");
+    }
+    return mlp_simd_i64_max(array_data(arr), array_length(arr));
+}
+
+int64_t mlp_array_dot(MelpList* a, MelpList* b) {
+    size_t length = same_length(a, b, "dot: lists differ in length");
+    return mlp_simd_i64_dot(array_data(a), array_data(b), length);
+}
+
+void mlp_array_scale(MelpList* arr, int64_t factor) {
+    mlp_simd_i64_scale(array_data(arr), array_data(arr), array_length(arr), factor);
+}
+
+void mlp_array_add(MelpList* dst, MelpList* src) {
+    size_t length = same_length(dst, src, "add: lists differ in length");
+    mlp_simd_i64_add(array_data(dst), array_data(dst), array_data(src), length);
+}
+
+void mlp_array_mul(MelpList* dst, MelpList* src) {
+    size_t length = same_length(dst, src, "mul: lists differ in length");
+    mlp_simd_i64_mul(array_data(dst), array_data(dst), array_data(src), length);
+}
+
+void mlp_array_prefix_sum(MelpList* arr) {
+    mlp_simd_i64_prefix_sum(array_data(arr), array_data(arr), array_length(arr));
+}
+
+int64_t mlp_array_count_less(MelpList* arr, int64_t value) {
+    return (int64_t)mlp_simd_i64_count_if(array_data(arr), array_length(arr), MLP_CMP_LT, value);
+}
+
+int64_t mlp_array_count_equal(MelpList* arr, int64_t value) {
+    return (int64_t)mlp_simd_i64_count_if(array_data(arr), array_length(arr), MLP_CMP_EQ, value);
+}
+
+int64_t mlp_array_count_greater(MelpList* arr, int64_t value) {
+    return (int64_t)mlp_simd_i64_count_if(array_data(arr), array_length(arr), MLP_CMP_GT, value);
 }
@@ -3,6 +3,7 @@
  * 
  * Minimal array support for Stage 2 bridge
  * Wrapper around melp_list for fixed-size numeric arrays
+ * (int64_t elements read and written directly in the list buffer)
  * 
  * Task 0.3 - Stage 2 Bridge
  * Date: 2 Ocak 2026
@@ -47,4 +48,38 @@ int64_t mlp_array_get(MelpList* arr, size_t index);
  */
 int mlp_array_set(MelpList* arr, size_t index, int64_t value);
 
+// -----------------------------------------------------------------------------
+// Bulk Operations (numeric[] builtins, vectorized by mlp_array_simd.c)
+// -----------------------------------------------------------------------------
+// Compiled code passes numeric[] values (MelpList of int64_t) directly.
+// Binary operations need equal lengths and, like min / max of an empty
+// list, stop the program with mlp_runtime_error otherwise.
+
+/** fill(xs; value): every element = value */
+void mlp_array_fill(MelpList* arr, int64_t value);
+
+/** copy(dst; src): dst[i] = src[i] */
+void mlp_array_copy(MelpList* dst, MelpList* src);
+
+/** sum(xs), min(xs), max(xs) */
+int64_t mlp_array_sum(MelpList* arr);
+int64_t mlp_array_min(MelpList* arr);
+int64_t mlp_array_max(MelpList* arr);
+
+/** dot(xs; ys): sum of xs[i] * ys[i] */
+int64_t mlp_array_dot(MelpList* a, MelpList* b);
+
+/** scale(xs; factor), add(xs; ys), mul(xs; ys): in place on the first list */
+void mlp_array_scale(MelpList* arr, int64_t factor);
+void mlp_array_add(MelpList* dst, MelpList* src);
+void mlp_array_mul(MelpList* dst, MelpList* src);
+
+/** prefix_sum(xs): xs[i] = xs[0] + ... + xs[i] */
+void mlp_array_prefix_sum(MelpList* arr);
+
+/** count_less / count_equal / count_greater(xs; value) */
+int64_t mlp_array_count_less(MelpList* arr, int64_t value);
+int64_t mlp_array_count_equal(MelpList* arr, int64_t value);
+int64_t mlp_array_count_greater(MelpList* arr, int64_t value);
+
 #endif // MLP_ARRAY_H
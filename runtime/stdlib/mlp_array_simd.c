@@ -0,0 +1,827 @@
+/**
+ * MLP Standard Library - Vectorized Numeric Array Kernels
+ *
+ * Element-wise kernels (fill, copy, scale, add, mul) are plain load / op /
+ * store loops. Reductions keep one partial result per lane and fold the
+ * lanes at the end; double sums and dot products use four vector
+ * accumulators under AVX2 so the add latency does not bound the loop.
+ * Prefix sums scan each vector in registers (log2(lanes) shifted adds),
+ * then add the running total; the total advances by the vector's last lane,
+ * so the loop-carried chain is a single add per vector.
+ *
+ * SSE2 has no 64-bit integer multiply or compare: products are built from
+ * 32x32->64 multiplies, and int64 min / max / count_if use the scalar
+ * kernels at that level. As in mlp_string_simd.c, AVX2 kernels use a
+ * target attribute and scalar tails.
+ *
+ * Created: 4 Şubat 2026
+ */
+
+#include "mlp_array_simd.h"
+#include <string.h>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define MLP_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define MLP_SIMD_X86 0
+#endif
+
+typedef struct {
+    void (*fill64)(uint64_t*, size_t, uint64_t);
+    void (*copy64)(uint64_t*, const uint64_t*, size_t);
+
+    int64_t (*i64_sum)(const int64_t*, size_t);
+    int64_t (*i64_min)(const int64_t*, size_t);
+    int64_t (*i64_max)(const int64_t*, size_t);
+    int64_t (*i64_dot)(const int64_t*, const int64_t*, size_t);
+    void (*i64_scale)(int64_t*, const int64_t*, size_t, int64_t);
+    void (*i64_add)(int64_t*, const int64_t*, const int64_t*, size_t);
+    void (*i64_mul)(int64_t*, const int64_t*, const int64_t*, size_t);
+    void (*i64_prefix_sum)(int64_t*, const int64_t*, size_t);
+    size_t (*i64_count_if)(const int64_t*, size_t, MlpCompare, int64_t);
+
+    double (*f64_sum)(const double*, size_t);
+    double (*f64_min)(const double*, size_t);
+    double (*f64_max)(const double*, size_t);
+    double (*f64_dot)(const double*, const double*, size_t);
+    void (*f64_scale)(double*, const double*, size_t, double);
+    void (*f64_add)(double*, const double*, const double*, size_t);
+    void (*f64_mul)(double*, const double*, const double*, size_t);
+    void (*f64_prefix_sum)(double*, const double*, size_t);
+    size_t (*f64_count_if)(const double*, size_t, MlpCompare, double);
+} ArrayKernels;
+
+// -----------------------------------------------------------------------------
+// Scalar kernels (reference; also used for vector tails)
+// -----------------------------------------------------------------------------
+
+// Integer arithmetic goes through uint64_t so overflow wraps instead of UB
+
+static void fill64_scalar(uint64_t* dst, size_t length, uint64_t value) {
+    for (size_t i = 0; i < length; i++) dst[i] = value;
+}
+
+static void copy64_scalar(uint64_t* dst, const uint64_t* src, size_t length) {
+    for (size_t i = 0; i < length; i++) dst[i] = src[i];
+}
+
+static int64_t i64_sum_scalar(const int64_t* src, size_t length) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < length; i++) sum += (uint64_t)src[i];
+    return (int64_t)sum;
+}
+
+static int64_t i64_min_scalar(const int64_t* src, size_t length) {
+    int64_t min = INT64_MAX;
+    for (size_t i = 0; i < length; i++) min = src[i] < min ? src[i] : min;
+    return min;
+}
+
+static int64_t i64_max_scalar(const int64_t* src, size_t length) {
+    int64_t max = INT64_MIN;
+    for (size_t i = 0; i < length; i++) max = src[i] > max ? src[i] : max;
+    return max;
+}
+
+static int64_t i64_dot_scalar(const int64_t* a, const int64_t* b, size_t length) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < length; i++) sum += (uint64_t)a[i] * (uint64_t)b[i];
+    return (int64_t)sum;
+}
+
+static void i64_scale_scalar(int64_t* dst, const int64_t* src, size_t length, int64_t factor) {
+    for (size_t i = 0; i < length; i++) dst[i] = (int64_t)((uint64_t)src[i] * (uint64_t)factor);
+}
+
+static void i64_add_scalar(int64_t* dst, const int64_t* a, const int64_t* b, size_t length) {
+    for (size_t i = 0; i < length; i++) dst[i] = (int64_t)((uint64_t)a[i] + (uint64_t)b[i]);
+}
+
+static void i64_mul_scalar(int64_t* dst, const int64_t* a, const int64_t* b, size_t length) {
+    for (size_t i = 0; i < length; i++) dst[i] = (int64_t)((uint64_t)a[i] * (uint64_t)b[i]);
+}
+
+static void i64_prefix_sum_scalar(int64_t* dst, const int64_t* src, size_t length) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < length; i++) {
+        sum += (uint64_t)src[i];
+        dst[i] = (int64_t)sum;
+    }
+}
+
+static int i64_compare(int64_t x, MlpCompare op, int64_t value) {
+    switch (op) {
+        case MLP_CMP_LT: return x < value;
+        case MLP_CMP_LE: return x <= value;
+        case MLP_CMP_EQ: return x == value;
+        case MLP_CMP_NE: return x != value;
+        case MLP_CMP_GE: return x >= value;
+        case MLP_CMP_GT: return x > value;
+    }
+    return 0;
+}
+
+static size_t i64_count_if_scalar(const int64_t* src, size_t length, MlpCompare op, int64_t value) {
+    size_t count = 0;
+    for (size_t i = 0; i < length; i++) count += (size_t)i64_compare(src[i], op, value);
+    return count;
+}
+
+static double f64_sum_scalar(const double* src, size_t length) {
+    double sum = 0.0;
+    for (size_t i = 0; i < length; i++) sum += src[i];
+    return sum;
+}
+
+static double f64_min_scalar(const double* src, size_t length) {
+    double min = __builtin_inf();
+    for (size_t i = 0; i < length; i++) min = src[i] < min ? src[i] : min;
+    return min;
+}
+
+static double f64_max_scalar(const double* src, size_t length) {
+    double max = -__builtin_inf();
+    for (size_t i = 0; i < length; i++) max = src[i] > max ? src[i] : max;
+    return max;
+}
+
+static double f64_dot_scalar(const double* a, const double* b, size_t length) {
+    double sum = 0.0;
+    for (size_t i = 0; i < length; i++) sum += a[i] * b[i];
+    return sum;
+}
+
+static void f64_scale_scalar(double* dst, const double* src, size_t length, double factor) {
+    for (size_t i = 0; i < length; i++) dst[i] = src[i] * factor;
+}
+
+static void f64_add_scalar(double* dst, const double* a, const double* b, size_t length) {
+    for (size_t i = 0; i < length; i++) dst[i] = a[i] + b[i];
+}
+
+static void f64_mul_scalar(double* dst, const double* a, const double* b, size_t length) {
+    for (size_t i = 0; i < length; i++) dst[i] = a[i] * b[i];
+}
+
+static void f64_prefix_sum_scalar(double* dst, const double* src, size_t length) {
+    double sum = 0.0;
+    for (size_t i = 0; i < length; i++) {
+        sum += src[i];
+        dst[i] = sum;
+    }
+}
+
+static int f64_compare(double x, MlpCompare op, double value) {
+    switch (op) {
+        case MLP_CMP_LT: return x < value;
+        case MLP_CMP_LE: return x <= value;
+        case MLP_CMP_EQ: return x == value;
+        case MLP_CMP_NE: return x != value;
+        case MLP_CMP_GE: return x >= value;
+        case MLP_CMP_GT: return x > value;
+    }
+    return 0;
+}
+
+static size_t f64_count_if_scalar(const double* src, size_t length, MlpCompare op, double value) {
+    size_t count = 0;
+    for (size_t i = 0; i < length; i++) count += (size_t)f64_compare(src[i], op, value);
+    return count;
+}
+
+#if MLP_SIMD_X86
+
+/* count_if in vector form: every predicate is (lt & sel_lt) | (eq & sel_eq)
+ * | (gt & sel_gt), optionally inverted (NE). Selectors are all-ones or
+ * zero lanes, so the loops need no per-op variants (and no compare
+ * immediates, which unoptimized builds cannot fold).
+ */
+typedef struct {
+    int64_t lt, eq, gt, invert;
+} CompareSelect;
+
+static CompareSelect compare_select(MlpCompare op) {
+    CompareSelect s = { 0, 0, 0, 0 };
+    switch (op) {
+        case MLP_CMP_LT: s.lt = -1; break;
+        case MLP_CMP_LE: s.lt = -1; s.eq = -1; break;
+        case MLP_CMP_EQ: s.eq = -1; break;
+        case MLP_CMP_NE: s.eq = -1; s.invert = -1; break;
+        case MLP_CMP_GE: s.gt = -1; s.eq = -1; break;
+        case MLP_CMP_GT: s.gt = -1; break;
+    }
+    return s;
+}
+
+// -----------------------------------------------------------------------------
+// SSE2 kernels (2 lanes)
+// -----------------------------------------------------------------------------
+
+static int64_t lanes_sum_sse2(__m128i v) {
+    int64_t lanes[2];
+    _mm_storeu_si128((__m128i*)lanes, v);
+    return (int64_t)((uint64_t)lanes[0] + (uint64_t)lanes[1]);
+}
+
+// Low 64 bits of a * b per lane: lo*lo + ((lo*hi + hi*lo) << 32)
+static __m128i mul_epi64_sse2(__m128i a, __m128i b) {
+    __m128i lo = _mm_mul_epu32(a, b);
+    __m128i cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), b),
+                                  _mm_mul_epu32(a, _mm_srli_epi64(b, 32)));
+    return _mm_add_epi64(lo, _mm_slli_epi64(cross, 32));
+}
+
+static void fill64_sse2(uint64_t* dst, size_t length, uint64_t value) {
+    __m128i v = _mm_set1_epi64x((long long)value);
+    size_t i = 0;
+    for (; i + 2 <= length; i += 2) _mm_storeu_si128((__m128i*)(dst + i), v);
+    fill64_scalar(dst + i, length - i, value);
+}
+
+static void copy64_sse2(uint64_t* dst, const uint64_t* src, size_t length) {
+    size_t i = 0;
+    for (; i + 2 <= length; i += 2) {
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_loadu_si128((const __m128i*)(src + i)));
+    }
+    copy64_scalar(dst + i, src + i, length - i);
+}
+
+static int64_t i64_sum_sse2(const int64_t* src, size_t length) {
+    __m128i acc = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 2 <= length; i += 2) acc = _mm_add_epi64(acc, _mm_loadu_si128((const __m128i*)(src + i)));
+    return (int64_t)((uint64_t)lanes_sum_sse2(acc) + (uint64_t)i64_sum_scalar(src + i, length - i));
+}
+
+static int64_t i64_dot_sse2(const int64_t* a, const int64_t* b, size_t length) {
+    __m128i acc = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 2 <= length; i += 2) {
+        acc = _mm_add_epi64(acc, mul_epi64_sse2(_mm_loadu_si128((const __m128i*)(a + i)),
+                                                _mm_loadu_si128((const __m128i*)(b + i))));
+    }
+    return (int64_t)((uint64_t)lanes_sum_sse2(acc) + (uint64_t)i64_dot_scalar(a + i, b + i, length - i));
+}
+
+static void i64_scale_sse2(int64_t* dst, const int64_t* src, size_t length, int64_t factor) {
+    __m128i f = _mm_set1_epi64x(factor);
+    size_t i = 0;
+    for (; i + 2 <= length; i += 2) {
+        _mm_storeu_si128((__m128i*)(dst + i), mul_epi64_sse2(_mm_loadu_si128((const __m128i*)(src + i)), f));
+    }
+    i64_scale_scalar(dst + i, src + i, length - i, factor);
+}
+
+static void i64_add_sse2(int64_t* dst, const int64_t* a, const int64_t* b, size_t length) {
+    size_t i = 0;
+    for (; i + 2 <= length; i += 2) {
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_add_epi64(_mm_loadu_si128((const __m128i*)(a + i)),
+                                                            _mm_loadu_si128((const __m128i*)(b + i))));
+    }
+    i64_add_scalar(dst + i, a + i, b + i, length - i);
+}
+
+static void i64_mul_sse2(int64_t* dst, const int64_t* a, const int64_t* b, size_t length) {
+    size_t i = 0;
+    for (; i + 2 <= length; i += 2) {
+        _mm_storeu_si128((__m128i*)(dst + i), mul_epi64_sse2(_mm_loadu_si128((const __m128i*)(a + i)),
+                                                             _mm_loadu_si128((const __m128i*)(b + i))));
+    }
+    i64_mul_scalar(dst + i, a + i, b + i, length - i);
+}
+
+static void i64_prefix_sum_sse2(int64_t* dst, const int64_t* src, size_t length) {
+    __m128i carry = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 2 <= length; i += 2) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(src + i));
+        x = _mm_add_epi64(x, _mm_slli_si128(x, 8));  // [x0, x0 + x1]
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_add_epi64(x, carry));
+        carry = _mm_add_epi64(carry, _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 2, 3, 2)));
+    }
+    int64_t running = _mm_cvtsi128_si64(carry);
+    for (; i < length; i++) {
+        running = (int64_t)((uint64_t)running + (uint64_t)src[i]);
+        dst[i] = running;
+    }
+}
+
+static double f64_sum_sse2(const double* src, size_t length) {
+    __m128d acc0 = _mm_setzero_pd(), acc1 = _mm_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        acc0 = _mm_add_pd(acc0, _mm_loadu_pd(src + i));
+        acc1 = _mm_add_pd(acc1, _mm_loadu_pd(src + i + 2));
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, _mm_add_pd(acc0, acc1));
+    return lanes[0] + lanes[1] + f64_sum_scalar(src + i, length - i);
+}
+
+static double f64_min_sse2(const double* src, size_t length) {
+    __m128d m = _mm_set1_pd(__builtin_inf());
+    size_t i = 0;
+    for (; i + 2 <= length; i += 2) m = _mm_min_pd(m, _mm_loadu_pd(src + i));
+    double lanes[2];
+    _mm_storeu_pd(lanes, m);
+    double tail = f64_min_scalar(src + i, length - i);
+    double min = lanes[0] < lanes[1] ? lanes[0] : lanes[1];
+    return tail < min ? tail : min;
+}
+
+static double f64_max_sse2(const double* src, size_t length) {
+    __m128d m = _mm_set1_pd(-__builtin_inf());
+    size_t i = 0;
+    for (; i + 2 <= length; i += 2) m = _mm_max_pd(m, _mm_loadu_pd(src + i));
+    double lanes[2];
+    _mm_storeu_pd(lanes, m);
+    double tail = f64_max_scalar(src + i, length - i);
+    double max = lanes[0] > lanes[1] ? lanes[0] : lanes[1];
+    return tail > max ? tail : max;
+}
+
+static double f64_dot_sse2(const double* a, const double* b, size_t length) {
+    __m128d acc0 = _mm_setzero_pd(), acc1 = _mm_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+        acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_loadu_pd(a + i + 2), _mm_loadu_pd(b + i + 2)));
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, _mm_add_pd(acc0, acc1));
+    return lanes[0] + lanes[1] + f64_dot_scalar(a + i, b + i, length - i);
+}
+
+static void f64_scale_sse2(double* dst, const double* src, size_t length, double factor) {
+    __m128d f = _mm_set1_pd(factor);
+    size_t i = 0;
+    for (; i + 2 <= length; i += 2) _mm_storeu_pd(dst + i, _mm_mul_pd(_mm_loadu_pd(src + i), f));
+    f64_scale_scalar(dst + i, src + i, length - i, factor);
+}
+
+static void f64_add_sse2(double* dst, const double* a, const double* b, size_t length) {
+    size_t i = 0;
+    for (; i + 2 <= length; i += 2) _mm_storeu_pd(dst + i, _mm_add_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+    f64_add_scalar(dst + i, a + i, b + i, length - i);
+}
+
+static void f64_mul_sse2(double* dst, const double* a, const double* b, size_t length) {
+    size_t i = 0;
+    for (; i + 2 <= length; i += 2) _mm_storeu_pd(dst + i, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+    f64_mul_scalar(dst + i, a + i, b + i, length - i);
+}
+
+static void f64_prefix_sum_sse2(double* dst, const double* src, size_t length) {
+    __m128d carry = _mm_setzero_pd();
+    size_t i = 0;
+    for (; i + 2 <= length; i += 2) {
+        __m128d x = _mm_loadu_pd(src + i);
+        x = _mm_add_pd(x, _mm_castsi128_pd(_mm_slli_si128(_mm_castpd_si128(x), 8)));
+        _mm_storeu_pd(dst + i, _mm_add_pd(x, carry));
+        carry = _mm_add_pd(carry, _mm_unpackhi_pd(x, x));
+    }
+    double running = _mm_cvtsd_f64(carry);
+    for (; i < length; i++) {
+        running += src[i];
+        dst[i] = running;
+    }
+}
+
+static size_t f64_count_if_sse2(const double* src, size_t length, MlpCompare op, double value) {
+    CompareSelect s = compare_select(op);
+    __m128d v = _mm_set1_pd(value);
+    __m128d sel_lt = _mm_castsi128_pd(_mm_set1_epi64x(s.lt));
+    __m128d sel_eq = _mm_castsi128_pd(_mm_set1_epi64x(s.eq));
+    __m128d sel_gt = _mm_castsi128_pd(_mm_set1_epi64x(s.gt));
+    __m128d invert = _mm_castsi128_pd(_mm_set1_epi64x(s.invert));
+    __m128i counts = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 2 <= length; i += 2) {
+        __m128d x = _mm_loadu_pd(src + i);
+        __m128d mask = _mm_or_pd(_mm_or_pd(_mm_and_pd(_mm_cmplt_pd(x, v), sel_lt),
+                                           _mm_and_pd(_mm_cmpeq_pd(x, v), sel_eq)),
+                                 _mm_and_pd(_mm_cmpgt_pd(x, v), sel_gt));
+        counts = _mm_sub_epi64(counts, _mm_castpd_si128(_mm_xor_pd(mask, invert)));
+    }
+    return (size_t)lanes_sum_sse2(counts) + f64_count_if_scalar(src + i, length - i, op, value);
+}
+
+// -----------------------------------------------------------------------------
+// AVX2 kernels (4 lanes)
+// -----------------------------------------------------------------------------
+
+#define MLP_AVX2 __attribute__((target("avx2")))
+
+MLP_AVX2 static int64_t lanes_sum_avx2(__m256i v) {
+    int64_t lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, v);
+    return (int64_t)((uint64_t)lanes[0] + (uint64_t)lanes[1] + (uint64_t)lanes[2] + (uint64_t)lanes[3]);
+}
+
+MLP_AVX2 static double lanes_sum_pd_avx2(__m256d v) {
+    double lanes[4];
+    _mm256_storeu_pd(lanes, v);
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+}
+
+MLP_AVX2 static __m256i mul_epi64_avx2(__m256i a, __m256i b) {
+    __m256i lo = _mm256_mul_epu32(a, b);
+    __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b),
+                                     _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+    return _mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32));
+}
+
+MLP_AVX2 static void fill64_avx2(uint64_t* dst, size_t length, uint64_t value) {
+    __m256i v = _mm256_set1_epi64x((long long)value);
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) _mm256_storeu_si256((__m256i*)(dst + i), v);
+    fill64_scalar(dst + i, length - i, value);
+}
+
+MLP_AVX2 static void copy64_avx2(uint64_t* dst, const uint64_t* src, size_t length) {
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_loadu_si256((const __m256i*)(src + i)));
+    }
+    copy64_scalar(dst + i, src + i, length - i);
+}
+
+MLP_AVX2 static int64_t i64_sum_avx2(const int64_t* src, size_t length) {
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) acc = _mm256_add_epi64(acc, _mm256_loadu_si256((const __m256i*)(src + i)));
+    return (int64_t)((uint64_t)lanes_sum_avx2(acc) + (uint64_t)i64_sum_scalar(src + i, length - i));
+}
+
+MLP_AVX2 static int64_t i64_min_avx2(const int64_t* src, size_t length) {
+    // Two accumulators: compare + blend latency would bound one
+    __m256i m0 = _mm256_set1_epi64x(INT64_MAX), m1 = m0;
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        __m256i x0 = _mm256_loadu_si256((const __m256i*)(src + i));
+        __m256i x1 = _mm256_loadu_si256((const __m256i*)(src + i + 4));
+        m0 = _mm256_blendv_epi8(m0, x0, _mm256_cmpgt_epi64(m0, x0));
+        m1 = _mm256_blendv_epi8(m1, x1, _mm256_cmpgt_epi64(m1, x1));
+    }
+    __m256i m = _mm256_blendv_epi8(m0, m1, _mm256_cmpgt_epi64(m0, m1));
+    int64_t lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, m);
+    int64_t min = i64_min_scalar(src + i, length - i);
+    int64_t lane_min = i64_min_scalar(lanes, 4);
+    return lane_min < min ? lane_min : min;
+}
+
+MLP_AVX2 static int64_t i64_max_avx2(const int64_t* src, size_t length) {
+    // Two accumulators: compare + blend latency would bound one
+    __m256i m0 = _mm256_set1_epi64x(INT64_MIN), m1 = m0;
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        __m256i x0 = _mm256_loadu_si256((const __m256i*)(src + i));
+        __m256i x1 = _mm256_loadu_si256((const __m256i*)(src + i + 4));
+        m0 = _mm256_blendv_epi8(m0, x0, _mm256_cmpgt_epi64(x0, m0));
+        m1 = _mm256_blendv_epi8(m1, x1, _mm256_cmpgt_epi64(x1, m1));
+    }
+    __m256i m = _mm256_blendv_epi8(m0, m1, _mm256_cmpgt_epi64(m1, m0));
+    int64_t lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, m);
+    int64_t max = i64_max_scalar(src + i, length - i);
+    int64_t lane_max = i64_max_scalar(lanes, 4);
+    return lane_max > max ? lane_max : max;
+}
+
+MLP_AVX2 static int64_t i64_dot_avx2(const int64_t* a, const int64_t* b, size_t length) {
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        acc = _mm256_add_epi64(acc, mul_epi64_avx2(_mm256_loadu_si256((const __m256i*)(a + i)),
+                                                   _mm256_loadu_si256((const __m256i*)(b + i))));
+    }
+    return (int64_t)((uint64_t)lanes_sum_avx2(acc) + (uint64_t)i64_dot_scalar(a + i, b + i, length - i));
+}
+
+MLP_AVX2 static void i64_scale_avx2(int64_t* dst, const int64_t* src, size_t length, int64_t factor) {
+    __m256i f = _mm256_set1_epi64x(factor);
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        _mm256_storeu_si256((__m256i*)(dst + i),
+                            mul_epi64_avx2(_mm256_loadu_si256((const __m256i*)(src + i)), f));
+    }
+    i64_scale_scalar(dst + i, src + i, length - i, factor);
+}
+
+MLP_AVX2 static void i64_add_avx2(int64_t* dst, const int64_t* a, const int64_t* b, size_t length) {
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        _mm256_storeu_si256((__m256i*)(dst + i),
+                            _mm256_add_epi64(_mm256_loadu_si256((const __m256i*)(a + i)),
+                                             _mm256_loadu_si256((const __m256i*)(b + i))));
+    }
+    i64_add_scalar(dst + i, a + i, b + i, length - i);
+}
+
+MLP_AVX2 static void i64_mul_avx2(int64_t* dst, const int64_t* a, const int64_t* b, size_t length) {
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        _mm256_storeu_si256((__m256i*)(dst + i),
+                            mul_epi64_avx2(_mm256_loadu_si256((const __m256i*)(a + i)),
+                                           _mm256_loadu_si256((const __m256i*)(b + i))));
+    }
+    i64_mul_scalar(dst + i, a + i, b + i, length - i);
+}
+
+MLP_AVX2 static void i64_prefix_sum_avx2(int64_t* dst, const int64_t* src, size_t length) {
+    __m256i zero = _mm256_setzero_si256();
+    __m256i carry = zero;
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(src + i));
+        // Shift by one lane: [0, x0, x1, x2]
+        __m256i shifted = _mm256_permute4x64_epi64(x, _MM_SHUFFLE(2, 1, 0, 0));
+        x = _mm256_add_epi64(x, _mm256_blend_epi32(shifted, zero, 0x03));
+        // Shift by two lanes: [0, 0, x0, x1]
+        shifted = _mm256_permute4x64_epi64(x, _MM_SHUFFLE(1, 0, 0, 0));
+        x = _mm256_add_epi64(x, _mm256_blend_epi32(shifted, zero, 0x0F));
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_add_epi64(x, carry));
+        carry = _mm256_add_epi64(carry, _mm256_permute4x64_epi64(x, _MM_SHUFFLE(3, 3, 3, 3)));
+    }
+    int64_t running = _mm256_extract_epi64(carry, 0);
+    for (; i < length; i++) {
+        running = (int64_t)((uint64_t)running + (uint64_t)src[i]);
+        dst[i] = running;
+    }
+}
+
+MLP_AVX2 static size_t i64_count_if_avx2(const int64_t* src, size_t length, MlpCompare op, int64_t value) {
+    CompareSelect s = compare_select(op);
+    __m256i v = _mm256_set1_epi64x(value);
+    __m256i sel_lt = _mm256_set1_epi64x(s.lt);
+    __m256i sel_eq = _mm256_set1_epi64x(s.eq);
+    __m256i sel_gt = _mm256_set1_epi64x(s.gt);
+    __m256i invert = _mm256_set1_epi64x(s.invert);
+    __m256i counts = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(src + i));
+        __m256i mask = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_cmpgt_epi64(v, x), sel_lt),
+                                                       _mm256_and_si256(_mm256_cmpeq_epi64(x, v), sel_eq)),
+                                       _mm256_and_si256(_mm256_cmpgt_epi64(x, v), sel_gt));
+        counts = _mm256_sub_epi64(counts, _mm256_xor_si256(mask, invert));
+    }
+    return (size_t)lanes_sum_avx2(counts) + i64_count_if_scalar(src + i, length - i, op, value);
+}
+
+MLP_AVX2 static double f64_sum_avx2(const double* src, size_t length) {
+    __m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd();
+    __m256d acc2 = _mm256_setzero_pd(), acc3 = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        acc0 = _mm256_add_pd(acc0, _mm256_loadu_pd(src + i));
+        acc1 = _mm256_add_pd(acc1, _mm256_loadu_pd(src + i + 4));
+        acc2 = _mm256_add_pd(acc2, _mm256_loadu_pd(src + i + 8));
+        acc3 = _mm256_add_pd(acc3, _mm256_loadu_pd(src + i + 12));
+    }
+    __m256d acc = _mm256_add_pd(_mm256_add_pd(acc0, acc1), _mm256_add_pd(acc2, acc3));
+    return lanes_sum_pd_avx2(acc) + f64_sum_scalar(src + i, length - i);
+}
+
+MLP_AVX2 static double f64_min_avx2(const double* src, size_t length) {
+    __m256d m = _mm256_set1_pd(__builtin_inf());
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) m = _mm256_min_pd(m, _mm256_loadu_pd(src + i));
+    double lanes[4];
+    _mm256_storeu_pd(lanes, m);
+    double min = f64_min_scalar(src + i, length - i);
+    double lane_min = f64_min_scalar(lanes, 4);
+    return lane_min < min ? lane_min : min;
+}
+
+MLP_AVX2 static double f64_max_avx2(const double* src, size_t length) {
+    __m256d m = _mm256_set1_pd(-__builtin_inf());
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) m = _mm256_max_pd(m, _mm256_loadu_pd(src + i));
+    double lanes[4];
+    _mm256_storeu_pd(lanes, m);
+    double max = f64_max_scalar(src + i, length - i);
+    double lane_max = f64_max_scalar(lanes, 4);
+    return lane_max > max ? lane_max : max;
+}
+
+MLP_AVX2 static double f64_dot_avx2(const double* a, const double* b, size_t length) {
+    __m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd();
+    __m256d acc2 = _mm256_setzero_pd(), acc3 = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        acc0 = _mm256_add_pd(acc0, _mm256_mul_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+        acc1 = _mm256_add_pd(acc1, _mm256_mul_pd(_mm256_loadu_pd(a + i + 4), _mm256_loadu_pd(b + i + 4)));
+        acc2 = _mm256_add_pd(acc2, _mm256_mul_pd(_mm256_loadu_pd(a + i + 8), _mm256_loadu_pd(b + i + 8)));
+        acc3 = _mm256_add_pd(acc3, _mm256_mul_pd(_mm256_loadu_pd(a + i + 12), _mm256_loadu_pd(b + i + 12)));
+    }
+    __m256d acc = _mm256_add_pd(_mm256_add_pd(acc0, acc1), _mm256_add_pd(acc2, acc3));
+    return lanes_sum_pd_avx2(acc) + f64_dot_scalar(a + i, b + i, length - i);
+}
+
+MLP_AVX2 static void f64_scale_avx2(double* dst, const double* src, size_t length, double factor) {
+    __m256d f = _mm256_set1_pd(factor);
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) _mm256_storeu_pd(dst + i, _mm256_mul_pd(_mm256_loadu_pd(src + i), f));
+    f64_scale_scalar(dst + i, src + i, length - i, factor);
+}
+
+MLP_AVX2 static void f64_add_avx2(double* dst, const double* a, const double* b, size_t length) {
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        _mm256_storeu_pd(dst + i, _mm256_add_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+    }
+    f64_add_scalar(dst + i, a + i, b + i, length - i);
+}
+
+MLP_AVX2 static void f64_mul_avx2(double* dst, const double* a, const double* b, size_t length) {
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        _mm256_storeu_pd(dst + i, _mm256_mul_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+    }
+    f64_mul_scalar(dst + i, a + i, b + i, length - i);
+}
+
+MLP_AVX2 static void f64_prefix_sum_avx2(double* dst, const double* src, size_t length) {
+    __m256d zero = _mm256_setzero_pd();
+    __m256d carry = zero;
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        __m256d x = _mm256_loadu_pd(src + i);
+        __m256d shifted = _mm256_permute4x64_pd(x, _MM_SHUFFLE(2, 1, 0, 0));
+        x = _mm256_add_pd(x, _mm256_blend_pd(shifted, zero, 0x1));
+        shifted = _mm256_permute4x64_pd(x, _MM_SHUFFLE(1, 0, 0, 0));
+        x = _mm256_add_pd(x, _mm256_blend_pd(shifted, zero, 0x3));
+        _mm256_storeu_pd(dst + i, _mm256_add_pd(x, carry));
+        carry = _mm256_add_pd(carry, _mm256_permute4x64_pd(x, _MM_SHUFFLE(3, 3, 3, 3)));
+    }
+    double running = _mm256_cvtsd_f64(carry);
+    for (; i < length; i++) {
+        running += src[i];
+        dst[i] = running;
+    }
+}
+
+MLP_AVX2 static size_t f64_count_if_avx2(const double* src, size_t length, MlpCompare op, double value) {
+    CompareSelect s = compare_select(op);
+    __m256d v = _mm256_set1_pd(value);
+    __m256d sel_lt = _mm256_castsi256_pd(_mm256_set1_epi64x(s.lt));
+    __m256d sel_eq = _mm256_castsi256_pd(_mm256_set1_epi64x(s.eq));
+    __m256d sel_gt = _mm256_castsi256_pd(_mm256_set1_epi64x(s.gt));
+    __m256d invert = _mm256_castsi256_pd(_mm256_set1_epi64x(s.invert));
+    __m256i counts = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        __m256d x = _mm256_loadu_pd(src + i);
+        __m256d mask = _mm256_or_pd(_mm256_or_pd(_mm256_and_pd(_mm256_cmp_pd(x, v, _CMP_LT_OQ), sel_lt),
+                                                 _mm256_and_pd(_mm256_cmp_pd(x, v, _CMP_EQ_OQ), sel_eq)),
+                                    _mm256_and_pd(_mm256_cmp_pd(x, v, _CMP_GT_OQ), sel_gt));
+        counts = _mm256_sub_epi64(counts, _mm256_castpd_si256(_mm256_xor_pd(mask, invert)));
+    }
+    return (size_t)lanes_sum_avx2(counts) + f64_count_if_scalar(src + i, length - i, op, value);
+}
+
+#endif // MLP_SIMD_X86
+
+// -----------------------------------------------------------------------------
+// Dispatch
+// -----------------------------------------------------------------------------
+
+static const ArrayKernels kernel_sets[] = {
+    { fill64_scalar, copy64_scalar,
+      i64_sum_scalar, i64_min_scalar, i64_max_scalar, i64_dot_scalar, i64_scale_scalar,
+      i64_add_scalar, i64_mul_scalar, i64_prefix_sum_scalar, i64_count_if_scalar,
+      f64_sum_scalar, f64_min_scalar, f64_max_scalar, f64_dot_scalar, f64_scale_scalar,
+      f64_add_scalar, f64_mul_scalar, f64_prefix_sum_scalar, f64_count_if_scalar },
+#if MLP_SIMD_X86
+    { fill64_sse2, copy64_sse2,
+      i64_sum_sse2, i64_min_scalar, i64_max_scalar, i64_dot_sse2, i64_scale_sse2,
+      i64_add_sse2, i64_mul_sse2, i64_prefix_sum_sse2, i64_count_if_scalar,
+      f64_sum_sse2, f64_min_sse2, f64_max_sse2, f64_dot_sse2, f64_scale_sse2,
+      f64_add_sse2, f64_mul_sse2, f64_prefix_sum_sse2, f64_count_if_sse2 },
+    { fill64_avx2, copy64_avx2,
+      i64_sum_avx2, i64_min_avx2, i64_max_avx2, i64_dot_avx2, i64_scale_avx2,
+      i64_add_avx2, i64_mul_avx2, i64_prefix_sum_avx2, i64_count_if_avx2,
+      f64_sum_avx2, f64_min_avx2, f64_max_avx2, f64_dot_avx2, f64_scale_avx2,
+      f64_add_avx2, f64_mul_avx2, f64_prefix_sum_avx2, f64_count_if_avx2 },
+#endif
+};
+
+// Set on first use; racing first calls all store the same values
+static const ArrayKernels* active_kernels = NULL;
+static MlpSimdLevel active_level = MLP_SIMD_SCALAR;
+
+MlpSimdLevel mlp_array_simd_set_level(MlpSimdLevel level) {
+    MlpSimdLevel max_level = mlp_simd_max_level();
+    if (level > max_level) {
+        level = max_level;
+    }
+    active_level = level;
+    active_kernels = &kernel_sets[level];
+    return level;
+}
+
+static const ArrayKernels* kernels(void) {
+    if (!active_kernels) {
+        mlp_array_simd_set_level(mlp_simd_max_level());
+    }
+    return active_kernels;
+}
+
+MlpSimdLevel mlp_array_simd_level(void) {
+    kernels();
+    return active_level;
+}
+
+// -----------------------------------------------------------------------------
+// Public kernels
+// -----------------------------------------------------------------------------
+
+void mlp_simd_fill64(void* dst, size_t length, uint64_t value) {
+    kernels()->fill64((uint64_t*)dst, length, value);
+}
+
+void mlp_simd_copy64(void* dst, const void* src, size_t length) {
+    // Forward block copies are safe unless dst starts inside src
+    const uint64_t* from = (const uint64_t*)src;
+    uint64_t* to = (uint64_t*)dst;
+    if (to > from && to < from + length) {
+        memmove(dst, src, length * sizeof(uint64_t));
+        return;
+    }
+    kernels()->copy64(to, from, length);
+}
+
+int64_t mlp_simd_i64_sum(const int64_t* src, size_t length) {
+    return kernels()->i64_sum(src, length);
+}
+
+int64_t mlp_simd_i64_min(const int64_t* src, size_t length) {
+    return kernels()->i64_min(src, length);
+}
+
+int64_t mlp_simd_i64_max(const int64_t* src, size_t length) {
+    return kernels()->i64_max(src, length);
+}
+
+int64_t mlp_simd_i64_dot(const int64_t* a, const int64_t* b, size_t length) {
+    return kernels()->i64_dot(a, b, length);
+}
+
+void mlp_simd_i64_scale(int64_t* dst, const int64_t* src, size_t length, int64_t factor) {
+    kernels()->i64_scale(dst, src, length, factor);
+}
+
+void mlp_simd_i64_add(int64_t* dst, const int64_t* a, const int64_t* b, size_t length) {
+    kernels()->i64_add(dst, a, b, length);
+}
+
+void mlp_simd_i64_mul(int64_t* dst, const int64_t* a, const int64_t* b, size_t length) {
+    kernels()->i64_mul(dst, a, b, length);
+}
+
+void mlp_simd_i64_prefix_sum(int64_t* dst, const int64_t* src, size_t length) {
+    kernels()->i64_prefix_sum(dst, src, length);
+}
+
+size_t mlp_simd_i64_count_if(const int64_t* src, size_t length, MlpCompare op, int64_t value) {
+    return kernels()->i64_count_if(src, length, op, value);
+}
+
+double mlp_simd_f64_sum(const double* src, size_t length) {
+    return kernels()->f64_sum(src, length);
+}
+
+double mlp_simd_f64_min(const double* src, size_t length) {
+    return kernels()->f64_min(src, length);
+}
+
+double mlp_simd_f64_max(const double* src, size_t length) {
+    return kernels()->f64_max(src, length);
+}
+
+double mlp_simd_f64_dot(const double* a, const double* b, size_t length) {
+    return kernels()->f64_dot(a, b, length);
+}
+
+void mlp_simd_f64_scale(double* dst, const double* src, size_t length, double factor) {
+    kernels()->f64_scale(dst, src, length, factor);
+}
+
+void mlp_simd_f64_add(double* dst, const double* a, const double* b, size_t length) {
+    kernels()->f64_add(dst, a, b, length);
+}
+
+void mlp_simd_f64_mul(double* dst, const double* a, const double* b, size_t length) {
+    kernels()->f64_mul(dst, a, b, length);
+}
+
+void mlp_simd_f64_prefix_sum(double* dst, const double* src, size_t length) {
+    kernels()->f64_prefix_sum(dst, src, length);
+}
+
+size_t mlp_simd_f64_count_if(const double* src, size_t length, MlpCompare op, double value) {
+    return kernels()->f64_count_if(src, length, op, value);
+}
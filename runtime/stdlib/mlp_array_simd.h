@@ -0,0 +1,100 @@
+/**
+ * MLP Standard Library - Vectorized Numeric Array Kernels
+ *
+ * Bulk operations on contiguous int64_t / double buffers, behind the
+ * numeric[] builtins (mlp_array.c) and MelpDenseArray (mlp_dense_array.c).
+ * Like the string kernels (mlp_string_simd.h), each kernel has a scalar
+ * reference version and SSE2 / AVX2 versions on x86-64; the best set the
+ * CPU supports is picked on first use.
+ *
+ * Integer arithmetic wraps (two's complement), as in compiled MLP code.
+ * Vector sums, dot products and prefix sums of doubles add in a different
+ * order than the scalar loop, so results may differ in the last bits.
+ * Buffers need no particular alignment; dst may equal a source operand.
+ *
+ * Created: 4 Şubat 2026
+ */
+
+#ifndef MLP_ARRAY_SIMD_H
+#define MLP_ARRAY_SIMD_H
+
+#include <stddef.h>  // size_t
+#include <stdint.h>
+#include "mlp_string_simd.h"  // MlpSimdLevel
+
+/**
+ * Element predicate of the count_if kernels: element <op> value
+ */
+typedef enum {
+    MLP_CMP_LT = 0,
+    MLP_CMP_LE,
+    MLP_CMP_EQ,
+    MLP_CMP_NE,
+    MLP_CMP_GE,
+    MLP_CMP_GT
+} MlpCompare;
+
+/**
+ * Kernel set in use (detected from CPUID on first call), and switching it
+ * (tests and benchmarks compare levels this way). Independent of the
+ * string kernels' level; levels above mlp_simd_max_level() are clamped.
+ */
+MlpSimdLevel mlp_array_simd_level(void);
+MlpSimdLevel mlp_array_simd_set_level(MlpSimdLevel level);
+
+// -----------------------------------------------------------------------------
+// 64-bit moves (int64_t and double alike)
+// -----------------------------------------------------------------------------
+
+/** dst[i] = value (bit pattern of an int64_t or double) */
+void mlp_simd_fill64(void* dst, size_t length, uint64_t value);
+
+/** dst[i] = src[i]; the buffers may overlap */
+void mlp_simd_copy64(void* dst, const void* src, size_t length);
+
+// -----------------------------------------------------------------------------
+// int64_t
+// -----------------------------------------------------------------------------
+
+int64_t mlp_simd_i64_sum(const int64_t* src, size_t length);
+
+/** Smallest / largest element; INT64_MAX / INT64_MIN when length is 0 */
+int64_t mlp_simd_i64_min(const int64_t* src, size_t length);
+int64_t mlp_simd_i64_max(const int64_t* src, size_t length);
+
+/** sum of a[i] * b[i] */
+int64_t mlp_simd_i64_dot(const int64_t* a, const int64_t* b, size_t length);
+
+/** dst[i] = src[i] * factor */
+void mlp_simd_i64_scale(int64_t* dst, const int64_t* src, size_t length, int64_t factor);
+
+/** dst[i] = a[i] + b[i] / a[i] * b[i] */
+void mlp_simd_i64_add(int64_t* dst, const int64_t* a, const int64_t* b, size_t length);
+void mlp_simd_i64_mul(int64_t* dst, const int64_t* a, const int64_t* b, size_t length);
+
+/** Inclusive scan: dst[i] = src[0] + ... + src[i] */
+void mlp_simd_i64_prefix_sum(int64_t* dst, const int64_t* src, size_t length);
+
+/** Number of i with src[i] <op> value */
+size_t mlp_simd_i64_count_if(const int64_t* src, size_t length, MlpCompare op, int64_t value);
+
+// -----------------------------------------------------------------------------
+// double
+// -----------------------------------------------------------------------------
+
+double mlp_simd_f64_sum(const double* src, size_t length);
+
+/** Smallest / largest element; +inf / -inf when length is 0 (NaNs: unspecified) */
+double mlp_simd_f64_min(const double* src, size_t length);
+double mlp_simd_f64_max(const double* src, size_t length);
+
+double mlp_simd_f64_dot(const double* a, const double* b, size_t length);
+void mlp_simd_f64_scale(double* dst, const double* src, size_t length, double factor);
+void mlp_simd_f64_add(double* dst, const double* a, const double* b, size_t length);
+void mlp_simd_f64_mul(double* dst, const double* a, const double* b, size_t length);
+void mlp_simd_f64_prefix_sum(double* dst, const double* src, size_t length);
+
+/** Ordered compares except MLP_CMP_NE, which (as in C) counts NaNs */
+size_t mlp_simd_f64_count_if(const double* src, size_t length, MlpCompare op, double value);
+
+#endif // MLP_ARRAY_SIMD_H
@@ -0,0 +1,63 @@
+/**
+ * MLP Standard Library - Dense Numeric Arrays
+ *
+ * Created: 4 Şubat 2026
+ */
+
+#include "mlp_dense_array.h"
+#include "mlp_array_simd.h"
+#include <stdlib.h>
+#include <string.h>
+
+MelpDenseArray* melp_dense_create(MelpDenseKind kind, size_t length) {
+    if (length > (SIZE_MAX - MELP_DENSE_ALIGNMENT) / sizeof(int64_t)) {
+        return NULL;
+    }
+
+    MelpDenseArray* array = malloc(sizeof(MelpDenseArray));
+    if (!array) return NULL;
+
+    // Whole cache lines (aligned_alloc wants a multiple of the alignment);
+    // at least one, so data is never NULL
+    size_t bytes = length * sizeof(int64_t);
+    size_t padded = (bytes + MELP_DENSE_ALIGNMENT - 1) / MELP_DENSE_ALIGNMENT * MELP_DENSE_ALIGNMENT;
+    if (padded == 0) {
+        padded = MELP_DENSE_ALIGNMENT;
+    }
+
+    array->data = aligned_alloc(MELP_DENSE_ALIGNMENT, padded);
+    if (!array->data) {
+        free(array);
+        return NULL;
+    }
+    memset(array->data, 0, padded);  // All-zero bits are 0 and 0.0
+    array->length = length;
+    array->kind = kind;
+    return array;
+}
+
+MelpDenseArray* melp_dense_from_list(const MelpList* list) {
+    if (!list || list->element_size != sizeof(int64_t)) {
+        return NULL;
+    }
+
+    MelpDenseArray* array = melp_dense_create(MELP_DENSE_INT64, list->length);
+    if (array) {
+        mlp_simd_copy64(array->data, list->elements, list->length);
+    }
+    return array;
+}
+
+void melp_dense_free(MelpDenseArray* array) {
+    if (!array) return;
+    free(array->data);
+    free(array);
+}
+
+int64_t* melp_dense_i64(MelpDenseArray* array) {
+    return array && array->kind == MELP_DENSE_INT64 ? (int64_t*)array->data : NULL;
+}
+
+double* melp_dense_f64(MelpDenseArray* array) {
+    return array && array->kind == MELP_DENSE_FLOAT64 ? (double*)array->data : NULL;
+}
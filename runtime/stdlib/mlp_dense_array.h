@@ -0,0 +1,62 @@
+/**
+ * MLP Standard Library - Dense Numeric Arrays
+ *
+ * Fixed-length int64_t or double arrays in one zero-filled, cache-line
+ * aligned buffer, for the bulk kernels in mlp_array_simd.h:
+ *
+ *   MelpDenseArray* a = melp_dense_create(MELP_DENSE_FLOAT64, n);
+ *   double* x = melp_dense_f64(a);
+ *   mlp_simd_f64_add(x, x, y, n);
+ *   double total = mlp_simd_f64_sum(x, n);
+ *
+ * Unlike MelpList there is no capacity or element size: the length never
+ * changes, and the buffer is padded to a whole number of cache lines so
+ * vector loops never split a line at either end.
+ *
+ * Created: 4 Şubat 2026
+ */
+
+#ifndef MLP_DENSE_ARRAY_H
+#define MLP_DENSE_ARRAY_H
+
+#include <stddef.h>  // size_t
+#include <stdint.h>  // int64_t
+#include "mlp_list.h"
+
+// Alignment of MelpDenseArray.data (one cache line, two AVX2 vectors)
+#define MELP_DENSE_ALIGNMENT 64
+
+typedef enum {
+    MELP_DENSE_INT64 = 0,
+    MELP_DENSE_FLOAT64 = 1
+} MelpDenseKind;
+
+typedef struct {
+    void* data;          // length elements, MELP_DENSE_ALIGNMENT aligned
+    size_t length;       // Number of elements (fixed)
+    MelpDenseKind kind;  // Element type (both are 8 bytes)
+} MelpDenseArray;
+
+/**
+ * Create a zero-filled array
+ * @return New array, or NULL on allocation failure
+ */
+MelpDenseArray* melp_dense_create(MelpDenseKind kind, size_t length);
+
+/**
+ * Copy of an int64_t MelpList (e.g. a numeric[] value)
+ * @return New MELP_DENSE_INT64 array, or NULL (no list, other element size,
+ *         allocation failure)
+ */
+MelpDenseArray* melp_dense_from_list(const MelpList* list);
+
+void melp_dense_free(MelpDenseArray* array);
+
+/**
+ * Typed views of the data
+ * @return Element pointer, or NULL if array is NULL or of the other kind
+ */
+int64_t* melp_dense_i64(MelpDenseArray* array);
+double* melp_dense_f64(MelpDenseArray* array);
+
+#endif // MLP_DENSE_ARRAY_H
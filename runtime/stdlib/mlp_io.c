@@ -2,10 +2,11 @@
  * MLP Standard Library - I/O Functions
  * 
  * Architecture: Works with STO (Smart Type Optimization)
- * Handles int64, double, BigDecimal transparently
+ * Handles int64, int128, fixed-point decimal, double, BigDecimal transparently
  */
 
 #include "mlp_io.h"
+#include "../sto/fixed_decimal.h"  // INT128/DECIMAL values are passed by value
 #include <stdio.h>
 #include <stdint.h>
 #include <inttypes.h>
@@ -23,8 +24,8 @@ char* strdup(const char* s) {
 }
 #endif
 
-// External STO runtime functions (from libsto_runtime.a)
-extern char* sto_bigdec_to_string(void* bigdec);
+// STO runtime functions (from libsto_runtime.a) via fixed_decimal.h, which
+// also declares the int128.h and bigdecimal.h APIs
 
 // ============================================================================
 // Core STO-Aware Functions
@@ -42,20 +43,32 @@ void mlp_println_numeric(void* value, uint8_t sto_type) {
             printf("%" PRId64 "\n", *(int64_t*)value);
             break;
             
+        case INTERNAL_TYPE_INT128:
+            sto_int128_fprint(*(STOInt128*)value, stdout);
+            putchar('\n');
+            break;
+            
+        case INTERNAL_TYPE_DECIMAL64:
+            sto_dec64_fprint(*(STODecimal64*)value, stdout);
+            putchar('\n');
+            break;
+            
+        case INTERNAL_TYPE_DECIMAL128:
+            sto_dec128_fprint(*(STODecimal128*)value, stdout);
+            putchar('\n');
+            break;
+            
         case INTERNAL_TYPE_DOUBLE:
             printf("%g\n", *(double*)value);
             break;
             
-        case INTERNAL_TYPE_BIGDECIMAL: {
-            char* str = sto_bigdec_to_string(value);
-            if (str) {
-                printf("%s\n", str);
-                free(str);
+        case INTERNAL_TYPE_BIGDECIMAL:
+            if (sto_bigdec_fprint((BigDecimal*)value, stdout) >= 0) {
+                putchar('\n');
             } else {
                 printf("(BigDecimal error)\n");
             }
             break;
-        }
         
         default:
             printf("(unknown numeric type: %d)\n", sto_type);
@@ -74,20 +87,27 @@ void mlp_print_numeric(void* value, uint8_t sto_type) {
             printf("%" PRId64, *(int64_t*)value);
             break;
             
+        case INTERNAL_TYPE_INT128:
+            sto_int128_fprint(*(STOInt128*)value, stdout);
+            break;
+            
+        case INTERNAL_TYPE_DECIMAL64:
+            sto_dec64_fprint(*(STODecimal64*)value, stdout);
+            break;
+            
+        case INTERNAL_TYPE_DECIMAL128:
+            sto_dec128_fprint(*(STODecimal128*)value, stdout);
+            break;
+            
         case INTERNAL_TYPE_DOUBLE:
             printf("%g", *(double*)value);
             break;
             
-        case INTERNAL_TYPE_BIGDECIMAL: {
-            char* str = sto_bigdec_to_string(value);
-            if (str) {
-                printf("%s", str);
-                free(str);
-            } else {
+        case INTERNAL_TYPE_BIGDECIMAL:
+            if (sto_bigdec_fprint((BigDecimal*)value, stdout) < 0) {
                 printf("(BigDecimal error)");
             }
             break;
-        }
         
         default:
             printf("(unknown numeric type: %d)", sto_type);
@@ -104,12 +124,22 @@ char* mlp_toString_numeric(void* value, uint8_t sto_type) {
             snprintf(buffer, sizeof(buffer), "%" PRId64, *(int64_t*)value);
             return strdup(buffer);
             
+        case INTERNAL_TYPE_INT128:
+            return sto_int128_to_string(*(STOInt128*)value);  // Already allocates
+            
+        case INTERNAL_TYPE_DECIMAL64:
+            sto_dec64_format(*(STODecimal64*)value, buffer);
+            return strdup(buffer);
+            
+        case INTERNAL_TYPE_DECIMAL128:
+            return sto_dec128_to_string(*(STODecimal128*)value);  // Already allocates
+            
         case INTERNAL_TYPE_DOUBLE:
             snprintf(buffer, sizeof(buffer), "%g", *(double*)value);
             return strdup(buffer);
             
         case INTERNAL_TYPE_BIGDECIMAL:
-            return sto_bigdec_to_string(value);  // Already allocates
+            return sto_bigdec_to_string((BigDecimal*)value);  // Already allocates
             
         default:
             return strdup("(unknown)");
@@ -137,6 +167,15 @@ void mlp_println_string(const char* str) {
     }
 }
 
+void mlp_println_str(MelpStr str) {
+    fwrite(str.data, 1, str.length, stdout);
+    putchar('\n');
+}
+
+void mlp_print_str(MelpStr str) {
+    fwrite(str.data, 1, str.length, stdout);
+}
+
 // Print boolean with newline
 void mlp_println_bool(int value) {
     printf("%s\n", value ? "true" : "false");
@@ -214,13 +253,25 @@ int64_t mlp_input_numeric_prompt(const char* prompt) {
 // File I/O Functions (YZ_33 - Phase 9)
 // ============================================================================
 
+// fopen needs a NUL-terminated path: use the text in place when it already
+// ends at a NUL, else a copy in *owned (caller frees)
+static const char* path_cstr(MelpStr path, char** owned) {
+    *owned = NULL;
+    if (path.data[path.length] == '\0') {
+        return path.data;
+    }
+    *owned = mlp_str_to_cstr(path);
+    return *owned;
+}
+
 // Read entire file content as string
-char* mlp_read_file(const char* filename) {
-    if (!filename) return strdup("");
-    
-    FILE* file = fopen(filename, "r");
+MelpStr mlp_read_file_str(MelpStr filename) {
+    char* owned_path;
+    const char* path = path_cstr(filename, &owned_path);
+    FILE* file = path ? fopen(path, "r") : NULL;
+    free(owned_path);
     if (!file) {
-        return strdup("");  // File not found or permission denied
+        return mlp_str_from_len(strdup(""), 0);  // File not found or permission denied
     }
     
     // Get file size
@@ -232,7 +283,7 @@ char* mlp_read_file(const char* filename) {
     char* content = (char*)malloc(file_size + 1);
     if (!content) {
         fclose(file);
-        return strdup("");
+        return mlp_str_from_len(strdup(""), 0);
     }
     
     // Read entire file
@@ -240,39 +291,48 @@ char* mlp_read_file(const char* filename) {
     content[bytes_read] = '\0';
     
     fclose(file);
-    return content;
+    return mlp_str_from_len(content, bytes_read);
 }
 
-// Write string content to file (overwrite)
-int64_t mlp_write_file(const char* filename, const char* content) {
-    if (!filename || !content) return 0;
-    
-    FILE* file = fopen(filename, "w");
+char* mlp_read_file(const char* filename) {
+    if (!filename) return strdup("");
+    return (char*)mlp_read_file_str(mlp_str_from_cstr(filename)).data;
+}
+
+// Write content by length (mode "w" or "a")
+static int64_t write_file_str(MelpStr filename, MelpStr content, const char* mode) {
+    char* owned_path;
+    const char* path = path_cstr(filename, &owned_path);
+    FILE* file = path ? fopen(path, mode) : NULL;
+    free(owned_path);
     if (!file) {
         return 0;  // Permission denied or invalid path
     }
     
-    size_t len = strlen(content);
-    size_t written = fwrite(content, 1, len, file);
+    size_t written = fwrite(content.data, 1, content.length, file);
     fclose(file);
     
-    return (written == len) ? 1 : 0;
+    return (written == content.length) ? 1 : 0;
+}
+
+// Write string content to file (overwrite)
+int64_t mlp_write_file_str(MelpStr filename, MelpStr content) {
+    return write_file_str(filename, content, "w");
+}
+
+int64_t mlp_write_file(const char* filename, const char* content) {
+    if (!filename || !content) return 0;
+    return mlp_write_file_str(mlp_str_from_cstr(filename), mlp_str_from_cstr(content));
 }
 
 // Append string content to file
+int64_t mlp_append_file_str(MelpStr filename, MelpStr content) {
+    return write_file_str(filename, content, "a");
+}
+
 int64_t mlp_append_file(const char* filename, const char* content) {
     if (!filename || !content) return 0;
-    
-    FILE* file = fopen(filename, "a");
-    if (!file) {
-        return 0;  // Permission denied or invalid path
-    }
-    
-    size_t len = strlen(content);
-    size_t written = fwrite(content, 1, len, file);
-    fclose(file);
-    
-    return (written == len) ? 1 : 0;
+    return mlp_append_file_str(mlp_str_from_cstr(filename), mlp_str_from_cstr(content));
 }
 
 // ============================================================================
@@ -3,7 +3,7 @@
  * 
  * Architecture: Works with STO (Smart Type Optimization)
  * User only sees: numeric, string, boolean
- * Runtime handles: int64/BigDecimal, SSO/heap internally
+ * Runtime handles: int64/int128/decimal/BigDecimal, SSO/heap internally
  */
 
 #ifndef MLP_IO_H
@@ -11,9 +11,11 @@
 
 #include <stdint.h>
 #include "../sto/sto_types.h"  // Use STO type definitions
+#include "mlp_string.h"        // MelpStr
 
 // Legacy compatibility (deprecated - use INTERNAL_TYPE_* from sto_types.h)
 #define STO_TYPE_INT64      INTERNAL_TYPE_INT64
+#define STO_TYPE_INT128     INTERNAL_TYPE_INT128
 #define STO_TYPE_DOUBLE     INTERNAL_TYPE_DOUBLE
 #define STO_TYPE_BIGDECIMAL INTERNAL_TYPE_BIGDECIMAL
 #define STO_TYPE_STRING     INTERNAL_TYPE_SSO_STRING
@@ -24,13 +26,20 @@
 // ============================================================================
 
 // Print numeric value with newline
-// value: pointer to numeric (int64*, double*, or BigDecimal*)
-// sto_type: INTERNAL_TYPE_INT64, INTERNAL_TYPE_DOUBLE, or INTERNAL_TYPE_BIGDECIMAL
+// value: pointer to numeric (int64*, __int128*, STODecimal64*, STODecimal128*,
+//        double*, or BigDecimal*)
+// sto_type: INTERNAL_TYPE_INT64, _INT128, _DECIMAL64, _DECIMAL128, _DOUBLE,
+//           or _BIGDECIMAL
 void mlp_println_numeric(void* value, uint8_t sto_type);
 
 // Print string with newline
 void mlp_println_string(const char* str);
 
+// MelpStr versions (what generated code calls): written by length, so
+// nothing is rescanned and embedded NULs are printed
+void mlp_println_str(MelpStr str);
+void mlp_print_str(MelpStr str);
+
 // Print boolean with newline
 void mlp_println_bool(int value);
 
@@ -93,6 +102,12 @@ int64_t mlp_write_file(const char* filename, const char* content);
 // Returns: 1 on success, 0 on error
 int64_t mlp_append_file(const char* filename, const char* content);
 
+// MelpStr versions: the result of mlp_read_file_str carries the byte count
+// fread returned (free with mlp_str_free); content is written by length
+MelpStr mlp_read_file_str(MelpStr filename);
+int64_t mlp_write_file_str(MelpStr filename, MelpStr content);
+int64_t mlp_append_file_str(MelpStr filename, MelpStr content);
+
 // ============================================================================
 // Simple Wrapper Functions (BOOTSTRAP_YZ_07 - Stage 2 Bootstrap)
 // ============================================================================
@@ -3,12 +3,15 @@
  * 
  * STO-compliant list operations for MELP compiler
  * YZ_200: Full list implementation with runtime allocation
+ * Elements are stored inline in one buffer (no allocation per element)
  * 
  * Created: 21 Aralık 2025 (YZ_200)
  */
 
 #include "mlp_list.h"
 #include "mlp_panic.h"
+#include "mlp_string.h"    // MelpStr elements of string lists
+#include "../sto/sto_pool.h"  // List headers and buffers come from the runtime pool
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -19,6 +22,9 @@
 // Growth factor (capacity doubles each time)
 #define GROWTH_FACTOR 2
 
+// Address of element i in the inline buffer
+#define ELEMENT_AT(list, i) ((list)->elements + (i) * (list)->element_size)
+
 // -----------------------------------------------------------------------------
 // Core List Operations
 // -----------------------------------------------------------------------------
@@ -28,41 +34,63 @@ MelpList* melp_list_create(size_t element_size) {
         return NULL;
     }
     
-    MelpList* list = (MelpList*)malloc(sizeof(MelpList));
+    MelpList* list = (MelpList*)sto_pool_alloc(sizeof(MelpList), STO_POOL_LIST);
     if (!list) {
         return NULL;
     }
     
-    list->elements = (void**)malloc(sizeof(void*) * INITIAL_CAPACITY);
+    list->elements = (unsigned char*)sto_pool_alloc(element_size * INITIAL_CAPACITY, STO_POOL_LIST);
     if (!list->elements) {
-        free(list);
+        sto_pool_free(list, sizeof(MelpList), STO_POOL_LIST);
         return NULL;
     }
     
     list->length = 0;
     list->capacity = INITIAL_CAPACITY;
     list->element_size = element_size;
+    list->refcount = 1;
     
     return list;
 }
 
 void melp_list_free(MelpList* list) {
-    if (!list) {
+    if (!list || list->refcount == MELP_LIST_REFCOUNT_STACK) {
         return;
     }
     
-    // Free each element
-    for (size_t i = 0; i < list->length; i++) {
-        if (list->elements[i]) {
-            free(list->elements[i]);
-        }
-    }
-    
-    // Free the element array
-    free(list->elements);
+    // Elements live in the buffer: one free
+    sto_pool_free(list->elements, list->element_size * list->capacity, STO_POOL_LIST);
     
     // Free the list structure
-    free(list);
+    sto_pool_free(list, sizeof(MelpList), STO_POOL_LIST);
+}
+
+void melp_list_retain(MelpList* list) {
+    if (list && list->refcount != MELP_LIST_REFCOUNT_STACK) {
+        list->refcount++;
+    }
+}
+
+void melp_list_release(MelpList* list) {
+    if (list && list->refcount != MELP_LIST_REFCOUNT_STACK && --list->refcount == 0) {
+        melp_list_free(list);
+    }
+}
+
+void melp_list_free_strings(MelpList* list) {
+    if (!list) {
+        return;
+    }
+    for (size_t i = 0; i < list->length; i++) {
+        mlp_str_free(*(MelpStr*)ELEMENT_AT(list, i));
+    }
+    melp_list_free(list);
+}
+
+void melp_list_release_strings(MelpList* list) {
+    if (list && list->refcount != MELP_LIST_REFCOUNT_STACK && --list->refcount == 0) {
+        melp_list_free_strings(list);
+    }
 }
 
 size_t melp_list_length(MelpList* list) {
@@ -87,7 +115,7 @@ void* melp_list_get(MelpList* list, size_t index) {
         return NULL;
     }
     
-    return list->elements[index];
+    return ELEMENT_AT(list, index);
 }
 
 int melp_list_set(MelpList* list, size_t index, void* element) {
@@ -99,18 +127,8 @@ int melp_list_set(MelpList* list, size_t index, void* element) {
         return -1;  // Null element
     }
     
-    // Free old element
-    if (list->elements[index]) {
-        free(list->elements[index]);
-    }
-    
-    // Allocate and copy new element
-    list->elements[index] = malloc(list->element_size);
-    if (!list->elements[index]) {
-        return -1;  // Memory allocation failure
-    }
-    
-    memcpy(list->elements[index], element, list->element_size);
+    // Overwrite in place
+    memcpy(ELEMENT_AT(list, index), element, list->element_size);
     
     return 0;
 }
@@ -120,17 +138,17 @@ int melp_list_set(MelpList* list, size_t index, void* element) {
 // -----------------------------------------------------------------------------
 
 static int melp_list_grow(MelpList* list) {
-    size_t new_capacity = list->capacity * GROWTH_FACTOR;
-    
-    void** new_elements = (void**)realloc(list->elements, sizeof(void*) * new_capacity);
-    if (!new_elements) {
-        return -1;  // Memory allocation failure
-    }
-    
-    list->elements = new_elements;
-    list->capacity = new_capacity;
-    
-    return 0;
+    return melp_list_reserve(list, list->capacity * GROWTH_FACTOR);
+}
+
+// Offset of element in the list's buffer (melp_list_get hands out pointers
+// into it), or -1 if it lives elsewhere
+static ptrdiff_t melp_list_alias_offset(MelpList* list, const void* element) {
+    const unsigned char* data = (const unsigned char*)element;
+    if (data >= list->elements && data < ELEMENT_AT(list, list->length)) {
+        return data - list->elements;
+    }
+    return -1;
 }
 
 // -----------------------------------------------------------------------------
@@ -142,20 +160,17 @@ int melp_list_append(MelpList* list, void* element) {
         return -1;
     }
     
-    // Grow if needed
+    // Grow if needed ('element' may live in the buffer that is about to move)
+    ptrdiff_t offset = melp_list_alias_offset(list, element);
     if (list->length >= list->capacity) {
         if (melp_list_grow(list) != 0) {
             return -1;
         }
+        if (offset >= 0) element = list->elements + offset;
     }
     
-    // Allocate and copy element
-    list->elements[list->length] = malloc(list->element_size);
-    if (!list->elements[list->length]) {
-        return -1;
-    }
-    
-    memcpy(list->elements[list->length], element, list->element_size);
+    // Copy element into the next free slot
+    memcpy(ELEMENT_AT(list, list->length), element, list->element_size);
     list->length++;
     
     return 0;
@@ -166,25 +181,20 @@ int melp_list_prepend(MelpList* list, void* element) {
         return -1;
     }
     
-    // Grow if needed
+    // Grow if needed ('element' may live in the buffer that is about to move)
+    ptrdiff_t offset = melp_list_alias_offset(list, element);
     if (list->length >= list->capacity) {
         if (melp_list_grow(list) != 0) {
             return -1;
         }
     }
     
-    // Shift all elements right by one
-    for (size_t i = list->length; i > 0; i--) {
-        list->elements[i] = list->elements[i - 1];
-    }
+    // Shift all elements right by one (an aliased element moves with them)
+    memmove(ELEMENT_AT(list, 1), list->elements, list->length * list->element_size);
+    if (offset >= 0) element = ELEMENT_AT(list, 1) + offset;
     
-    // Allocate and copy new element at index 0
-    list->elements[0] = malloc(list->element_size);
-    if (!list->elements[0]) {
-        return -1;
-    }
-    
-    memcpy(list->elements[0], element, list->element_size);
+    // Copy new element to index 0
+    memcpy(list->elements, element, list->element_size);
     list->length++;
     
     return 0;
@@ -195,15 +205,9 @@ int melp_list_remove(MelpList* list, size_t index) {
         return -1;  // Index out of bounds
     }
     
-    // Free the element
-    if (list->elements[index]) {
-        free(list->elements[index]);
-    }
-    
-    // Shift all elements left by one
-    for (size_t i = index; i < list->length - 1; i++) {
-        list->elements[i] = list->elements[i + 1];
-    }
+    // Shift following elements left by one
+    memmove(ELEMENT_AT(list, index), ELEMENT_AT(list, index + 1),
+            (list->length - index - 1) * list->element_size);
     
     list->length--;
     
@@ -215,14 +219,7 @@ void melp_list_clear(MelpList* list) {
         return;
     }
     
-    // Free all elements
-    for (size_t i = 0; i < list->length; i++) {
-        if (list->elements[i]) {
-            free(list->elements[i]);
-            list->elements[i] = NULL;
-        }
-    }
-    
+    // Nothing to free per element
     list->length = 0;
 }
 
@@ -246,13 +243,11 @@ MelpList* melp_list_clone(MelpList* list) {
         return NULL;
     }
     
-    // Copy all elements
-    for (size_t i = 0; i < list->length; i++) {
-        if (melp_list_append(new_list, list->elements[i]) != 0) {
-            melp_list_free(new_list);
-            return NULL;
-        }
+    // Copy all elements at once
+    if (list->length > 0) {
+        memcpy(new_list->elements, list->elements, list->length * list->element_size);
     }
+    new_list->length = list->length;
     
     return new_list;
 }
@@ -264,12 +259,19 @@ void melp_list_reverse(MelpList* list) {
     
     size_t left = 0;
     size_t right = list->length - 1;
+    size_t size = list->element_size;
+    unsigned char temp[64];
     
     while (left < right) {
-        // Swap elements
-        void* temp = list->elements[left];
-        list->elements[left] = list->elements[right];
-        list->elements[right] = temp;
+        // Swap elements (in temp-sized chunks for large elements)
+        unsigned char* a = ELEMENT_AT(list, left);
+        unsigned char* b = ELEMENT_AT(list, right);
+        for (size_t offset = 0; offset < size; offset += sizeof(temp)) {
+            size_t chunk = size - offset < sizeof(temp) ? size - offset : sizeof(temp);
+            memcpy(temp, a + offset, chunk);
+            memcpy(a + offset, b + offset, chunk);
+            memcpy(b + offset, temp, chunk);
+        }
         
         left++;
         right--;
@@ -288,7 +290,13 @@ int melp_list_reserve(MelpList* list, size_t new_capacity) {
         return 0;  // No need to grow
     }
     
-    void** new_elements = (void**)realloc(list->elements, sizeof(void*) * new_capacity);
+    if (new_capacity > SIZE_MAX / list->element_size) {
+        return -1;  // Byte size would overflow
+    }
+    
+    unsigned char* new_elements =
+        (unsigned char*)sto_pool_realloc(list->elements, list->element_size * list->capacity,
+                                         list->element_size * new_capacity, STO_POOL_LIST);
     if (!new_elements) {
         return -1;
     }
@@ -299,6 +307,49 @@ int melp_list_reserve(MelpList* list, size_t new_capacity) {
     return 0;
 }
 
+int melp_list_resize(MelpList* list, size_t new_length) {
+    if (!list) {
+        return -1;
+    }
+    
+    if (new_length > list->capacity) {
+        // Doubling keeps repeated small resizes amortized
+        size_t new_capacity = list->capacity * GROWTH_FACTOR;
+        if (new_capacity < new_length) {
+            new_capacity = new_length;
+        }
+        if (melp_list_reserve(list, new_capacity) != 0) {
+            return -1;
+        }
+    }
+    
+    if (new_length > list->length) {
+        memset(ELEMENT_AT(list, list->length), 0,
+               (new_length - list->length) * list->element_size);
+    }
+    list->length = new_length;
+    
+    return 0;
+}
+
+// -----------------------------------------------------------------------------
+// Compiled Code Entry Points
+// -----------------------------------------------------------------------------
+
+MelpList* melp_list_create_zeroed(size_t element_size, size_t length) {
+    MelpList* list = melp_list_create(element_size);
+    if (!list || melp_list_resize(list, length) != 0) {
+        mlp_runtime_error("Out of memory creating list");
+    }
+    return list;
+}
+
+void melp_list_grow_checked(MelpList* list) {
+    if (melp_list_grow(list) != 0) {
+        mlp_runtime_error("Out of memory growing list");
+    }
+}
+
 // -----------------------------------------------------------------------------
 // Debug & Introspection
 // -----------------------------------------------------------------------------
@@ -313,10 +364,11 @@ void melp_list_print_debug(MelpList* list) {
     
     for (size_t i = 0; i < list->length; i++) {
         if (list->element_size == sizeof(int64_t)) {
-            int64_t* val = (int64_t*)list->elements[i];
-            printf("%lld", (long long)*val);
+            int64_t val;
+            memcpy(&val, ELEMENT_AT(list, i), sizeof(val));
+            printf("%lld", (long long)val);
         } else {
-            printf("%p", list->elements[i]);
+            printf("%p", (void*)ELEMENT_AT(list, i));
         }
         
         if (i < list->length - 1) {
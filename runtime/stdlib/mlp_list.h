@@ -17,18 +17,29 @@
  * MelpList - Dynamic array structure
  * 
  * Design Philosophy:
- * - Generic storage using void* array
+ * - Elements stored inline: one element_size * capacity buffer, element i
+ *   at elements + i * element_size (no per-element allocation)
  * - Capacity doubling strategy (Python/Rust Vec style)
  * - STO-compatible (heap allocation tracked)
  * - Initial capacity: 4 elements
+ * - Reference counted: compiled code shares a list between variables
+ *   (melp_list_retain/melp_list_release); C callers own the one reference
+ *   melp_list_create returns and may free it directly
+ * - Stack lists: the compiler places a list literal that never escapes its
+ *   function (and is never appended to) in the function's stack frame,
+ *   header and elements; its refcount is MELP_LIST_REFCOUNT_STACK, which
+ *   retain, release and free leave alone
  */
 typedef struct {
-    void** elements;      // Array of generic pointers
+    unsigned char* elements;  // capacity * element_size bytes, contiguous
     size_t length;        // Current number of elements
     size_t capacity;      // Allocated capacity
     size_t element_size;  // Size of each element in bytes (for homogeneous lists)
+    size_t refcount;      // References held (1 after create)
 } MelpList;
 
+#define MELP_LIST_REFCOUNT_STACK SIZE_MAX  // Refcount of a list in a stack frame (never freed)
+
 // -----------------------------------------------------------------------------
 // Core List Operations
 // -----------------------------------------------------------------------------
@@ -41,11 +52,30 @@ typedef struct {
 MelpList* melp_list_create(size_t element_size);
 
 /**
- * Free a list and all its allocated memory
+ * Free a list and all its allocated memory, whatever its refcount (a stack
+ * list is left alone)
  * @param list List to free
  */
 void melp_list_free(MelpList* list);
 
+/**
+ * Take / drop a reference (NULL and stack lists are ignored); the last
+ * release frees
+ * @param list List to share or let go of
+ */
+void melp_list_retain(MelpList* list);
+void melp_list_release(MelpList* list);
+
+/**
+ * Same for a list of MelpStr elements, which owns their text (compiled
+ * string[] lists): each element's text is freed with the list
+ * (mlp_str_free). Freeing a stack list frees its elements' text and
+ * leaves the list itself alone.
+ * @param list List of MelpStr to let go of
+ */
+void melp_list_free_strings(MelpList* list);
+void melp_list_release_strings(MelpList* list);
+
 /**
  * Get the current length of the list
  * @param list List to query
@@ -69,11 +99,14 @@ int melp_list_is_empty(MelpList* list);
  * @param list List to access
  * @param index Zero-based index
  * @return Pointer to element, or NULL if index out of bounds
+ *
+ * NOTE: Points into the list's buffer, do not free! Valid until the list
+ * grows (append, prepend, reserve, resize) or is freed.
  */
 void* melp_list_get(MelpList* list, size_t index);
 
 /**
- * Set element at specified index
+ * Set element at specified index (copied in place, no allocation)
  * @param list List to modify
  * @param index Zero-based index
  * @param element Pointer to element data to copy
@@ -88,7 +121,7 @@ int melp_list_set(MelpList* list, size_t index, void* element);
 /**
  * Append element to end of list
  * @param list List to modify
- * @param element Pointer to element data to copy
+ * @param element Pointer to element data to copy (may point into list)
  * @return 0 on success, -1 on failure (memory allocation)
  */
 int melp_list_append(MelpList* list, void* element);
@@ -96,7 +129,7 @@ int melp_list_append(MelpList* list, void* element);
 /**
  * Prepend element to beginning of list
  * @param list List to modify
- * @param element Pointer to element data to copy
+ * @param element Pointer to element data to copy (may point into list)
  * @return 0 on success, -1 on failure (memory allocation)
  */
 int melp_list_prepend(MelpList* list, void* element);
@@ -147,6 +180,36 @@ size_t melp_list_capacity(MelpList* list);
  */
 int melp_list_reserve(MelpList* list, size_t new_capacity);
 
+/**
+ * Set the length of the list; new elements are zero-filled
+ * @param list List to modify
+ * @param new_length Number of elements afterwards
+ * @return 0 on success, -1 on failure
+ */
+int melp_list_resize(MelpList* list, size_t new_length);
+
+// -----------------------------------------------------------------------------
+// Compiled Code Entry Points
+// -----------------------------------------------------------------------------
+// Stage 2 lowers typed lists (numeric[], boolean[], string[]) to loads and
+// stores on this struct; it calls into the runtime only to allocate, grow,
+// retain/release and free. These never return on allocation failure
+// (mlp_runtime_error).
+
+/**
+ * Create a list of length zero-filled elements
+ * @param element_size Size of each element in bytes
+ * @param length Initial number of elements
+ * @return New list (never NULL)
+ */
+MelpList* melp_list_create_zeroed(size_t element_size, size_t length);
+
+/**
+ * Double the capacity of a full list (slow path of an inline append)
+ * @param list List to grow
+ */
+void melp_list_grow_checked(MelpList* list);
+
 // -----------------------------------------------------------------------------
 // Debug & Introspection
 // -----------------------------------------------------------------------------
@@ -1,43 +1,329 @@
 /**
  * MLP Standard Library - Map (Hash Table) Operations Implementation
- * 
- * Hash table with chaining for collision resolution
+ *
+ * Open addressing with SwissTable-style control bytes
  * YZ_201: Map/Dictionary Type Implementation
- * 
+ *
+ * Each slot has a control byte: CTRL_EMPTY, CTRL_DELETED, or H2 (the low
+ * 7 bits of the entry's hash). A lookup starts at H1 (the remaining hash
+ * bits) & mask and compares a whole group of 16 control bytes against H2
+ * in one SSE2 compare; only matching slots are looked at, and the search
+ * ends at the first group with an empty slot. Groups are visited in
+ * triangular steps, which covers every group of a power-of-two table.
+ * The first MELP_MAP_GROUP_WIDTH control bytes are mirrored after the
+ * last one, so a group load never wraps.
+ *
  * Created: 21 Aralık 2025 (YZ_201)
  */
 
 #include "mlp_map.h"
+#include "../sto/sto_pool.h"  // Headers, tables and key blocks come from the runtime pool
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 
-#ifndef _GNU_SOURCE
-#define _GNU_SOURCE  // For strdup on some systems
+#if defined(__x86_64__) && defined(__GNUC__)
+#define MLP_MAP_SSE2 1
+#include <emmintrin.h>
+#else
+#define MLP_MAP_SSE2 0
 #endif
 
 // Constants
 #define INITIAL_CAPACITY 16
-#define LOAD_FACTOR 0.75
-#define FNV_OFFSET_BASIS 14695981039346656037ULL
-#define FNV_PRIME 1099511628211ULL
+#define GROUP MELP_MAP_GROUP_WIDTH
+#define CTRL_EMPTY ((uint8_t)0x80)
+#define CTRL_DELETED ((uint8_t)0xFE)
+#define NOT_FOUND ((size_t)-1)
+#define KEY_BLOCK_MIN 4096
+#define KEY_BLOCK_MAX (1 << 20)
+
+struct MelpMapKeyBlock {
+    MelpMapKeyBlock* next;
+    size_t used;
+    size_t size;
+    char data[];
+};
 
 // -----------------------------------------------------------------------------
-// Hash Function: FNV-1a (Fowler-Noll-Vo)
+// Hash Function: wyhash (final version 4)
 // -----------------------------------------------------------------------------
+// Reads 8 bytes per step and mixes with one 64x64->128 multiply, so short
+// keys cost a couple of multiplies instead of one multiply per byte.
+
+static const uint64_t wyhash_secret[4] = {
+    0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL,
+    0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL
+};
+
+static inline void wy_mum(uint64_t* a, uint64_t* b) {
+#ifdef __SIZEOF_INT128__
+    __uint128_t r = (__uint128_t)*a * *b;
+    *a = (uint64_t)r;
+    *b = (uint64_t)(r >> 64);
+#else
+    uint64_t ha = *a >> 32, hb = *b >> 32, la = (uint32_t)*a, lb = (uint32_t)*b;
+    uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    uint64_t t = rl + (rm0 << 32), c = t < rl;
+    uint64_t lo = t + (rm1 << 32);
+    c += lo < t;
+    *a = lo;
+    *b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+}
+
+static inline uint64_t wy_mix(uint64_t a, uint64_t b) {
+    wy_mum(&a, &b);
+    return a ^ b;
+}
+
+static inline uint64_t wy_r8(const uint8_t* p) {
+    uint64_t v;
+    memcpy(&v, p, 8);
+    return v;
+}
+
+static inline uint64_t wy_r4(const uint8_t* p) {
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return v;
+}
+
+static inline uint64_t wy_r3(const uint8_t* p, size_t k) {
+    return ((uint64_t)p[0] << 16) | ((uint64_t)p[k >> 1] << 8) | p[k - 1];
+}
+
+uint64_t melp_map_hash_bytes(const void* data, size_t length) {
+    const uint8_t* p = (const uint8_t*)data;
+    const uint64_t* s = wyhash_secret;
+    uint64_t seed = wy_mix(s[0], s[1]);
+    uint64_t a, b;
+
+    if (length <= 16) {
+        if (length >= 4) {
+            a = (wy_r4(p) << 32) | wy_r4(p + ((length >> 3) << 2));
+            b = (wy_r4(p + length - 4) << 32) | wy_r4(p + length - 4 - ((length >> 3) << 2));
+        } else if (length > 0) {
+            a = wy_r3(p, length);
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        size_t i = length;
+        if (i >= 48) {
+            uint64_t see1 = seed, see2 = seed;
+            do {
+                seed = wy_mix(wy_r8(p) ^ s[1], wy_r8(p + 8) ^ seed);
+                see1 = wy_mix(wy_r8(p + 16) ^ s[2], wy_r8(p + 24) ^ see1);
+                see2 = wy_mix(wy_r8(p + 32) ^ s[3], wy_r8(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while (i >= 48);
+            seed ^= see1 ^ see2;
+        }
+        while (i > 16) {
+            seed = wy_mix(wy_r8(p) ^ s[1], wy_r8(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+        a = wy_r8(p + i - 16);
+        b = wy_r8(p + i - 8);
+    }
+
+    a ^= s[1];
+    b ^= seed;
+    wy_mum(&a, &b);
+    return wy_mix(a ^ s[0] ^ length, b ^ s[1]);
+}
 
 uint64_t melp_map_hash(const char* key) {
     if (!key) return 0;
-    
-    uint64_t hash = FNV_OFFSET_BASIS;
-    
-    while (*key) {
-        hash ^= (uint64_t)(unsigned char)(*key);
-        hash *= FNV_PRIME;
-        key++;
+    return melp_map_hash_bytes(key, strlen(key));
+}
+
+// -----------------------------------------------------------------------------
+// Control Byte Groups
+// -----------------------------------------------------------------------------
+// Bit i of a mask is set when control byte i of the group matches.
+
+static inline uint32_t group_match(const uint8_t* group, uint8_t h2) {
+#if MLP_MAP_SSE2
+    __m128i ctrl = _mm_loadu_si128((const __m128i*)group);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)h2)));
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < GROUP; i++) mask |= (uint32_t)(group[i] == h2) << i;
+    return mask;
+#endif
+}
+
+static inline uint32_t group_match_empty(const uint8_t* group) {
+    return group_match(group, CTRL_EMPTY);
+}
+
+// Empty and deleted are the only control bytes with the top bit set
+static inline uint32_t group_match_free(const uint8_t* group) {
+#if MLP_MAP_SSE2
+    return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)group));
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < GROUP; i++) mask |= (uint32_t)(group[i] >> 7) << i;
+    return mask;
+#endif
+}
+
+static inline uint64_t hash_h1(uint64_t hash) { return hash >> 7; }
+static inline uint8_t hash_h2(uint64_t hash) { return (uint8_t)(hash & 0x7F); }
+
+// Entries allowed before a rehash: 7/8 of the slots
+static size_t growth_limit(size_t capacity) {
+    return capacity - capacity / 8;
+}
+
+static void set_ctrl(MelpMap* map, size_t index, uint8_t value) {
+    map->ctrl[index] = value;
+    if (index < GROUP) {
+        map->ctrl[map->capacity + index] = value;  // Mirror for unwrapped loads
+    }
+}
+
+static inline MelpMapSlot* slot_at(const MelpMap* map, size_t index) {
+    return (MelpMapSlot*)(map->entries + index * map->entry_size);
+}
+
+static inline unsigned char* value_at(const MelpMap* map, size_t index) {
+    return (unsigned char*)(slot_at(map, index) + 1);
+}
+
+static inline const char* slot_key(const MelpMapSlot* slot) {
+    return slot->key_length <= MELP_MAP_INLINE_KEY ? slot->key.inline_key : slot->key.arena_key;
+}
+
+// -----------------------------------------------------------------------------
+// Probing
+// -----------------------------------------------------------------------------
+
+static size_t find_slot(const MelpMap* map, const char* key, size_t length, uint64_t hash) {
+    size_t mask = map->capacity - 1;
+    size_t pos = hash_h1(hash) & mask;
+    uint8_t h2 = hash_h2(hash);
+
+    for (size_t step = GROUP; ; step += GROUP) {
+        const uint8_t* group = map->ctrl + pos;
+        for (uint32_t match = group_match(group, h2); match; match &= match - 1) {
+            size_t index = (pos + (size_t)__builtin_ctz(match)) & mask;
+            const MelpMapSlot* slot = slot_at(map, index);
+            if (slot->hash == hash && slot->key_length == length &&
+                memcmp(slot_key(slot), key, length) == 0) {
+                return index;
+            }
+        }
+        if (group_match_empty(group)) return NOT_FOUND;
+        pos = (pos + step) & mask;
+    }
+}
+
+// First empty or deleted slot on hash's probe sequence (one always exists:
+// the load stays under 7/8)
+static size_t find_free_slot(const MelpMap* map, uint64_t hash) {
+    size_t mask = map->capacity - 1;
+    size_t pos = hash_h1(hash) & mask;
+
+    for (size_t step = GROUP; ; step += GROUP) {
+        uint32_t free_mask = group_match_free(map->ctrl + pos);
+        if (free_mask) return (pos + (size_t)__builtin_ctz(free_mask)) & mask;
+        pos = (pos + step) & mask;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Key Arena
+// -----------------------------------------------------------------------------
+
+static void free_key_blocks(MelpMapKeyBlock* block) {
+    while (block) {
+        MelpMapKeyBlock* next = block->next;
+        sto_pool_free(block, sizeof(MelpMapKeyBlock) + block->size, STO_POOL_MAP);
+        block = next;
+    }
+}
+
+static MelpMapKeyBlock* new_key_block(size_t size, MelpMapKeyBlock* next) {
+    MelpMapKeyBlock* block = (MelpMapKeyBlock*)sto_pool_alloc(sizeof(MelpMapKeyBlock) + size, STO_POOL_MAP);
+    if (!block) return NULL;
+    block->next = next;
+    block->used = 0;
+    block->size = size;
+    return block;
+}
+
+// NUL-terminated copy of a long key in the arena
+static const char* copy_key(MelpMap* map, const char* key, size_t length) {
+    size_t need = length + 1;
+    MelpMapKeyBlock* block = map->keys;
+    if (!block || block->size - block->used < need) {
+        size_t size = block ? block->size * 2 : KEY_BLOCK_MIN;
+        if (size > KEY_BLOCK_MAX) size = KEY_BLOCK_MAX;
+        if (size < need) size = need;
+        block = new_key_block(size, map->keys);
+        if (!block) return NULL;
+        map->keys = block;
     }
-    
-    return hash;
+
+    char* copy = block->data + block->used;
+    memcpy(copy, key, length);
+    copy[length] = '\0';
+    block->used += need;
+    map->key_bytes_live += need;
+    return copy;
+}
+
+// Move the present long keys into one block, dropping removed ones
+// (skipped, keeping the old arena, if the block cannot be allocated)
+static void compact_keys(MelpMap* map) {
+    size_t size = map->key_bytes_live > KEY_BLOCK_MIN ? map->key_bytes_live : KEY_BLOCK_MIN;
+    MelpMapKeyBlock* block = new_key_block(size, NULL);
+    if (!block) return;
+
+    for (size_t i = 0; i < map->capacity; i++) {
+        if (map->ctrl[i] & CTRL_EMPTY) continue;  // Empty or deleted
+        MelpMapSlot* slot = slot_at(map, i);
+        if (slot->key_length <= MELP_MAP_INLINE_KEY) continue;
+        char* copy = block->data + block->used;
+        memcpy(copy, slot->key.arena_key, slot->key_length + 1);
+        block->used += slot->key_length + 1;
+        slot->key.arena_key = copy;
+    }
+
+    free_key_blocks(map->keys);
+    map->keys = block;
+    map->key_bytes_dead = 0;
+}
+
+// -----------------------------------------------------------------------------
+// Table Allocation
+// -----------------------------------------------------------------------------
+
+// Bytes of the block holding a table of map->capacity entries
+static size_t table_bytes(const MelpMap* map) {
+    return map->capacity * (map->entry_size + 1) + GROUP;
+}
+
+// Entries and control bytes in one block (entries first: the block is
+// freed through map->entries). capacity is a power of two >= GROUP.
+static int alloc_table(MelpMap* map, size_t capacity) {
+    if (capacity > (SIZE_MAX - GROUP) / (map->entry_size + 1)) return 0;
+
+    size_t entries_bytes = capacity * map->entry_size;
+    unsigned char* block = (unsigned char*)sto_pool_alloc(entries_bytes + capacity + GROUP, STO_POOL_MAP);
+    if (!block) return 0;
+
+    map->entries = block;
+    map->ctrl = block + entries_bytes;
+    map->capacity = capacity;
+    memset(map->ctrl, CTRL_EMPTY, capacity + GROUP);
+    return 1;
 }
 
 // -----------------------------------------------------------------------------
@@ -45,44 +331,30 @@ uint64_t melp_map_hash(const char* key) {
 // -----------------------------------------------------------------------------
 
 MelpMap* melp_map_create(size_t value_size) {
-    MelpMap* map = (MelpMap*)malloc(sizeof(MelpMap));
+    MelpMap* map = (MelpMap*)sto_pool_calloc(sizeof(MelpMap), STO_POOL_MAP);
     if (!map) {
         fprintf(stderr, "MELP Runtime Error: Failed to allocate map\n");
         return NULL;
     }
-    
-    map->capacity = INITIAL_CAPACITY;
-    map->length = 0;
+
     map->value_size = value_size;
-    
-    // Allocate bucket array (calloc for NULL initialization)
-    map->buckets = (MelpMapNode**)calloc(map->capacity, sizeof(MelpMapNode*));
-    if (!map->buckets) {
+    map->entry_size = (sizeof(MelpMapSlot) + value_size + 7) & ~(size_t)7;
+    if (map->entry_size < value_size || !alloc_table(map, INITIAL_CAPACITY)) {
         fprintf(stderr, "MELP Runtime Error: Failed to allocate map buckets\n");
-        free(map);
+        sto_pool_free(map, sizeof(MelpMap), STO_POOL_MAP);
         return NULL;
     }
-    
+    map->growth_left = growth_limit(INITIAL_CAPACITY);
+
     return map;
 }
 
 void melp_map_free(MelpMap* map) {
     if (!map) return;
-    
-    // Free all nodes in all buckets
-    for (size_t i = 0; i < map->capacity; i++) {
-        MelpMapNode* node = map->buckets[i];
-        while (node) {
-            MelpMapNode* next = node->next;
-            free(node->key);      // Free copied key
-            free(node->value);    // Free copied value
-            free(node);           // Free node itself
-            node = next;
-        }
-    }
-    
-    free(map->buckets);
-    free(map);
+
+    sto_pool_free(map->entries, table_bytes(map), STO_POOL_MAP);  // Entries and control bytes
+    free_key_blocks(map->keys);
+    sto_pool_free(map, sizeof(MelpMap), STO_POOL_MAP);
 }
 
 // -----------------------------------------------------------------------------
@@ -91,37 +363,34 @@ void melp_map_free(MelpMap* map) {
 
 int melp_map_resize(MelpMap* map, size_t new_capacity) {
     if (!map || new_capacity == 0) return 0;
-    
-    // Allocate new bucket array
-    MelpMapNode** new_buckets = (MelpMapNode**)calloc(new_capacity, sizeof(MelpMapNode*));
-    if (!new_buckets) {
+
+    size_t capacity = INITIAL_CAPACITY;
+    while (capacity < new_capacity || growth_limit(capacity) < map->length) {
+        if (capacity > SIZE_MAX / 2) return 0;
+        capacity *= 2;
+    }
+
+    MelpMap old = *map;
+    if (!alloc_table(map, capacity)) {
         fprintf(stderr, "MELP Runtime Error: Failed to resize map\n");
+        *map = old;
         return 0;
     }
-    
-    // Rehash all existing nodes
-    for (size_t i = 0; i < map->capacity; i++) {
-        MelpMapNode* node = map->buckets[i];
-        while (node) {
-            MelpMapNode* next = node->next;
-            
-            // Compute new bucket index
-            uint64_t hash = melp_map_hash(node->key);
-            size_t new_index = hash % new_capacity;
-            
-            // Insert at head of new bucket (preserves O(1) insertion)
-            node->next = new_buckets[new_index];
-            new_buckets[new_index] = node;
-            
-            node = next;
-        }
+
+    // Move every entry by its cached hash (no key is read or rehashed)
+    for (size_t i = 0; i < old.capacity; i++) {
+        if (old.ctrl[i] & CTRL_EMPTY) continue;  // Empty or deleted
+        const MelpMapSlot* slot = slot_at(&old, i);
+        size_t index = find_free_slot(map, slot->hash);
+        set_ctrl(map, index, hash_h2(slot->hash));
+        memcpy(slot_at(map, index), slot, map->entry_size);  // Slot, inline key, value
+    }
+    sto_pool_free(old.entries, table_bytes(&old), STO_POOL_MAP);
+    map->growth_left = growth_limit(capacity) - map->length;
+
+    if (map->key_bytes_dead > map->key_bytes_live) {
+        compact_keys(map);
     }
-    
-    // Replace old buckets with new ones
-    free(map->buckets);
-    map->buckets = new_buckets;
-    map->capacity = new_capacity;
-    
     return 1;
 }
 
@@ -131,58 +400,56 @@ int melp_map_resize(MelpMap* map, size_t new_capacity) {
 
 int melp_map_insert(MelpMap* map, const char* key, const void* value) {
     if (!map || !key || !value) return 0;
-    
-    // Check if resize needed (load factor > 0.75)
-    if ((double)map->length / (double)map->capacity > LOAD_FACTOR) {
-        if (!melp_map_resize(map, map->capacity * 2)) {
+
+    size_t length = strlen(key);
+    uint64_t hash = melp_map_hash_bytes(key, length);
+
+    // Check if key already exists (update if found)
+    size_t index = find_slot(map, key, length, hash);
+    if (index != NOT_FOUND) {
+        memcpy(value_at(map, index), value, map->value_size);
+        return 1;
+    }
+
+    // Reusing a deleted slot costs nothing; taking an empty one needs room.
+    // Mostly deleted slots: rebuild at the same size, else double.
+    index = find_free_slot(map, hash);
+    if (map->ctrl[index] == CTRL_EMPTY && map->growth_left == 0) {
+        size_t capacity = map->length < growth_limit(map->capacity) / 2
+                              ? map->capacity : map->capacity * 2;
+        if (!melp_map_resize(map, capacity)) {
             return 0;  // Resize failed
         }
+        index = find_free_slot(map, hash);
     }
-    
-    // Compute bucket index
-    uint64_t hash = melp_map_hash(key);
-    size_t index = hash % map->capacity;
-    
-    // Check if key already exists (update if found)
-    MelpMapNode* node = map->buckets[index];
-    while (node) {
-        if (strcmp(node->key, key) == 0) {
-            // Key exists, update value
-            memcpy(node->value, value, map->value_size);
-            return 1;
+
+    // Copy key (take ownership): short keys into the slot, long ones into
+    // the arena. Insert/remove cycles reuse slots without a rehash, so dead
+    // arena bytes are also reclaimed here once they outweigh both the live
+    // keys and a scan of the table.
+    MelpMapSlot* slot = slot_at(map, index);
+    if (length <= MELP_MAP_INLINE_KEY) {
+        memcpy(slot->key.inline_key, key, length + 1);
+    } else {
+        if (map->key_bytes_dead > map->key_bytes_live + map->capacity) {
+            compact_keys(map);
         }
-        node = node->next;
-    }
-    
-    // Key doesn't exist, create new node
-    MelpMapNode* new_node = (MelpMapNode*)malloc(sizeof(MelpMapNode));
-    if (!new_node) {
-        fprintf(stderr, "MELP Runtime Error: Failed to allocate map node\n");
-        return 0;
-    }
-    
-    // Copy key (take ownership)
-    new_node->key = strdup(key);
-    if (!new_node->key) {
-        fprintf(stderr, "MELP Runtime Error: Failed to copy map key\n");
-        free(new_node);
-        return 0;
+        const char* copy = copy_key(map, key, length);
+        if (!copy) {
+            fprintf(stderr, "MELP Runtime Error: Failed to copy map key\n");
+            return 0;
+        }
+        slot->key.arena_key = copy;
     }
-    
-    // Copy value (take ownership)
-    new_node->value = malloc(map->value_size);
-    if (!new_node->value) {
-        fprintf(stderr, "MELP Runtime Error: Failed to allocate map value\n");
-        free(new_node->key);
-        free(new_node);
-        return 0;
+
+    if (map->ctrl[index] == CTRL_EMPTY) {
+        map->growth_left--;
     }
-    memcpy(new_node->value, value, map->value_size);
-    
-    // Insert at head of bucket (O(1) insertion)
-    new_node->next = map->buckets[index];
-    map->buckets[index] = new_node;
-    
+    set_ctrl(map, index, hash_h2(hash));
+    slot->hash = hash;
+    slot->key_length = length;
+    memcpy(value_at(map, index), value, map->value_size);
+
     map->length++;
     return 1;
 }
@@ -193,21 +460,10 @@ int melp_map_insert(MelpMap* map, const char* key, const void* value) {
 
 void* melp_map_get(MelpMap* map, const char* key) {
     if (!map || !key) return NULL;
-    
-    // Compute bucket index
-    uint64_t hash = melp_map_hash(key);
-    size_t index = hash % map->capacity;
-    
-    // Search in bucket chain
-    MelpMapNode* node = map->buckets[index];
-    while (node) {
-        if (strcmp(node->key, key) == 0) {
-            return node->value;  // Found!
-        }
-        node = node->next;
-    }
-    
-    return NULL;  // Not found
+
+    size_t length = strlen(key);
+    size_t index = find_slot(map, key, length, melp_map_hash_bytes(key, length));
+    return index == NOT_FOUND ? NULL : value_at(map, index);
 }
 
 // -----------------------------------------------------------------------------
@@ -216,38 +472,34 @@ void* melp_map_get(MelpMap* map, const char* key) {
 
 int melp_map_remove(MelpMap* map, const char* key) {
     if (!map || !key) return 0;
-    
-    // Compute bucket index
-    uint64_t hash = melp_map_hash(key);
-    size_t index = hash % map->capacity;
-    
-    // Search in bucket chain (track previous node for deletion)
-    MelpMapNode* node = map->buckets[index];
-    MelpMapNode* prev = NULL;
-    
-    while (node) {
-        if (strcmp(node->key, key) == 0) {
-            // Found! Remove node from chain
-            if (prev) {
-                prev->next = node->next;  // Remove from middle/end
-            } else {
-                map->buckets[index] = node->next;  // Remove from head
-            }
-            
-            // Free node memory
-            free(node->key);
-            free(node->value);
-            free(node);
-            
-            map->length--;
-            return 1;  // Success
-        }
-        
-        prev = node;
-        node = node->next;
+
+    size_t length = strlen(key);
+    size_t index = find_slot(map, key, length, melp_map_hash_bytes(key, length));
+    if (index == NOT_FOUND) {
+        return 0;  // Key not found
+    }
+
+    // If every group that holds this slot also has an empty slot, no probe
+    // ever went past it, so it can be empty again instead of a tombstone
+    size_t mask = map->capacity - 1;
+    uint32_t empty_before = group_match_empty(map->ctrl + ((index - GROUP) & mask));
+    uint32_t empty_after = group_match_empty(map->ctrl + index);
+    int never_full = empty_before && empty_after &&
+                     (size_t)__builtin_ctz(empty_after) +
+                     (size_t)(__builtin_clz(empty_before) - (32 - GROUP)) < GROUP;
+
+    set_ctrl(map, index, never_full ? CTRL_EMPTY : CTRL_DELETED);
+    if (never_full) {
+        map->growth_left++;
+    }
+
+    size_t key_length = slot_at(map, index)->key_length;
+    if (key_length > MELP_MAP_INLINE_KEY) {
+        map->key_bytes_live -= key_length + 1;
+        map->key_bytes_dead += key_length + 1;
     }
-    
-    return 0;  // Key not found
+    map->length--;
+    return 1;  // Success
 }
 
 // -----------------------------------------------------------------------------
@@ -266,3 +518,17 @@ size_t melp_map_length(MelpMap* map) {
     if (!map) return 0;
     return map->length;
 }
+
+// -----------------------------------------------------------------------------
+// Map Iteration
+// -----------------------------------------------------------------------------
+
+void melp_map_foreach(MelpMap* map, void (*visit)(const char* key, void* value, void* context),
+                      void* context) {
+    if (!map || !visit) return;
+
+    for (size_t i = 0; i < map->capacity; i++) {
+        if (map->ctrl[i] & CTRL_EMPTY) continue;  // Empty or deleted
+        visit(slot_key(slot_at(map, i)), value_at(map, i), context);
+    }
+}
@@ -1,9 +1,10 @@
 /**
  * MLP Standard Library - Map (Hash Table) Operations Header
- * 
+ *
  * STO-compliant map operations for MELP compiler
- * YZ_201: Hash table with chaining implementation
- * 
+ * YZ_201: Hash table implementation
+ * Open addressing with SwissTable-style control bytes (replaces chaining)
+ *
  * Created: 21 Aralık 2025 (YZ_201)
  */
 
@@ -14,30 +15,61 @@
 #include <stdint.h>  // int64_t, uint64_t
 
 /**
- * Hash Table Node - Singly linked list for collision handling
+ * Probe group width: control bytes compared per step (one SSE2 register)
  */
-typedef struct MelpMapNode {
-    char* key;                  // String key (owned by node)
-    void* value;                // Generic value pointer
-    struct MelpMapNode* next;   // Next node in chain (for collisions)
-} MelpMapNode;
+#define MELP_MAP_GROUP_WIDTH 16
 
 /**
- * MelpMap - Hash table with chaining
- * 
+ * Keys up to this many bytes are stored in the slot itself
+ */
+#define MELP_MAP_INLINE_KEY 15
+
+/**
+ * Slot - One entry of the open-addressed table (its value follows it)
+ * The full hash is cached, so growing never rehashes a key and a probe
+ * only compares key bytes when the whole 64-bit hash already matches.
+ */
+typedef struct MelpMapSlot {
+    uint64_t hash;              // wyhash of the key
+    size_t key_length;
+    union {
+        char inline_key[MELP_MAP_INLINE_KEY + 1];  // key_length <= 15 (NUL-terminated)
+        const char* arena_key;                     // Longer: copy in the key arena
+    } key;
+} MelpMapSlot;
+
+/**
+ * Key arena block (keys are bump-allocated, never freed one by one)
+ */
+typedef struct MelpMapKeyBlock MelpMapKeyBlock;
+
+/**
+ * MelpMap - Open-addressing hash table (SwissTable layout)
+ *
  * Design Philosophy:
- * - Open hashing (chaining) for collision resolution
- * - FNV-1a hash function for string keys
- * - Load factor: 0.75 (resize when length > capacity * 0.75)
- * - Initial capacity: 16 buckets
+ * - One control byte per slot: empty, deleted, or the low 7 hash bits of
+ *   the entry; a probe compares 16 of them at once and only looks at
+ *   slots whose 7 bits match
+ * - Capacity is a power of two (index = hash bits & mask, no division)
+ * - Max load 7/8; deleted slots count against it until the next rehash
+ * - Entries (slot + value) and control bytes share one allocation; short
+ *   keys are stored in the slot and longer ones in an arena, so an insert
+ *   does no per-entry malloc and a hit touches one control group and one
+ *   entry
  * - String keys only (for stage0 simplicity)
- * - Generic values (void* pointers)
+ * - Generic values (value_size bytes, copied in)
  */
 typedef struct {
-    MelpMapNode** buckets;    // Array of bucket heads
+    uint8_t* ctrl;            // capacity + MELP_MAP_GROUP_WIDTH control bytes
+    unsigned char* entries;   // capacity entries: MelpMapSlot, then the value
+    size_t entry_size;        // sizeof(MelpMapSlot) + value_size, 8-byte aligned
     size_t length;            // Current number of key-value pairs
-    size_t capacity;          // Number of buckets
+    size_t capacity;          // Number of slots (power of two, >= 16)
+    size_t growth_left;       // Inserts into empty slots before a rehash
     size_t value_size;        // Size of each value in bytes (for type safety)
+    MelpMapKeyBlock* keys;    // Key arena (newest block first)
+    size_t key_bytes_live;    // Arena bytes of present (long) keys
+    size_t key_bytes_dead;    // Arena bytes of removed keys (reclaimed on rehash)
 } MelpMap;
 
 // -----------------------------------------------------------------------------
@@ -52,7 +84,7 @@ typedef struct {
 MelpMap* melp_map_create(size_t value_size);
 
 /**
- * Free a map and all its allocated memory (keys, values, nodes)
+ * Free a map and all its allocated memory (table, values, key arena)
  * @param map Map to free
  */
 void melp_map_free(MelpMap* map);
@@ -71,8 +103,9 @@ int melp_map_insert(MelpMap* map, const char* key, const void* value);
  * @param map Target map
  * @param key String key to lookup
  * @return Pointer to value data, or NULL if key not found
- * 
- * NOTE: Returned pointer is owned by the map, do not free!
+ *
+ * NOTE: Returned pointer is owned by the map, do not free! Values move
+ * when the table grows, so it is valid until the next insert.
  */
 void* melp_map_get(MelpMap* map, const char* key);
 
@@ -99,21 +132,39 @@ int melp_map_has_key(MelpMap* map, const char* key);
  */
 size_t melp_map_length(MelpMap* map);
 
+/**
+ * Call visit for every key-value pair, in table order
+ * @param map Target map
+ * @param visit Called with the key, the value (owned by the map, may be
+ *              modified in place) and context; it must not insert or remove
+ * @param context Passed through to visit
+ */
+void melp_map_foreach(MelpMap* map, void (*visit)(const char* key, void* value, void* context),
+                      void* context);
+
 // -----------------------------------------------------------------------------
 // Internal Helper Functions
 // -----------------------------------------------------------------------------
 
 /**
- * FNV-1a hash function for string keys
+ * wyhash of a string key (bytes before the NUL)
  * @param key String to hash
  * @return 64-bit hash value
  */
 uint64_t melp_map_hash(const char* key);
 
 /**
- * Resize map to new capacity (internal use)
+ * wyhash of length bytes (8 bytes per multiply-mix step)
+ */
+uint64_t melp_map_hash_bytes(const void* data, size_t length);
+
+/**
+ * Rebuild the table with room for new_capacity slots (internal use)
+ * Rounded up to a power of two that keeps the load under 7/8. Entries
+ * are moved by their cached hash; deleted slots and dead key bytes are
+ * dropped.
  * @param map Target map
- * @param new_capacity New number of buckets
+ * @param new_capacity Requested number of slots
  * @return 1 on success, 0 on failure
  */
 int melp_map_resize(MelpMap* map, size_t new_capacity);
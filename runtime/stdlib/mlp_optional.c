@@ -5,6 +5,7 @@
 
 #include "mlp_optional.h"
 #include "mlp_panic.h"
+#include "../sto/sto_pool.h"  // Optional headers come from the runtime pool
 #include <stdlib.h>
 #include <string.h>
 
@@ -17,7 +18,7 @@
 // ============================================================================
 
 MelpOptional* melp_optional_some(void* value, size_t value_size) {
-    MelpOptional* opt = (MelpOptional*)malloc(sizeof(MelpOptional));
+    MelpOptional* opt = (MelpOptional*)sto_pool_alloc(sizeof(MelpOptional), STO_POOL_OPTIONAL);
     if (!opt) {
         melp_runtime_error("Failed to allocate memory for optional");
     }
@@ -29,7 +30,7 @@ MelpOptional* melp_optional_some(void* value, size_t value_size) {
 }
 
 MelpOptional* melp_optional_none(void) {
-    MelpOptional* opt = (MelpOptional*)malloc(sizeof(MelpOptional));
+    MelpOptional* opt = (MelpOptional*)sto_pool_alloc(sizeof(MelpOptional), STO_POOL_OPTIONAL);
     if (!opt) {
         melp_runtime_error("Failed to allocate memory for optional");
     }
@@ -177,15 +178,15 @@ void* melp_optional_assert(MelpOptional* opt, const char* message) {
 
 void melp_optional_free(MelpOptional* opt) {
     if (opt) {
-        free(opt);
+        sto_pool_free(opt, sizeof(MelpOptional), STO_POOL_OPTIONAL);
     }
 }
 
 void melp_optional_free_deep(MelpOptional* opt) {
     if (opt) {
         if (opt->value) {
-            free(opt->value);
+            free(opt->value);  // Caller's malloc'd payload
         }
-        free(opt);
+        sto_pool_free(opt, sizeof(MelpOptional), STO_POOL_OPTIONAL);
     }
 }
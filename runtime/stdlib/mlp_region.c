@@ -0,0 +1,182 @@
+/**
+ * MLP Standard Library - Regions (Arena Allocation)
+ *
+ * Chunks form a stack (newest on top). Each chunk records the region
+ * offset of its first byte, so a mark is a single number: releasing it
+ * pops the chunks that start past it and rewinds the one it falls in.
+ * When a request does not fit, the rest of the top chunk is skipped.
+ *
+ * Created: 18 Ekim 2026
+ */
+
+#include "mlp_region.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define REGION_ALIGN 16
+
+typedef struct MlpRegionChunk {
+    struct MlpRegionChunk* prev;
+    size_t base;          // Region offset of data[0]
+    size_t size;          // Bytes in data
+    size_t used;          // Bytes handed out
+    _Alignas(REGION_ALIGN) unsigned char data[];
+} MlpRegionChunk;
+
+struct MlpRegion {
+    MlpRegionChunk* top;
+    MlpRegionChunk* spare;    // Last released standard-size chunk
+    size_t chunk_size;
+};
+
+// Generated code's temporaries (one region per thread, no setup)
+static _Thread_local MlpRegion temp_region = { NULL, NULL, MLP_REGION_CHUNK_SIZE };
+
+// -----------------------------------------------------------------------------
+// Chunks
+// -----------------------------------------------------------------------------
+
+// Keep a popped chunk as the spare if it has the standard size
+static void retire_chunk(MlpRegion* region, MlpRegionChunk* chunk) {
+    if (chunk->size == region->chunk_size && !region->spare) {
+        region->spare = chunk;
+    } else {
+        free(chunk);
+    }
+}
+
+static void free_chunks(MlpRegion* region) {
+    while (region->top) {
+        MlpRegionChunk* chunk = region->top;
+        region->top = chunk->prev;
+        free(chunk);
+    }
+    free(region->spare);
+    region->spare = NULL;
+}
+
+// Start a new chunk holding at least need bytes and take need from it
+static void* alloc_in_new_chunk(MlpRegion* region, size_t need) {
+    size_t size = need > region->chunk_size ? need : region->chunk_size;
+    MlpRegionChunk* chunk;
+    if (region->spare && region->spare->size >= size) {
+        chunk = region->spare;
+        region->spare = NULL;
+    } else {
+        chunk = (MlpRegionChunk*)malloc(sizeof(MlpRegionChunk) + size);
+        if (!chunk) {
+            return NULL;
+        }
+        chunk->size = size;
+    }
+
+    MlpRegionChunk* top = region->top;
+    chunk->prev = top;
+    chunk->base = top ? top->base + top->size : 0;
+    chunk->used = need;
+    region->top = chunk;
+    return chunk->data;
+}
+
+// -----------------------------------------------------------------------------
+// Regions
+// -----------------------------------------------------------------------------
+
+MlpRegion* mlp_region_create(size_t chunk_size) {
+    MlpRegion* region = (MlpRegion*)malloc(sizeof(MlpRegion));
+    if (!region) {
+        return NULL;
+    }
+    region->top = NULL;
+    region->spare = NULL;
+    region->chunk_size = chunk_size ? chunk_size : MLP_REGION_CHUNK_SIZE;
+    return region;
+}
+
+void mlp_region_destroy(MlpRegion* region) {
+    if (!region) {
+        return;
+    }
+    free_chunks(region);
+    free(region);
+}
+
+void* mlp_region_alloc(MlpRegion* region, size_t size) {
+    if (size > SIZE_MAX - REGION_ALIGN) {
+        return NULL;
+    }
+    size_t need = size ? (size + REGION_ALIGN - 1) & ~(size_t)(REGION_ALIGN - 1) : REGION_ALIGN;
+
+    MlpRegionChunk* top = region->top;
+    if (top && top->size - top->used >= need) {
+        void* result = top->data + top->used;
+        top->used += need;
+        return result;
+    }
+    return alloc_in_new_chunk(region, need);
+}
+
+char* mlp_region_strndup(MlpRegion* region, const char* data, size_t length) {
+    if (length == SIZE_MAX) {
+        return NULL;
+    }
+    char* copy = (char*)mlp_region_alloc(region, length + 1);
+    if (!copy) {
+        return NULL;
+    }
+    memcpy(copy, data, length);
+    copy[length] = '\0';
+    return copy;
+}
+
+MlpRegionMark mlp_region_mark(const MlpRegion* region) {
+    return (MlpRegionMark)mlp_region_used(region);
+}
+
+void mlp_region_release(MlpRegion* region, MlpRegionMark mark) {
+    size_t offset = mark > 0 ? (size_t)mark : 0;
+    if (offset > mlp_region_used(region)) {
+        return;  // Already released (marks out of order)
+    }
+
+    while (region->top && region->top->base > offset) {
+        MlpRegionChunk* chunk = region->top;
+        region->top = chunk->prev;
+        retire_chunk(region, chunk);
+    }
+    if (region->top) {
+        region->top->used = offset - region->top->base;
+    }
+}
+
+void mlp_region_reset(MlpRegion* region) {
+    while (region->top) {
+        MlpRegionChunk* chunk = region->top;
+        region->top = chunk->prev;
+        retire_chunk(region, chunk);
+    }
+}
+
+size_t mlp_region_used(const MlpRegion* region) {
+    return region->top ? region->top->base + region->top->used : 0;
+}
+
+// -----------------------------------------------------------------------------
+// Per-thread temporaries
+// -----------------------------------------------------------------------------
+
+MlpRegion* mlp_region_temp(void) {
+    return &temp_region;
+}
+
+int64_t mlp_region_enter(void) {
+    return (int64_t)mlp_region_used(&temp_region);
+}
+
+void mlp_region_leave(int64_t mark) {
+    mlp_region_release(&temp_region, mark);
+}
+
+void* mlp_region_temp_alloc(size_t size) {
+    return mlp_region_alloc(&temp_region, size);
+}
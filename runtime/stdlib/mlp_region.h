@@ -0,0 +1,117 @@
+/**
+ * MLP Standard Library - Regions (Arena Allocation) Header
+ *
+ * A region hands out memory by bumping a pointer through chunks and frees
+ * it in bulk: everything allocated after a mark is released at once by
+ * mlp_region_release(mark). There is no per-object free.
+ *
+ * Every thread also has a temporaries region that generated code uses for
+ * strings that never outlive the statement creating them (print(a + b),
+ * length(s + t), s + t == u ...): a function takes a mark on entry
+ * (mlp_region_enter) and hands its temporaries back at the end of each
+ * loop iteration and before returning (mlp_region_leave). Memory used by
+ * a long-running loop is bounded by one iteration's temporaries, and no
+ * temporary is freed one by one.
+ *
+ * Created: 18 Ekim 2026
+ */
+
+#ifndef MLP_REGION_H
+#define MLP_REGION_H
+
+#include <stddef.h>  // size_t
+#include <stdint.h>  // int64_t
+
+// -----------------------------------------------------------------------------
+// Regions
+// -----------------------------------------------------------------------------
+
+/**
+ * MlpRegion - Chunked bump allocator
+ *
+ * Design Philosophy:
+ * - Allocation is a pointer bump (16-byte aligned); a full chunk is
+ *   followed by a new one, so earlier allocations never move
+ * - A mark is the region's offset, so releasing is popping chunks down to
+ *   it; marks must be released innermost first (stack order)
+ * - One released chunk is kept, so a loop that crosses a chunk boundary on
+ *   every iteration does not call malloc/free each time
+ */
+typedef struct MlpRegion MlpRegion;
+
+typedef int64_t MlpRegionMark;
+
+#define MLP_REGION_CHUNK_SIZE 8192   // Default chunk size (bytes)
+
+/**
+ * Create an empty region
+ * @param chunk_size Bytes per chunk (0 = MLP_REGION_CHUNK_SIZE); larger
+ *        requests get a chunk of their own
+ * @return New region, or NULL on allocation failure
+ */
+MlpRegion* mlp_region_create(size_t chunk_size);
+
+/**
+ * Free a region and everything allocated in it
+ */
+void mlp_region_destroy(MlpRegion* region);
+
+/**
+ * Allocate size bytes (16-byte aligned, uninitialized)
+ * @return Memory valid until a mark taken before this call is released,
+ *         or NULL on allocation failure
+ */
+void* mlp_region_alloc(MlpRegion* region, size_t size);
+
+/**
+ * Copy length bytes into the region and NUL-terminate them
+ */
+char* mlp_region_strndup(MlpRegion* region, const char* data, size_t length);
+
+/**
+ * Current position / release everything allocated after it
+ * Releasing a mark also releases the marks taken after it.
+ */
+MlpRegionMark mlp_region_mark(const MlpRegion* region);
+void mlp_region_release(MlpRegion* region, MlpRegionMark mark);
+
+/**
+ * Release everything (chunks are freed, except the one spare)
+ */
+void mlp_region_reset(MlpRegion* region);
+
+/**
+ * Bytes handed out since creation / the last reset (alignment and
+ * skipped chunk tails included)
+ */
+size_t mlp_region_used(const MlpRegion* region);
+
+// -----------------------------------------------------------------------------
+// Per-thread temporaries (generated code)
+// -----------------------------------------------------------------------------
+
+/**
+ * This thread's temporaries region (static per thread, nothing to set up)
+ */
+MlpRegion* mlp_region_temp(void);
+
+/**
+ * Mark / release the temporaries region
+ *
+ * Example (what the compiler emits for a function using temporaries):
+ *   int64_t mark = mlp_region_enter();
+ *   while (...) { print(mlp_str_concat_tmp(a, b)); mlp_region_leave(mark); }
+ *   mlp_region_leave(mark);
+ *   return ...;
+ *
+ * Between calls a thread keeps at most its first chunk and the spare.
+ */
+int64_t mlp_region_enter(void);
+void mlp_region_leave(int64_t mark);
+
+/**
+ * Allocate from the temporaries region (NULL on allocation failure)
+ */
+void* mlp_region_temp_alloc(size_t size);
+
+#endif // MLP_REGION_H
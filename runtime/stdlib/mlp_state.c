@@ -1,57 +1,103 @@
 // YZ_34: Phase 8 - State Manager Implementation
 // STO-optimized (SSO + Heap), File I/O based persistence
+//
+// Entries are indexed by key in STATE_SHARD_COUNT hash tables (MelpMap);
+// the top bits of the key's hash pick the shard. Each shard has its own
+// read-write lock, so lookups of any keys and writes to different shards
+// run in parallel. Values stay inline in the table slot (SSO) up to 23
+// bytes; longer ones live in the STO pool.
+//
+// Persistence modes (config persist_mode):
+// - json: save rewrites persist_file with the whole state, load parses it
+// - log:  every set/delete/clear is appended to <persist_file>.log (under
+//         the shard lock, so the log order matches the table) before it is
+//         applied; the log is compacted into <persist_file>.snapshot once
+//         it outgrows both compact_threshold and the last snapshot. load
+//         maps the snapshot and replays the log; save only syncs the log.
+
+#ifndef _GNU_SOURCE
+#define _POSIX_C_SOURCE 200809L  // pthread_rwlock_t, strdup
+#endif
 
 #include "mlp_state.h"
 #include "mlp_io.h"
+#include "mlp_map.h"
+#include "mlp_state_log.h"
+#include "../sto/sto_pool.h"  // Long values come from the runtime pool
+#include <pthread.h>
+#include <stdatomic.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
-#ifndef _GNU_SOURCE
-char* strdup(const char* s);
-#endif
-
 // STO: Small String Optimization size
 #define STATE_SSO_SIZE 24
 
-// State Entry (STO-optimized)
-typedef struct StateEntry {
-    char* key;
-    
+// Shards (independent tables and locks): enough that threads rarely meet
+#define STATE_SHARD_BITS 6
+#define STATE_SHARD_COUNT (1 << STATE_SHARD_BITS)
+
+// Log bytes before the first compaction (later ones also wait for the log
+// to outgrow the snapshot, so compaction stays O(changes) amortized)
+#define STATE_COMPACT_THRESHOLD (4 << 20)
+
+typedef enum {
+    STATE_PERSIST_JSON = 0,  // Whole state rewritten by save
+    STATE_PERSIST_LOG        // Append-only log + snapshot
+} StatePersistMode;
+
+// State Value (STO-optimized), stored in the shard's table slot
+typedef struct StateValue {
     // STO: Value representation
     union {
         char sso_data[STATE_SSO_SIZE];  // ≤23 bytes (inline)
         char* heap_ptr;                  // >23 bytes (heap)
     } value;
-    
+
     size_t value_len;
     uint8_t is_heap;  // 0 = SSO, 1 = heap
-    
-    struct StateEntry* next;  // Linked list
-} StateEntry;
+} StateValue;
+
+// Shard: one table and the lock guarding it (own cache lines, so threads
+// taking neighbouring shards' locks do not share a line)
+typedef struct StateShard {
+    _Alignas(64) pthread_rwlock_t lock;
+    MelpMap* index;  // Key -> StateValue
+
+    // Statistics (for debugging)
+    size_t total_sso_count;
+    size_t total_heap_count;
+    size_t total_heap_bytes;
+} StateShard;
 
 // State Manager
 typedef struct {
-    StateEntry* entries;
-    int count;
-    
+    StateShard shards[STATE_SHARD_COUNT];
+
     // Configuration
     int auto_persist;       // 0 = memory only, 1 = auto-save
     char* persist_file;     // Default: .melp_state.json
-    
-    // Statistics (for debugging)
-    size_t total_sso_count;
-    size_t total_heap_count;
-    size_t total_heap_bytes;
+    StatePersistMode persist_mode;
+    size_t compact_threshold;  // Log bytes before compaction (0 = only mlp_state_compact)
+
+    // Log mode
+    MlpStateLog log;
+    pthread_mutex_t compact_lock;     // One compaction at a time (taken before shard locks)
+    _Atomic size_t snapshot_bytes;    // Size of the last snapshot written or loaded
 } StateManager;
 
 // Global instance
 static StateManager* g_state_manager = NULL;
 
 // Forward declarations
-static StateEntry* find_entry(const char* key);
-static StateEntry* create_entry(const char* key);
-static void free_entry(StateEntry* entry);
+static StateShard* shard_for(const char* key);
+static int64_t store_value(const char* key, const char* value, int log_it);
+static int64_t remove_value(const char* key, int log_it);
+static int64_t clear_values(int log_it);
+static void free_value(const char* key, void* value, void* context);
+static void compact_if_due(void);
+static char* log_file_path(const char* suffix);
+static int64_t load_log(void);
 
 // ============================================================================
 // Lifecycle Management
@@ -62,21 +108,40 @@ int64_t mlp_state_init(void) {
         fprintf(stderr, "Warning: state_init() called twice! Ignoring.\n");
         return 0;
     }
-    
-    g_state_manager = (StateManager*)malloc(sizeof(StateManager));
-    if (!g_state_manager) {
+
+    StateManager* manager = (StateManager*)aligned_alloc(64, sizeof(StateManager));
+    if (!manager) {
         fprintf(stderr, "Error: Failed to allocate state manager\n");
         return 0;
     }
-    
-    g_state_manager->entries = NULL;
-    g_state_manager->count = 0;
-    g_state_manager->auto_persist = 0;
-    g_state_manager->persist_file = strdup(".melp_state.json");
-    g_state_manager->total_sso_count = 0;
-    g_state_manager->total_heap_count = 0;
-    g_state_manager->total_heap_bytes = 0;
-    
+
+    for (int i = 0; i < STATE_SHARD_COUNT; i++) {
+        StateShard* shard = &manager->shards[i];
+        shard->index = melp_map_create(sizeof(StateValue));
+        if (!shard->index) {
+            fprintf(stderr, "Error: Failed to allocate state index\n");
+            while (i-- > 0) {
+                melp_map_free(manager->shards[i].index);
+                pthread_rwlock_destroy(&manager->shards[i].lock);
+            }
+            free(manager);
+            return 0;
+        }
+        pthread_rwlock_init(&shard->lock, NULL);
+        shard->total_sso_count = 0;
+        shard->total_heap_count = 0;
+        shard->total_heap_bytes = 0;
+    }
+
+    manager->auto_persist = 0;
+    manager->persist_file = strdup(".melp_state.json");
+    manager->persist_mode = STATE_PERSIST_JSON;
+    manager->compact_threshold = STATE_COMPACT_THRESHOLD;
+    mlp_state_log_init(&manager->log, MLP_STATE_FSYNC_SAVE);
+    pthread_mutex_init(&manager->compact_lock, NULL);
+    atomic_init(&manager->snapshot_bytes, 0);
+    g_state_manager = manager;
+
     return 1;
 }
 
@@ -84,19 +149,21 @@ int64_t mlp_state_close(void) {
     if (g_state_manager == NULL) {
         return 0;
     }
-    
+
     // Free all entries
-    StateEntry* entry = g_state_manager->entries;
-    while (entry) {
-        StateEntry* next = entry->next;
-        free_entry(entry);
-        entry = next;
+    for (int i = 0; i < STATE_SHARD_COUNT; i++) {
+        StateShard* shard = &g_state_manager->shards[i];
+        melp_map_foreach(shard->index, free_value, NULL);
+        melp_map_free(shard->index);
+        pthread_rwlock_destroy(&shard->lock);
     }
-    
+
+    mlp_state_log_destroy(&g_state_manager->log);  // Synced unless fsync=never
+    pthread_mutex_destroy(&g_state_manager->compact_lock);
     free(g_state_manager->persist_file);
     free(g_state_manager);
     g_state_manager = NULL;
-    
+
     return 1;
 }
 
@@ -107,12 +174,12 @@ __attribute__((destructor))
 void mlp_state_auto_cleanup(void) {
     if (g_state_manager != NULL) {
         fprintf(stderr, "[State Manager] Auto-cleanup triggered\n");
-        
+
         // Auto-save if enabled
         if (g_state_manager->auto_persist) {
             mlp_state_save();
         }
-        
+
         mlp_state_close();
     }
 }
@@ -126,55 +193,20 @@ int64_t mlp_state_set(const char* key, const char* value) {
         fprintf(stderr, "Error: State manager not initialized. Call state_init() first!\n");
         return 0;
     }
-    
+
     if (!key || !value) return 0;
-    
-    size_t len = strlen(value);
-    StateEntry* entry = find_entry(key);
-    
-    // Create new entry if not found
-    if (!entry) {
-        entry = create_entry(key);
-        if (!entry) return 0;
-        
-        // Add to list
-        entry->next = g_state_manager->entries;
-        g_state_manager->entries = entry;
-        g_state_manager->count++;
-    } else {
-        // Free old value if heap
-        if (entry->is_heap && entry->value.heap_ptr) {
-            free(entry->value.heap_ptr);
-            entry->value.heap_ptr = NULL;
-        }
-    }
-    
-    // STO Decision: SSO vs Heap
-    if (len < STATE_SSO_SIZE) {
-        // Small String Optimization (stack inline)
-        memcpy(entry->value.sso_data, value, len + 1);
-        entry->is_heap = 0;
-        g_state_manager->total_sso_count++;
-    } else {
-        // Heap allocation (large data)
-        entry->value.heap_ptr = (char*)malloc(len + 1);
-        if (!entry->value.heap_ptr) {
-            fprintf(stderr, "Error: Failed to allocate heap for large value\n");
-            return 0;
-        }
-        strcpy(entry->value.heap_ptr, value);
-        entry->is_heap = 1;
-        g_state_manager->total_heap_count++;
-        g_state_manager->total_heap_bytes += len;
-    }
-    
-    entry->value_len = len;
-    
-    // Auto-persist if enabled
-    if (g_state_manager->auto_persist) {
+
+    int log_it = g_state_manager->persist_mode == STATE_PERSIST_LOG;
+    if (!store_value(key, value, log_it)) return 0;
+
+    // Auto-persist if enabled (after the shard lock is released); the log
+    // already has the change
+    if (log_it) {
+        compact_if_due();
+    } else if (g_state_manager->auto_persist) {
         mlp_state_save();
     }
-    
+
     return 1;
 }
 
@@ -183,70 +215,51 @@ char* mlp_state_get(const char* key) {
         fprintf(stderr, "Error: State manager not initialized\n");
         return strdup("");
     }
-    
+
     if (!key) return strdup("");
-    
-    StateEntry* entry = find_entry(key);
+
+    StateShard* shard = shard_for(key);
+    pthread_rwlock_rdlock(&shard->lock);
+
+    StateValue* entry = (StateValue*)melp_map_get(shard->index, key);
+    char* copy;
     if (!entry) {
-        return strdup("");  // Not found
-    }
-    
-    // Return copy of value
-    if (entry->is_heap) {
-        return strdup(entry->value.heap_ptr);
+        copy = strdup("");  // Not found
     } else {
-        return strdup(entry->value.sso_data);
+        // Return copy of value (taken under the lock: a writer may free it)
+        const char* data = entry->is_heap ? entry->value.heap_ptr : entry->value.sso_data;
+        copy = (char*)malloc(entry->value_len + 1);
+        if (copy) memcpy(copy, data, entry->value_len + 1);
     }
+
+    pthread_rwlock_unlock(&shard->lock);
+    return copy;
 }
 
 int64_t mlp_state_has(const char* key) {
     if (g_state_manager == NULL || !key) return 0;
-    return find_entry(key) != NULL ? 1 : 0;
+
+    StateShard* shard = shard_for(key);
+    pthread_rwlock_rdlock(&shard->lock);
+    int found = melp_map_has_key(shard->index, key);
+    pthread_rwlock_unlock(&shard->lock);
+
+    return found ? 1 : 0;
 }
 
 int64_t mlp_state_delete(const char* key) {
     if (g_state_manager == NULL || !key) return 0;
-    
-    StateEntry* prev = NULL;
-    StateEntry* curr = g_state_manager->entries;
-    
-    while (curr) {
-        if (strcmp(curr->key, key) == 0) {
-            // Found - remove from list
-            if (prev) {
-                prev->next = curr->next;
-            } else {
-                g_state_manager->entries = curr->next;
-            }
-            
-            free_entry(curr);
-            g_state_manager->count--;
-            return 1;
-        }
-        prev = curr;
-        curr = curr->next;
-    }
-    
-    return 0;  // Not found
+
+    int log_it = g_state_manager->persist_mode == STATE_PERSIST_LOG;
+    int64_t removed = remove_value(key, log_it);
+    if (removed && log_it) compact_if_due();
+    return removed;  // 0: not found
 }
 
 int64_t mlp_state_clear(void) {
     if (g_state_manager == NULL) return 0;
-    
-    StateEntry* entry = g_state_manager->entries;
-    while (entry) {
-        StateEntry* next = entry->next;
-        free_entry(entry);
-        entry = next;
-    }
-    
-    g_state_manager->entries = NULL;
-    g_state_manager->count = 0;
-    g_state_manager->total_sso_count = 0;
-    g_state_manager->total_heap_count = 0;
-    g_state_manager->total_heap_bytes = 0;
-    
-    return 1;
+
+    return clear_values(g_state_manager->persist_mode == STATE_PERSIST_LOG);
 }
 
 // ============================================================================
@@ -258,20 +271,64 @@ int64_t mlp_state_config_set(const char* key, const char* value) {
         fprintf(stderr, "Error: State manager not initialized\n");
         return 0;
     }
-    
+
     if (!key || !value) return 0;
-    
+
     if (strcmp(key, "auto_persist") == 0) {
         g_state_manager->auto_persist = atoi(value);
         return 1;
     }
-    
+
     if (strcmp(key, "persist_file") == 0) {
         free(g_state_manager->persist_file);
         g_state_manager->persist_file = strdup(value);
+        if (g_state_manager->persist_mode == STATE_PERSIST_LOG) {
+            char* log_path = log_file_path(".log");
+            mlp_state_log_set_path(&g_state_manager->log, log_path);
+            free(log_path);
+        }
+        return 1;
+    }
+
+    // "json" (default) or "log"
+    if (strcmp(key, "persist_mode") == 0) {
+        StatePersistMode mode;
+        if (strcmp(value, "json") == 0) {
+            mode = STATE_PERSIST_JSON;
+        } else if (strcmp(value, "log") == 0) {
+            mode = STATE_PERSIST_LOG;
+        } else {
+            fprintf(stderr, "Warning: Unknown persist_mode: %s (json, log)\n", value);
+            return 0;
+        }
+        g_state_manager->persist_mode = mode;
+        char* log_path = mode == STATE_PERSIST_LOG ? log_file_path(".log") : NULL;
+        mlp_state_log_set_path(&g_state_manager->log, log_path);
+        free(log_path);
+        return 1;
+    }
+
+    // When log records reach the disk: "always", "save" (default), "never"
+    if (strcmp(key, "fsync") == 0) {
+        if (strcmp(value, "always") == 0) {
+            g_state_manager->log.fsync = MLP_STATE_FSYNC_ALWAYS;
+        } else if (strcmp(value, "save") == 0) {
+            g_state_manager->log.fsync = MLP_STATE_FSYNC_SAVE;
+        } else if (strcmp(value, "never") == 0) {
+            g_state_manager->log.fsync = MLP_STATE_FSYNC_NEVER;
+        } else {
+            fprintf(stderr, "Warning: Unknown fsync policy: %s (always, save, never)\n", value);
+            return 0;
+        }
         return 1;
     }
-    
+
+    // Log bytes before automatic compaction (0: only mlp_state_compact)
+    if (strcmp(key, "compact_threshold") == 0) {
+        g_state_manager->compact_threshold = (size_t)strtoull(value, NULL, 10);
+        return 1;
+    }
+
     fprintf(stderr, "Warning: Unknown config key: %s\n", key);
     return 0;
 }
@@ -280,51 +337,91 @@ int64_t mlp_state_config_set(const char* key, const char* value) {
 // Persistence (Simple JSON)
 // ============================================================================
 
+// Growable JSON text (doubles, so building it is linear in its size)
+typedef struct {
+    char* data;
+    size_t length;
+    size_t capacity;
+    int first;   // No entry written yet (no separator)
+    int failed;  // An allocation failed
+} JsonBuffer;
+
+static void json_reserve(JsonBuffer* json, size_t extra) {
+    if (json->failed || json->length + extra + 1 <= json->capacity) return;
+
+    size_t capacity = json->capacity;
+    while (json->length + extra + 1 > capacity) capacity *= 2;
+    char* data = (char*)realloc(json->data, capacity);
+    if (!data) {
+        json->failed = 1;
+        return;
+    }
+    json->data = data;
+    json->capacity = capacity;
+}
+
+static void json_append(JsonBuffer* json, const char* text, size_t length) {
+    json_reserve(json, length);
+    if (json->failed) return;
+    memcpy(json->data + json->length, text, length);
+    json->length += length;
+    json->data[json->length] = '\0';
+}
+
+static void json_append_entry(const char* key, void* value, void* context) {
+    JsonBuffer* json = (JsonBuffer*)context;
+    StateValue* entry = (StateValue*)value;
+
+    if (!json->first) json_append(json, ",\n", 2);
+    json->first = 0;
+
+    json_append(json, "  \"", 3);
+    json_append(json, key, strlen(key));
+    json_append(json, "\": \"", 4);
+
+    // Get value
+    const char* val = entry->is_heap ? entry->value.heap_ptr : entry->value.sso_data;
+
+    // Escape special characters (at most two bytes each)
+    json_reserve(json, 2 * entry->value_len + 1);
+    if (json->failed) return;
+    for (size_t i = 0; i < entry->value_len; i++) {
+        if (val[i] == '"' || val[i] == '\\') {
+            json->data[json->length++] = '\\';
+        }
+        json->data[json->length++] = val[i];
+    }
+    json_append(json, "\"", 1);
+}
+
 int64_t mlp_state_save(void) {
     if (g_state_manager == NULL) return 0;
-    
+
+    // Log mode: every change is already in the log, make it durable
+    if (g_state_manager->persist_mode == STATE_PERSIST_LOG) {
+        return mlp_state_log_sync(&g_state_manager->log);
+    }
+
     // Build simple JSON
-    char* json = (char*)malloc(1024 * 1024);  // 1MB buffer
-    if (!json) return 0;
-    
-    strcpy(json, "{\n");
-    
-    StateEntry* entry = g_state_manager->entries;
-    int first = 1;
-    
-    while (entry) {
-        if (!first) strcat(json, ",\n");
-        first = 0;
-        
-        strcat(json, "  \"");
-        strcat(json, entry->key);
-        strcat(json, "\": \"");
-        
-        // Get value
-        const char* val = entry->is_heap ? entry->value.heap_ptr : entry->value.sso_data;
-        
-        // Escape special characters
-        size_t current_len = strlen(json);
-        const char* p = val;
-        while (*p) {
-            if (*p == '"' || *p == '\\') {
-                json[current_len++] = '\\';
-            }
-            json[current_len++] = *p++;
-        }
-        json[current_len] = '\0';
-        
-        strcat(json, "\"");
-        
-        entry = entry->next;
-    }
-    
-    strcat(json, "\n}\n");
-    
+    JsonBuffer json = { (char*)malloc(4096), 0, 4096, 1, 0 };
+    if (!json.data) return 0;
+
+    json_append(&json, "{\n", 2);
+
+    // One shard at a time: writers to the other shards are not held up
+    for (int i = 0; i < STATE_SHARD_COUNT; i++) {
+        StateShard* shard = &g_state_manager->shards[i];
+        pthread_rwlock_rdlock(&shard->lock);
+        melp_map_foreach(shard->index, json_append_entry, &json);
+        pthread_rwlock_unlock(&shard->lock);
+    }
+
+    json_append(&json, "\n}\n", 3);
+
     // Write to file
-    int64_t result = mlp_write_file(g_state_manager->persist_file, json);
-    free(json);
-    
+    int64_t result = json.failed ? 0 : mlp_write_file(g_state_manager->persist_file, json.data);
+    free(json.data);
+
     return result;
 }
 
@@ -333,26 +430,30 @@ int64_t mlp_state_load(void) {
         fprintf(stderr, "Error: State manager not initialized\n");
         return 0;
     }
-    
+
+    if (g_state_manager->persist_mode == STATE_PERSIST_LOG) {
+        return load_log();
+    }
+
     // Read file
     char* json = mlp_read_file(g_state_manager->persist_file);
     if (!json || strlen(json) == 0) {
         if (json) free(json);
         return 0;  // File not found or empty
     }
-    
+
     // Simple JSON parser (key-value pairs only)
     char* p = json;
-    
+
     while (*p) {
         // Skip whitespace and {
         while (*p && (*p == ' ' || *p == '\n' || *p == '\t' || *p == '{' || *p == ',')) p++;
         if (*p == '}' || *p == '\0') break;
-        
+
         // Parse key
         if (*p != '"') break;
         p++;  // Skip opening "
-        
+
         char key[256] = {0};
         int i = 0;
         while (*p && *p != '"' && i < 255) {
@@ -360,14 +461,14 @@ int64_t mlp_state_load(void) {
         }
         if (*p != '"') break;
         p++;  // Skip closing "
-        
+
         // Skip : and whitespace
         while (*p && (*p == ':' || *p == ' ' || *p == '\t' || *p == '\n')) p++;
-        
+
         // Parse value
         if (*p != '"') break;
         p++;  // Skip opening "
-        
+
         char value[4096] = {0};
         i = 0;
         while (*p && *p != '"' && i < 4095) {
@@ -378,49 +479,284 @@ int64_t mlp_state_load(void) {
         }
         if (*p != '"') break;
         p++;  // Skip closing "
-        
-        // Set state
-        mlp_state_set(key, value);
+
+        // Set state (no auto-persist: the file already holds it)
+        store_value(key, value, 0);
     }
-    
+
     free(json);
     return 1;
 }
 
+// ============================================================================
+// Persistence (Append-Only Log + Snapshot)
+// ============================================================================
+
+// Apply a snapshot entry or a replayed log record (not logged again)
+static void apply_record(MlpStateOp op, const char* key, const char* value,
+                         size_t value_length, void* context) {
+    (void)value_length;
+    (void)context;
+    switch (op) {
+        case MLP_STATE_OP_SET:    store_value(key, value, 0); break;
+        case MLP_STATE_OP_DELETE: remove_value(key, 0); break;
+        case MLP_STATE_OP_CLEAR:  clear_values(0); break;
+    }
+}
+
+// Size every shard's table for its share of a snapshot's entries (plus
+// slack for an uneven split), so loading never grows a table
+static void reserve_entries(uint64_t entry_count, void* context) {
+    (void)context;
+    size_t per_shard = (size_t)(entry_count / STATE_SHARD_COUNT);
+    per_shard += per_shard / 8;
+    for (int i = 0; i < STATE_SHARD_COUNT; i++) {
+        StateShard* shard = &g_state_manager->shards[i];
+        pthread_rwlock_wrlock(&shard->lock);
+        size_t wanted = melp_map_length(shard->index) + per_shard;
+        if (wanted > shard->index->capacity - shard->index->capacity / 8) {
+            melp_map_resize(shard->index, wanted + wanted / 7 + 1);
+        }
+        pthread_rwlock_unlock(&shard->lock);
+    }
+}
+
+// Map the snapshot, then replay the log written since it
+static int64_t load_log(void) {
+    char* snapshot_path = log_file_path(".snapshot");
+    if (!snapshot_path) return 0;
+
+    size_t snapshot_bytes = 0;
+    int64_t entries = mlp_state_snapshot_load(snapshot_path, reserve_entries, apply_record, NULL,
+                                              &snapshot_bytes);
+    free(snapshot_path);
+    if (entries == -2) {
+        // Without its base the log would rebuild a wrong state
+        fprintf(stderr, "Error: State snapshot is damaged, not loaded\n");
+        return 0;
+    }
+    atomic_store(&g_state_manager->snapshot_bytes, snapshot_bytes);
+
+    int64_t records = mlp_state_log_replay(&g_state_manager->log, apply_record, NULL);
+    return (entries >= 0 || records >= 0) ? 1 : 0;  // 0: no files yet
+}
+
+static void add_snapshot_entry(const char* key, void* value, void* context) {
+    StateValue* entry = (StateValue*)value;
+    const char* data = entry->is_heap ? entry->value.heap_ptr : entry->value.sso_data;
+    mlp_state_snapshot_add((MlpStateSnapshotWriter*)context, key, data, entry->value_len);
+}
+
+// Write the snapshot and empty the log (compact_lock held)
+static int64_t compact_locked(void) {
+    char* snapshot_path = log_file_path(".snapshot");
+    MlpStateSnapshotWriter writer;
+    if (!snapshot_path || !mlp_state_snapshot_begin(&writer, snapshot_path)) {
+        free(snapshot_path);
+        return 0;
+    }
+
+    // Read locks on every shard (in order, like clear) hold off all
+    // writers, so the snapshot and the emptied log agree; readers go on
+    for (int i = 0; i < STATE_SHARD_COUNT; i++) {
+        pthread_rwlock_rdlock(&g_state_manager->shards[i].lock);
+    }
+    for (int i = 0; i < STATE_SHARD_COUNT; i++) {
+        melp_map_foreach(g_state_manager->shards[i].index, add_snapshot_entry, &writer);
+    }
+
+    int64_t bytes = mlp_state_snapshot_commit(&writer, snapshot_path, g_state_manager->log.fsync);
+    int ok = bytes >= 0 && mlp_state_log_reset(&g_state_manager->log);
+    if (bytes >= 0) {
+        atomic_store(&g_state_manager->snapshot_bytes, (size_t)bytes);
+    }
+
+    for (int i = STATE_SHARD_COUNT - 1; i >= 0; i--) {
+        pthread_rwlock_unlock(&g_state_manager->shards[i].lock);
+    }
+    free(snapshot_path);
+    return ok ? 1 : 0;
+}
+
+int64_t mlp_state_compact(void) {
+    if (g_state_manager == NULL) return 0;
+    if (g_state_manager->persist_mode != STATE_PERSIST_LOG) {
+        return mlp_state_save();  // JSON: a save is the compact form
+    }
+
+    pthread_mutex_lock(&g_state_manager->compact_lock);
+    int64_t result = compact_locked();
+    pthread_mutex_unlock(&g_state_manager->compact_lock);
+    return result;
+}
+
+static int compaction_due(void) {
+    size_t threshold = g_state_manager->compact_threshold;
+    size_t log_bytes = atomic_load_explicit(&g_state_manager->log.bytes, memory_order_relaxed);
+    return threshold != 0 && log_bytes >= threshold &&
+           log_bytes >= atomic_load_explicit(&g_state_manager->snapshot_bytes, memory_order_relaxed);
+}
+
+// Compact once the log outgrows both the threshold and the snapshot
+// (called without any shard lock held; threads that find it due together
+// compact once)
+static void compact_if_due(void) {
+    if (!compaction_due()) return;
+
+    pthread_mutex_lock(&g_state_manager->compact_lock);
+    if (compaction_due()) {
+        compact_locked();
+    }
+    pthread_mutex_unlock(&g_state_manager->compact_lock);
+}
+
 // ============================================================================
 // Helper Functions
 // ============================================================================
 
-static StateEntry* find_entry(const char* key) {
-    StateEntry* entry = g_state_manager->entries;
-    while (entry) {
-        if (strcmp(entry->key, key) == 0) {
-            return entry;
+static StateShard* shard_for(const char* key) {
+    uint64_t hash = melp_map_hash(key);
+    return &g_state_manager->shards[hash >> (64 - STATE_SHARD_BITS)];
+}
+
+// persist_file + suffix (caller frees)
+static char* log_file_path(const char* suffix) {
+    size_t base = strlen(g_state_manager->persist_file);
+    size_t extra = strlen(suffix);
+    char* path = (char*)malloc(base + extra + 1);
+    if (!path) return NULL;
+    memcpy(path, g_state_manager->persist_file, base);
+    memcpy(path + base, suffix, extra + 1);
+    return path;
+}
+
+// Insert or replace key's value under its shard's write lock. With log_it
+// the record is appended under the same lock (log order = table order);
+// if the append fails the table is left unchanged.
+static int64_t store_value(const char* key, const char* value, int log_it) {
+    size_t len = strlen(value);
+    StateValue stored;
+
+    // STO Decision: SSO vs Heap (allocated before the lock is taken)
+    if (len < STATE_SSO_SIZE) {
+        // Small String Optimization (inline in the table slot)
+        memcpy(stored.value.sso_data, value, len + 1);
+        stored.is_heap = 0;
+    } else {
+        // Heap allocation (large data)
+        stored.value.heap_ptr = (char*)sto_pool_alloc(len + 1, STO_POOL_STATE);
+        if (!stored.value.heap_ptr) {
+            fprintf(stderr, "Error: Failed to allocate heap for large value\n");
+            return 0;
+        }
+        memcpy(stored.value.heap_ptr, value, len + 1);
+        stored.is_heap = 1;
+    }
+    stored.value_len = len;
+
+    StateShard* shard = shard_for(key);
+    pthread_rwlock_wrlock(&shard->lock);
+
+    StateValue* entry = (StateValue*)melp_map_get(shard->index, key);
+    int ok;
+    if (entry) {
+        ok = !log_it || mlp_state_log_append(&g_state_manager->log, MLP_STATE_OP_SET, key, value, len);
+        if (ok) {
+            // Free old value if heap
+            free_value(key, entry, NULL);
+            *entry = stored;
+        }
+    } else {
+        ok = melp_map_insert(shard->index, key, &stored);
+        if (ok && log_it &&
+            !mlp_state_log_append(&g_state_manager->log, MLP_STATE_OP_SET, key, value, len)) {
+            melp_map_remove(shard->index, key);
+            ok = 0;
+        }
+    }
+
+    if (ok) {
+        if (stored.is_heap) {
+            shard->total_heap_count++;
+            shard->total_heap_bytes += len;
+        } else {
+            shard->total_sso_count++;
         }
-        entry = entry->next;
     }
-    return NULL;
+
+    pthread_rwlock_unlock(&shard->lock);
+
+    if (!ok) {
+        if (log_it) fprintf(stderr, "Error: Failed to append to the state log\n");
+        free_value(key, &stored, NULL);
+        return 0;
+    }
+    return 1;
 }
 
-static StateEntry* create_entry(const char* key) {
-    StateEntry* entry = (StateEntry*)malloc(sizeof(StateEntry));
-    if (!entry) return NULL;
-    
-    entry->key = strdup(key);
-    entry->value_len = 0;
-    entry->is_heap = 0;
-    entry->next = NULL;
-    
-    return entry;
+// Remove key (logged first with log_it); 0 if it was not present
+static int64_t remove_value(const char* key, int log_it) {
+    StateShard* shard = shard_for(key);
+    pthread_rwlock_wrlock(&shard->lock);
+
+    StateValue* entry = (StateValue*)melp_map_get(shard->index, key);
+    int removed = entry != NULL &&
+                  (!log_it || mlp_state_log_append(&g_state_manager->log, MLP_STATE_OP_DELETE, key, "", 0));
+    if (removed) {
+        free_value(key, entry, NULL);
+        melp_map_remove(shard->index, key);
+    }
+
+    pthread_rwlock_unlock(&shard->lock);
+    return removed ? 1 : 0;
 }
 
-static void free_entry(StateEntry* entry) {
-    if (!entry) return;
-    
-    if (entry->key) free(entry->key);
+static void free_value(const char* key, void* value, void* context) {
+    (void)key;
+    (void)context;
+    StateValue* entry = (StateValue*)value;
     if (entry->is_heap && entry->value.heap_ptr) {
-        free(entry->value.heap_ptr);
+        sto_pool_free(entry->value.heap_ptr, entry->value_len + 1, STO_POOL_STATE);
+        entry->value.heap_ptr = NULL;
+    }
+}
+
+// Swap an empty table into every shard. All write locks are held at once
+// (in shard order), so no set can land between the clear record and the
+// tables it empties. 0 if the tables could not be allocated (nothing cleared).
+static int64_t clear_values(int log_it) {
+    MelpMap* empty[STATE_SHARD_COUNT];
+    for (int i = 0; i < STATE_SHARD_COUNT; i++) {
+        empty[i] = melp_map_create(sizeof(StateValue));
+        if (!empty[i]) {
+            while (i-- > 0) melp_map_free(empty[i]);
+            return 0;
+        }
+    }
+
+    for (int i = 0; i < STATE_SHARD_COUNT; i++) {
+        pthread_rwlock_wrlock(&g_state_manager->shards[i].lock);
+    }
+
+    int ok = !log_it || mlp_state_log_append(&g_state_manager->log, MLP_STATE_OP_CLEAR, "", "", 0);
+    for (int i = 0; i < STATE_SHARD_COUNT; i++) {
+        StateShard* shard = &g_state_manager->shards[i];
+        if (ok) {
+            melp_map_foreach(shard->index, free_value, NULL);
+            MelpMap* old = shard->index;
+            shard->index = empty[i];
+            empty[i] = old;  // Freed below, outside the locks
+            shard->total_sso_count = 0;
+            shard->total_heap_count = 0;
+            shard->total_heap_bytes = 0;
+        }
+    }
+
+    for (int i = STATE_SHARD_COUNT - 1; i >= 0; i--) {
+        pthread_rwlock_unlock(&g_state_manager->shards[i].lock);
+    }
+    for (int i = 0; i < STATE_SHARD_COUNT; i++) {
+        melp_map_free(empty[i]);
     }
-    
-    free(entry);
+    return ok ? 1 : 0;
 }
@@ -1,5 +1,10 @@
 // YZ_34: Phase 8 - State Manager
 // User-controlled lifecycle, STO-optimized, persistent storage
+//
+// Keys are hash-indexed (O(1) get/set/has/delete at any key count).
+// Data operations, save and compact may be called from any number of threads;
+// init, close, config_set and load are meant for one thread while no
+// other thread uses the state.
 
 #ifndef MLP_STATE_H
 #define MLP_STATE_H
@@ -18,10 +23,19 @@ int64_t mlp_state_delete(const char* key);
 int64_t mlp_state_clear(void);
 
 // Configuration
+//   auto_persist       "0" / "1"
+//   persist_file       path (log mode: <path>.log and <path>.snapshot)
+//   persist_mode       "json" (save rewrites the file) or "log" (append-only
+//                      log of changes, compacted into a snapshot)
+//   fsync              log mode: "always" (every change), "save" (default,
+//                      on save and close) or "never"
+//   compact_threshold  log mode: log bytes before compaction (default 4 MB,
+//                      "0": only mlp_state_compact)
 int64_t mlp_state_config_set(const char* key, const char* value);
 
 // Persistence
-int64_t mlp_state_save(void);
-int64_t mlp_state_load(void);
+int64_t mlp_state_save(void);     // Log mode: sync the log (O(1), changes are already in it)
+int64_t mlp_state_load(void);     // Log mode: map the snapshot, replay the log
+int64_t mlp_state_compact(void);  // Log mode: write the snapshot, empty the log
 
 #endif // MLP_STATE_H
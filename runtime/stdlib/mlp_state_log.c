@@ -0,0 +1,512 @@
+/**
+ * MLP Standard Library - State Manager Log and Snapshot Files
+ *
+ * Record encoding, CRC-32C, the append-only log and mapped snapshots
+ * (format: mlp_state_log.h). Knows nothing about the state's tables:
+ * mlp_state.c decides what to append and applies what is replayed.
+ *
+ * Created: 18 Ekim 2026
+ */
+
+#define _POSIX_C_SOURCE 200809L  // fdatasync, ftruncate, mmap, fileno
+
+#include "mlp_state_log.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define MLP_STATE_CRC_X86 1
+#include <nmmintrin.h>
+#else
+#define MLP_STATE_CRC_X86 0
+#endif
+
+#define LOG_MAGIC_BYTES 8
+#define RECORD_STACK_BYTES 256  // Records up to this size are encoded on the stack
+
+// -----------------------------------------------------------------------------
+// CRC-32C (reflected polynomial 0x82F63B78)
+// -----------------------------------------------------------------------------
+// SSE4.2 has an instruction for it (8 bytes per step); elsewhere a byte
+// table. Loading a snapshot checksums every byte of it, so the speed shows.
+
+static uint32_t crc32c_table[256];
+static uint32_t (*crc32c_update)(uint32_t, const unsigned char*, size_t);
+static pthread_once_t crc32c_once = PTHREAD_ONCE_INIT;
+
+static uint32_t crc32c_scalar(uint32_t crc, const unsigned char* p, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        crc = crc32c_table[(crc ^ p[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+#if MLP_STATE_CRC_X86
+__attribute__((target("sse4.2")))
+static uint32_t crc32c_sse42(uint32_t crc, const unsigned char* p, size_t length) {
+    uint64_t wide = crc;
+    for (; length >= 8; p += 8, length -= 8) {
+        uint64_t word;
+        memcpy(&word, p, sizeof(word));
+        wide = _mm_crc32_u64(wide, word);
+    }
+    crc = (uint32_t)wide;
+    for (; length > 0; p++, length--) {
+        crc = _mm_crc32_u8(crc, *p);
+    }
+    return crc;
+}
+#endif
+
+static void init_crc32c(void) {
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0x82F63B78u & (0u - (crc & 1)));
+        }
+        crc32c_table[i] = crc;
+    }
+
+    crc32c_update = crc32c_scalar;
+#if MLP_STATE_CRC_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse4.2")) {
+        crc32c_update = crc32c_sse42;
+    }
+#endif
+}
+
+uint32_t mlp_state_crc32c(uint32_t crc, const void* data, size_t length) {
+    pthread_once(&crc32c_once, init_crc32c);
+    return ~crc32c_update(~crc, (const unsigned char*)data, length);
+}
+
+// -----------------------------------------------------------------------------
+// Records
+// -----------------------------------------------------------------------------
+
+// Header + key + NUL + value + NUL, padded to 8 bytes
+static size_t record_bytes(size_t key_length, size_t value_length) {
+    size_t payload = key_length + 1 + value_length + 1;
+    return sizeof(MlpStateRecordHeader) + ((payload + 7) & ~(size_t)7);
+}
+
+static uint32_t record_checksum(const unsigned char* record, size_t key_length, size_t value_length) {
+    size_t covered = sizeof(MlpStateRecordHeader) - sizeof(uint32_t) + key_length + 1 + value_length + 1;
+    return mlp_state_crc32c(0, record + sizeof(uint32_t), covered);
+}
+
+// record must have record_bytes(key_length, value_length) bytes
+static void encode_record(unsigned char* record, MlpStateOp op, const char* key, size_t key_length,
+                          const char* value, size_t value_length) {
+    size_t size = record_bytes(key_length, value_length);
+    memset(record, 0, size);
+
+    MlpStateRecordHeader header = { 0, (uint32_t)op, (uint32_t)key_length, (uint32_t)value_length };
+    memcpy(record, &header, sizeof(header));
+    unsigned char* payload = record + sizeof(header);
+    memcpy(payload, key, key_length);
+    memcpy(payload + key_length + 1, value, value_length);
+
+    header.checksum = record_checksum(record, key_length, value_length);
+    memcpy(record, &header.checksum, sizeof(uint32_t));
+}
+
+// Size of the intact record at offset, or 0 (torn, corrupt or out of bounds)
+static size_t check_record(const unsigned char* data, size_t size, size_t offset,
+                           MlpStateRecordHeader* header) {
+    if (size - offset < sizeof(MlpStateRecordHeader)) return 0;
+    memcpy(header, data + offset, sizeof(*header));
+    if (header->op < MLP_STATE_OP_SET || header->op > MLP_STATE_OP_CLEAR) return 0;
+
+    size_t bytes = record_bytes(header->key_length, header->value_length);
+    if (bytes > size - offset) return 0;
+
+    const unsigned char* record = data + offset;
+    const unsigned char* payload = record + sizeof(*header);
+    if (payload[header->key_length] != '\0' ||
+        payload[header->key_length + 1 + header->value_length] != '\0' ||
+        record_checksum(record, header->key_length, header->value_length) != header->checksum) {
+        return 0;
+    }
+    return bytes;
+}
+
+static void visit_record(const unsigned char* record, const MlpStateRecordHeader* header,
+                         MlpStateRecordVisit visit, void* context) {
+    const char* key = (const char*)record + sizeof(*header);
+    visit((MlpStateOp)header->op, key, key + header->key_length + 1, header->value_length, context);
+}
+
+static int write_all(int fd, const void* data, size_t length) {
+    const char* p = (const char*)data;
+    while (length > 0) {
+        ssize_t written = write(fd, p, length);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return 0;
+        }
+        p += written;
+        length -= (size_t)written;
+    }
+    return 1;
+}
+
+// Walk the records of a mapped log; returns how many were intact (their
+// end in *valid_end). visit may be NULL (only find the end).
+static int64_t scan_log(const unsigned char* data, size_t size, MlpStateRecordVisit visit,
+                        void* context, size_t* valid_end) {
+    int64_t records = 0;
+    size_t offset = LOG_MAGIC_BYTES;
+    MlpStateRecordHeader header;
+    size_t bytes;
+
+    while ((bytes = check_record(data, size, offset, &header)) != 0) {
+        if (visit) visit_record(data + offset, &header, visit, context);
+        offset += bytes;
+        records++;
+    }
+    *valid_end = offset;
+    return records;
+}
+
+// Map fd's log, visit it and cut what follows the last intact record
+static int64_t replay_fd(int fd, const char* path, MlpStateRecordVisit visit, void* context,
+                         size_t* file_bytes) {
+    struct stat st;
+    if (fstat(fd, &st) != 0) return -1;
+    size_t size = (size_t)st.st_size;
+    *file_bytes = size;
+    if (size == 0) return 0;  // Created, magic not written yet
+    if (size < LOG_MAGIC_BYTES) return -1;
+
+    unsigned char* data = (unsigned char*)mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) return -1;
+    if (memcmp(data, MLP_STATE_LOG_MAGIC, LOG_MAGIC_BYTES) != 0) {
+        munmap(data, size);
+        fprintf(stderr, "Warning: %s is not a state log\n", path);
+        return -1;
+    }
+    posix_madvise(data, size, POSIX_MADV_SEQUENTIAL);
+
+    size_t valid_end;
+    int64_t records = scan_log(data, size, visit, context, &valid_end);
+    munmap(data, size);
+
+    if (valid_end < size) {
+        fprintf(stderr, "[State Manager] %s: dropped %zu bytes after the last intact record\n",
+                path, size - valid_end);
+        if (ftruncate(fd, (off_t)valid_end) != 0) return -1;
+        *file_bytes = valid_end;
+    }
+    return records;
+}
+
+// -----------------------------------------------------------------------------
+// Log
+// -----------------------------------------------------------------------------
+
+void mlp_state_log_init(MlpStateLog* log, MlpStateFsync fsync) {
+    pthread_mutex_init(&log->lock, NULL);
+    log->path = NULL;
+    log->fd = -1;
+    log->fsync = fsync;
+    log->tail_checked = 0;
+    atomic_init(&log->bytes, 0);
+}
+
+static void close_log(MlpStateLog* log) {
+    if (log->fd >= 0) {
+        if (log->fsync != MLP_STATE_FSYNC_NEVER) fdatasync(log->fd);
+        close(log->fd);
+        log->fd = -1;
+    }
+}
+
+void mlp_state_log_set_path(MlpStateLog* log, const char* path) {
+    pthread_mutex_lock(&log->lock);
+    close_log(log);
+    free(log->path);
+    log->path = path ? strdup(path) : NULL;
+    log->tail_checked = 0;
+    atomic_store(&log->bytes, 0);
+    pthread_mutex_unlock(&log->lock);
+}
+
+// Open for appending (lock held): a new file gets the magic, an old one
+// loses a torn tail first, so new records never follow garbage
+static int open_log(MlpStateLog* log) {
+    if (log->fd >= 0) return 1;
+    if (!log->path) return 0;
+
+    int fd = open(log->path, O_RDWR | O_CREAT | O_APPEND, 0644);
+    if (fd < 0) return 0;
+
+    size_t size = 0;
+    if (!log->tail_checked && replay_fd(fd, log->path, NULL, NULL, &size) < 0) {
+        close(fd);
+        return 0;
+    }
+    if (log->tail_checked) {
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            close(fd);
+            return 0;
+        }
+        size = (size_t)st.st_size;
+    }
+    if (size == 0) {
+        if (!write_all(fd, MLP_STATE_LOG_MAGIC, LOG_MAGIC_BYTES)) {
+            close(fd);
+            return 0;
+        }
+        size = LOG_MAGIC_BYTES;
+    }
+
+    log->fd = fd;
+    log->tail_checked = 1;
+    atomic_store(&log->bytes, size);
+    return 1;
+}
+
+// A failed append (lock held) may have written part of its record: cut the
+// file back to the last acknowledged one, or the next append would land
+// after a torn record and be dropped by replay with everything after it.
+// If even that fails, close the file so the next open checks the tail.
+static void discard_tail(MlpStateLog* log) {
+    if (ftruncate(log->fd, (off_t)atomic_load(&log->bytes)) == 0) return;
+    close(log->fd);
+    log->fd = -1;
+    log->tail_checked = 0;
+}
+
+int mlp_state_log_append(MlpStateLog* log, MlpStateOp op, const char* key,
+                         const char* value, size_t value_length) {
+    size_t key_length = strlen(key);
+    if (key_length > UINT32_MAX || value_length > UINT32_MAX) return 0;
+
+    size_t bytes = record_bytes(key_length, value_length);
+    unsigned char stack_record[RECORD_STACK_BYTES];
+    unsigned char* record = bytes <= sizeof(stack_record) ? stack_record : (unsigned char*)malloc(bytes);
+    if (!record) return 0;
+    encode_record(record, op, key, key_length, value, value_length);
+
+    pthread_mutex_lock(&log->lock);
+    if (!open_log(log)) {
+        pthread_mutex_unlock(&log->lock);
+        if (record != stack_record) free(record);
+        return 0;
+    }
+    int ok = write_all(log->fd, record, bytes);
+    if (ok && log->fsync == MLP_STATE_FSYNC_ALWAYS) {
+        ok = fdatasync(log->fd) == 0;
+    }
+    if (ok) {
+        atomic_fetch_add(&log->bytes, bytes);
+    } else {
+        discard_tail(log);
+    }
+    pthread_mutex_unlock(&log->lock);
+
+    if (record != stack_record) free(record);
+    return ok;
+}
+
+int mlp_state_log_sync(MlpStateLog* log) {
+    pthread_mutex_lock(&log->lock);
+    int ok = log->fd < 0 || log->fsync == MLP_STATE_FSYNC_NEVER || fdatasync(log->fd) == 0;
+    pthread_mutex_unlock(&log->lock);
+    return ok;
+}
+
+int mlp_state_log_reset(MlpStateLog* log) {
+    pthread_mutex_lock(&log->lock);
+    int ok = open_log(log) && ftruncate(log->fd, LOG_MAGIC_BYTES) == 0;
+    if (ok && log->fsync != MLP_STATE_FSYNC_NEVER) {
+        ok = fdatasync(log->fd) == 0;
+    }
+    if (ok) {
+        atomic_store(&log->bytes, LOG_MAGIC_BYTES);
+    }
+    pthread_mutex_unlock(&log->lock);
+    return ok;
+}
+
+void mlp_state_log_destroy(MlpStateLog* log) {
+    close_log(log);
+    free(log->path);
+    log->path = NULL;
+    pthread_mutex_destroy(&log->lock);
+}
+
+int64_t mlp_state_log_replay(MlpStateLog* log, MlpStateRecordVisit visit, void* context) {
+    pthread_mutex_lock(&log->lock);
+    char* path = log->path ? strdup(log->path) : NULL;
+    pthread_mutex_unlock(&log->lock);
+    if (!path) return -1;
+
+    // Visited without the lock: visit may take the state's shard locks
+    int64_t records = -1;
+    size_t size = 0;
+    int fd = open(path, O_RDWR);
+    if (fd >= 0) {
+        records = replay_fd(fd, path, visit, context, &size);
+        close(fd);
+    }
+
+    pthread_mutex_lock(&log->lock);
+    if (records >= 0 && log->path && strcmp(log->path, path) == 0) {
+        log->tail_checked = 1;
+        if (log->fd >= 0) atomic_store(&log->bytes, size);
+    }
+    pthread_mutex_unlock(&log->lock);
+
+    free(path);
+    return records;
+}
+
+// -----------------------------------------------------------------------------
+// Snapshot
+// -----------------------------------------------------------------------------
+
+int mlp_state_snapshot_begin(MlpStateSnapshotWriter* writer, const char* path) {
+    size_t length = strlen(path);
+    writer->temp_path = (char*)malloc(length + 5);
+    if (!writer->temp_path) return 0;
+    memcpy(writer->temp_path, path, length);
+    memcpy(writer->temp_path + length, ".tmp", 5);
+
+    writer->file = fopen(writer->temp_path, "wb");
+    if (!writer->file) {
+        free(writer->temp_path);
+        return 0;
+    }
+    writer->entry_count = 0;
+    writer->body_bytes = 0;
+
+    // Header placeholder (filled in by commit)
+    MlpStateSnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    writer->failed = fwrite(&header, sizeof(header), 1, writer->file) != 1;
+    return 1;
+}
+
+void mlp_state_snapshot_add(MlpStateSnapshotWriter* writer, const char* key,
+                            const char* value, size_t value_length) {
+    if (writer->failed) return;
+
+    size_t key_length = strlen(key);
+    if (key_length > UINT32_MAX || value_length > UINT32_MAX) {
+        writer->failed = 1;
+        return;
+    }
+
+    size_t bytes = record_bytes(key_length, value_length);
+    unsigned char stack_record[RECORD_STACK_BYTES];
+    unsigned char* record = bytes <= sizeof(stack_record) ? stack_record : (unsigned char*)malloc(bytes);
+    if (!record) {
+        writer->failed = 1;
+        return;
+    }
+    encode_record(record, MLP_STATE_OP_SET, key, key_length, value, value_length);
+    if (fwrite(record, 1, bytes, writer->file) != bytes) writer->failed = 1;
+    if (record != stack_record) free(record);
+
+    writer->entry_count++;
+    writer->body_bytes += bytes;
+}
+
+// fsync the directory holding path, so the rename itself is durable
+static void sync_parent_directory(const char* path) {
+    const char* slash = strrchr(path, '/');
+    char* directory = slash ? strndup(path, (size_t)(slash - path) + 1) : strdup(".");
+    if (!directory) return;
+
+    int fd = open(directory, O_RDONLY);
+    if (fd >= 0) {
+        fsync(fd);
+        close(fd);
+    }
+    free(directory);
+}
+
+int64_t mlp_state_snapshot_commit(MlpStateSnapshotWriter* writer, const char* path,
+                                  MlpStateFsync fsync) {
+    MlpStateSnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, MLP_STATE_SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.entry_count = writer->entry_count;
+    header.body_bytes = writer->body_bytes;
+    header.checksum = mlp_state_crc32c(0, &header, offsetof(MlpStateSnapshotHeader, checksum));
+
+    int ok = !writer->failed &&
+             fseek(writer->file, 0, SEEK_SET) == 0 &&
+             fwrite(&header, sizeof(header), 1, writer->file) == 1 &&
+             fflush(writer->file) == 0 &&
+             (fsync == MLP_STATE_FSYNC_NEVER || fdatasync(fileno(writer->file)) == 0);
+    ok = fclose(writer->file) == 0 && ok;
+    ok = ok && rename(writer->temp_path, path) == 0;
+
+    if (ok && fsync != MLP_STATE_FSYNC_NEVER) {
+        sync_parent_directory(path);
+    }
+    if (!ok) {
+        remove(writer->temp_path);
+    }
+    free(writer->temp_path);
+    writer->temp_path = NULL;
+    return ok ? (int64_t)(sizeof(header) + writer->body_bytes) : -1;
+}
+
+int64_t mlp_state_snapshot_load(const char* path, void (*reserve)(uint64_t entry_count, void* context),
+                                MlpStateRecordVisit visit, void* context, size_t* file_bytes) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(MlpStateSnapshotHeader)) {
+        close(fd);
+        return -2;
+    }
+    size_t size = (size_t)st.st_size;
+    unsigned char* data = (unsigned char*)mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  // The mapping stays valid
+    if (data == MAP_FAILED) return -2;
+    posix_madvise(data, size, POSIX_MADV_SEQUENTIAL);
+
+    MlpStateSnapshotHeader header;
+    memcpy(&header, data, sizeof(header));
+    int ok = memcmp(header.magic, MLP_STATE_SNAPSHOT_MAGIC, sizeof(header.magic)) == 0 &&
+             header.checksum == mlp_state_crc32c(0, &header, offsetof(MlpStateSnapshotHeader, checksum)) &&
+             header.body_bytes == size - sizeof(header);
+
+    // Check every record before visiting any (all or nothing)
+    uint64_t count = 0;
+    size_t offset = sizeof(header);
+    MlpStateRecordHeader record;
+    size_t bytes;
+    while (ok && offset < size && (bytes = check_record(data, size, offset, &record)) != 0 &&
+           record.op == MLP_STATE_OP_SET) {
+        offset += bytes;
+        count++;
+    }
+    ok = ok && offset == size && count == header.entry_count;
+
+    if (ok) {
+        if (reserve) reserve(count, context);
+        for (offset = sizeof(header); offset < size; offset += bytes) {
+            memcpy(&record, data + offset, sizeof(record));
+            bytes = record_bytes(record.key_length, record.value_length);
+            visit_record(data + offset, &record, visit, context);
+        }
+        if (file_bytes) *file_bytes = size;
+    }
+
+    munmap(data, size);
+    return ok ? (int64_t)count : -2;
+}
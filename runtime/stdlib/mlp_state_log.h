@@ -0,0 +1,170 @@
+/**
+ * MLP Standard Library - State Manager Log and Snapshot Files
+ *
+ * On-disk format of the state manager's log persistence mode
+ * (persist_mode = log, see mlp_state.c):
+ *
+ * - Log (<persist_file>.log): an 8-byte magic, then one record per set,
+ *   delete or clear, appended as it happens. A crash can only tear the
+ *   last record; replay stops at the first record whose length or
+ *   checksum does not hold and cuts the file there.
+ * - Snapshot (<persist_file>.snapshot): a header and one set record per
+ *   entry, written to a temporary file and renamed over the old one, so
+ *   it is always complete. Loading maps it and reads keys and values in
+ *   place (both are stored NUL-terminated).
+ *
+ * Record: MlpStateRecordHeader, key bytes + NUL, value bytes + NUL, zero
+ * padding to 8 bytes (headers stay aligned in a mapping). The checksum is
+ * CRC-32C of the header after the checksum field and of the key and value
+ * with their NULs. Integers are in native byte order.
+ *
+ * Replaying a log on top of a snapshot that already contains it gives
+ * the same state (every record sets its key to the value it ends up
+ * with), so a crash between writing a snapshot and emptying the log
+ * loses nothing.
+ *
+ * Created: 18 Ekim 2026
+ */
+
+#ifndef MLP_STATE_LOG_H
+#define MLP_STATE_LOG_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stddef.h>  // size_t
+#include <stdint.h>
+#include <stdio.h>   // FILE
+
+#define MLP_STATE_LOG_MAGIC "MLPLOG01"
+#define MLP_STATE_SNAPSHOT_MAGIC "MLPSNAP1"
+
+/**
+ * Record operation
+ */
+typedef enum {
+    MLP_STATE_OP_SET = 1,
+    MLP_STATE_OP_DELETE = 2,   // value is empty
+    MLP_STATE_OP_CLEAR = 3     // key and value are empty
+} MlpStateOp;
+
+/**
+ * When appended records are forced to disk (fdatasync)
+ */
+typedef enum {
+    MLP_STATE_FSYNC_ALWAYS = 0,  // Every record, before set/delete/clear returns
+    MLP_STATE_FSYNC_SAVE,        // On mlp_state_save() and close (default)
+    MLP_STATE_FSYNC_NEVER        // Left to the OS (records still survive a process crash)
+} MlpStateFsync;
+
+typedef struct {
+    uint32_t checksum;       // CRC-32C of the rest of the record (padding excluded)
+    uint32_t op;             // MlpStateOp
+    uint32_t key_length;     // Without the NUL
+    uint32_t value_length;   // Without the NUL
+} MlpStateRecordHeader;
+
+typedef struct {
+    char magic[8];           // MLP_STATE_SNAPSHOT_MAGIC
+    uint64_t entry_count;
+    uint64_t body_bytes;     // Record bytes after the header
+    uint32_t checksum;       // CRC-32C of the fields above
+    uint32_t reserved;
+} MlpStateSnapshotHeader;
+
+/**
+ * Append side of a log file (opened on the first append)
+ * Appends are serialized by the log's own lock.
+ */
+typedef struct {
+    pthread_mutex_t lock;
+    char* path;
+    int fd;                  // -1 until opened
+    MlpStateFsync fsync;
+    int tail_checked;        // Replayed (or cut) since the path was set
+    _Atomic size_t bytes;    // File size, magic included
+} MlpStateLog;
+
+/**
+ * Called for every valid record of a log or snapshot, in file order
+ * (key and value are NUL-terminated; they point into a mapping that is
+ * gone after the call)
+ */
+typedef void (*MlpStateRecordVisit)(MlpStateOp op, const char* key, const char* value,
+                                    size_t value_length, void* context);
+
+/** CRC-32C (Castagnoli) of length bytes, continuing from crc (0 to start) */
+uint32_t mlp_state_crc32c(uint32_t crc, const void* data, size_t length);
+
+// -----------------------------------------------------------------------------
+// Log
+// -----------------------------------------------------------------------------
+
+void mlp_state_log_init(MlpStateLog* log, MlpStateFsync fsync);
+
+/** Point the log at path (closes the current file; NULL: no file) */
+void mlp_state_log_set_path(MlpStateLog* log, const char* path);
+
+/**
+ * Append one record (one write; fdatasync under MLP_STATE_FSYNC_ALWAYS)
+ * A failed append cuts what it wrote off the file again.
+ * @return 1 on success, 0 if the file could not be opened or written
+ */
+int mlp_state_log_append(MlpStateLog* log, MlpStateOp op, const char* key,
+                         const char* value, size_t value_length);
+
+/** fdatasync appended records (nothing under MLP_STATE_FSYNC_NEVER); 1 on success */
+int mlp_state_log_sync(MlpStateLog* log);
+
+/** Drop every record (after a snapshot holds them); 1 on success */
+int mlp_state_log_reset(MlpStateLog* log);
+
+/** Close the file and free the path (the log can be initialized again) */
+void mlp_state_log_destroy(MlpStateLog* log);
+
+/**
+ * Replay the log file: visit every valid record, then cut a torn or
+ * corrupt tail off the file (an append that opens a file not replayed
+ * yet cuts it too, so new records never follow garbage)
+ * @return Records visited, or -1 if there is no log file (or not a log)
+ */
+int64_t mlp_state_log_replay(MlpStateLog* log, MlpStateRecordVisit visit, void* context);
+
+// -----------------------------------------------------------------------------
+// Snapshot
+// -----------------------------------------------------------------------------
+
+typedef struct {
+    FILE* file;
+    char* temp_path;
+    uint64_t entry_count;
+    uint64_t body_bytes;
+    int failed;
+} MlpStateSnapshotWriter;
+
+/** Start writing a snapshot (into path + ".tmp"); 1 on success */
+int mlp_state_snapshot_begin(MlpStateSnapshotWriter* writer, const char* path);
+
+/** Add one entry (key NUL-terminated, value value_length bytes) */
+void mlp_state_snapshot_add(MlpStateSnapshotWriter* writer, const char* key,
+                            const char* value, size_t value_length);
+
+/**
+ * Finish the snapshot: write the header, fdatasync (unless
+ * MLP_STATE_FSYNC_NEVER) and rename it over path
+ * @return Size of the snapshot file, or -1 on failure (path untouched)
+ */
+int64_t mlp_state_snapshot_commit(MlpStateSnapshotWriter* writer, const char* path,
+                                  MlpStateFsync fsync);
+
+/**
+ * Map the snapshot at path and visit its entries (checked in full first:
+ * a damaged snapshot visits nothing)
+ * @param reserve Called with the entry count before the first visit, so
+ *                tables can be sized once (may be NULL)
+ * @param file_bytes Set to the snapshot's size when it is loaded (may be NULL)
+ * @return Entries visited, -1 if there is no snapshot, -2 if it is damaged
+ */
+int64_t mlp_state_snapshot_load(const char* path, void (*reserve)(uint64_t entry_count, void* context),
+                                MlpStateRecordVisit visit, void* context, size_t* file_bytes);
+
+#endif // MLP_STATE_LOG_H
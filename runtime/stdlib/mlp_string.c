@@ -3,6 +3,10 @@
  * 
  * Architecture: STO-compliant string operations
  * Works with both literal strings and heap-allocated strings
+ * Search, case conversion and trimming run on the vectorized kernels in
+ * mlp_string_simd.c (each input is measured once, then scanned by length)
+ * The mlp_str_* functions take MelpStr (data, length) and never rescan;
+ * the char* mlp_string_* functions measure once and forward to them.
  * 
  * Created: 9 Aralık 2025 (YZ_06)
  */
@@ -10,6 +14,9 @@
 #define _POSIX_C_SOURCE 200809L
 
 #include "mlp_string.h"
+#include "mlp_string_simd.h"
+#include "mlp_region.h"
+#include "../sto/sto_types.h"  // sto_is_rodata
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -25,6 +32,116 @@ char* strdup(const char* s) {
 }
 #endif
 
+// ============================================================================
+// MelpStr (primary ABI)
+// ============================================================================
+
+MelpStr mlp_str_from_cstr(const char* str) {
+    MelpStr result = { str ? str : "", str ? strlen(str) : 0 };
+    return result;
+}
+
+MelpStr mlp_str_from_len(const char* data, size_t length) {
+    MelpStr result = { data ? data : "", data ? length : 0 };
+    return result;
+}
+
+// New NUL-terminated buffer holding up to three pieces back to back
+// (malloc'd, or in the thread's temporaries region)
+static char* join3_in(MelpStr a, MelpStr b, MelpStr c, int temporary, const char* caller) {
+    size_t total_len = a.length + b.length + c.length;
+    char* result = temporary ? (char*)mlp_region_temp_alloc(total_len + 1)
+                             : (char*)malloc(total_len + 1);
+    if (!result) {
+        fprintf(stderr, "Error: %s - malloc failed\n", caller);
+        return NULL;
+    }
+    
+    memcpy(result, a.data, a.length);
+    memcpy(result + a.length, b.data, b.length);
+    memcpy(result + a.length + b.length, c.data, c.length);
+    result[total_len] = '\0';
+    return result;
+}
+
+static char* join3(MelpStr a, MelpStr b, MelpStr c, const char* caller) {
+    return join3_in(a, b, c, 0, caller);
+}
+
+static const MelpStr empty_str = { "", 0 };
+
+MelpStr mlp_str_concat(MelpStr a, MelpStr b) {
+    char* data = join3(a, b, empty_str, "mlp_str_concat");
+    return data ? mlp_str_from_len(data, a.length + b.length) : empty_str;
+}
+
+MelpStr mlp_str_concat3(MelpStr a, MelpStr b, MelpStr c) {
+    char* data = join3(a, b, c, "mlp_str_concat3");
+    return data ? mlp_str_from_len(data, a.length + b.length + c.length) : empty_str;
+}
+
+MelpStr mlp_str_concat_tmp(MelpStr a, MelpStr b) {
+    char* data = join3_in(a, b, empty_str, 1, "mlp_str_concat_tmp");
+    return data ? mlp_str_from_len(data, a.length + b.length) : empty_str;
+}
+
+MelpStr mlp_str_concat3_tmp(MelpStr a, MelpStr b, MelpStr c) {
+    char* data = join3_in(a, b, c, 1, "mlp_str_concat3_tmp");
+    return data ? mlp_str_from_len(data, a.length + b.length + c.length) : empty_str;
+}
+
+int mlp_str_equals(MelpStr a, MelpStr b) {
+    if (a.length != b.length) {
+        return 0;  // No byte is read
+    }
+    return a.data == b.data || memcmp(a.data, b.data, a.length) == 0;
+}
+
+int mlp_str_compare(MelpStr a, MelpStr b) {
+    size_t common = a.length < b.length ? a.length : b.length;
+    int result = (a.data == b.data) ? 0 : memcmp(a.data, b.data, common);
+    if (result != 0) {
+        return result;
+    }
+    return (a.length > b.length) - (a.length < b.length);
+}
+
+int64_t mlp_str_length(MelpStr str) {
+    return (int64_t)str.length;
+}
+
+int64_t mlp_str_index_of(MelpStr str, MelpStr substr) {
+    const char* found = mlp_simd_find(str.data, str.length, substr.data, substr.length);
+    return found ? (int64_t)(found - str.data) : -1;
+}
+
+char* mlp_str_to_cstr(MelpStr str) {
+    return join3(str, empty_str, empty_str, "mlp_str_to_cstr");
+}
+
+void mlp_str_free(MelpStr str) {
+    if (!sto_is_rodata(str.data)) {
+        free((char*)str.data);
+    }
+}
+
+MelpStr mlp_str_own(MelpStr str) {
+    if (sto_is_rodata(str.data)) {
+        return str;
+    }
+    if (str.length == 0) {
+        return empty_str;  // Nothing to copy (nor to free later)
+    }
+    char* data = join3(str, empty_str, empty_str, "mlp_str_own");
+    return data ? mlp_str_from_len(data, str.length) : empty_str;
+}
+
+MelpStr mlp_str_to_tmp(MelpStr str) {
+    char* data = join3_in(str, empty_str, empty_str, 1, "mlp_str_to_tmp");
+    mlp_str_free(str);
+    return data ? mlp_str_from_len(data, str.length) : empty_str;
+}
+
 // ============================================================================
 // String Concatenation
 // ============================================================================
@@ -42,29 +159,9 @@ char* strdup(const char* s) {
  *   text message = greeting + " " + target  // "Hello World"
  */
 char* mlp_string_concat(const char* str1, const char* str2) {
-    // Null safety
-    if (!str1 && !str2) return strdup("");
-    if (!str1) return strdup(str2);
-    if (!str2) return strdup(str1);
-    
-    // Calculate total length
-    size_t len1 = strlen(str1);
-    size_t len2 = strlen(str2);
-    size_t total_len = len1 + len2;
-    
-    // Allocate result (heap)
-    char* result = (char*)malloc(total_len + 1);
-    if (!result) {
-        fprintf(stderr, "Error: mlp_string_concat - malloc failed\n");
-        return NULL;
-    }
-    
-    // Copy strings
-    memcpy(result, str1, len1);
-    memcpy(result + len1, str2, len2);
-    result[total_len] = '\0';
-    
-    return result;
+    // NULL is treated as "" (measured once here, then copied by length)
+    return join3(mlp_str_from_cstr(str1), mlp_str_from_cstr(str2), empty_str,
+                 "mlp_string_concat");
 }
 
 /**
@@ -82,27 +179,8 @@ char* mlp_string_concat(const char* str1, const char* str2) {
  *   text result = a + b + c  // Uses mlp_string_concat3 for efficiency
  */
 char* mlp_string_concat3(const char* str1, const char* str2, const char* str3) {
-    if (!str1) str1 = "";
-    if (!str2) str2 = "";
-    if (!str3) str3 = "";
-    
-    size_t len1 = strlen(str1);
-    size_t len2 = strlen(str2);
-    size_t len3 = strlen(str3);
-    size_t total_len = len1 + len2 + len3;
-    
-    char* result = (char*)malloc(total_len + 1);
-    if (!result) {
-        fprintf(stderr, "Error: mlp_string_concat3 - malloc failed\n");
-        return NULL;
-    }
-    
-    memcpy(result, str1, len1);
-    memcpy(result + len1, str2, len2);
-    memcpy(result + len1 + len2, str3, len3);
-    result[total_len] = '\0';
-    
-    return result;
+    return join3(mlp_str_from_cstr(str1), mlp_str_from_cstr(str2), mlp_str_from_cstr(str3),
+                 "mlp_string_concat3");
 }
 
 // ============================================================================
@@ -129,7 +207,7 @@ int mlp_string_compare(const char* str1, const char* str2) {
     if (!str1) return -1;
     if (!str2) return 1;
     
-    return strcmp(str1, str2);
+    return mlp_str_compare(mlp_str_from_cstr(str1), mlp_str_from_cstr(str2));
 }
 
 /**
@@ -143,7 +221,10 @@ int mlp_string_compare(const char* str1, const char* str2) {
  *   if msg == "test"  → mlp_string_equals(msg, "test")
  */
 int mlp_string_equals(const char* str1, const char* str2) {
-    return mlp_string_compare(str1, str2) == 0;
+    if (!str1 || !str2) {
+        return str1 == str2;
+    }
+    return mlp_str_equals(mlp_str_from_cstr(str1), mlp_str_from_cstr(str2));
 }
 
 /**
@@ -154,7 +235,7 @@ int mlp_string_equals(const char* str1, const char* str2) {
  * @return 1 if not equal, 0 if equal
  */
 int mlp_string_not_equals(const char* str1, const char* str2) {
-    return mlp_string_compare(str1, str2) != 0;
+    return !mlp_string_equals(str1, str2);
 }
 
 // ============================================================================
@@ -185,12 +266,27 @@ int mlp_string_is_empty(const char* str) {
  * Duplicate a string
  * 
  * @param str Source string
- * @return New heap-allocated copy (caller must free)
+ * @return New heap-allocated, writable copy (caller must free)
  */
 char* mlp_string_duplicate(const char* str) {
     return str ? strdup(str) : NULL;
 }
 
+/**
+ * Keep a string past its owner without copying literals
+ * 
+ * @param str Source string
+ * @return str itself when it is a literal in .rodata (immutable, lives
+ *         forever), otherwise a new heap-allocated copy; read-only either
+ *         way, release with mlp_string_release
+ */
+const char* mlp_string_keep(const char* str) {
+    if (str && sto_is_rodata(str)) {
+        return str;
+    }
+    return mlp_string_duplicate(str);
+}
+
 /**
  * YZ_22: Extract substring
  * 
@@ -231,10 +327,7 @@ char* mlp_string_substring(const char* str, size_t start, size_t length) {
 int mlp_string_indexOf(const char* str, const char* substr) {
     if (!str || !substr) return -1;
     
-    const char* found = strstr(str, substr);
-    if (!found) return -1;
-    
-    return (int)(found - str);  // Calculate index
+    return (int)mlp_str_index_of(mlp_str_from_cstr(str), mlp_str_from_cstr(substr));
 }
 
 /**
@@ -277,15 +370,24 @@ char* mlp_string_char_at(const char* str, size_t index) {
  * 
  * @param str String to free
  * 
- * Note: Do NOT free string literals (.rodata)!
- * Only free heap-allocated strings returned by concat/duplicate.
+ * Literals in .rodata are skipped, so any string the runtime handed out
+ * can be passed here.
  */
 void mlp_string_free(char* str) {
-    if (str) {
+    if (str && !sto_is_rodata(str)) {
         free(str);
     }
 }
 
+/**
+ * Release a string returned by mlp_string_keep
+ * 
+ * @param str Kept string (a literal is left alone)
+ */
+void mlp_string_release(const char* str) {
+    mlp_string_free((char*)str);
+}
+
 // ============================================================================
 // YZ_90: Number to String Conversion (for string interpolation)
 // ============================================================================
@@ -370,14 +472,7 @@ char* mlp_string_toUpperCase(const char* str) {
     char* result = malloc(len + 1);
     if (!result) return NULL;
     
-    for (size_t i = 0; i < len; i++) {
-        unsigned char c = (unsigned char)str[i];
-        if (c >= 'a' && c <= 'z') {
-            result[i] = c - 32;  // 'a' - 'A' = 32
-        } else {
-            result[i] = c;
-        }
-    }
+    mlp_simd_case_map(result, str, len, 1);
     result[len] = '\0';
     
     return result;
@@ -399,14 +494,7 @@ char* mlp_string_toLowerCase(const char* str) {
     char* result = malloc(len + 1);
     if (!result) return NULL;
     
-    for (size_t i = 0; i < len; i++) {
-        unsigned char c = (unsigned char)str[i];
-        if (c >= 'A' && c <= 'Z') {
-            result[i] = c + 32;  // 'A' + 32 = 'a'
-        } else {
-            result[i] = c;
-        }
-    }
+    mlp_simd_case_map(result, str, len, 0);
     result[len] = '\0';
     
     return result;
@@ -424,29 +512,15 @@ char* mlp_string_toLowerCase(const char* str) {
 char* mlp_string_trim(const char* str) {
     if (!str) return NULL;
     
-    // Find start (skip leading whitespace)
-    const char* start = str;
-    while (*start && (*start == ' ' || *start == '\t' || *start == '\n' || *start == '\r')) {
-        start++;
-    }
-    
-    // If string is all whitespace
-    if (*start == '\0') {
-        return strdup("");
-    }
-    
-    // Find end (skip trailing whitespace)
-    const char* end = str + strlen(str) - 1;
-    while (end > start && (*end == ' ' || *end == '\t' || *end == '\n' || *end == '\r')) {
-        end--;
-    }
+    // Skip leading whitespace, then drop trailing whitespace from the rest
+    size_t str_len = strlen(str);
+    size_t start = mlp_simd_span_space(str, str_len);
+    size_t len = mlp_simd_rspan_space(str + start, str_len - start);
     
-    // Calculate length and copy
-    size_t len = end - start + 1;
     char* result = malloc(len + 1);
     if (!result) return NULL;
     
-    memcpy(result, start, len);
+    memcpy(result, str + start, len);
     result[len] = '\0';
     
     return result;
@@ -465,12 +539,7 @@ char* mlp_string_trimStart(const char* str) {
     if (!str) return NULL;
     
     // Skip leading whitespace
-    const char* start = str;
-    while (*start && (*start == ' ' || *start == '\t' || *start == '\n' || *start == '\r')) {
-        start++;
-    }
-    
-    return strdup(start);
+    return strdup(str + mlp_simd_span_space(str, strlen(str)));
 }
 
 /**
@@ -485,17 +554,8 @@ char* mlp_string_trimStart(const char* str) {
 char* mlp_string_trimEnd(const char* str) {
     if (!str) return NULL;
     
-    size_t len = strlen(str);
-    if (len == 0) return strdup("");
-    
-    // Find end (skip trailing whitespace)
-    const char* end = str + len - 1;
-    while (end >= str && (*end == ' ' || *end == '\t' || *end == '\n' || *end == '\r')) {
-        end--;
-    }
-    
-    // Calculate length and copy
-    size_t new_len = end - str + 1;
+    // Drop trailing whitespace
+    size_t new_len = mlp_simd_rspan_space(str, strlen(str));
     char* result = malloc(new_len + 1);
     if (!result) return NULL;
     
@@ -525,14 +585,14 @@ char* mlp_string_replace(const char* str, const char* old_substr, const char* ne
     if (!old_substr || old_substr[0] == '\0') return strdup(str);
     if (!new_substr) new_substr = "";
     
-    // Find first occurrence
-    const char* found = strstr(str, old_substr);
-    if (!found) return strdup(str);  // Not found, return copy
-    
     size_t old_len = strlen(old_substr);
     size_t new_len = strlen(new_substr);
     size_t str_len = strlen(str);
     
+    // Find first occurrence
+    const char* found = mlp_simd_find(str, str_len, old_substr, old_len);
+    if (!found) return strdup(str);  // Not found, return copy
+    
     // Calculate new string length
     size_t result_len = str_len - old_len + new_len;
     char* result = malloc(result_len + 1);
@@ -568,10 +628,12 @@ char* mlp_string_replaceAll(const char* str, const char* old_substr, const char*
     size_t new_len = strlen(new_substr);
     size_t str_len = strlen(str);
     
+    const char* str_end = str + str_len;
+    
     // Count occurrences first
-    int count = 0;
+    size_t count = 0;
     const char* p = str;
-    while ((p = strstr(p, old_substr)) != NULL) {
+    while ((p = mlp_simd_find(p, str_end - p, old_substr, old_len)) != NULL) {
         count++;
         p += old_len;
     }
@@ -579,14 +641,14 @@ char* mlp_string_replaceAll(const char* str, const char* old_substr, const char*
     if (count == 0) return strdup(str);  // Not found
     
     // Calculate new string length
-    size_t result_len = str_len + count * (new_len - old_len);
+    size_t result_len = str_len - count * old_len + count * new_len;
     char* result = malloc(result_len + 1);
     if (!result) return NULL;
     
     // Build result string
     char* dest = result;
     const char* src = str;
-    while ((p = strstr(src, old_substr)) != NULL) {
+    while ((p = mlp_simd_find(src, str_end - src, old_substr, old_len)) != NULL) {
         // Copy prefix
         size_t prefix_len = p - src;
         memcpy(dest, src, prefix_len);
@@ -600,7 +662,7 @@ char* mlp_string_replaceAll(const char* str, const char* old_substr, const char*
     }
     
     // Copy remainder
-    strcpy(dest, src);
+    memcpy(dest, src, str_end - src + 1);
     
     return result;
 }
@@ -625,6 +687,7 @@ char** mlp_string_split(const char* str, const char* delimiter, int* count) {
     
     *count = 0;
     size_t delim_len = strlen(delimiter);
+    const char* str_end = str + strlen(str);
     
     // Handle empty delimiter - return whole string as single element
     if (delim_len == 0) {
@@ -638,7 +701,7 @@ char** mlp_string_split(const char* str, const char* delimiter, int* count) {
     // Count parts first
     int parts = 1;
     const char* p = str;
-    while ((p = strstr(p, delimiter)) != NULL) {
+    while ((p = mlp_simd_find(p, str_end - p, delimiter, delim_len)) != NULL) {
         parts++;
         p += delim_len;
     }
@@ -652,7 +715,7 @@ char** mlp_string_split(const char* str, const char* delimiter, int* count) {
     const char* start = str;
     p = str;
     
-    while ((p = strstr(start, delimiter)) != NULL) {
+    while ((p = mlp_simd_find(start, str_end - start, delimiter, delim_len)) != NULL) {
         size_t part_len = p - start;
         result[idx] = malloc(part_len + 1);
         if (!result[idx]) {
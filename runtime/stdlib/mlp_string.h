@@ -10,8 +10,78 @@
 #define MLP_STRING_H
 
 #include <stddef.h>  // size_t
+#include <stdint.h>  // int64_t
 
-// String concatenation
+// =============================================================================
+// MelpStr - primary string ABI (generated code <-> runtime)
+// =============================================================================
+//
+// A string is passed by value as (data, length). Nothing rescans for the
+// terminator, lengths are compared before bytes, and a substring is just a
+// narrower (data, length) into the same text.
+//
+// - data[length] is always readable: every MelpStr points into a
+//   NUL-terminated buffer (literals, runtime results, substrings of those).
+//   It is only '\0' when the string runs to the end of that buffer.
+// - Embedded NUL bytes are ordinary characters.
+// - A MelpStr does not own its text. Results of mlp_str_concat / concat3
+//   and mlp_str_own own a new buffer (free with mlp_str_free), *_tmp
+//   results belong to the temporaries region, substring / char_at results
+//   borrow.
+//
+// In LLVM IR the type is %MelpStr = type { i8*, i64 }; as a C argument it is
+// passed as two scalars (i8* data, i64 length) and returned as { i8*, i64 }
+// (x86-64 SysV: two INTEGER eightbytes).
+//
+// The char* functions further down are compatibility shims: they measure
+// their arguments once and forward to the MelpStr versions.
+
+typedef struct MelpStr {
+    const char* data;
+    size_t length;      // Bytes (excluding the NUL after them)
+} MelpStr;
+
+// MelpStr of a string literal, without strlen: MLP_STR_LITERAL("abc")
+#define MLP_STR_LITERAL(lit) ((MelpStr){ (lit), sizeof(lit) - 1 })
+
+MelpStr mlp_str_from_cstr(const char* str);   // NULL -> ""
+MelpStr mlp_str_from_len(const char* data, size_t length);
+
+MelpStr mlp_str_concat(MelpStr a, MelpStr b);
+MelpStr mlp_str_concat3(MelpStr a, MelpStr b, MelpStr c);
+
+// Same, but the result lives in the thread's temporaries region
+// (mlp_region.h): valid until the enclosing mlp_region_leave, never freed
+// with mlp_str_free. Generated code uses these for strings that do not
+// outlive their statement.
+MelpStr mlp_str_concat_tmp(MelpStr a, MelpStr b);
+MelpStr mlp_str_concat3_tmp(MelpStr a, MelpStr b, MelpStr c);
+
+int mlp_str_equals(MelpStr a, MelpStr b);     // Lengths first, then memcmp
+int mlp_str_compare(MelpStr a, MelpStr b);    // memcmp order, shorter first on ties
+int64_t mlp_str_length(MelpStr str);
+int64_t mlp_str_index_of(MelpStr str, MelpStr substr);  // -1 if not found
+
+// Copy to a new NUL-terminated char* (caller frees) for char* APIs
+char* mlp_str_to_cstr(MelpStr str);
+void mlp_str_free(MelpStr str);               // mlp_str_concat / concat3 / own results (literals: no-op)
+
+// Text to keep past its statement (what generated code stores in a
+// variable or list, or returns): read-only text such as literals and
+// char_at results as-is, anything else copied into a new buffer
+MelpStr mlp_str_own(MelpStr str);
+
+// Move an owned string into the temporaries region (str is freed)
+MelpStr mlp_str_to_tmp(MelpStr str);
+
+// Zero-copy substring / char_at: mlp_string_view.h
+
+// =============================================================================
+// char* compatibility shims
+// =============================================================================
+
+// String concatenation (one new buffer per call; for repeated appends use
+// MlpStringBuilder in mlp_string_builder.h - the compiler does so for loops)
 char* mlp_string_concat(const char* str1, const char* str2);
 char* mlp_string_concat3(const char* str1, const char* str2, const char* str3);
 
@@ -24,8 +94,10 @@ int mlp_string_not_equals(const char* str1, const char* str2);
 size_t mlp_string_length(const char* str);
 int mlp_string_is_empty(const char* str);
 
-// String manipulation
+// String manipulation (these copy; mlp_string_view.h has zero-copy
+// substring / char access / split returning views)
 char* mlp_string_duplicate(const char* str);
+const char* mlp_string_keep(const char* str);  // Literals: returned as-is (release with mlp_string_release)
 char* mlp_string_substring(const char* str, size_t start, size_t length);  // YZ_22
 int mlp_string_indexOf(const char* str, const char* substr);  // YZ_22
 char* mlp_string_char_at(const char* str, size_t index);  // Task 0.2: Character access
@@ -49,5 +121,6 @@ void mlp_string_split_free(char** parts, int count);
 
 // Memory management
 void mlp_string_free(char* str);
+void mlp_string_release(const char* str);  // mlp_string_keep results
 
 #endif // MLP_STRING_H
@@ -0,0 +1,363 @@
+/**
+ * MLP Standard Library - String Builder & Rope Implementation
+ *
+ * Builder: one buffer that doubles on overflow, so building an n-byte
+ * string by appends costs O(n) copying and O(log n) allocations instead of
+ * O(n²) / O(pieces) with mlp_string_concat.
+ *
+ * Rope: leaves hold text, inner nodes cache length/depth. Appending short
+ * pieces merges them into the rightmost leaf (up to MLP_ROPE_LEAF_MAX), and
+ * a tree deeper than MLP_ROPE_MAX_DEPTH is rebuilt balanced from its leaves.
+ *
+ * Created: 12 Aralık 2025
+ */
+
+#include "mlp_string_builder.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+// Default capacity for new builders
+#define BUILDER_INITIAL_CAPACITY 16
+
+// -----------------------------------------------------------------------------
+// String Builder
+// -----------------------------------------------------------------------------
+
+MlpStringBuilder* mlp_string_builder_create(size_t initial_capacity) {
+    MlpStringBuilder* sb = (MlpStringBuilder*)malloc(sizeof(MlpStringBuilder));
+    if (!sb) {
+        return NULL;
+    }
+
+    size_t capacity = initial_capacity ? initial_capacity : BUILDER_INITIAL_CAPACITY;
+    sb->data = (char*)malloc(capacity + 1);
+    if (!sb->data) {
+        free(sb);
+        return NULL;
+    }
+
+    sb->data[0] = '\0';
+    sb->length = 0;
+    sb->capacity = capacity;
+    return sb;
+}
+
+MlpStringBuilder* mlp_string_builder_from(const char* str) {
+    return mlp_string_builder_from_str(mlp_str_from_cstr(str));
+}
+
+MlpStringBuilder* mlp_string_builder_from_str(MelpStr str) {
+    MlpStringBuilder* sb = mlp_string_builder_create(
+        str.length > BUILDER_INITIAL_CAPACITY ? str.length : BUILDER_INITIAL_CAPACITY);
+    if (!sb) {
+        fprintf(stderr, "Error: mlp_string_builder_from - malloc failed\n");
+        return NULL;
+    }
+
+    mlp_string_builder_append_len(sb, str.data, str.length);
+    return sb;
+}
+
+int mlp_string_builder_reserve(MlpStringBuilder* sb, size_t capacity) {
+    if (!sb) {
+        return 0;
+    }
+    if (capacity <= sb->capacity) {
+        return 1;
+    }
+
+    char* data = (char*)realloc(sb->data, capacity + 1);
+    if (!data) {
+        return 0;
+    }
+
+    sb->data = data;
+    sb->capacity = capacity;
+    return 1;
+}
+
+void mlp_string_builder_append_len(MlpStringBuilder* sb, const char* data, size_t length) {
+    if (!sb || !data || length == 0) {
+        return;
+    }
+
+    size_t needed = sb->length + length;
+    if (needed > sb->capacity) {
+        // data may point into the buffer that is about to move
+        int aliased = data >= sb->data && data < sb->data + sb->length;
+        size_t offset = aliased ? (size_t)(data - sb->data) : 0;
+
+        size_t grown = sb->capacity * 2;
+        if (!mlp_string_builder_reserve(sb, grown > needed ? grown : needed)) {
+            fprintf(stderr, "Error: mlp_string_builder_append - realloc failed\n");
+            return;
+        }
+        if (aliased) {
+            data = sb->data + offset;
+        }
+    }
+
+    memmove(sb->data + sb->length, data, length);
+    sb->length = needed;
+    sb->data[needed] = '\0';
+}
+
+void mlp_string_builder_append(MlpStringBuilder* sb, const char* str) {
+    if (!str) {
+        return;
+    }
+    mlp_string_builder_append_len(sb, str, strlen(str));
+}
+
+void mlp_string_builder_append_str(MlpStringBuilder* sb, MelpStr str) {
+    mlp_string_builder_append_len(sb, str.data, str.length);
+}
+
+size_t mlp_string_builder_length(const MlpStringBuilder* sb) {
+    return sb ? sb->length : 0;
+}
+
+const char* mlp_string_builder_peek(const MlpStringBuilder* sb) {
+    return sb ? sb->data : "";
+}
+
+char* mlp_string_builder_build(MlpStringBuilder* sb) {
+    if (!sb) {
+        return strdup("");
+    }
+
+    // Hand the buffer over; only the builder header is freed
+    char* result = sb->data;
+    free(sb);
+    return result;
+}
+
+MelpStr mlp_string_builder_build_str(MlpStringBuilder* sb) {
+    size_t length = sb ? sb->length : 0;
+    char* data = mlp_string_builder_build(sb);
+    return mlp_str_from_len(data, data ? length : 0);
+}
+
+void mlp_string_builder_free(MlpStringBuilder* sb) {
+    if (!sb) {
+        return;
+    }
+    free(sb->data);
+    free(sb);
+}
+
+// -----------------------------------------------------------------------------
+// Rope - Node Helpers
+// -----------------------------------------------------------------------------
+
+static int rope_is_leaf(const MlpRope* rope) {
+    return rope->text != NULL;
+}
+
+// Leaf holding a followed by b
+static MlpRope* rope_leaf(const char* a, size_t a_len, const char* b, size_t b_len) {
+    MlpRope* rope = (MlpRope*)malloc(sizeof(MlpRope));
+    if (!rope) {
+        return NULL;
+    }
+
+    rope->text = (char*)malloc(a_len + b_len + 1);
+    if (!rope->text) {
+        free(rope);
+        return NULL;
+    }
+
+    if (a_len) memcpy(rope->text, a, a_len);
+    if (b_len) memcpy(rope->text + a_len, b, b_len);
+    rope->text[a_len + b_len] = '\0';
+    rope->length = a_len + b_len;
+    rope->depth = 0;
+    rope->refcount = 1;
+    rope->left = NULL;
+    rope->right = NULL;
+    return rope;
+}
+
+// Inner node taking over one reference to each child (released on failure)
+static MlpRope* rope_node(MlpRope* left, MlpRope* right) {
+    if (!left || !right) {
+        mlp_rope_release(left);
+        mlp_rope_release(right);
+        return NULL;
+    }
+
+    MlpRope* rope = (MlpRope*)malloc(sizeof(MlpRope));
+    if (!rope) {
+        mlp_rope_release(left);
+        mlp_rope_release(right);
+        return NULL;
+    }
+
+    rope->text = NULL;
+    rope->left = left;
+    rope->right = right;
+    rope->length = left->length + right->length;
+    rope->depth = 1 + (left->depth > right->depth ? left->depth : right->depth);
+    rope->refcount = 1;
+    return rope;
+}
+
+static size_t rope_count_leaves(const MlpRope* rope) {
+    if (rope_is_leaf(rope)) {
+        return 1;
+    }
+    return rope_count_leaves(rope->left) + rope_count_leaves(rope->right);
+}
+
+static void rope_collect_leaves(MlpRope* rope, MlpRope** leaves, size_t* count) {
+    if (rope_is_leaf(rope)) {
+        leaves[(*count)++] = rope;
+        return;
+    }
+    rope_collect_leaves(rope->left, leaves, count);
+    rope_collect_leaves(rope->right, leaves, count);
+}
+
+// Balanced tree over leaves[lo, hi) (leaves are shared, not copied)
+static MlpRope* rope_build_balanced(MlpRope** leaves, size_t lo, size_t hi) {
+    if (hi - lo == 1) {
+        mlp_rope_retain(leaves[lo]);
+        return leaves[lo];
+    }
+
+    size_t mid = lo + (hi - lo) / 2;
+    return rope_node(rope_build_balanced(leaves, lo, mid),
+                     rope_build_balanced(leaves, mid, hi));
+}
+
+static MlpRope* rope_rebalance(MlpRope* rope) {
+    size_t count = rope_count_leaves(rope);
+    MlpRope** leaves = (MlpRope**)malloc(count * sizeof(MlpRope*));
+    if (!leaves) {
+        mlp_rope_retain(rope);
+        return rope;  // Still correct, just deeper
+    }
+
+    size_t collected = 0;
+    rope_collect_leaves(rope, leaves, &collected);
+    MlpRope* balanced = rope_build_balanced(leaves, 0, count);
+    free(leaves);
+    return balanced;
+}
+
+static void rope_copy_to(const MlpRope* rope, char* out) {
+    if (rope_is_leaf(rope)) {
+        memcpy(out, rope->text, rope->length);
+        return;
+    }
+    rope_copy_to(rope->left, out);
+    rope_copy_to(rope->right, out + rope->left->length);
+}
+
+// -----------------------------------------------------------------------------
+// Rope - Public API
+// -----------------------------------------------------------------------------
+
+MlpRope* mlp_rope_from_len(const char* data, size_t length) {
+    return rope_leaf(data, data ? length : 0, NULL, 0);
+}
+
+MlpRope* mlp_rope_from(const char* str) {
+    return mlp_rope_from_len(str, str ? strlen(str) : 0);
+}
+
+MlpRope* mlp_rope_concat(MlpRope* left, MlpRope* right) {
+    if (!left || left->length == 0) {
+        if (!right) return mlp_rope_from_len("", 0);
+        mlp_rope_retain(right);
+        return right;
+    }
+    if (!right || right->length == 0) {
+        mlp_rope_retain(left);
+        return left;
+    }
+
+    // Two short leaves: one merged leaf
+    if (rope_is_leaf(left) && rope_is_leaf(right) &&
+        left->length + right->length <= MLP_ROPE_LEAF_MAX) {
+        return rope_leaf(left->text, left->length, right->text, right->length);
+    }
+
+    // Appending a short piece: merge it into the rightmost leaf
+    if (!rope_is_leaf(left) && rope_is_leaf(right) && rope_is_leaf(left->right) &&
+        left->right->length + right->length <= MLP_ROPE_LEAF_MAX) {
+        MlpRope* tail = rope_leaf(left->right->text, left->right->length,
+                                  right->text, right->length);
+        if (!tail) {
+            return NULL;
+        }
+        mlp_rope_retain(left->left);
+        return rope_node(left->left, tail);
+    }
+
+    mlp_rope_retain(left);
+    mlp_rope_retain(right);
+    MlpRope* rope = rope_node(left, right);
+    if (rope && rope->depth > MLP_ROPE_MAX_DEPTH) {
+        MlpRope* balanced = rope_rebalance(rope);
+        mlp_rope_release(rope);
+        rope = balanced;
+    }
+    return rope;
+}
+
+size_t mlp_rope_length(const MlpRope* rope) {
+    return rope ? rope->length : 0;
+}
+
+char mlp_rope_char_at(const MlpRope* rope, size_t index) {
+    if (!rope || index >= rope->length) {
+        return '\0';
+    }
+
+    while (!rope_is_leaf(rope)) {
+        if (index < rope->left->length) {
+            rope = rope->left;
+        } else {
+            index -= rope->left->length;
+            rope = rope->right;
+        }
+    }
+    return rope->text[index];
+}
+
+char* mlp_rope_flatten(const MlpRope* rope) {
+    size_t length = mlp_rope_length(rope);
+    char* result = (char*)malloc(length + 1);
+    if (!result) {
+        fprintf(stderr, "Error: mlp_rope_flatten - malloc failed\n");
+        return NULL;
+    }
+
+    if (rope) {
+        rope_copy_to(rope, result);
+    }
+    result[length] = '\0';
+    return result;
+}
+
+void mlp_rope_retain(MlpRope* rope) {
+    if (rope) {
+        rope->refcount++;
+    }
+}
+
+void mlp_rope_release(MlpRope* rope) {
+    if (!rope || --rope->refcount > 0) {
+        return;
+    }
+
+    if (rope_is_leaf(rope)) {
+        free(rope->text);
+    } else {
+        mlp_rope_release(rope->left);
+        mlp_rope_release(rope->right);
+    }
+    free(rope);
+}
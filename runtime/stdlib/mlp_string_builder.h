@@ -0,0 +1,149 @@
+/**
+ * MLP Standard Library - String Builder & Rope Header
+ *
+ * Repeated concatenation without the O(n²) copying of mlp_string_concat:
+ * - MlpStringBuilder: growable buffer, amortized O(1) appends, build()
+ *   hands the buffer over as the result string (no final copy)
+ * - MlpRope: concatenation tree for very large strings; concat is O(1)
+ *   and text is only copied once, when the rope is flattened
+ *
+ * The Stage 2 compiler lowers accumulate-in-loop concatenation
+ * (s = s + x inside a while loop) to the builder automatically.
+ *
+ * Created: 12 Aralık 2025
+ */
+
+#ifndef MLP_STRING_BUILDER_H
+#define MLP_STRING_BUILDER_H
+
+#include <stddef.h>  // size_t
+#include "mlp_string.h"  // MelpStr
+
+// -----------------------------------------------------------------------------
+// String Builder
+// -----------------------------------------------------------------------------
+
+/**
+ * MlpStringBuilder - Growable string buffer
+ *
+ * Design Philosophy:
+ * - Capacity doubles on overflow (amortized O(1) per appended byte)
+ * - Explicit length: appends never rescan the text
+ * - Always NUL-terminated, so the buffer is a valid C string at any time
+ */
+typedef struct MlpStringBuilder {
+    char* data;           // capacity + 1 bytes
+    size_t length;        // Bytes used (excluding NUL)
+    size_t capacity;      // Bytes usable before the NUL
+} MlpStringBuilder;
+
+/**
+ * Create an empty builder
+ * @param initial_capacity Bytes to reserve up front (0 = default)
+ * @return New builder, or NULL on allocation failure
+ */
+MlpStringBuilder* mlp_string_builder_create(size_t initial_capacity);
+
+/**
+ * Create a builder holding a copy of str (NULL = empty)
+ *
+ * Example (what the compiler emits for a concat loop, MelpStr versions):
+ *   MlpStringBuilder* sb = mlp_string_builder_from_str(s);
+ *   while (...) mlp_string_builder_append_str(sb, x);
+ *   s = mlp_string_builder_build_str(sb);
+ */
+MlpStringBuilder* mlp_string_builder_from(const char* str);
+MlpStringBuilder* mlp_string_builder_from_str(MelpStr str);
+
+/**
+ * Append a C string / a byte range
+ * Out of memory leaves the builder unchanged (reported on stderr).
+ */
+void mlp_string_builder_append(MlpStringBuilder* sb, const char* str);
+void mlp_string_builder_append_len(MlpStringBuilder* sb, const char* data, size_t length);
+void mlp_string_builder_append_str(MlpStringBuilder* sb, MelpStr str);
+
+/**
+ * Make room for capacity bytes without changing the text
+ * @return 1 on success, 0 on allocation failure
+ */
+int mlp_string_builder_reserve(MlpStringBuilder* sb, size_t capacity);
+
+size_t mlp_string_builder_length(const MlpStringBuilder* sb);
+
+/**
+ * Current text (owned by the builder, valid until the next append)
+ */
+const char* mlp_string_builder_peek(const MlpStringBuilder* sb);
+
+/**
+ * Finish building: returns the builder's buffer as a heap string
+ * (free with mlp_string_free) and frees the builder itself.
+ * Zero-copy - the text is not moved.
+ */
+char* mlp_string_builder_build(MlpStringBuilder* sb);
+MelpStr mlp_string_builder_build_str(MlpStringBuilder* sb);  // Free with mlp_str_free
+
+/**
+ * Discard a builder and its text
+ */
+void mlp_string_builder_free(MlpStringBuilder* sb);
+
+// -----------------------------------------------------------------------------
+// Rope
+// -----------------------------------------------------------------------------
+
+// Leaves up to this size are merged on concat instead of adding a node
+#define MLP_ROPE_LEAF_MAX 512
+
+// Concatenation depth that triggers a rebalance
+#define MLP_ROPE_MAX_DEPTH 48
+
+/**
+ * MlpRope - Immutable, reference-counted concatenation tree
+ *
+ * Leaves own their text; inner nodes share their children, so a rope
+ * can be part of any number of larger ropes. Lengths are cached per node.
+ */
+typedef struct MlpRope {
+    size_t length;        // Total bytes in this subtree
+    int depth;            // 0 for leaves
+    int refcount;
+    struct MlpRope* left;     // Inner nodes only
+    struct MlpRope* right;
+    char* text;           // Leaves only (NUL-terminated)
+} MlpRope;
+
+/**
+ * Create a leaf rope from a C string / a byte range (refcount 1)
+ */
+MlpRope* mlp_rope_from(const char* str);
+MlpRope* mlp_rope_from_len(const char* data, size_t length);
+
+/**
+ * Concatenate two ropes in O(1) (plus a small leaf copy when both ends
+ * are short). The result holds its own references: the caller still owns
+ * left and right and releases them as usual.
+ * @return New rope (refcount 1), or NULL on allocation failure
+ */
+MlpRope* mlp_rope_concat(MlpRope* left, MlpRope* right);
+
+size_t mlp_rope_length(const MlpRope* rope);
+
+/**
+ * Byte at index (O(depth)); '\0' past the end
+ */
+char mlp_rope_char_at(const MlpRope* rope, size_t index);
+
+/**
+ * Copy the whole text into a new heap string (caller frees)
+ */
+char* mlp_rope_flatten(const MlpRope* rope);
+
+/**
+ * Reference counting (release frees the rope once unused)
+ */
+void mlp_rope_retain(MlpRope* rope);
+void mlp_rope_release(MlpRope* rope);
+
+#endif // MLP_STRING_BUILDER_H
@@ -0,0 +1,313 @@
+/**
+ * MLP Standard Library - Vectorized String Kernels
+ *
+ * Substring search uses first/last-byte filtering: compare a block of
+ * haystack starting positions against needle[0] and the block shifted by
+ * needle_len - 1 against the needle's last byte; only positions where both
+ * match are checked with memcmp. Case mapping and whitespace classification
+ * are plain range/equality compares on 16 or 32 bytes at a time.
+ *
+ * The AVX2 kernels are compiled with a target attribute, so the library
+ * itself needs no -mavx2 and still runs on any x86-64 CPU. Their tails use
+ * the scalar kernels, not SSE2: legacy SSE code after 256-bit ops pays an
+ * AVX/SSE transition penalty.
+ *
+ * Created: 13 Aralık 2025
+ */
+
+#include "mlp_string_simd.h"
+#include <string.h>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define MLP_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define MLP_SIMD_X86 0
+#endif
+
+typedef struct {
+    const char* (*find)(const char*, size_t, const char*, size_t);
+    void (*case_map)(char*, const char*, size_t, int);
+    size_t (*span_space)(const char*, size_t);
+    size_t (*rspan_space)(const char*, size_t);
+} SimdKernels;
+
+// -----------------------------------------------------------------------------
+// Scalar kernels (reference; also used for vector tails)
+// -----------------------------------------------------------------------------
+
+static int is_space(unsigned char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static const char* find_scalar(const char* haystack, size_t haystack_len,
+                               const char* needle, size_t needle_len) {
+    if (needle_len == 0) return haystack;
+    if (needle_len > haystack_len) return NULL;
+
+    size_t last = haystack_len - needle_len;
+    for (size_t i = 0; i <= last; i++) {
+        if (haystack[i] == needle[0] &&
+            memcmp(haystack + i + 1, needle + 1, needle_len - 1) == 0) {
+            return haystack + i;
+        }
+    }
+    return NULL;
+}
+
+static void case_map_scalar(char* dst, const char* src, size_t length, int upper) {
+    unsigned char first = upper ? 'a' : 'A';
+    for (size_t i = 0; i < length; i++) {
+        unsigned char c = (unsigned char)src[i];
+        dst[i] = (char)((unsigned char)(c - first) < 26 ? c ^ 0x20 : c);
+    }
+}
+
+static size_t span_space_scalar(const char* str, size_t length) {
+    size_t i = 0;
+    while (i < length && is_space((unsigned char)str[i])) i++;
+    return i;
+}
+
+static size_t rspan_space_scalar(const char* str, size_t length) {
+    while (length > 0 && is_space((unsigned char)str[length - 1])) length--;
+    return length;
+}
+
+#if MLP_SIMD_X86
+
+// -----------------------------------------------------------------------------
+// SSE2 kernels (16 bytes)
+// -----------------------------------------------------------------------------
+
+static const char* find_sse2(const char* haystack, size_t haystack_len,
+                             const char* needle, size_t needle_len) {
+    if (needle_len == 0) return haystack;
+    if (needle_len > haystack_len) return NULL;
+
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last = _mm_set1_epi8(needle[needle_len - 1]);
+    size_t limit = haystack_len - needle_len + 1;  // Candidate start positions
+    size_t i = 0;
+
+    for (; i + 16 <= limit; i += 16) {
+        __m128i block_first = _mm_loadu_si128((const __m128i*)(haystack + i));
+        __m128i block_last = _mm_loadu_si128((const __m128i*)(haystack + i + needle_len - 1));
+        unsigned mask = (unsigned)_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(block_first, first), _mm_cmpeq_epi8(block_last, last)));
+
+        while (mask) {
+            size_t pos = i + (size_t)__builtin_ctz(mask);
+            if (needle_len <= 2 || memcmp(haystack + pos + 1, needle + 1, needle_len - 2) == 0) {
+                return haystack + pos;
+            }
+            mask &= mask - 1;
+        }
+    }
+    return find_scalar(haystack + i, haystack_len - i, needle, needle_len);  // Last < 16 candidates
+}
+
+static void case_map_sse2(char* dst, const char* src, size_t length, int upper) {
+    // Signed compares: bytes >= 0x80 are negative and never letters
+    const char first = upper ? 'a' : 'A';
+    const __m128i below = _mm_set1_epi8((char)(first - 1));
+    const __m128i above = _mm_set1_epi8((char)(first + 26));
+    const __m128i flip = _mm_set1_epi8(0x20);
+    size_t i = 0;
+
+    for (; i + 16 <= length; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(v, below), _mm_cmplt_epi8(v, above));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_xor_si128(v, _mm_and_si128(letter, flip)));
+    }
+    case_map_scalar(dst + i, src + i, length - i, upper);
+}
+
+// Bit per byte: 1 where the byte is not whitespace
+static unsigned non_space_mask_sse2(__m128i v) {
+    __m128i space = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\t'))),
+        _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\r'))));
+    return ~(unsigned)_mm_movemask_epi8(space) & 0xFFFFu;
+}
+
+static size_t span_space_sse2(const char* str, size_t length) {
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        unsigned mask = non_space_mask_sse2(_mm_loadu_si128((const __m128i*)(str + i)));
+        if (mask) return i + (size_t)__builtin_ctz(mask);
+    }
+    return i + span_space_scalar(str + i, length - i);
+}
+
+static size_t rspan_space_sse2(const char* str, size_t length) {
+    for (; length >= 16; length -= 16) {
+        unsigned mask = non_space_mask_sse2(_mm_loadu_si128((const __m128i*)(str + length - 16)));
+        if (mask) return length - 16 + (size_t)(32 - __builtin_clz(mask));
+    }
+    return rspan_space_scalar(str, length);
+}
+
+// -----------------------------------------------------------------------------
+// AVX2 kernels (32 bytes)
+// -----------------------------------------------------------------------------
+
+#define MLP_AVX2 __attribute__((target("avx2")))
+
+MLP_AVX2
+static const char* find_avx2(const char* haystack, size_t haystack_len,
+                             const char* needle, size_t needle_len) {
+    if (needle_len == 0) return haystack;
+    if (needle_len > haystack_len) return NULL;
+
+    const __m256i first = _mm256_set1_epi8(needle[0]);
+    const __m256i last = _mm256_set1_epi8(needle[needle_len - 1]);
+    size_t limit = haystack_len - needle_len + 1;
+    size_t i = 0;
+
+    for (; i + 32 <= limit; i += 32) {
+        __m256i block_first = _mm256_loadu_si256((const __m256i*)(haystack + i));
+        __m256i block_last = _mm256_loadu_si256((const __m256i*)(haystack + i + needle_len - 1));
+        unsigned mask = (unsigned)_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(block_first, first),
+                             _mm256_cmpeq_epi8(block_last, last)));
+
+        while (mask) {
+            size_t pos = i + (size_t)__builtin_ctz(mask);
+            if (needle_len <= 2 || memcmp(haystack + pos + 1, needle + 1, needle_len - 2) == 0) {
+                return haystack + pos;
+            }
+            mask &= mask - 1;
+        }
+    }
+    return find_scalar(haystack + i, haystack_len - i, needle, needle_len);
+}
+
+MLP_AVX2
+static void case_map_avx2(char* dst, const char* src, size_t length, int upper) {
+    const char first = upper ? 'a' : 'A';
+    const __m256i below = _mm256_set1_epi8((char)(first - 1));
+    const __m256i above = _mm256_set1_epi8((char)(first + 26));
+    const __m256i flip = _mm256_set1_epi8(0x20);
+    size_t i = 0;
+
+    for (; i + 32 <= length; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(src + i));
+        __m256i letter = _mm256_and_si256(_mm256_cmpgt_epi8(v, below),
+                                          _mm256_cmpgt_epi8(above, v));
+        _mm256_storeu_si256((__m256i*)(dst + i),
+                            _mm256_xor_si256(v, _mm256_and_si256(letter, flip)));
+    }
+    case_map_scalar(dst + i, src + i, length - i, upper);
+}
+
+MLP_AVX2
+static unsigned non_space_mask_avx2(__m256i v) {
+    __m256i space = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')),
+                        _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\t'))),
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')),
+                        _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\r'))));
+    return ~(unsigned)_mm256_movemask_epi8(space);
+}
+
+MLP_AVX2
+static size_t span_space_avx2(const char* str, size_t length) {
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        unsigned mask = non_space_mask_avx2(_mm256_loadu_si256((const __m256i*)(str + i)));
+        if (mask) return i + (size_t)__builtin_ctz(mask);
+    }
+    return i + span_space_scalar(str + i, length - i);
+}
+
+MLP_AVX2
+static size_t rspan_space_avx2(const char* str, size_t length) {
+    for (; length >= 32; length -= 32) {
+        unsigned mask = non_space_mask_avx2(_mm256_loadu_si256((const __m256i*)(str + length - 32)));
+        if (mask) return length - 32 + (size_t)(32 - __builtin_clz(mask));
+    }
+    return rspan_space_scalar(str, length);
+}
+
+#endif // MLP_SIMD_X86
+
+// -----------------------------------------------------------------------------
+// Dispatch
+// -----------------------------------------------------------------------------
+
+static const SimdKernels kernel_sets[] = {
+    { find_scalar, case_map_scalar, span_space_scalar, rspan_space_scalar },
+#if MLP_SIMD_X86
+    { find_sse2, case_map_sse2, span_space_sse2, rspan_space_sse2 },
+    { find_avx2, case_map_avx2, span_space_avx2, rspan_space_avx2 },
+#endif
+};
+
+// Set on first use; racing first calls all store the same values
+static const SimdKernels* active_kernels = NULL;
+static MlpSimdLevel active_level = MLP_SIMD_SCALAR;
+
+MlpSimdLevel mlp_simd_max_level(void) {
+#if MLP_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return MLP_SIMD_AVX2;
+    }
+    return MLP_SIMD_SSE2;
+#else
+    return MLP_SIMD_SCALAR;
+#endif
+}
+
+MlpSimdLevel mlp_simd_set_level(MlpSimdLevel level) {
+    MlpSimdLevel max_level = mlp_simd_max_level();
+    if (level > max_level) {
+        level = max_level;
+    }
+    active_level = level;
+    active_kernels = &kernel_sets[level];
+    return level;
+}
+
+static const SimdKernels* kernels(void) {
+    if (!active_kernels) {
+        mlp_simd_set_level(mlp_simd_max_level());
+    }
+    return active_kernels;
+}
+
+MlpSimdLevel mlp_simd_level(void) {
+    kernels();
+    return active_level;
+}
+
+const char* mlp_simd_level_name(MlpSimdLevel level) {
+    switch (level) {
+        case MLP_SIMD_SCALAR: return "scalar";
+        case MLP_SIMD_SSE2: return "sse2";
+        case MLP_SIMD_AVX2: return "avx2";
+    }
+    return "?";
+}
+
+// -----------------------------------------------------------------------------
+// Public kernels
+// -----------------------------------------------------------------------------
+
+const char* mlp_simd_find(const char* haystack, size_t haystack_len,
+                          const char* needle, size_t needle_len) {
+    return kernels()->find(haystack, haystack_len, needle, needle_len);
+}
+
+void mlp_simd_case_map(char* dst, const char* src, size_t length, int upper) {
+    kernels()->case_map(dst, src, length, upper);
+}
+
+size_t mlp_simd_span_space(const char* str, size_t length) {
+    return kernels()->span_space(str, length);
+}
+
+size_t mlp_simd_rspan_space(const char* str, size_t length) {
+    return kernels()->rspan_space(str, length);
+}
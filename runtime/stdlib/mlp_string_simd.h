@@ -0,0 +1,72 @@
+/**
+ * MLP Standard Library - Vectorized String Kernels
+ *
+ * Byte-range primitives behind indexOf / replace / split / case conversion
+ * / trim in mlp_string.c. Each kernel has a scalar reference version and
+ * SSE2 / AVX2 versions (x86-64); the best one the CPU supports is picked
+ * on first use.
+ *
+ * Kernels take explicit lengths, so callers measure each string once
+ * instead of calling strlen per operation.
+ *
+ * Created: 13 Aralık 2025
+ */
+
+#ifndef MLP_STRING_SIMD_H
+#define MLP_STRING_SIMD_H
+
+#include <stddef.h>  // size_t
+
+/**
+ * Kernel sets, in increasing order of width
+ */
+typedef enum {
+    MLP_SIMD_SCALAR = 0,  // Portable byte loops (reference)
+    MLP_SIMD_SSE2 = 1,    // 16 bytes per step (x86-64 baseline)
+    MLP_SIMD_AVX2 = 2     // 32 bytes per step
+} MlpSimdLevel;
+
+/**
+ * Kernel set in use (detected from CPUID on first call)
+ */
+MlpSimdLevel mlp_simd_level(void);
+
+/**
+ * Best kernel set this CPU supports
+ */
+MlpSimdLevel mlp_simd_max_level(void);
+
+/**
+ * Switch kernel sets (tests and benchmarks compare levels this way)
+ * Levels above mlp_simd_max_level() are clamped.
+ * @return Level now in use
+ */
+MlpSimdLevel mlp_simd_set_level(MlpSimdLevel level);
+
+const char* mlp_simd_level_name(MlpSimdLevel level);
+
+/**
+ * First occurrence of needle[0, needle_len) in haystack[0, haystack_len)
+ * Vector versions filter candidates on the needle's first and last byte,
+ * then confirm with memcmp.
+ * @return Pointer into haystack, or NULL (empty needle matches at 0)
+ */
+const char* mlp_simd_find(const char* haystack, size_t haystack_len,
+                          const char* needle, size_t needle_len);
+
+/**
+ * Copy length bytes from src to dst, mapping ASCII letters to upper case
+ * (upper != 0) or lower case. Other bytes, including UTF-8, are copied
+ * unchanged. dst and src may be the same buffer.
+ */
+void mlp_simd_case_map(char* dst, const char* src, size_t length, int upper);
+
+/**
+ * Whitespace is ' ', '\t', '\n' and '\r' (as in trim)
+ * span:  number of leading whitespace bytes
+ * rspan: length once trailing whitespace is dropped
+ */
+size_t mlp_simd_span_space(const char* str, size_t length);
+size_t mlp_simd_rspan_space(const char* str, size_t length);
+
+#endif // MLP_STRING_SIMD_H
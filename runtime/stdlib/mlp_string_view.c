@@ -0,0 +1,239 @@
+/**
+ * MLP Standard Library - String Views Implementation
+ *
+ * Owners keep header and text in one allocation; views are plain
+ * (pointer, length, owner) values, so substring / char access cost a
+ * refcount increment instead of a malloc + copy.
+ *
+ * Created: 14 Aralık 2025
+ */
+
+#define _POSIX_C_SOURCE 200809L  // strnlen
+
+#include "mlp_string_view.h"
+#include "mlp_string_simd.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+// -----------------------------------------------------------------------------
+// Owner
+// -----------------------------------------------------------------------------
+
+MlpStringOwner* mlp_string_owner_from_len(const char* data, size_t length) {
+    MlpStringOwner* owner = (MlpStringOwner*)malloc(sizeof(MlpStringOwner) + length + 1);
+    if (!owner) {
+        fprintf(stderr, "Error: mlp_string_owner_create - malloc failed\n");
+        return NULL;
+    }
+
+    owner->refcount = 1;
+    owner->length = length;
+    if (length) memcpy(owner->text, data, length);
+    owner->text[length] = '\0';
+    return owner;
+}
+
+MlpStringOwner* mlp_string_owner_create(const char* str) {
+    return mlp_string_owner_from_len(str, str ? strlen(str) : 0);
+}
+
+void mlp_string_owner_retain(MlpStringOwner* owner) {
+    if (owner) {
+        owner->refcount++;
+    }
+}
+
+void mlp_string_owner_release(MlpStringOwner* owner) {
+    if (owner && --owner->refcount == 0) {
+        free(owner);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Views
+// -----------------------------------------------------------------------------
+
+// View sharing parent's owner (takes a reference)
+static MlpStringView view_within(MlpStringView parent, const char* data, size_t length) {
+    MlpStringView view = { data, length, parent.owner };
+    mlp_string_owner_retain(parent.owner);
+    return view;
+}
+
+MlpStringView mlp_string_view_borrow(const char* str) {
+    MlpStringView view = { str ? str : "", str ? strlen(str) : 0, NULL };
+    return view;
+}
+
+MlpStringView mlp_string_view_of(MlpStringOwner* owner) {
+    if (!owner) {
+        return mlp_string_view_borrow(NULL);
+    }
+    MlpStringView view = { owner->text, owner->length, owner };
+    mlp_string_owner_retain(owner);
+    return view;
+}
+
+MlpStringView mlp_string_view_substring(MlpStringView view, size_t start, size_t length) {
+    if (start >= view.length) {
+        return view_within(view, view.data + view.length, 0);
+    }
+    if (length > view.length - start) {
+        length = view.length - start;
+    }
+    return view_within(view, view.data + start, length);
+}
+
+MlpStringView mlp_string_view_char_at(MlpStringView view, size_t index) {
+    return mlp_string_view_substring(view, index, 1);
+}
+
+MlpStringView mlp_string_view_retain(MlpStringView view) {
+    if (view.owner) {
+        return view_within(view, view.data, view.length);
+    }
+
+    // Borrowed text: materialize so the copy can outlive it
+    MlpStringOwner* owner = mlp_string_owner_from_len(view.data, view.length);
+    MlpStringView kept = mlp_string_view_of(owner);
+    mlp_string_owner_release(owner);  // kept holds the only reference
+    return kept;
+}
+
+void mlp_string_view_release(MlpStringView* view) {
+    if (!view) {
+        return;
+    }
+    mlp_string_owner_release(view->owner);
+    view->data = "";
+    view->length = 0;
+    view->owner = NULL;
+}
+
+int mlp_string_view_equals(MlpStringView a, MlpStringView b) {
+    if (a.length != b.length) {
+        return 0;
+    }
+    return a.data == b.data || memcmp(a.data, b.data, a.length) == 0;
+}
+
+const char* mlp_string_view_cstr(MlpStringView* view) {
+    if (!view) {
+        return NULL;
+    }
+    // Views end inside NUL-terminated text, so data[length] is readable
+    if (view->data[view->length] == '\0') {
+        return view->data;
+    }
+
+    MlpStringOwner* owner = mlp_string_owner_from_len(view->data, view->length);
+    if (!owner) {
+        return NULL;
+    }
+    mlp_string_owner_release(view->owner);
+    view->data = owner->text;
+    view->owner = owner;  // Takes over the creation reference
+    return owner->text;
+}
+
+char* mlp_string_view_to_string(MlpStringView view) {
+    char* result = (char*)malloc(view.length + 1);
+    if (!result) {
+        fprintf(stderr, "Error: mlp_string_view_to_string - malloc failed\n");
+        return NULL;
+    }
+    memcpy(result, view.data, view.length);
+    result[view.length] = '\0';
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+// Split
+// -----------------------------------------------------------------------------
+
+MlpStringViewArray* mlp_string_view_split(MlpStringView view, const char* delimiter) {
+    size_t delim_len = delimiter ? strlen(delimiter) : 0;
+    const char* end = view.data + view.length;
+
+    // Count parts first, so header and parts share one allocation
+    size_t count = 1;
+    if (delim_len > 0) {
+        const char* p = view.data;
+        while ((p = mlp_simd_find(p, end - p, delimiter, delim_len)) != NULL) {
+            count++;
+            p += delim_len;
+        }
+    }
+
+    MlpStringViewArray* array = (MlpStringViewArray*)malloc(
+        sizeof(MlpStringViewArray) + count * sizeof(MlpStringView));
+    if (!array) {
+        fprintf(stderr, "Error: mlp_string_view_split - malloc failed\n");
+        return NULL;
+    }
+
+    array->count = count;
+    array->owner = view.owner;
+    mlp_string_owner_retain(view.owner);  // One reference for all parts
+
+    const char* start = view.data;
+    for (size_t i = 0; i + 1 < count; i++) {
+        const char* p = mlp_simd_find(start, end - start, delimiter, delim_len);
+        MlpStringView part = { start, (size_t)(p - start), view.owner };
+        array->parts[i] = part;
+        start = p + delim_len;
+    }
+    MlpStringView last = { start, (size_t)(end - start), view.owner };
+    array->parts[count - 1] = last;
+
+    return array;
+}
+
+void mlp_string_view_array_free(MlpStringViewArray* array) {
+    if (!array) {
+        return;
+    }
+    mlp_string_owner_release(array->owner);
+    free(array);
+}
+
+// -----------------------------------------------------------------------------
+// C-string entry points for generated code
+// -----------------------------------------------------------------------------
+
+// Every byte value followed by NUL: "\x00", "\x01", ... "\xff"
+#define BYTE_1(n)   { (char)(n), '\0' }
+#define BYTE_4(n)   BYTE_1(n), BYTE_1((n) + 1), BYTE_1((n) + 2), BYTE_1((n) + 3)
+#define BYTE_16(n)  BYTE_4(n), BYTE_4((n) + 4), BYTE_4((n) + 8), BYTE_4((n) + 12)
+#define BYTE_64(n)  BYTE_16(n), BYTE_16((n) + 16), BYTE_16((n) + 32), BYTE_16((n) + 48)
+static const char single_bytes[256][2] = {
+    BYTE_64(0), BYTE_64(64), BYTE_64(128), BYTE_64(192)
+};
+
+MelpStr mlp_str_substring(MelpStr str, int64_t start, int64_t length) {
+    if (start < 0 || (uint64_t)start >= str.length || length <= 0) {
+        return mlp_str_from_len(str.data + str.length, 0);
+    }
+    if ((uint64_t)length > str.length - (uint64_t)start) {
+        length = (int64_t)(str.length - (uint64_t)start);
+    }
+    return mlp_str_from_len(str.data + start, (size_t)length);
+}
+
+MelpStr mlp_str_char_at(MelpStr str, int64_t index) {
+    if (index < 0 || (uint64_t)index >= str.length) {
+        return mlp_str_from_len("", 0);
+    }
+    return mlp_str_from_len(single_bytes[(unsigned char)str.data[index]], 1);
+}
+
+const char* mlp_string_char_at_view(const char* str, size_t index) {
+    if (!str) {
+        return "";
+    }
+    if (strnlen(str, index + 1) <= index) {
+        return "";  // Out of bounds (never reads past the NUL)
+    }
+    return single_bytes[(unsigned char)str[index]];
+}
@@ -0,0 +1,166 @@
+/**
+ * MLP Standard Library - String Views Header
+ *
+ * Zero-copy substring / split / character access:
+ * - MlpStringOwner: refcounted, immutable string (header + text in one block)
+ * - MlpStringView: pointer + length into an owner (or into borrowed text);
+ *   taking a view only bumps the owner's refcount, nothing is copied
+ * - Split returns all parts in one allocation (MlpStringViewArray)
+ *
+ * Text is copied only when a view has to outlive borrowed text
+ * (mlp_string_view_retain on an unowned view) or when a NUL-terminated
+ * C string is needed and the view does not already end at a NUL
+ * (mlp_string_view_cstr).
+ *
+ * Created: 14 Aralık 2025
+ */
+
+#ifndef MLP_STRING_VIEW_H
+#define MLP_STRING_VIEW_H
+
+#include <stddef.h>  // size_t
+#include "mlp_string.h"  // MelpStr
+
+// -----------------------------------------------------------------------------
+// Owner (refcounted parent string)
+// -----------------------------------------------------------------------------
+
+typedef struct MlpStringOwner {
+    int refcount;
+    size_t length;        // Bytes (excluding NUL)
+    char text[];          // NUL-terminated
+} MlpStringOwner;
+
+/**
+ * Copy a C string / byte range into a new owner (refcount 1)
+ * @return Owner, or NULL on allocation failure
+ */
+MlpStringOwner* mlp_string_owner_create(const char* str);
+MlpStringOwner* mlp_string_owner_from_len(const char* data, size_t length);
+
+void mlp_string_owner_retain(MlpStringOwner* owner);
+void mlp_string_owner_release(MlpStringOwner* owner);
+
+// -----------------------------------------------------------------------------
+// Views
+// -----------------------------------------------------------------------------
+
+/**
+ * MlpStringView - Borrowed byte range
+ *
+ * A view with an owner holds one reference to it and must be released.
+ * A view without an owner borrows text it does not control (a literal or
+ * a caller's buffer); releasing it is a no-op.
+ */
+typedef struct MlpStringView {
+    const char* data;
+    size_t length;
+    MlpStringOwner* owner;  // NULL: borrowed text
+} MlpStringView;
+
+/**
+ * View of a C string without copying or owning it (NULL = empty)
+ */
+MlpStringView mlp_string_view_borrow(const char* str);
+
+/**
+ * View of a whole owner (takes a new reference)
+ */
+MlpStringView mlp_string_view_of(MlpStringOwner* owner);
+
+/**
+ * Sub-range of a view, clamped like mlp_string_substring
+ * Shares the parent's text and owner (takes a new reference).
+ */
+MlpStringView mlp_string_view_substring(MlpStringView view, size_t start, size_t length);
+
+/**
+ * One-byte view at index (empty view when out of bounds) - no allocation
+ */
+MlpStringView mlp_string_view_char_at(MlpStringView view, size_t index);
+
+/**
+ * Another reference to the same text. An unowned view is copied into a
+ * new owner first, since that is the only way it can outlive its text.
+ */
+MlpStringView mlp_string_view_retain(MlpStringView view);
+
+/**
+ * Drop the view's reference (clears the view)
+ */
+void mlp_string_view_release(MlpStringView* view);
+
+/**
+ * Byte equality: lengths first, then memcmp
+ */
+int mlp_string_view_equals(MlpStringView a, MlpStringView b);
+
+/**
+ * NUL-terminated text of a view
+ * Zero-copy when the view already ends at a NUL (whole strings and
+ * suffixes); otherwise the view is re-pointed at a fresh owner holding a
+ * copy. The result stays valid while the view is held (call it only on
+ * views you hold a reference for, not on borrowed split parts).
+ * @return Text, or NULL on allocation failure
+ */
+const char* mlp_string_view_cstr(MlpStringView* view);
+
+/**
+ * New heap copy of the text (caller frees) for char* APIs
+ */
+char* mlp_string_view_to_string(MlpStringView view);
+
+// -----------------------------------------------------------------------------
+// Split
+// -----------------------------------------------------------------------------
+
+/**
+ * Result of mlp_string_view_split: header and parts in one allocation.
+ * The array holds a single reference for all parts; parts are borrowed
+ * (do not release them), use mlp_string_view_retain to keep one longer.
+ */
+typedef struct MlpStringViewArray {
+    size_t count;
+    MlpStringOwner* owner;
+    MlpStringView parts[];
+} MlpStringViewArray;
+
+/**
+ * Split a view on delimiter (same rules as mlp_string_split: empty
+ * delimiter gives one part, empty parts are kept)
+ * @return Array (free with mlp_string_view_array_free), NULL on failure
+ */
+MlpStringViewArray* mlp_string_view_split(MlpStringView view, const char* delimiter);
+
+void mlp_string_view_array_free(MlpStringViewArray* array);
+
+// -----------------------------------------------------------------------------
+// MelpStr entry points for generated code
+// -----------------------------------------------------------------------------
+
+/**
+ * Substring, clamped like mlp_string_substring - never copies
+ * The result points into str's text (borrowed, not NUL-terminated), so it
+ * is only valid while str is: generated code copies it (mlp_str_own)
+ * wherever it is kept.
+ */
+MelpStr mlp_str_substring(MelpStr str, int64_t start, int64_t length);
+
+/**
+ * Character at index (empty when out of bounds) - never allocates
+ * The result points at a static 1-byte string, so it stays valid after
+ * str is gone.
+ */
+MelpStr mlp_str_char_at(MelpStr str, int64_t index);
+
+// -----------------------------------------------------------------------------
+// C-string shims (measure str, then same rules as above)
+// -----------------------------------------------------------------------------
+
+/**
+ * Character at index as a 1-byte C string from a static table
+ * No allocation; the result is never freed. "" when out of bounds.
+ */
+const char* mlp_string_char_at_view(const char* str, size_t index);
+
+#endif // MLP_STRING_VIEW_H
@@ -0,0 +1,325 @@
+/**
+ * Test program for the vectorized numeric array kernels
+ * Differential tests: every kernel set this CPU supports must agree with
+ * the scalar kernels on random inputs (lengths around the 2/4/16-lane
+ * blocks, unaligned starts, wrapping int64 products). Double inputs are
+ * small integers, so sums are exact in any order. Then MelpDenseArray
+ * storage and the numeric[] builtins (mlp_array_*) are checked.
+ *
+ * Build: make test_array_simd (or make test)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "mlp_array.h"
+#include "mlp_array_simd.h"
+#include "mlp_dense_array.h"
+
+static int failures = 0;
+
+static void report(int ok) {
+    if (ok) {
+        printf("  ✅ PASSED\n\n");
+    } else {
+        printf("  ❌ FAILED\n\n");
+        failures++;
+    }
+}
+
+// Deterministic inputs (xorshift64)
+static unsigned long long rng_state = 0x9E3779B97F4A7C15ULL;
+
+static unsigned long long rng64(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static unsigned rng(unsigned bound) {
+    return (unsigned)(rng64() % bound);
+}
+
+// Small values (many equal elements for count_if) or full 64-bit range
+static void fill_i64(int64_t* buffer, size_t length, int wide) {
+    for (size_t i = 0; i < length; i++) {
+        buffer[i] = wide ? (int64_t)rng64() : (int64_t)rng(21) - 10;
+    }
+}
+
+static void fill_f64(double* buffer, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        buffer[i] = (double)((int)rng(201) - 100);
+    }
+}
+
+#define MAX_INPUT 70
+#define ROUNDS 5000
+
+void test_int64_differential() {
+    printf("Test 1: int64 Kernels Match Scalar Kernels\n");
+    MlpSimdLevel max_level = mlp_simd_max_level();
+    int64_t a[MAX_INPUT + 4], b[MAX_INPUT + 4];
+    int64_t expected[MAX_INPUT + 4], actual[MAX_INPUT + 4];
+    int mismatches = 0;
+
+    for (int round = 0; round < ROUNDS; round++) {
+        size_t offset = rng(4);
+        size_t length = rng(MAX_INPUT);
+        int64_t* x = a + offset;
+        int64_t* y = b + offset;
+        fill_i64(x, length, round % 3 == 0);
+        fill_i64(y, length, round % 3 == 0);
+        int64_t factor = round % 3 == 0 ? (int64_t)rng64() : (int64_t)rng(7) - 3;
+        int64_t value = (int64_t)rng(21) - 10;
+        MlpCompare op = (MlpCompare)rng(6);
+
+        mlp_array_simd_set_level(MLP_SIMD_SCALAR);
+        int64_t sum = mlp_simd_i64_sum(x, length);
+        int64_t min = mlp_simd_i64_min(x, length);
+        int64_t max = mlp_simd_i64_max(x, length);
+        int64_t dot = mlp_simd_i64_dot(x, y, length);
+        size_t count = mlp_simd_i64_count_if(x, length, op, value);
+
+        for (int level = MLP_SIMD_SSE2; level <= (int)max_level; level++) {
+            mlp_array_simd_set_level((MlpSimdLevel)level);
+            int ok = mlp_simd_i64_sum(x, length) == sum &&
+                     mlp_simd_i64_min(x, length) == min &&
+                     mlp_simd_i64_max(x, length) == max &&
+                     mlp_simd_i64_dot(x, y, length) == dot &&
+                     mlp_simd_i64_count_if(x, length, op, value) == count;
+
+            // Element-wise kernels: same output buffer contents
+            void (*binary[2])(int64_t*, const int64_t*, const int64_t*, size_t) = {
+                mlp_simd_i64_add, mlp_simd_i64_mul
+            };
+            for (int k = 0; ok && k < 2; k++) {
+                mlp_array_simd_set_level(MLP_SIMD_SCALAR);
+                binary[k](expected, x, y, length);
+                mlp_array_simd_set_level((MlpSimdLevel)level);
+                binary[k](actual, x, y, length);
+                ok = memcmp(expected, actual, length * sizeof(int64_t)) == 0;
+            }
+            if (ok) {
+                mlp_array_simd_set_level(MLP_SIMD_SCALAR);
+                mlp_simd_i64_scale(expected, x, length, factor);
+                mlp_array_simd_set_level((MlpSimdLevel)level);
+                mlp_simd_i64_scale(actual, x, length, factor);
+                ok = memcmp(expected, actual, length * sizeof(int64_t)) == 0;
+            }
+            if (ok) {
+                mlp_array_simd_set_level(MLP_SIMD_SCALAR);
+                mlp_simd_i64_prefix_sum(expected, x, length);
+                mlp_array_simd_set_level((MlpSimdLevel)level);
+                mlp_simd_i64_prefix_sum(actual, x, length);
+                ok = memcmp(expected, actual, length * sizeof(int64_t)) == 0;
+            }
+            mismatches += !ok;
+        }
+    }
+    mlp_array_simd_set_level(max_level);
+
+    printf("  %d rounds, levels scalar..%s, mismatches=%d\n",
+           ROUNDS, mlp_simd_level_name(max_level), mismatches);
+    report(mismatches == 0);
+}
+
+void test_double_differential() {
+    printf("Test 2: double Kernels Match Scalar Kernels\n");
+    MlpSimdLevel max_level = mlp_simd_max_level();
+    double a[MAX_INPUT + 4], b[MAX_INPUT + 4];
+    double expected[MAX_INPUT + 4], actual[MAX_INPUT + 4];
+    int mismatches = 0;
+
+    for (int round = 0; round < ROUNDS; round++) {
+        size_t offset = rng(4);
+        size_t length = rng(MAX_INPUT);
+        double* x = a + offset;
+        double* y = b + offset;
+        fill_f64(x, length);
+        fill_f64(y, length);
+        double value = (double)((int)rng(201) - 100);
+        MlpCompare op = (MlpCompare)rng(6);
+        if (length > 0 && round % 5 == 0) {
+            x[rng((unsigned)length)] = __builtin_nan("");  // NE counts NaNs, the rest do not
+        }
+
+        mlp_array_simd_set_level(MLP_SIMD_SCALAR);
+        double sum = mlp_simd_f64_sum(y, length);
+        double min = mlp_simd_f64_min(y, length);
+        double max = mlp_simd_f64_max(y, length);
+        double dot = mlp_simd_f64_dot(y, y, length);
+        size_t count = mlp_simd_f64_count_if(x, length, op, value);
+
+        for (int level = MLP_SIMD_SSE2; level <= (int)max_level; level++) {
+            mlp_array_simd_set_level((MlpSimdLevel)level);
+            int ok = mlp_simd_f64_sum(y, length) == sum &&
+                     mlp_simd_f64_min(y, length) == min &&
+                     mlp_simd_f64_max(y, length) == max &&
+                     mlp_simd_f64_dot(y, y, length) == dot &&
+                     mlp_simd_f64_count_if(x, length, op, value) == count;
+
+            void (*binary[2])(double*, const double*, const double*, size_t) = {
+                mlp_simd_f64_add, mlp_simd_f64_mul
+            };
+            for (int k = 0; ok && k < 2; k++) {
+                mlp_array_simd_set_level(MLP_SIMD_SCALAR);
+                binary[k](expected, y, y, length);
+                mlp_array_simd_set_level((MlpSimdLevel)level);
+                binary[k](actual, y, y, length);
+                ok = memcmp(expected, actual, length * sizeof(double)) == 0;
+            }
+            if (ok) {
+                mlp_array_simd_set_level(MLP_SIMD_SCALAR);
+                mlp_simd_f64_scale(expected, y, length, -2.5);
+                mlp_array_simd_set_level((MlpSimdLevel)level);
+                mlp_simd_f64_scale(actual, y, length, -2.5);
+                ok = memcmp(expected, actual, length * sizeof(double)) == 0;
+            }
+            if (ok) {
+                mlp_array_simd_set_level(MLP_SIMD_SCALAR);
+                mlp_simd_f64_prefix_sum(expected, y, length);
+                mlp_array_simd_set_level((MlpSimdLevel)level);
+                mlp_simd_f64_prefix_sum(actual, y, length);
+                ok = memcmp(expected, actual, length * sizeof(double)) == 0;
+            }
+            mismatches += !ok;
+        }
+    }
+    mlp_array_simd_set_level(max_level);
+
+    printf("  %d rounds, levels scalar..%s, mismatches=%d\n",
+           ROUNDS, mlp_simd_level_name(max_level), mismatches);
+    report(mismatches == 0);
+}
+
+void test_fill_copy() {
+    printf("Test 3: fill64 / copy64 Including Overlapping Copies\n");
+    MlpSimdLevel max_level = mlp_simd_max_level();
+    int64_t buffer[64], expected[64];
+    int ok = 1;
+
+    for (int level = MLP_SIMD_SCALAR; ok && level <= (int)max_level; level++) {
+        mlp_array_simd_set_level((MlpSimdLevel)level);
+        for (size_t length = 0; ok && length <= 40; length++) {
+            for (int i = 0; i < 64; i++) buffer[i] = i;
+            mlp_simd_fill64(buffer + 1, length, 7);
+            for (int i = 0; i < 64; i++) {
+                ok = ok && buffer[i] == ((size_t)i >= 1 && (size_t)i <= length ? 7 : i);
+            }
+
+            // Shift right by 3 and left by 3 within one buffer
+            for (int shift = -3; ok && shift <= 3; shift += 6) {
+                for (int i = 0; i < 64; i++) buffer[i] = expected[i] = i;
+                memmove(expected + 8 + shift, expected + 8, length * sizeof(int64_t));
+                mlp_simd_copy64(buffer + 8 + shift, buffer + 8, length);
+                ok = memcmp(buffer, expected, sizeof(buffer)) == 0;
+            }
+        }
+    }
+    mlp_array_simd_set_level(max_level);
+    report(ok);
+}
+
+void test_edge_values() {
+    printf("Test 4: Empty Inputs, Wrapping and Known Results\n");
+    int64_t values[9] = { 3, -1, 4, -1, 5, -9, 2, 6, INT64_MAX };
+    int64_t scan[9];
+    int ok = 1;
+
+    for (int level = MLP_SIMD_SCALAR; ok && level <= (int)mlp_simd_max_level(); level++) {
+        mlp_array_simd_set_level((MlpSimdLevel)level);
+        ok = mlp_simd_i64_min(values, 0) == INT64_MAX && mlp_simd_i64_max(values, 0) == INT64_MIN &&
+             mlp_simd_f64_min(NULL, 0) == __builtin_inf() && mlp_simd_i64_sum(NULL, 0) == 0;
+        ok = ok && mlp_simd_i64_sum(values, 8) == 9 && mlp_simd_i64_min(values, 9) == -9 &&
+             mlp_simd_i64_max(values, 9) == INT64_MAX &&
+             mlp_simd_i64_sum(values, 9) == INT64_MIN + 8;  // wraps
+        ok = ok && mlp_simd_i64_count_if(values, 9, MLP_CMP_LT, 0) == 3 &&
+             mlp_simd_i64_count_if(values, 9, MLP_CMP_GE, 0) == 6 &&
+             mlp_simd_i64_count_if(values, 9, MLP_CMP_NE, -1) == 7;
+        mlp_simd_i64_prefix_sum(scan, values, 8);
+        ok = ok && scan[0] == 3 && scan[3] == 5 && scan[7] == 9;
+    }
+    mlp_array_simd_set_level(mlp_simd_max_level());
+    printf("  kernels in use: %s\n", mlp_simd_level_name(mlp_array_simd_level()));
+    report(ok);
+}
+
+void test_dense_array() {
+    printf("Test 5: MelpDenseArray Is Aligned, Zeroed and Typed\n");
+    int ok = 1;
+
+    for (size_t length = 0; ok && length < 20; length++) {
+        MelpDenseArray* array = melp_dense_create(MELP_DENSE_FLOAT64, length);
+        ok = array && array->data && ((uintptr_t)array->data % MELP_DENSE_ALIGNMENT) == 0 &&
+             melp_dense_f64(array) && !melp_dense_i64(array) &&
+             mlp_simd_f64_sum(melp_dense_f64(array), length) == 0.0;
+        melp_dense_free(array);
+    }
+
+    MelpList* list = mlp_array_create(1000);
+    for (size_t i = 0; i < 1000; i++) mlp_array_set(list, i, (int64_t)i);
+    MelpDenseArray* copy = melp_dense_from_list(list);
+    ok = ok && copy && copy->kind == MELP_DENSE_INT64 && copy->length == 1000 &&
+         mlp_simd_i64_sum(melp_dense_i64(copy), copy->length) == 999 * 1000 / 2;
+    ok = ok && melp_dense_from_list(NULL) == NULL && melp_dense_i64(NULL) == NULL;
+
+    melp_dense_free(copy);
+    melp_list_free(list);
+    report(ok);
+}
+
+void test_list_builtins() {
+    printf("Test 6: numeric[] Builtins (mlp_array_*)\n");
+    MelpList* xs = mlp_array_create(100);
+    MelpList* ys = mlp_array_create(100);
+    int64_t* x = (int64_t*)xs->elements;
+
+    mlp_array_fill(ys, 2);
+    for (size_t i = 0; i < 100; i++) x[i] = (int64_t)i - 50;
+    int ok = mlp_array_sum(xs) == -50 && mlp_array_min(xs) == -50 && mlp_array_max(xs) == 49 &&
+             mlp_array_dot(xs, ys) == -100 && mlp_array_count_less(xs, 0) == 50 &&
+             mlp_array_count_equal(xs, 0) == 1 && mlp_array_count_greater(xs, 0) == 49;
+
+    mlp_array_add(xs, ys);   // i - 48
+    mlp_array_mul(xs, ys);   // 2i - 96
+    mlp_array_scale(xs, 3);  // 6i - 288
+    ok = ok && x[0] == -288 && x[99] == 306;
+
+    mlp_array_copy(ys, xs);
+    mlp_array_prefix_sum(ys);
+    ok = ok && ((int64_t*)ys->elements)[99] == mlp_array_sum(xs) && x[1] == -282;
+
+    MelpList* empty = melp_list_create(sizeof(int64_t));
+    ok = ok && mlp_array_sum(empty) == 0 && mlp_array_sum(NULL) == 0;
+
+    melp_list_free(xs);
+    melp_list_free(ys);
+    melp_list_free(empty);
+    report(ok);
+}
+
+int main() {
+    printf("=================================\n");
+    printf("MLP Array Kernel Test Suite\n");
+    printf("=================================\n\n");
+
+    test_int64_differential();
+    test_double_differential();
+    test_fill_copy();
+    test_edge_values();
+    test_dense_array();
+    test_list_builtins();
+
+    printf("=================================\n");
+    if (failures == 0) {
+        printf("✅ All Tests Completed!\n");
+    } else {
+        printf("❌ %d test(s) failed\n", failures);
+    }
+    printf("=================================\n");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -5,7 +5,10 @@
 
 #include <stdio.h>
 #include <stdint.h>
+#include <string.h>
 #include "mlp_list.h"
+#include "mlp_array.h"
+#include "mlp_string.h"
 
 void test_list_create() {
     printf("Test 1: List Creation\n");
@@ -184,6 +187,217 @@ void test_list_empty() {
     melp_list_free(list);
 }
 
+void test_list_inline_storage() {
+    printf("Test 8: Inline Storage (contiguous, set in place)\n");
+    MelpList* list = melp_list_create(sizeof(int64_t));
+    
+    for (int64_t i = 0; i < 1000; i++) {
+        melp_list_append(list, &i);
+    }
+    
+    // Element i sits right after element i - 1
+    int ok = 1;
+    int64_t* first = (int64_t*)melp_list_get(list, 0);
+    for (size_t i = 0; i < 1000; i++) {
+        ok = ok && (int64_t*)melp_list_get(list, i) == first + i && first[i] == (int64_t)i;
+    }
+    
+    // Overwriting keeps the element where it is
+    int64_t new_val = -7;
+    int64_t* before = (int64_t*)melp_list_get(list, 500);
+    melp_list_set(list, 500, &new_val);
+    ok = ok && (int64_t*)melp_list_get(list, 500) == before && *before == -7;
+    
+    melp_list_remove(list, 0);
+    ok = ok && melp_list_length(list) == 999 && *(int64_t*)melp_list_get(list, 0) == 1 &&
+         *(int64_t*)melp_list_get(list, 998) == 999;
+    
+    printf("  length=%zu, capacity=%zu\n", melp_list_length(list), melp_list_capacity(list));
+    if (ok) {
+        printf("  ✅ PASSED\n\n");
+    } else {
+        printf("  ❌ FAILED\n\n");
+    }
+    
+    melp_list_free(list);
+}
+
+typedef struct {
+    int32_t id;
+    char name[20];
+} TestRecord;  // 24 bytes: not a multiple of 16
+
+void test_list_struct_elements() {
+    printf("Test 9: Struct Elements (clone, reverse, prepend)\n");
+    MelpList* list = melp_list_create(sizeof(TestRecord));
+    
+    for (int32_t i = 0; i < 5; i++) {
+        TestRecord record = { i, "" };
+        snprintf(record.name, sizeof(record.name), "record-%d", (int)i);
+        melp_list_append(list, &record);
+    }
+    TestRecord head = { -1, "head" };
+    melp_list_prepend(list, &head);
+    
+    MelpList* copy = melp_list_clone(list);
+    melp_list_reverse(list);
+    
+    // list: 4 3 2 1 0 head, copy: head 0 1 2 3 4
+    int ok = melp_list_length(copy) == 6 && melp_list_length(list) == 6;
+    for (size_t i = 0; ok && i < 6; i++) {
+        TestRecord* a = (TestRecord*)melp_list_get(list, i);
+        TestRecord* b = (TestRecord*)melp_list_get(copy, 5 - i);
+        ok = a->id == b->id && strcmp(a->name, b->name) == 0;
+    }
+    ok = ok && ((TestRecord*)melp_list_get(list, 5))->id == -1 &&
+         strcmp(((TestRecord*)melp_list_get(list, 0))->name, "record-4") == 0;
+    
+    if (ok) {
+        printf("  ✅ PASSED\n\n");
+    } else {
+        printf("  ❌ FAILED\n\n");
+    }
+    
+    melp_list_free(copy);
+    melp_list_free(list);
+}
+
+void test_array_direct_index() {
+    printf("Test 10: mlp_array (zeroed, direct get/set)\n");
+    MelpList* arr = mlp_array_create(100000);
+    
+    int ok = arr && melp_list_length(arr) == 100000 && mlp_array_get(arr, 99999) == 0;
+    for (size_t i = 0; ok && i < 100000; i += 3) {
+        ok = mlp_array_set(arr, i, (int64_t)i * 2) == 0;
+    }
+    for (size_t i = 0; ok && i < 100000; i++) {
+        ok = mlp_array_get(arr, i) == (i % 3 == 0 ? (int64_t)i * 2 : 0);
+    }
+    ok = ok && mlp_array_set(arr, 100000, 1) == -1;
+    
+    // Resize zero-fills only the new tail
+    melp_list_resize(arr, 100005);
+    ok = ok && mlp_array_get(arr, 99999) == 99999 * 2 && mlp_array_get(arr, 100004) == 0;
+    
+    printf("  length=%zu, capacity=%zu\n", melp_list_length(arr), melp_list_capacity(arr));
+    if (ok) {
+        printf("  ✅ PASSED\n\n");
+    } else {
+        printf("  ❌ FAILED\n\n");
+    }
+    
+    melp_list_free(arr);
+}
+
+void test_list_refcount() {
+    printf("Test 11: Retain/Release (compiled code's shared lists)\n");
+    MelpList* list = melp_list_create_zeroed(sizeof(int64_t), 3);
+    int ok = list->refcount == 1;
+    
+    // Two variables share it: the first release must not free it
+    melp_list_retain(list);
+    melp_list_release(list);
+    ok = ok && list->refcount == 1 && melp_list_length(list) == 3;
+    
+    // NULL (a moved-from or unset variable) is ignored
+    melp_list_retain(NULL);
+    melp_list_release(NULL);
+    
+    printf("  refcount=%zu\n", list->refcount);
+    if (ok) {
+        printf("  ✅ PASSED\n\n");
+    } else {
+        printf("  ❌ FAILED\n\n");
+    }
+    
+    melp_list_release(list);
+}
+
+void test_list_stack() {
+    printf("Test 12: Stack Lists (non-escaping literals)\n");
+    
+    // What generated code builds in a frame for [7; 8; 9]
+    int64_t data[3] = { 7, 8, 9 };
+    MelpList list = { (unsigned char*)data, 3, 3, sizeof(int64_t), MELP_LIST_REFCOUNT_STACK };
+    
+    // Reference counting leaves it alone, even a free
+    melp_list_retain(&list);
+    melp_list_release(&list);
+    melp_list_release(&list);
+    melp_list_free(&list);
+    
+    int ok = list.refcount == MELP_LIST_REFCOUNT_STACK && melp_list_length(&list) == 3 &&
+             *(int64_t*)melp_list_get(&list, 2) == 9;
+    printf("  length=%zu\n", melp_list_length(&list));
+    if (ok) {
+        printf("  ✅ PASSED\n\n");
+    } else {
+        printf("  ❌ FAILED\n\n");
+    }
+}
+
+void test_list_aliased_element() {
+    printf("Test 13: Element From the Same List (append/prepend while growing)\n");
+    MelpList* list = melp_list_create(sizeof(int64_t));
+    
+    int64_t values[] = {42, 7, 8, 9};
+    for (int i = 0; i < 4; i++) {
+        melp_list_append(list, &values[i]);
+    }
+    
+    // Full list: the grow moves the buffer melp_list_get points into
+    melp_list_append(list, melp_list_get(list, 0));
+    // The shift moves the element being prepended
+    melp_list_prepend(list, melp_list_get(list, 3));
+    
+    int64_t expected[] = {9, 42, 7, 8, 9, 42};
+    int ok = melp_list_length(list) == 6;
+    for (int i = 0; ok && i < 6; i++) {
+        ok = *(int64_t*)melp_list_get(list, i) == expected[i];
+    }
+    
+    melp_list_print_debug(list);
+    if (ok) {
+        printf("  ✅ PASSED\n\n");
+    } else {
+        printf("  ❌ FAILED\n\n");
+    }
+    
+    melp_list_free(list);
+}
+
+void test_list_strings() {
+    printf("Test 14: String Lists Free Their Elements' Text\n");
+    MelpList* list = melp_list_create(sizeof(MelpStr));
+    char word[] = "word";
+    MelpStr owned = mlp_str_own(mlp_str_from_cstr(word));
+    MelpStr literal = MLP_STR_LITERAL("literal");
+    melp_list_append(list, &owned);
+    melp_list_append(list, &literal);
+    
+    // A shared list keeps its text until the last release
+    melp_list_retain(list);
+    melp_list_release_strings(list);
+    MelpStr first = *(MelpStr*)melp_list_get(list, 0);
+    int ok = list->refcount == 1 && mlp_str_equals(first, MLP_STR_LITERAL("word"));
+    printf("  first=\"%.*s\"\n", (int)first.length, first.data);
+    melp_list_release_strings(list);  // Frees "word" (the literal is left alone) and the list
+    
+    // A stack list frees its elements' text, not itself
+    MelpStr texts[2] = { mlp_str_own(mlp_str_from_cstr(word)), literal };
+    MelpList stack = { (unsigned char*)texts, 2, 2, sizeof(MelpStr), MELP_LIST_REFCOUNT_STACK };
+    melp_list_release_strings(&stack);
+    melp_list_free_strings(&stack);
+    melp_list_free_strings(NULL);
+    ok = ok && stack.refcount == MELP_LIST_REFCOUNT_STACK && stack.length == 2;
+    
+    if (ok) {
+        printf("  ✅ PASSED\n\n");
+    } else {
+        printf("  ❌ FAILED\n\n");
+    }
+}
+
 int main() {
     printf("=================================\n");
     printf("MLP List Runtime Test Suite\n");
@@ -197,6 +411,13 @@ int main() {
     test_list_remove();
     test_list_capacity_growth();
     test_list_empty();
+    test_list_inline_storage();
+    test_list_struct_elements();
+    test_array_direct_index();
+    test_list_refcount();
+    test_list_stack();
+    test_list_aliased_element();
+    test_list_strings();
     
     printf("=================================\n");
     printf("✅ All Tests Completed!\n");
@@ -0,0 +1,258 @@
+/**
+ * Test program for MelpMap (open addressing, SwissTable control bytes)
+ * Inserts, updates, lookups and removes must agree with a plain reference
+ * through growth, tombstones and the mirrored control bytes at the table
+ * end; keys are copied into the map's arena.
+ *
+ * Build: make test_map (or make test)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "mlp_map.h"
+
+static int failures = 0;
+
+static void report(int ok) {
+    if (ok) {
+        printf("  ✅ PASSED\n\n");
+    } else {
+        printf("  ❌ FAILED\n\n");
+        failures++;
+    }
+}
+
+static void key_for(char* buffer, size_t size, int i) {
+    snprintf(buffer, size, "key-%d", i);
+}
+
+// Odd keys are too long to be stored in the slot (arena keys)
+static void mixed_key_for(char* buffer, size_t size, int i) {
+    snprintf(buffer, size, "%s-%d", (i & 1) ? "long-key-kept-in-the-arena" : "k", i);
+}
+
+void test_basic_operations() {
+    printf("Test 1: Insert / Get / Update / Remove\n");
+    MelpMap* map = melp_map_create(sizeof(int64_t));
+    int64_t one = 1, two = 2, three = 3;
+
+    char key[32];
+    strcpy(key, "alpha");
+    int ok = melp_map_insert(map, key, &one) && melp_map_insert(map, "beta", &two);
+    key[0] = 'X';  // The map keeps its own copy of the key
+    ok = ok && melp_map_get(map, "alpha") && *(int64_t*)melp_map_get(map, "alpha") == 1 &&
+         melp_map_get(map, "Xlpha") == NULL;
+
+    ok = ok && melp_map_insert(map, "alpha", &three) && melp_map_length(map) == 2 &&
+         *(int64_t*)melp_map_get(map, "alpha") == 3;
+    ok = ok && melp_map_insert(map, "", &two) && *(int64_t*)melp_map_get(map, "") == 2;
+
+    ok = ok && melp_map_remove(map, "beta") && !melp_map_remove(map, "beta") &&
+         !melp_map_has_key(map, "beta") && melp_map_has_key(map, "alpha") &&
+         melp_map_length(map) == 2;
+    ok = ok && !melp_map_insert(map, NULL, &one) && !melp_map_insert(map, "x", NULL) &&
+         melp_map_get(NULL, "x") == NULL && melp_map_length(NULL) == 0;
+    printf("  length=%zu, capacity=%zu\n", melp_map_length(map), map->capacity);
+
+    melp_map_free(map);
+    report(ok);
+}
+
+void test_growth() {
+    printf("Test 2: Growth Keeps Every Entry (100000 keys)\n");
+    MelpMap* map = melp_map_create(sizeof(int64_t));
+    char key[32];
+    int ok = 1;
+
+    for (int64_t i = 0; i < 100000; i++) {
+        key_for(key, sizeof(key), (int)i);
+        ok = ok && melp_map_insert(map, key, &i);
+    }
+    for (int i = 0; ok && i < 100000; i++) {
+        key_for(key, sizeof(key), i);
+        int64_t* value = melp_map_get(map, key);
+        ok = value && *value == i;
+    }
+    key_for(key, sizeof(key), 100000);
+    ok = ok && melp_map_get(map, key) == NULL;
+
+    // Power of two, load at most 7/8
+    size_t capacity = map->capacity;
+    ok = ok && (capacity & (capacity - 1)) == 0 && map->length * 8 <= capacity * 7;
+    printf("  length=%zu, capacity=%zu\n", map->length, capacity);
+
+    melp_map_free(map);
+    report(ok);
+}
+
+void test_remove_and_reuse() {
+    printf("Test 3: Removes, Tombstones and Reinsertion Match a Reference\n");
+    enum { KEYS = 5000 };
+    MelpMap* map = melp_map_create(sizeof(int64_t));
+    int64_t* expected = malloc(sizeof(int64_t) * KEYS);  // -1 = absent
+    char key[64];
+    int ok = 1;
+
+    for (int i = 0; i < KEYS; i++) expected[i] = -1;
+
+    // Deterministic mix of inserts, updates and removes
+    uint64_t state = 88172645463325252ULL;
+    for (int step = 0; ok && step < 200000; step++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        int i = (int)(state % KEYS);
+        mixed_key_for(key, sizeof(key), i);
+        if (state & (1ULL << 40)) {
+            int64_t value = (int64_t)step;
+            ok = melp_map_insert(map, key, &value);
+            expected[i] = value;
+        } else {
+            ok = melp_map_remove(map, key) == (expected[i] >= 0);
+            expected[i] = -1;
+        }
+    }
+
+    size_t present = 0;
+    for (int i = 0; ok && i < KEYS; i++) {
+        mixed_key_for(key, sizeof(key), i);
+        int64_t* value = melp_map_get(map, key);
+        ok = expected[i] >= 0 ? (value && *value == expected[i]) : value == NULL;
+        present += expected[i] >= 0;
+    }
+    ok = ok && melp_map_length(map) == present;
+
+    // Arena does not keep every removed key alive
+    printf("  length=%zu, capacity=%zu, live key bytes=%zu, dead=%zu\n",
+           map->length, map->capacity, map->key_bytes_live, map->key_bytes_dead);
+    ok = ok && map->key_bytes_dead <= map->key_bytes_live + map->capacity + 32;
+
+    free(expected);
+    melp_map_free(map);
+    report(ok);
+}
+
+void test_small_table_wraparound() {
+    printf("Test 4: Full 16-Slot Table Probes Across the Mirrored End\n");
+    MelpMap* map = melp_map_create(sizeof(int32_t));
+    char key[32];
+    int ok = 1;
+
+    // 14 entries: 7/8 of the initial 16 slots, so no growth
+    for (int32_t i = 0; i < 14; i++) {
+        key_for(key, sizeof(key), i);
+        ok = ok && melp_map_insert(map, key, &i);
+    }
+    ok = ok && map->capacity == 16;
+    for (int i = 0; i < 14; i += 2) {
+        key_for(key, sizeof(key), i);
+        ok = ok && melp_map_remove(map, key);
+    }
+    for (int32_t i = 100; i < 107; i++) {
+        key_for(key, sizeof(key), i);
+        ok = ok && melp_map_insert(map, key, &i);
+    }
+    for (int i = 0; i < 14; i++) {
+        key_for(key, sizeof(key), i);
+        int32_t* value = melp_map_get(map, key);
+        ok = ok && ((i % 2) ? (value && *value == i) : value == NULL);
+    }
+    for (int i = 100; i < 107; i++) {
+        key_for(key, sizeof(key), i);
+        ok = ok && melp_map_has_key(map, key);
+    }
+    printf("  length=%zu, capacity=%zu\n", map->length, map->capacity);
+
+    melp_map_free(map);
+    report(ok);
+}
+
+void test_hash() {
+    printf("Test 5: wyhash Is Stable and Reads Only the Key\n");
+    char buffer[64];
+    memset(buffer, 'a', sizeof(buffer));
+    int ok = melp_map_hash("melp") == melp_map_hash_bytes("melp", 4) &&
+             melp_map_hash("melp") != melp_map_hash("melq") &&
+             melp_map_hash("") == melp_map_hash_bytes(buffer, 0) &&
+             melp_map_hash(NULL) == 0;
+
+    // Every length class (0-3, 4-16, 17-47, 48+) depends on the last byte
+    for (size_t length = 1; ok && length < sizeof(buffer); length++) {
+        uint64_t before = melp_map_hash_bytes(buffer, length);
+        buffer[length - 1] = 'b';
+        ok = melp_map_hash_bytes(buffer, length) != before;
+        buffer[length - 1] = 'a';
+    }
+    printf("  hash(\"melp\")=%016llx\n", (unsigned long long)melp_map_hash("melp"));
+    report(ok);
+}
+
+typedef struct {
+    size_t visits;
+    int64_t key_sum;
+    int keys_match;
+} ForeachTally;
+
+static void tally_entry(const char* key, void* value, void* context) {
+    ForeachTally* tally = (ForeachTally*)context;
+    char expected[64];
+    mixed_key_for(expected, sizeof(expected), (int)*(int64_t*)value);
+    tally->visits++;
+    tally->key_sum += *(int64_t*)value;
+    tally->keys_match = tally->keys_match && strcmp(key, expected) == 0;
+    *(int64_t*)value += 1000000;  // Values may be updated in place
+}
+
+void test_foreach() {
+    printf("Test 6: Foreach Visits Every Present Entry Once\n");
+    MelpMap* map = melp_map_create(sizeof(int64_t));
+    char key[64];
+    for (int64_t i = 0; i < 1000; i++) {
+        mixed_key_for(key, sizeof(key), (int)i);
+        melp_map_insert(map, key, &i);
+    }
+    for (int i = 0; i < 1000; i += 3) {
+        mixed_key_for(key, sizeof(key), i);
+        melp_map_remove(map, key);
+    }
+
+    ForeachTally tally = { 0, 0, 1 };
+    int64_t expected_sum = 0;
+    for (int i = 0; i < 1000; i++) {
+        if (i % 3) expected_sum += i;
+    }
+    melp_map_foreach(map, tally_entry, &tally);
+    mixed_key_for(key, sizeof(key), 1);
+    int ok = tally.keys_match && tally.visits == melp_map_length(map) && tally.visits == 666 &&
+             tally.key_sum == expected_sum && *(int64_t*)melp_map_get(map, key) == 1000001;
+    printf("  visits=%zu\n", tally.visits);
+
+    melp_map_foreach(NULL, tally_entry, &tally);  // Ignored
+    melp_map_free(map);
+    report(ok);
+}
+
+int main() {
+    printf("=================================\n");
+    printf("MLP Map Test Suite\n");
+    printf("=================================\n\n");
+
+    test_basic_operations();
+    test_growth();
+    test_remove_and_reuse();
+    test_small_table_wraparound();
+    test_hash();
+    test_foreach();
+
+    printf("=================================\n");
+    if (failures == 0) {
+        printf("✅ All Tests Completed!\n");
+    } else {
+        printf("❌ %d test(s) failed\n", failures);
+    }
+    printf("=================================\n");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,159 @@
+/**
+ * Test program for regions (mlp_region.h)
+ * Allocations must be aligned and stable, a mark must release exactly what
+ * came after it (across chunks), and the temporaries region must stay
+ * bounded when a loop leaves its mark every iteration.
+ *
+ * Build: make test_region (or make test)
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mlp_region.h"
+#include "mlp_string.h"
+
+static int failures = 0;
+
+static void report(int ok) {
+    if (ok) {
+        printf("  ✅ PASSED\n\n");
+    } else {
+        printf("  ❌ FAILED\n\n");
+        failures++;
+    }
+}
+
+void test_alloc_aligned_and_stable() {
+    printf("Test 1: Allocations Are Aligned and Never Move\n");
+    MlpRegion* region = mlp_region_create(256);
+    char* blocks[100];
+    int ok = region != NULL;
+
+    // 100 * 48 bytes spans many 256-byte chunks
+    for (int i = 0; i < 100 && ok; i++) {
+        blocks[i] = (char*)mlp_region_alloc(region, 40 + (size_t)(i % 8));
+        ok = blocks[i] && ((uintptr_t)blocks[i] % 16) == 0;
+        if (ok) memset(blocks[i], i, 40);
+    }
+    for (int i = 0; i < 100 && ok; i++) {
+        ok = blocks[i][0] == (char)i && blocks[i][39] == (char)i;
+    }
+    printf("  used=%zu bytes\n", mlp_region_used(region));
+
+    mlp_region_destroy(region);
+    report(ok);
+}
+
+void test_mark_release() {
+    printf("Test 2: Release Frees Exactly What Came After the Mark\n");
+    MlpRegion* region = mlp_region_create(128);
+    char* kept = mlp_region_strndup(region, "kept", 4);
+    MlpRegionMark mark = mlp_region_mark(region);
+
+    for (int i = 0; i < 50; i++) {
+        mlp_region_alloc(region, 100);  // One chunk each
+    }
+    size_t grown = mlp_region_used(region);
+    mlp_region_release(region, mark);
+    size_t after = mlp_region_used(region);
+    char* again = (char*)mlp_region_alloc(region, 8);
+
+    int ok = strcmp(kept, "kept") == 0 && grown > 5000 &&
+             after == (size_t)mark && again == kept + 16;
+    printf("  grown=%zu, after release=%zu\n", grown, after);
+
+    // Releasing a mark that is already gone is ignored
+    mlp_region_release(region, (MlpRegionMark)grown);
+    ok = ok && mlp_region_used(region) == (size_t)mark + 16;
+
+    mlp_region_reset(region);
+    ok = ok && mlp_region_used(region) == 0;
+    mlp_region_destroy(region);
+    report(ok);
+}
+
+void test_large_allocation() {
+    printf("Test 3: Requests Larger Than a Chunk Get Their Own\n");
+    MlpRegion* region = mlp_region_create(64);
+    MlpRegionMark mark = mlp_region_mark(region);
+    char* big = (char*)mlp_region_alloc(region, 10000);
+    int ok = big != NULL;
+    if (ok) {
+        memset(big, 'x', 10000);
+        ok = big[9999] == 'x';
+    }
+    char* small = mlp_region_strndup(region, "after", 5);
+    ok = ok && small && strcmp(small, "after") == 0;
+
+    mlp_region_release(region, mark);
+    ok = ok && mlp_region_used(region) == 0;
+    mlp_region_destroy(region);
+    report(ok);
+}
+
+void test_temporaries_bounded() {
+    printf("Test 4: Temporaries Stay Bounded Across Loop Iterations\n");
+    int64_t mark = mlp_region_enter();
+    size_t high_water = 0;
+    int ok = 1;
+
+    // What generated code does for print(s + "..." + t) in a loop
+    for (int i = 0; i < 100000 && ok; i++) {
+        MelpStr joined = mlp_str_concat3_tmp(MLP_STR_LITERAL("iteration "),
+                                             MLP_STR_LITERAL("number "),
+                                             MLP_STR_LITERAL("text"));
+        MelpStr twice = mlp_str_concat_tmp(joined, joined);
+        ok = twice.length == 2 * joined.length && twice.data[twice.length] == '\0' &&
+             mlp_str_equals(joined, MLP_STR_LITERAL("iteration number text"));
+        size_t used = mlp_region_used(mlp_region_temp());
+        if (used > high_water) high_water = used;
+        mlp_region_leave(mark);
+    }
+    printf("  high water=%zu bytes over 100000 iterations\n", high_water);
+
+    ok = ok && high_water < 256 && mlp_region_enter() == mark;
+    report(ok);
+}
+
+void test_nested_activations() {
+    printf("Test 5: Nested Marks Release Innermost First\n");
+    int64_t outer = mlp_region_enter();
+    MelpStr kept = mlp_str_concat_tmp(MLP_STR_LITERAL("outer "), MLP_STR_LITERAL("temporary"));
+
+    // A callee's activation: its temporaries go, the caller's stay
+    int64_t inner = mlp_region_enter();
+    for (int i = 0; i < 1000; i++) {
+        mlp_str_concat_tmp(kept, MLP_STR_LITERAL(" spills over many chunks ........"));
+    }
+    mlp_region_leave(inner);
+
+    int ok = inner > outer && mlp_region_enter() == inner &&
+             mlp_str_equals(kept, MLP_STR_LITERAL("outer temporary"));
+    mlp_region_leave(outer);
+    ok = ok && mlp_region_enter() == outer;
+    report(ok);
+}
+
+int main() {
+    printf("=================================\n");
+    printf("MLP Region Test Suite\n");
+    printf("=================================\n\n");
+
+    test_alloc_aligned_and_stable();
+    test_mark_release();
+    test_large_allocation();
+    test_temporaries_bounded();
+    test_nested_activations();
+
+    printf("=================================\n");
+    if (failures == 0) {
+        printf("✅ All Tests Completed!\n");
+    } else {
+        printf("❌ %d test(s) failed\n", failures);
+    }
+    printf("=================================\n");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -1,8 +1,14 @@
 // YZ_34: State Manager Runtime Tests
 // Test STO optimization (SSO vs Heap), persistence, auto-cleanup
 
+#define _POSIX_C_SOURCE 200809L  // SIGXFSZ
+
 #include "mlp_state.h"
+#include <pthread.h>
+#include <signal.h>
+#include <sys/resource.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <assert.h>
 
@@ -171,6 +177,311 @@ void test_namespace_convention() {
     mlp_state_close();
 }
 
+void test_many_keys() {
+    printf("\n=== Test 7: Many Keys (Hash Index) ===\n");
+    
+    mlp_state_init();
+    
+    // 100k keys: a linear scan per operation would take minutes
+    char key[32];
+    char value[64];
+    for (int i = 0; i < 100000; i++) {
+        snprintf(key, sizeof(key), "key:%d", i);
+        snprintf(value, sizeof(value), (i % 10) ? "v%d" : "a value long enough for the heap %d", i);
+        assert(mlp_state_set(key, value) == 1);
+    }
+    printf("✅ 100000 keys set (every 10th on the heap)\n");
+    
+    // Overwrite SSO with heap and heap with SSO, delete every third key
+    for (int i = 0; i < 100000; i += 3) {
+        snprintf(key, sizeof(key), "key:%d", i);
+        assert(mlp_state_delete(key) == 1);
+        assert(mlp_state_delete(key) == 0);
+    }
+    mlp_state_set("key:1", "now a value long enough for the heap");
+    mlp_state_set("key:10", "short");
+    
+    for (int i = 0; i < 100000; i++) {
+        snprintf(key, sizeof(key), "key:%d", i);
+        assert(mlp_state_has(key) == (i % 3 != 0));
+    }
+    char* one = mlp_state_get("key:1");
+    char* ten = mlp_state_get("key:10");
+    char* eleven = mlp_state_get("key:11");
+    char* gone = mlp_state_get("key:3");
+    assert(strcmp(one, "now a value long enough for the heap") == 0);
+    assert(strcmp(ten, "short") == 0);
+    assert(strcmp(eleven, "v11") == 0);
+    assert(strcmp(gone, "") == 0);
+    free(one);
+    free(ten);
+    free(eleven);
+    free(gone);
+    printf("✅ Overwrites and deletes agree with a reference\n");
+    
+    assert(mlp_state_clear() == 1);
+    assert(mlp_state_has("key:1") == 0);
+    printf("✅ clear: all 66666 removed\n");
+    
+    mlp_state_close();
+}
+
+#define WORKER_THREADS 4
+#define WORKER_KEYS 20000
+
+static void* state_worker(void* arg) {
+    int id = (int)(size_t)arg;
+    char key[32];
+    char value[64];
+    
+    // Own keys: set, read back, update; shared key: everyone writes it
+    for (int i = 0; i < WORKER_KEYS; i++) {
+        snprintf(key, sizeof(key), "t%d:%d", id, i);
+        snprintf(value, sizeof(value), (i & 1) ? "%d" : "thread value long enough for the heap %d", i);
+        if (mlp_state_set(key, value) != 1) return (void*)1;
+        char* read = mlp_state_get(key);
+        int same = strcmp(read, value) == 0;
+        free(read);
+        if (!same) return (void*)1;
+        
+        mlp_state_set("shared:counter", (i & 1) ? "odd" : "an even value long enough for the heap");
+        char* shared = mlp_state_get("shared:counter");
+        int valid = strcmp(shared, "odd") == 0 ||
+                    strcmp(shared, "an even value long enough for the heap") == 0;
+        free(shared);
+        if (!valid) return (void*)1;
+    }
+    for (int i = 0; i < WORKER_KEYS; i += 2) {
+        snprintf(key, sizeof(key), "t%d:%d", id, i);
+        if (mlp_state_delete(key) != 1) return (void*)1;
+    }
+    return NULL;
+}
+
+void test_concurrent_threads() {
+    printf("\n=== Test 8: Concurrent Threads ===\n");
+    
+    mlp_state_init();
+    
+    pthread_t threads[WORKER_THREADS];
+    for (int t = 0; t < WORKER_THREADS; t++) {
+        assert(pthread_create(&threads[t], NULL, state_worker, (void*)(size_t)t) == 0);
+    }
+    for (int t = 0; t < WORKER_THREADS; t++) {
+        void* result;
+        pthread_join(threads[t], &result);
+        assert(result == NULL);
+    }
+    printf("✅ %d threads: set/get/delete own keys, race on a shared key\n", WORKER_THREADS);
+    
+    // Odd keys survive with their values, even keys are gone
+    char key[32];
+    for (int t = 0; t < WORKER_THREADS; t++) {
+        for (int i = 0; i < WORKER_KEYS; i++) {
+            snprintf(key, sizeof(key), "t%d:%d", t, i);
+            assert(mlp_state_has(key) == (i & 1));
+        }
+    }
+    char* last = mlp_state_get("t0:19999");
+    assert(strcmp(last, "19999") == 0);
+    free(last);
+    assert(mlp_state_has("shared:counter") == 1);
+    printf("✅ Final state is consistent\n");
+    
+    mlp_state_close();
+}
+
+#define WAL_BASE "test_state_wal"
+
+static long file_size(const char* path) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return -1;
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fclose(f);
+    return size;
+}
+
+static void remove_wal_files(void) {
+    remove(WAL_BASE ".log");
+    remove(WAL_BASE ".snapshot");
+}
+
+static void open_wal_state(const char* fsync) {
+    assert(mlp_state_init() == 1);
+    assert(mlp_state_config_set("persist_file", WAL_BASE) == 1);
+    assert(mlp_state_config_set("persist_mode", "log") == 1);
+    assert(mlp_state_config_set("fsync", fsync) == 1);
+}
+
+static int state_equals(const char* key, const char* expected) {
+    char* value = mlp_state_get(key);
+    int same = strcmp(value, expected) == 0;
+    free(value);
+    return same;
+}
+
+void test_log_persistence() {
+    printf("\n=== Test 9: Append-Only Log Persistence ===\n");
+    remove_wal_files();
+    
+    open_wal_state("always");
+    assert(mlp_state_load() == 0);  // No files yet
+    assert(mlp_state_config_set("fsync", "sometimes") == 0);
+    assert(mlp_state_config_set("persist_mode", "xml") == 0);
+    
+    mlp_state_set("gone", "before the clear");
+    mlp_state_clear();
+    mlp_state_set("user", "Ali");
+    mlp_state_set("bio", "a value long enough for the heap, kept in the pool");
+    mlp_state_set("temp", "x");
+    assert(mlp_state_delete("temp") == 1);
+    mlp_state_set("user", "Veli");
+    assert(mlp_state_save() == 1);
+    assert(file_size(WAL_BASE ".log") > 8);
+    assert(file_size(WAL_BASE ".snapshot") == -1);  // Under the threshold
+    printf("✅ set/delete/clear appended (fsync=always)\n");
+    mlp_state_close();
+    
+    open_wal_state("save");
+    assert(mlp_state_load() == 1);
+    assert(state_equals("user", "Veli"));
+    assert(state_equals("bio", "a value long enough for the heap, kept in the pool"));
+    assert(mlp_state_has("temp") == 0);
+    assert(mlp_state_has("gone") == 0);
+    printf("✅ Replayed after restart\n");
+    mlp_state_close();
+}
+
+void test_log_torn_tail() {
+    printf("\n=== Test 10: Torn Log Tail ===\n");
+    
+    // A record cut short by a crash, then garbage
+    FILE* f = fopen(WAL_BASE ".log", "ab");
+    assert(f);
+    unsigned int partial[4] = { 0x12345678u, 1, 3, 100 };
+    fwrite(partial, sizeof(partial), 1, f);
+    fputs("key", f);
+    fclose(f);
+    long torn_size = file_size(WAL_BASE ".log");
+    
+    open_wal_state("never");
+    assert(mlp_state_load() == 1);
+    assert(state_equals("user", "Veli"));
+    assert(file_size(WAL_BASE ".log") == torn_size - 19);
+    printf("✅ Intact records kept, torn tail cut\n");
+    
+    // New records follow the last intact one
+    mlp_state_set("after", "crash");
+    mlp_state_close();
+    open_wal_state("never");
+    assert(mlp_state_load() == 1);
+    assert(state_equals("after", "crash"));
+    assert(state_equals("user", "Veli"));
+    printf("✅ Appends after recovery replay\n");
+    mlp_state_close();
+}
+
+void test_log_compaction() {
+    printf("\n=== Test 11: Log Compaction Into a Snapshot ===\n");
+    remove_wal_files();
+    
+    open_wal_state("save");
+    assert(mlp_state_config_set("compact_threshold", "16384") == 1);
+    char key[32];
+    char value[64];
+    for (int round = 0; round < 10; round++) {
+        for (int i = 0; i < 300; i++) {
+            snprintf(key, sizeof(key), "k%d", i);
+            snprintf(value, sizeof(value), (i % 4) ? "r%d-%d" : "round %d, a heap value of key %d", round, i);
+            mlp_state_set(key, value);
+        }
+    }
+    for (int i = 0; i < 300; i += 2) {
+        snprintf(key, sizeof(key), "k%d", i);
+        mlp_state_delete(key);
+    }
+    long snapshot = file_size(WAL_BASE ".snapshot");
+    long log = file_size(WAL_BASE ".log");
+    printf("  snapshot=%ld bytes, log=%ld bytes\n", snapshot, log);
+    assert(snapshot > 0);
+    assert(log < 16384 + 128);  // At most one record past the threshold
+    printf("✅ Log compacted automatically (threshold 16384)\n");
+    mlp_state_close();
+    
+    open_wal_state("save");
+    assert(mlp_state_load() == 1);
+    for (int i = 0; i < 300; i++) {
+        snprintf(key, sizeof(key), "k%d", i);
+        snprintf(value, sizeof(value), (i % 4) ? "r%d-%d" : "round %d, a heap value of key %d", 9, i);
+        assert(mlp_state_has(key) == (i & 1));
+        assert(!(i & 1) || state_equals(key, value));
+    }
+    printf("✅ Snapshot + log tail reloaded\n");
+    
+    assert(mlp_state_compact() == 1);
+    assert(file_size(WAL_BASE ".log") == 8);
+    mlp_state_close();
+    
+    // A damaged snapshot is refused as a whole
+    FILE* f = fopen(WAL_BASE ".snapshot", "r+b");
+    assert(f);
+    fseek(f, 100, SEEK_SET);
+    fputc('#', f);
+    fclose(f);
+    open_wal_state("save");
+    assert(mlp_state_load() == 0);
+    assert(mlp_state_has("k1") == 0);
+    printf("✅ Damaged snapshot detected by its checksums\n");
+    mlp_state_close();
+    
+    remove_wal_files();
+}
+
+void test_log_failed_append() {
+    printf("\n=== Test 12: Failed Log Append ===\n");
+    remove_wal_files();
+    
+    open_wal_state("never");
+    mlp_state_set("before", "1");
+    long size = file_size(WAL_BASE ".log");
+    assert(size > 8);
+    
+    // A file size limit lets the next record be written only in part
+    struct rlimit old_limit;
+    assert(getrlimit(RLIMIT_FSIZE, &old_limit) == 0);
+    struct rlimit limit = old_limit;
+    limit.rlim_cur = (rlim_t)size + 20;
+    signal(SIGXFSZ, SIG_IGN);
+    assert(setrlimit(RLIMIT_FSIZE, &limit) == 0);
+    assert(mlp_state_set("lost", "a value that does not fit under the file size limit") == 0);
+    assert(setrlimit(RLIMIT_FSIZE, &old_limit) == 0);
+    signal(SIGXFSZ, SIG_DFL);
+    assert(mlp_state_has("lost") == 0);
+    assert(file_size(WAL_BASE ".log") == size);
+    printf("✅ Partial record cut off the log\n");
+    
+    // Records acknowledged after the failure survive a restart
+    char key[32];
+    for (int i = 0; i < 10; i++) {
+        snprintf(key, sizeof(key), "after%d", i);
+        assert(mlp_state_set(key, "ok") == 1);
+    }
+    mlp_state_close();
+    open_wal_state("never");
+    assert(mlp_state_load() == 1);
+    assert(state_equals("before", "1"));
+    assert(mlp_state_has("lost") == 0);
+    for (int i = 0; i < 10; i++) {
+        snprintf(key, sizeof(key), "after%d", i);
+        assert(state_equals(key, "ok"));
+    }
+    printf("✅ Appends after a failed write replay\n");
+    mlp_state_close();
+    
+    remove_wal_files();
+}
+
 int main() {
     printf("🧪 MLP State Manager - Runtime Tests\n");
     printf("=====================================\n");
@@ -181,6 +492,12 @@ int main() {
     test_persistence();
     test_config();
     test_namespace_convention();
+    test_many_keys();
+    test_concurrent_threads();
+    test_log_persistence();
+    test_log_torn_tail();
+    test_log_compaction();
+    test_log_failed_append();
     
     printf("\n✅ ALL TESTS PASSED!\n");
     printf("\n💡 Note: Auto-cleanup will run at program exit\n");
@@ -0,0 +1,189 @@
+/**
+ * Test program for the MelpStr string ABI
+ * (data, length) strings must compare by length first, never rescan for a
+ * NUL (embedded NULs are ordinary bytes), and the char* shims must give the
+ * same results as before.
+ *
+ * Build: make test_string_abi (or make test)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mlp_string.h"
+#include "mlp_string_view.h"
+#include "mlp_string_builder.h"
+
+static int failures = 0;
+
+static void report(int ok) {
+    if (ok) {
+        printf("  ✅ PASSED\n\n");
+    } else {
+        printf("  ❌ FAILED\n\n");
+        failures++;
+    }
+}
+
+void test_equality_length_first() {
+    printf("Test 1: Equality Checks Length Before Bytes\n");
+    // Different lengths: no byte may be read, so a bogus pointer is safe
+    MelpStr bogus = { (const char*)16, 3 };
+    MelpStr abcd = MLP_STR_LITERAL("abcd");
+
+    int ok = !mlp_str_equals(abcd, bogus) &&
+             mlp_str_equals(abcd, mlp_str_from_cstr("abcd")) &&
+             !mlp_str_equals(abcd, MLP_STR_LITERAL("abce")) &&
+             mlp_str_equals(MLP_STR_LITERAL(""), mlp_str_from_cstr(NULL));
+    printf("  length mismatch short-circuits: %s\n", ok ? "YES" : "NO");
+    report(ok);
+}
+
+void test_embedded_nul() {
+    printf("Test 2: Embedded NUL Is Part of the String\n");
+    MelpStr a = MLP_STR_LITERAL("ab\0cd");
+    MelpStr b = MLP_STR_LITERAL("ab\0ce");
+    MelpStr joined = mlp_str_concat(a, MLP_STR_LITERAL("!"));
+
+    int ok = a.length == 5 && !mlp_str_equals(a, b) && mlp_str_compare(a, b) < 0 &&
+             joined.length == 6 && memcmp(joined.data, "ab\0cd!", 7) == 0 &&
+             mlp_str_index_of(joined, MLP_STR_LITERAL("\0c")) == 2;
+    printf("  length=%zu, joined length=%zu\n", a.length, joined.length);
+
+    mlp_str_free(joined);
+    report(ok);
+}
+
+void test_compare_order() {
+    printf("Test 3: Compare Orders Like strcmp\n");
+    const char* words[] = { "", "a", "ab", "abc", "abd", "b", "\xc3\xa7" };
+    size_t count = sizeof(words) / sizeof(words[0]);
+    int mismatches = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        for (size_t j = 0; j < count; j++) {
+            int expected = strcmp(words[i], words[j]);
+            int actual = mlp_str_compare(mlp_str_from_cstr(words[i]), mlp_str_from_cstr(words[j]));
+            if ((expected < 0) != (actual < 0) || (expected > 0) != (actual > 0) ||
+                (expected == 0) != (mlp_string_equals(words[i], words[j]) == 1)) {
+                mismatches++;
+            }
+        }
+    }
+    printf("  mismatches=%d\n", mismatches);
+    report(mismatches == 0);
+}
+
+void test_substring_and_char_at() {
+    printf("Test 4: Substring / Char At Borrow Without Copying\n");
+    MelpStr text = MLP_STR_LITERAL("hello, world");
+    MelpStr world = mlp_str_substring(text, 7, 100);  // Clamped
+    MelpStr ell = mlp_str_substring(text, 1, 3);
+    MelpStr comma = mlp_str_char_at(text, 5);
+    MelpStr none = mlp_str_char_at(text, -1);
+
+    printf("  \"%.*s\" \"%.*s\" \"%.*s\"\n", (int)world.length, world.data,
+           (int)ell.length, ell.data, (int)comma.length, comma.data);
+    int ok = world.data == text.data + 7 && world.length == 5 &&
+             ell.data == text.data + 1 && mlp_str_equals(ell, MLP_STR_LITERAL("ell")) &&
+             mlp_str_equals(comma, MLP_STR_LITERAL(",")) && comma.data[1] == '\0' &&
+             none.length == 0 && mlp_str_substring(text, 3, -2).length == 0;
+    report(ok);
+}
+
+void test_builder_and_shims() {
+    printf("Test 5: Builder Result Carries Its Length; char* Shims Agree\n");
+    MlpStringBuilder* sb = mlp_string_builder_from_str(MLP_STR_LITERAL("a"));
+    for (int i = 0; i < 100; i++) {
+        mlp_string_builder_append_str(sb, MLP_STR_LITERAL("b\0"));  // 2 bytes, one NUL
+    }
+    MelpStr built = mlp_string_builder_build_str(sb);
+
+    char* concat = mlp_string_concat("foo", "bar");
+    char* concat3 = mlp_string_concat3("a", NULL, "c");
+    int ok = built.length == 201 && built.data[200] == '\0' && built.data[201] == '\0' &&
+             strcmp(concat, "foobar") == 0 && strcmp(concat3, "ac") == 0 &&
+             mlp_string_compare(NULL, "x") < 0 && mlp_string_equals(NULL, NULL) &&
+             !mlp_string_equals("x", NULL) && mlp_string_not_equals("x", "y") &&
+             mlp_string_indexOf("hello world", "world") == 6;
+    printf("  built length=%zu\n", built.length);
+
+    mlp_str_free(built);
+    free(concat);
+    free(concat3);
+    report(ok);
+}
+
+void test_rodata_literals() {
+    printf("Test 6: Literals Are Used In Place, Never Freed\n");
+    static const char literal[] = "pooled literal";
+    const char* kept_literal = mlp_string_keep(literal);
+    char stack_text[] = "stack";
+    const char* kept_stack = mlp_string_keep(stack_text);
+
+    // A duplicate is always a writable copy, literal or not
+    char* dup_literal = mlp_string_duplicate(literal);
+    dup_literal[0] = 'P';
+
+    int ok = kept_literal == literal && kept_stack != stack_text && strcmp(kept_stack, "stack") == 0 &&
+             dup_literal != literal && strcmp(dup_literal, "Pooled literal") == 0;
+    printf("  literal kept in place: %s\n", kept_literal == literal ? "YES" : "NO");
+
+    // The releases must skip the literal (free() of .rodata would abort)
+    mlp_string_release(kept_literal);
+    mlp_str_free(MLP_STR_LITERAL(literal));
+    mlp_string_release(kept_stack);
+    free(dup_literal);
+    report(ok && strcmp(literal, "pooled literal") == 0);
+}
+
+void test_owned_copies() {
+    printf("Test 7: Owned Copies Keep Literals, Copy Borrowed Text\n");
+    char buffer[] = "borrowed text";
+    MelpStr literal = MLP_STR_LITERAL("literal");
+    MelpStr kept_literal = mlp_str_own(literal);
+    MelpStr kept_view = mlp_str_own(mlp_str_substring(mlp_str_from_cstr(buffer), 9, 4));
+    MelpStr kept_char = mlp_str_own(mlp_str_char_at(mlp_str_from_cstr(buffer), 0));
+    MelpStr kept_empty = mlp_str_own(mlp_str_from_len(buffer + 3, 0));
+    memset(buffer, '-', sizeof(buffer) - 1);  // The parent changes (or goes away)
+
+    // An owned result moved into the region: the region copy stays readable
+    MelpStr moved = mlp_str_to_tmp(mlp_str_concat(literal, MLP_STR_LITERAL("!")));
+
+    int ok = kept_literal.data == literal.data &&
+             mlp_str_equals(kept_view, MLP_STR_LITERAL("text")) && kept_view.data[4] == '\0' &&
+             mlp_str_equals(kept_char, MLP_STR_LITERAL("b")) && kept_char.data != buffer &&
+             kept_empty.length == 0 && kept_empty.data != buffer + 3 &&
+             mlp_str_equals(moved, MLP_STR_LITERAL("literal!"));
+    printf("  view copied: \"%.*s\"\n", (int)kept_view.length, kept_view.data);
+
+    mlp_str_free(kept_literal);
+    mlp_str_free(kept_view);
+    mlp_str_free(kept_char);
+    mlp_str_free(kept_empty);
+    report(ok);
+}
+
+int main() {
+    printf("=================================\n");
+    printf("MLP MelpStr ABI Test Suite\n");
+    printf("=================================\n\n");
+
+    test_equality_length_first();
+    test_embedded_nul();
+    test_compare_order();
+    test_substring_and_char_at();
+    test_builder_and_shims();
+    test_rodata_literals();
+    test_owned_copies();
+
+    printf("=================================\n");
+    if (failures == 0) {
+        printf("✅ All Tests Completed!\n");
+    } else {
+        printf("❌ %d test(s) failed\n", failures);
+    }
+    printf("=================================\n");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,187 @@
+/**
+ * Test program for MLP String Builder & Rope
+ * Validates builder growth/build and rope concat/flatten before the
+ * compiler lowers concat loops to them.
+ *
+ * Build: make test_string_builder (or make test)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mlp_string_builder.h"
+
+static int failures = 0;
+
+static void report(int ok) {
+    if (ok) {
+        printf("  ✅ PASSED\n\n");
+    } else {
+        printf("  ❌ FAILED\n\n");
+        failures++;
+    }
+}
+
+void test_builder_append() {
+    printf("Test 1: Builder Append\n");
+    MlpStringBuilder* sb = mlp_string_builder_from("Hello");
+    mlp_string_builder_append(sb, ", ");
+    mlp_string_builder_append(sb, "World");
+    mlp_string_builder_append(sb, NULL);
+
+    printf("  Text: \"%s\" (length=%zu)\n",
+           mlp_string_builder_peek(sb), mlp_string_builder_length(sb));
+    int ok = strcmp(mlp_string_builder_peek(sb), "Hello, World") == 0 &&
+             mlp_string_builder_length(sb) == 12;
+
+    mlp_string_builder_free(sb);
+    report(ok);
+}
+
+void test_builder_growth() {
+    printf("Test 2: Builder Growth (amortized)\n");
+    MlpStringBuilder* sb = mlp_string_builder_create(0);
+
+    // 1000 appends of 10 bytes: capacity doubles, so only a few regrowths
+    int regrowths = 0;
+    size_t capacity = sb->capacity;
+    for (int i = 0; i < 1000; i++) {
+        mlp_string_builder_append(sb, "0123456789");
+        if (sb->capacity != capacity) {
+            regrowths++;
+            capacity = sb->capacity;
+        }
+    }
+
+    printf("  length=%zu, capacity=%zu, regrowths=%d\n",
+           sb->length, sb->capacity, regrowths);
+    int ok = sb->length == 10000 && regrowths <= 10 &&
+             strlen(mlp_string_builder_peek(sb)) == 10000 &&
+             memcmp(mlp_string_builder_peek(sb) + 9990, "0123456789", 10) == 0;
+
+    mlp_string_builder_free(sb);
+    report(ok);
+}
+
+void test_builder_self_append() {
+    printf("Test 3: Builder Appends Its Own Text\n");
+    MlpStringBuilder* sb = mlp_string_builder_from("abcdefghijklmnop");  // fills capacity
+
+    // Source lives in the buffer that has to grow
+    mlp_string_builder_append_len(sb, mlp_string_builder_peek(sb), sb->length);
+
+    printf("  Text: \"%s\"\n", mlp_string_builder_peek(sb));
+    int ok = strcmp(mlp_string_builder_peek(sb),
+                    "abcdefghijklmnopabcdefghijklmnop") == 0;
+
+    mlp_string_builder_free(sb);
+    report(ok);
+}
+
+void test_builder_build() {
+    printf("Test 4: Build Hands Over the Buffer\n");
+    MlpStringBuilder* sb = mlp_string_builder_from("zero");
+    mlp_string_builder_append(sb, "-copy");
+    const char* buffer = mlp_string_builder_peek(sb);
+
+    char* result = mlp_string_builder_build(sb);
+    printf("  Result: \"%s\" (same buffer: %s)\n", result, result == buffer ? "YES" : "NO");
+    int ok = result == buffer && strcmp(result, "zero-copy") == 0;
+
+    free(result);
+    report(ok);
+}
+
+void test_rope_concat() {
+    printf("Test 5: Rope Concat / Char At\n");
+    MlpRope* a = mlp_rope_from("Hello, ");
+    MlpRope* b = mlp_rope_from("World");
+    MlpRope* ab = mlp_rope_concat(a, b);
+    MlpRope* abab = mlp_rope_concat(ab, ab);   // Shares ab twice
+
+    char* text = mlp_rope_flatten(abab);
+    printf("  Text: \"%s\" (length=%zu)\n", text, mlp_rope_length(abab));
+    int ok = strcmp(text, "Hello, WorldHello, World") == 0 &&
+             mlp_rope_length(abab) == 24 &&
+             mlp_rope_char_at(abab, 12) == 'H' &&
+             mlp_rope_char_at(abab, 23) == 'd' &&
+             mlp_rope_char_at(abab, 24) == '\0';
+
+    free(text);
+    mlp_rope_release(abab);
+    mlp_rope_release(ab);
+    mlp_rope_release(b);
+    mlp_rope_release(a);
+    report(ok);
+}
+
+void test_rope_large() {
+    printf("Test 6: Rope of Large Pieces Stays Shallow\n");
+    char piece[MLP_ROPE_LEAF_MAX + 1];
+    memset(piece, 'x', sizeof(piece) - 1);
+    piece[sizeof(piece) - 1] = '\0';
+
+    // 1000 large pieces: no leaf merging, so depth is kept by rebalancing
+    MlpRope* leaf = mlp_rope_from(piece);
+    MlpRope* rope = mlp_rope_from("");
+    for (int i = 0; i < 1000; i++) {
+        MlpRope* next = mlp_rope_concat(rope, leaf);
+        mlp_rope_release(rope);
+        rope = next;
+    }
+
+    char* text = mlp_rope_flatten(rope);
+    printf("  length=%zu, depth=%d\n", mlp_rope_length(rope), rope->depth);
+    int ok = mlp_rope_length(rope) == 1000 * (size_t)MLP_ROPE_LEAF_MAX &&
+             strlen(text) == mlp_rope_length(rope) &&
+             rope->depth <= MLP_ROPE_MAX_DEPTH;
+
+    free(text);
+    mlp_rope_release(rope);
+    mlp_rope_release(leaf);
+    report(ok);
+}
+
+void test_rope_small_appends() {
+    printf("Test 7: Rope Merges Short Appends\n");
+    MlpRope* rope = mlp_rope_from("");
+    for (int i = 0; i < 2000; i++) {
+        MlpRope* piece = mlp_rope_from("ab");
+        MlpRope* next = mlp_rope_concat(rope, piece);
+        mlp_rope_release(piece);
+        mlp_rope_release(rope);
+        rope = next;
+    }
+
+    printf("  length=%zu, depth=%d\n", mlp_rope_length(rope), rope->depth);
+    int ok = mlp_rope_length(rope) == 4000 &&
+             mlp_rope_char_at(rope, 3999) == 'b' &&
+             rope->depth <= MLP_ROPE_MAX_DEPTH;
+
+    mlp_rope_release(rope);
+    report(ok);
+}
+
+int main() {
+    printf("=================================\n");
+    printf("MLP String Builder Test Suite\n");
+    printf("=================================\n\n");
+
+    test_builder_append();
+    test_builder_growth();
+    test_builder_self_append();
+    test_builder_build();
+    test_rope_concat();
+    test_rope_large();
+    test_rope_small_appends();
+
+    printf("=================================\n");
+    if (failures == 0) {
+        printf("✅ All Tests Completed!\n");
+    } else {
+        printf("❌ %d test(s) failed\n", failures);
+    }
+    printf("=================================\n");
+
+    return failures == 0 ? 0 : 1;
+}
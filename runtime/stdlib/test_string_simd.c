@@ -0,0 +1,242 @@
+/**
+ * Test program for the vectorized string kernels
+ * Differential tests: every kernel set this CPU supports must agree with
+ * the scalar kernels on random inputs (lengths around the 16/32-byte
+ * block sizes, unaligned starts, high-bit bytes), then the mlp_string_*
+ * functions built on them are checked against known results.
+ *
+ * Build: make test_string_simd (or make test)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mlp_string.h"
+#include "mlp_string_simd.h"
+
+static int failures = 0;
+
+static void report(int ok) {
+    if (ok) {
+        printf("  ✅ PASSED\n\n");
+    } else {
+        printf("  ❌ FAILED\n\n");
+        failures++;
+    }
+}
+
+// Deterministic inputs (xorshift64)
+static unsigned long long rng_state = 0x9E3779B97F4A7C15ULL;
+
+static unsigned rng(unsigned bound) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (unsigned)(rng_state % bound);
+}
+
+// Random bytes from alphabet (small alphabets give many partial matches)
+static void fill(char* buffer, size_t length, const char* alphabet) {
+    size_t size = strlen(alphabet);
+    for (size_t i = 0; i < length; i++) {
+        buffer[i] = alphabet[rng((unsigned)size)];
+    }
+}
+
+#define MAX_INPUT 300
+#define ROUNDS 20000
+
+void test_find_differential() {
+    printf("Test 1: Find Matches Scalar Kernel\n");
+    MlpSimdLevel max_level = mlp_simd_max_level();
+    char* buffer = malloc(MAX_INPUT + 64);
+    char needle[48];
+    int mismatches = 0;
+
+    for (int round = 0; round < ROUNDS; round++) {
+        size_t offset = rng(32);
+        size_t hay_len = rng(MAX_INPUT);
+        char* hay = buffer + offset;
+        fill(hay, hay_len, round % 2 ? "ab" : "abcx");
+
+        // Half the needles are cut from the haystack, so matches happen
+        size_t needle_len = 1 + rng(40);
+        if (round % 2 == 0 && hay_len >= needle_len) {
+            memcpy(needle, hay + rng((unsigned)(hay_len - needle_len + 1)), needle_len);
+        } else {
+            fill(needle, needle_len, "abc");
+        }
+
+        mlp_simd_set_level(MLP_SIMD_SCALAR);
+        const char* expected = mlp_simd_find(hay, hay_len, needle, needle_len);
+        for (int level = MLP_SIMD_SSE2; level <= (int)max_level; level++) {
+            mlp_simd_set_level((MlpSimdLevel)level);
+            if (mlp_simd_find(hay, hay_len, needle, needle_len) != expected) {
+                mismatches++;
+            }
+        }
+    }
+    mlp_simd_set_level(max_level);
+
+    printf("  levels checked: scalar..%s, mismatches=%d\n",
+           mlp_simd_level_name(max_level), mismatches);
+    free(buffer);
+    report(mismatches == 0);
+}
+
+void test_find_edges() {
+    printf("Test 2: Find Edge Cases\n");
+    // Match in the last possible position, just past a block boundary
+    char hay[70];
+    memset(hay, 'a', sizeof(hay));
+    memcpy(hay + sizeof(hay) - 3, "xyz", 3);
+
+    int ok = mlp_simd_find(hay, sizeof(hay), "xyz", 3) == hay + sizeof(hay) - 3 &&
+             mlp_simd_find(hay, sizeof(hay), "z", 1) == hay + sizeof(hay) - 1 &&
+             mlp_simd_find(hay, sizeof(hay) - 1, "xyz", 3) == NULL &&
+             mlp_simd_find(hay, sizeof(hay), "", 0) == hay &&
+             mlp_simd_find(hay, 2, "aaa", 3) == NULL &&
+             mlp_simd_find(hay, sizeof(hay), "aay", 3) == NULL;
+
+    printf("  level=%s\n", mlp_simd_level_name(mlp_simd_level()));
+    report(ok);
+}
+
+void test_case_map_differential() {
+    printf("Test 3: Case Mapping Matches Scalar Kernel\n");
+    MlpSimdLevel max_level = mlp_simd_max_level();
+    unsigned char src[MAX_INPUT + 32];
+    char expected[MAX_INPUT + 32];
+    char actual[MAX_INPUT + 32];
+    int mismatches = 0;
+
+    for (int round = 0; round < ROUNDS / 4; round++) {
+        size_t offset = rng(32);
+        size_t length = rng(MAX_INPUT);
+        for (size_t i = 0; i < length; i++) {
+            src[offset + i] = (unsigned char)rng(256);  // Includes UTF-8 / high bytes
+        }
+        int upper = round % 2;
+
+        mlp_simd_set_level(MLP_SIMD_SCALAR);
+        mlp_simd_case_map(expected, (const char*)src + offset, length, upper);
+        for (int level = MLP_SIMD_SSE2; level <= (int)max_level; level++) {
+            mlp_simd_set_level((MlpSimdLevel)level);
+            mlp_simd_case_map(actual, (const char*)src + offset, length, upper);
+            if (memcmp(actual, expected, length) != 0) {
+                mismatches++;
+            }
+        }
+    }
+    mlp_simd_set_level(max_level);
+
+    printf("  mismatches=%d\n", mismatches);
+    report(mismatches == 0);
+}
+
+void test_space_span_differential() {
+    printf("Test 4: Whitespace Spans Match Scalar Kernel\n");
+    MlpSimdLevel max_level = mlp_simd_max_level();
+    char buffer[MAX_INPUT + 32];
+    int mismatches = 0;
+
+    for (int round = 0; round < ROUNDS; round++) {
+        size_t offset = rng(32);
+        size_t length = rng(MAX_INPUT);
+        char* str = buffer + offset;
+        fill(str, length, " \t\n\r");
+
+        // Zero, one or two non-space bytes anywhere
+        for (unsigned k = rng(3); k > 0 && length > 0; k--) {
+            str[rng((unsigned)length)] = (char)(k == 1 ? 'x' : 0xA0);
+        }
+
+        mlp_simd_set_level(MLP_SIMD_SCALAR);
+        size_t span = mlp_simd_span_space(str, length);
+        size_t rspan = mlp_simd_rspan_space(str, length);
+        for (int level = MLP_SIMD_SSE2; level <= (int)max_level; level++) {
+            mlp_simd_set_level((MlpSimdLevel)level);
+            if (mlp_simd_span_space(str, length) != span ||
+                mlp_simd_rspan_space(str, length) != rspan) {
+                mismatches++;
+            }
+        }
+    }
+    mlp_simd_set_level(max_level);
+
+    printf("  mismatches=%d\n", mismatches);
+    report(mismatches == 0);
+}
+
+// Compare a heap result with the expected text, then free it
+static int check(char* result, const char* expected) {
+    int ok = result && strcmp(result, expected) == 0;
+    if (!ok) {
+        printf("  got \"%s\", expected \"%s\"\n", result ? result : "(null)", expected);
+    }
+    free(result);
+    return ok;
+}
+
+void test_string_functions() {
+    printf("Test 5: String Functions on Every Kernel Set\n");
+    MlpSimdLevel max_level = mlp_simd_max_level();
+    const char* long_text =
+        "the quick brown fox jumps over the lazy dog; the quick brown fox jumps again";
+    int ok = 1;
+
+    for (int level = MLP_SIMD_SCALAR; level <= (int)max_level; level++) {
+        mlp_simd_set_level((MlpSimdLevel)level);
+
+        ok &= mlp_string_indexOf(long_text, "again") == 71;
+        ok &= mlp_string_indexOf(long_text, "fox jumps a") == 61;
+        ok &= mlp_string_indexOf(long_text, "cat") == -1;
+        ok &= check(mlp_string_replace("hello world", "world", "MELP"), "hello MELP");
+        ok &= check(mlp_string_replaceAll("a-b-c", "-", "_"), "a_b_c");
+        ok &= check(mlp_string_replaceAll("aaaaa", "aa", "b"), "bba");
+        ok &= check(mlp_string_replaceAll(long_text, "the ", ""),
+                    "quick brown fox jumps over lazy dog; quick brown fox jumps again");
+        ok &= check(mlp_string_replaceAll("xyxyxyxyxyxyxyxyxyxy", "y", "<y>"),
+                    "x<y>x<y>x<y>x<y>x<y>x<y>x<y>x<y>x<y>x<y>");
+        ok &= check(mlp_string_toUpperCase("Hello, Dünya! abcdefghijklmnopqrstuvwxyz"),
+                    "HELLO, DüNYA! ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+        ok &= check(mlp_string_toLowerCase("MELP Stage 2 ÇALIŞIYOR ABCDEFGHIJKLMNOPQRSTUVWXYZ"),
+                    "melp stage 2 ÇaliŞiyor abcdefghijklmnopqrstuvwxyz");
+        ok &= check(mlp_string_trim("  \t hello world \r\n  "), "hello world");
+        ok &= check(mlp_string_trim("                                        "), "");
+        ok &= check(mlp_string_trimStart("                                   x  "), "x  ");
+        ok &= check(mlp_string_trimEnd("  x                                    "), "  x");
+
+        int count = 0;
+        char** parts = mlp_string_split("alpha, beta, gamma, , delta", ", ", &count);
+        ok &= count == 5 && strcmp(parts[0], "alpha") == 0 && strcmp(parts[3], "") == 0 &&
+              strcmp(parts[4], "delta") == 0;
+        mlp_string_split_free(parts, count);
+    }
+    mlp_simd_set_level(max_level);
+
+    report(ok);
+}
+
+int main() {
+    printf("=================================\n");
+    printf("MLP SIMD String Kernel Test Suite\n");
+    printf("=================================\n\n");
+    printf("CPU kernel set: %s\n\n", mlp_simd_level_name(mlp_simd_max_level()));
+
+    test_find_differential();
+    test_find_edges();
+    test_case_map_differential();
+    test_space_span_differential();
+    test_string_functions();
+
+    printf("=================================\n");
+    if (failures == 0) {
+        printf("✅ All Tests Completed!\n");
+    } else {
+        printf("❌ %d test(s) failed\n", failures);
+    }
+    printf("=================================\n");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,187 @@
+/**
+ * Test program for MLP String Views
+ * Substring / char access / split must share the parent's text (no copies),
+ * keep the parent alive through its refcount, and only copy when a view
+ * needs its own NUL or has to outlive borrowed text.
+ *
+ * Build: make test_string_view (or make test)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mlp_string_view.h"
+
+static int failures = 0;
+
+static void report(int ok) {
+    if (ok) {
+        printf("  ✅ PASSED\n\n");
+    } else {
+        printf("  ❌ FAILED\n\n");
+        failures++;
+    }
+}
+
+// Does view point into owner's text?
+static int inside(MlpStringView view, const MlpStringOwner* owner) {
+    return view.data >= owner->text && view.data + view.length <= owner->text + owner->length;
+}
+
+void test_substring_shares_text() {
+    printf("Test 1: Substring Shares Parent Text\n");
+    MlpStringOwner* owner = mlp_string_owner_create("hello, world");
+    MlpStringView whole = mlp_string_view_of(owner);
+    MlpStringView world = mlp_string_view_substring(whole, 7, 100);  // Clamped
+    MlpStringView comma = mlp_string_view_char_at(whole, 5);
+    MlpStringView past_end = mlp_string_view_char_at(whole, 12);
+
+    printf("  \"%.*s\" / \"%.*s\", refcount=%d\n",
+           (int)world.length, world.data, (int)comma.length, comma.data, owner->refcount);
+    int ok = world.length == 5 && memcmp(world.data, "world", 5) == 0 &&
+             comma.length == 1 && comma.data[0] == ',' &&
+             inside(world, owner) && inside(comma, owner) &&
+             past_end.length == 0 && owner->refcount == 5;
+
+    mlp_string_view_release(&past_end);
+    mlp_string_view_release(&comma);
+    mlp_string_view_release(&world);
+    mlp_string_view_release(&whole);
+    ok = ok && owner->refcount == 1;
+    mlp_string_owner_release(owner);
+    report(ok);
+}
+
+void test_view_keeps_parent_alive() {
+    printf("Test 2: View Outlives Its Creator's Reference\n");
+    MlpStringOwner* owner = mlp_string_owner_create("temporary text");
+    MlpStringView whole = mlp_string_view_of(owner);
+    MlpStringView text = mlp_string_view_substring(whole, 10, 4);
+    mlp_string_view_release(&whole);
+    mlp_string_owner_release(owner);  // Only text's reference is left
+
+    // ASan would flag this if the parent had been freed
+    int ok = mlp_string_view_equals(text, mlp_string_view_borrow("text"));
+    printf("  text=\"%.*s\"\n", (int)text.length, text.data);
+
+    mlp_string_view_release(&text);
+    report(ok);
+}
+
+void test_cstr_copies_only_when_needed() {
+    printf("Test 3: C String Only Copies Inner Ranges\n");
+    MlpStringOwner* owner = mlp_string_owner_create("alpha beta");
+    MlpStringView whole = mlp_string_view_of(owner);
+    MlpStringView suffix = mlp_string_view_substring(whole, 6, 4);
+    MlpStringView inner = mlp_string_view_substring(whole, 0, 5);
+
+    const char* suffix_text = mlp_string_view_cstr(&suffix);
+    const char* inner_text = mlp_string_view_cstr(&inner);
+    printf("  suffix=\"%s\" (in place: %s), inner=\"%s\" (in place: %s)\n",
+           suffix_text, suffix_text == owner->text + 6 ? "YES" : "NO",
+           inner_text, inner_text == owner->text ? "YES" : "NO");
+    int ok = strcmp(suffix_text, "beta") == 0 && suffix_text == owner->text + 6 &&
+             strcmp(inner_text, "alpha") == 0 && inner_text != owner->text &&
+             inner.owner != owner && owner->refcount == 3;  // inner moved off owner
+
+    mlp_string_view_release(&inner);
+    mlp_string_view_release(&suffix);
+    mlp_string_view_release(&whole);
+    mlp_string_owner_release(owner);
+    report(ok);
+}
+
+void test_split_single_allocation() {
+    printf("Test 4: Split Returns Views in One Array\n");
+    MlpStringOwner* owner = mlp_string_owner_create("a,bb,,ccc");
+    MlpStringView whole = mlp_string_view_of(owner);
+    MlpStringViewArray* parts = mlp_string_view_split(whole, ",");
+    mlp_string_view_release(&whole);
+
+    int ok = parts && parts->count == 4 && owner->refcount == 2;
+    const char* expected[] = { "a", "bb", "", "ccc" };
+    for (size_t i = 0; ok && i < parts->count; i++) {
+        ok = mlp_string_view_equals(parts->parts[i], mlp_string_view_borrow(expected[i])) &&
+             inside(parts->parts[i], owner);
+    }
+    printf("  count=%zu, refcount=%d (one for all parts)\n", parts->count, owner->refcount);
+
+    // Keep one part after the array is gone
+    MlpStringView kept = mlp_string_view_retain(parts->parts[3]);
+    mlp_string_view_array_free(parts);
+    ok = ok && owner->refcount == 2 && mlp_string_view_equals(kept, mlp_string_view_borrow("ccc"));
+
+    mlp_string_view_release(&kept);
+    ok = ok && owner->refcount == 1;
+    mlp_string_owner_release(owner);
+    report(ok);
+}
+
+void test_borrowed_view_materializes() {
+    printf("Test 5: Borrowed View Copies When Retained\n");
+    char buffer[] = "stack text";
+    MlpStringView borrowed = mlp_string_view_substring(mlp_string_view_borrow(buffer), 6, 4);
+    MlpStringView kept = mlp_string_view_retain(borrowed);
+    memset(buffer, 'x', sizeof(buffer) - 1);  // Borrowed text changes
+
+    printf("  kept=\"%.*s\" (owned: %s)\n", (int)kept.length, kept.data, kept.owner ? "YES" : "NO");
+    int ok = kept.owner != NULL && mlp_string_view_equals(kept, mlp_string_view_borrow("text")) &&
+             borrowed.owner == NULL;
+
+    mlp_string_view_release(&kept);
+    mlp_string_view_release(&borrowed);  // No-op
+    report(ok);
+}
+
+void test_cstring_entry_points() {
+    printf("Test 6: C-String Char At\n");
+    const char* text = "MELP";
+    const char* m = mlp_string_char_at_view(text, 0);
+    const char* p = mlp_string_char_at_view(text, 3);
+
+    printf("  \"%s\" \"%s\"\n", m, p);
+    int ok = strcmp(m, "M") == 0 && strcmp(p, "P") == 0 &&
+             m == mlp_string_char_at_view("MLP", 0) &&   // Shared static table
+             strcmp(mlp_string_char_at_view(text, 4), "") == 0 &&
+             strcmp(mlp_string_char_at_view(text, (size_t)-1), "") == 0;
+
+    report(ok);
+}
+
+void test_kept_substring_outlives_parent() {
+    printf("Test 7: Kept Substring Outlives Its Parent\n");
+    MelpStr parent = mlp_str_concat(mlp_str_from_cstr("generated "), mlp_str_from_cstr("code"));
+    MelpStr view = mlp_str_substring(parent, 10, 4);
+    MelpStr kept = mlp_str_own(view);  // What generated code stores
+    int shared = view.data == parent.data + 10;
+    mlp_str_free(parent);
+
+    printf("  kept=\"%.*s\"\n", (int)kept.length, kept.data);
+    int ok = shared && kept.length == 4 && memcmp(kept.data, "code", 4) == 0;
+    mlp_str_free(kept);
+    report(ok);
+}
+
+int main() {
+    printf("=================================\n");
+    printf("MLP String View Test Suite\n");
+    printf("=================================\n\n");
+
+    test_substring_shares_text();
+    test_view_keeps_parent_alive();
+    test_cstr_copies_only_when_needed();
+    test_split_single_allocation();
+    test_borrowed_view_materializes();
+    test_cstring_entry_points();
+    test_kept_substring_outlives_parent();
+
+    printf("=================================\n");
+    if (failures == 0) {
+        printf("✅ All Tests Completed!\n");
+    } else {
+        printf("❌ %d test(s) failed\n", failures);
+    }
+    printf("=================================\n");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,325 @@
+// ============================================================================
+// BigDecimal Benchmark - STO Runtime
+// ============================================================================
+// Measures add, mul and compare on random operands of 20, 200 and 20000
+// decimal digits, then each multiplication / division algorithm against
+// the schoolbook path, string conversion up to a million digits, and a
+// ledger summation on the DECIMAL64 tier vs BigDecimal (with the BigDecimal
+// allocations made and avoided per entry, see sto_bigdec_get_stats()).
+// Each case runs until it has used ~0.2s of wall clock and reports the
+// mean time per operation.
+//
+// Usage: make bench   (or ./bench_bigdecimal [min_seconds])
+
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+#include "runtime_sto.h"
+#include "fixed_decimal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Deterministic operands (xorshift) so runs are comparable
+static uint64_t rng_state = 0x9E3779B97F4A7C15ULL;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static BigDecimal* random_bigdec(int digits) {
+    char* str = (char*)malloc(digits + 1);
+    str[0] = (char)('1' + rng_next() % 9);
+    for (int i = 1; i < digits; i++) {
+        str[i] = (char)('0' + rng_next() % 10);
+    }
+    str[digits] = '\0';
+
+    BigDecimal* bd = sto_bigdec_from_string(str);
+    free(str);
+    return bd;
+}
+
+// Sink so the optimizer cannot drop compare results
+static volatile int bench_sink;
+
+typedef enum { OP_ADD, OP_MUL, OP_COMPARE, OP_DIV } BenchOp;
+
+static const char* op_name(BenchOp op) {
+    switch (op) {
+        case OP_ADD: return "add";
+        case OP_MUL: return "mul";
+        case OP_COMPARE: return "compare";
+        case OP_DIV: return "div";
+    }
+    return "?";
+}
+
+static double bench_case(BenchOp op, BigDecimal* a, BigDecimal* b, double min_seconds) {
+    long iterations = 0;
+    double start = now_seconds();
+    double elapsed = 0.0;
+
+    do {
+        for (int i = 0; i < 16; i++) {
+            if (op == OP_COMPARE) {
+                bench_sink = sto_bigdec_compare(a, b);
+            } else {
+                BigDecimal* r = (op == OP_ADD) ? sto_bigdec_add(a, b)
+                              : (op == OP_MUL) ? sto_bigdec_mul(a, b)
+                              : sto_bigdec_div(a, b);
+                sto_bigdec_free(r);
+            }
+        }
+        iterations += 16;
+        elapsed = now_seconds() - start;
+    } while (elapsed < min_seconds);
+
+    return elapsed * 1e9 / (double)iterations;
+}
+
+// Ledger: sum of price * quantity over LEDGER_ENTRIES lines (scale 2 * 0)
+#define LEDGER_ENTRIES 100000
+
+typedef enum { LEDGER_DECIMAL64, LEDGER_TIERED, LEDGER_BIGDECIMAL, LEDGER_DOUBLE } LedgerPath;
+
+static const char* ledger_path_name(LedgerPath path) {
+    switch (path) {
+        case LEDGER_DECIMAL64: return "decimal64";
+        case LEDGER_TIERED: return "tiered";
+        case LEDGER_BIGDECIMAL: return "bigdecimal";
+        case LEDGER_DOUBLE: return "double";
+    }
+    return "?";
+}
+
+// One pass over the ledger; returns the total as text (caller frees)
+static char* ledger_run(LedgerPath path, const STODecimal64* prices, const STODecimal64* quantities) {
+    switch (path) {
+        case LEDGER_DECIMAL64: {
+            STODecimal64 total = { 0, 2 };
+            for (int i = 0; i < LEDGER_ENTRIES; i++) {
+                STODecimal64 line;
+                if (sto_dec64_mul(prices[i], quantities[i], &line) ||
+                    sto_dec64_add(total, line, &total)) {
+                    return NULL;
+                }
+            }
+            char buf[STO_DECIMAL_STRING_SIZE];
+            sto_dec64_format(total, buf);
+            char* str = (char*)malloc(strlen(buf) + 1);
+            strcpy(str, buf);
+            return str;
+        }
+        case LEDGER_TIERED: {
+            STODecimal64 zero = { 0, 2 };
+            STODecimal total = sto_decimal_from_dec64(zero);
+            for (int i = 0; i < LEDGER_ENTRIES; i++) {
+                STODecimal line = sto_decimal_mul(sto_decimal_from_dec64(prices[i]),
+                                                  sto_decimal_from_dec64(quantities[i]));
+                STODecimal next = sto_decimal_add(total, line);
+                sto_decimal_free(line);
+                sto_decimal_free(total);
+                total = next;
+            }
+            char* str = sto_decimal_to_string(total);
+            sto_decimal_free(total);
+            return str;
+        }
+        case LEDGER_BIGDECIMAL: {
+            // Operands arrive as BigDecimal like today's heap path
+            BigDecimal* total = sto_bigdec_from_int128_scaled(0, 2);
+            for (int i = 0; i < LEDGER_ENTRIES; i++) {
+                BigDecimal* price = sto_bigdec_from_int128_scaled(prices[i].units, prices[i].scale);
+                BigDecimal* quantity = sto_bigdec_from_int64(quantities[i].units);
+                BigDecimal* line = sto_bigdec_mul(price, quantity);
+                BigDecimal* next = sto_bigdec_add(total, line);
+                sto_bigdec_free(price);
+                sto_bigdec_free(quantity);
+                sto_bigdec_free(line);
+                sto_bigdec_free(total);
+                total = next;
+            }
+            char* str = sto_bigdec_to_string(total);
+            sto_bigdec_free(total);
+            return str;
+        }
+        case LEDGER_DOUBLE: {
+            double total = 0.0;
+            for (int i = 0; i < LEDGER_ENTRIES; i++) {
+                total += ((double)prices[i].units / 100.0) * (double)quantities[i].units;
+            }
+            char* str = (char*)malloc(64);
+            snprintf(str, 64, "%.2f", total);
+            return str;
+        }
+    }
+    return NULL;
+}
+
+static void bench_ledger(double min_seconds) {
+    STODecimal64* prices = (STODecimal64*)malloc(LEDGER_ENTRIES * sizeof(STODecimal64));
+    STODecimal64* quantities = (STODecimal64*)malloc(LEDGER_ENTRIES * sizeof(STODecimal64));
+    for (int i = 0; i < LEDGER_ENTRIES; i++) {
+        // -9999.99 .. 9999.99 (refunds included) times 1..100
+        prices[i].units = (int64_t)(rng_next() % 1999999) - 999999;
+        prices[i].scale = 2;
+        quantities[i].units = (int64_t)(rng_next() % 100) + 1;
+        quantities[i].scale = 0;
+    }
+
+    printf("\n%-10s %8s %16s %8s %8s  %s\n", "ledger", "entries", "ns/entry",
+           "allocs", "saved", "total");
+    char* reference = NULL;
+    const LedgerPath paths[] = { LEDGER_DECIMAL64, LEDGER_TIERED, LEDGER_BIGDECIMAL, LEDGER_DOUBLE };
+
+    for (size_t p = 0; p < sizeof(paths) / sizeof(paths[0]); p++) {
+        long runs = 0;
+        char* total = NULL;
+        sto_bigdec_reset_stats();
+        double start = now_seconds();
+        double elapsed = 0.0;
+        do {
+            free(total);
+            total = ledger_run(paths[p], prices, quantities);
+            runs++;
+            elapsed = now_seconds() - start;
+        } while (elapsed < min_seconds);
+
+        // BigDecimal allocations per entry: made (headers + limb buffers)
+        // and saved (inline limbs + stack values)
+        STOBigDecStats stats = sto_bigdec_get_stats();
+        double entries = (double)runs * LEDGER_ENTRIES;
+
+        // The first (DECIMAL64) total is the reference the others must match
+        if (p == 0) reference = total;
+        bool exact = total && reference && strcmp(total, reference) == 0;
+        printf("%-10s %8d %16.1f %8.2f %8.2f  %s%s\n", ledger_path_name(paths[p]), LEDGER_ENTRIES,
+               elapsed * 1e9 / entries, (stats.heap_values + stats.heap_limbs) / entries,
+               (stats.inline_limbs + stats.inline_values) / entries,
+               total ? total : "(overflow)", exact ? "" : "  (differs)");
+        if (total != reference) free(total);
+    }
+
+    free(reference);
+    free(prices);
+    free(quantities);
+}
+
+int main(int argc, char** argv) {
+    double min_seconds = (argc > 1) ? atof(argv[1]) : 0.2;
+    const int sizes[] = { 20, 200, 20000 };
+    const BenchOp ops[] = { OP_ADD, OP_MUL, OP_COMPARE };
+
+    printf("╔═══════════════════════════════════════════════════════╗\n");
+    printf("║       BigDecimal Benchmark - STO Runtime             ║\n");
+    printf("╚═══════════════════════════════════════════════════════╝\n");
+    printf("%-10s %8s %16s\n", "op", "digits", "ns/op");
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        BigDecimal* a = random_bigdec(sizes[s]);
+        BigDecimal* b = random_bigdec(sizes[s]);
+
+        for (size_t o = 0; o < sizeof(ops) / sizeof(ops[0]); o++) {
+            double ns = bench_case(ops[o], a, b, min_seconds);
+            printf("%-10s %8d %16.1f\n", op_name(ops[o]), sizes[s], ns);
+        }
+
+        sto_bigdec_free(a);
+        sto_bigdec_free(b);
+    }
+
+    // Multiplication algorithms (balanced operands)
+    const int mul_sizes[] = { 200, 500, 1000, 2000, 5000, 20000, 100000 };
+    const BigDecMulAlgorithm mul_algorithms[] = {
+        BIGDEC_MUL_SCHOOLBOOK, BIGDEC_MUL_KARATSUBA, BIGDEC_MUL_TOOM3, BIGDEC_MUL_AUTO
+    };
+    printf("\n%-10s %8s %16s %16s %16s %16s\n", "op", "digits",
+           "schoolbook", "karatsuba", "toom3", "auto");
+
+    for (size_t s = 0; s < sizeof(mul_sizes) / sizeof(mul_sizes[0]); s++) {
+        BigDecimal* a = random_bigdec(mul_sizes[s]);
+        BigDecimal* b = random_bigdec(mul_sizes[s]);
+
+        printf("%-10s %8d", "mul", mul_sizes[s]);
+        for (size_t m = 0; m < sizeof(mul_algorithms) / sizeof(mul_algorithms[0]); m++) {
+            sto_bigdec_set_mul_algorithm(mul_algorithms[m]);
+            printf(" %16.1f", bench_case(OP_MUL, a, b, min_seconds));
+        }
+        printf("\n");
+
+        sto_bigdec_free(a);
+        sto_bigdec_free(b);
+    }
+    sto_bigdec_set_mul_algorithm(BIGDEC_MUL_AUTO);
+
+    // Division algorithms (2n-digit dividend / n-digit divisor)
+    const int div_sizes[] = { 200, 1000, 2000, 5000, 20000, 50000 };
+    const BigDecDivAlgorithm div_algorithms[] = {
+        BIGDEC_DIV_SCHOOLBOOK, BIGDEC_DIV_NEWTON, BIGDEC_DIV_AUTO
+    };
+    printf("\n%-10s %8s %16s %16s %16s\n", "op", "digits", "schoolbook", "newton", "auto");
+
+    for (size_t s = 0; s < sizeof(div_sizes) / sizeof(div_sizes[0]); s++) {
+        BigDecimal* a = random_bigdec(2 * div_sizes[s]);
+        BigDecimal* b = random_bigdec(div_sizes[s]);
+
+        printf("%-10s %8d", "div", div_sizes[s]);
+        for (size_t d = 0; d < sizeof(div_algorithms) / sizeof(div_algorithms[0]); d++) {
+            sto_bigdec_set_div_algorithm(div_algorithms[d]);
+            printf(" %16.1f", bench_case(OP_DIV, a, b, min_seconds));
+        }
+        printf("\n");
+
+        sto_bigdec_free(a);
+        sto_bigdec_free(b);
+    }
+    sto_bigdec_set_div_algorithm(BIGDEC_DIV_AUTO);
+
+    // String conversion (divide and conquer), fprint streams to /dev/null
+    const int conv_sizes[] = { 200, 20000, 200000, 1000000 };
+    FILE* devnull = fopen("/dev/null", "w");
+    printf("\n%-10s %8s %16s %16s %16s\n", "op", "digits", "from_string", "to_string", "fprint");
+
+    for (size_t s = 0; s < sizeof(conv_sizes) / sizeof(conv_sizes[0]); s++) {
+        BigDecimal* a = random_bigdec(conv_sizes[s]);
+        char* text = sto_bigdec_to_string(a);
+        double ns[3];
+
+        for (int k = 0; k < 3; k++) {
+            long iterations = 0;
+            double start = now_seconds();
+            double elapsed = 0.0;
+            do {
+                if (k == 0) {
+                    sto_bigdec_free(sto_bigdec_from_string(text));
+                } else if (k == 1) {
+                    free(sto_bigdec_to_string(a));
+                } else if (devnull) {
+                    bench_sink = sto_bigdec_fprint(a, devnull);
+                }
+                iterations++;
+                elapsed = now_seconds() - start;
+            } while (elapsed < min_seconds);
+            ns[k] = elapsed * 1e9 / (double)iterations;
+        }
+        printf("%-10s %8d %16.1f %16.1f %16.1f\n", "convert", conv_sizes[s], ns[0], ns[1], ns[2]);
+
+        free(text);
+        sto_bigdec_free(a);
+    }
+    if (devnull) fclose(devnull);
+
+    bench_ledger(min_seconds);
+
+    return 0;
+}
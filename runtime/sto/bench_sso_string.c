@@ -0,0 +1,167 @@
+// ============================================================================
+// SSO String Benchmark - STO Runtime
+// ============================================================================
+// Time and heap allocations per operation for the 24-byte by-value
+// SSOString: create / concat / substring / copy on short (inline) and long
+// (heap) strings, then building a 10 KB string by append in place vs
+// repeated concatenation. The "boxed" rows malloc the SSOString itself,
+// which is what the old pointer API did for every result.
+// Each case runs until it has used ~0.2s of wall clock.
+//
+// Usage: make bench   (or ./bench_sso_string [min_seconds])
+
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+#include "sso_string.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Sink so the optimizer cannot drop results
+static volatile size_t bench_sink;
+
+typedef enum {
+    OP_CREATE, OP_CONCAT, OP_SUBSTRING, OP_COPY, OP_BOXED_CREATE, OP_BOXED_CONCAT
+} BenchOp;
+
+static const char* op_name(BenchOp op) {
+    switch (op) {
+        case OP_CREATE: return "create";
+        case OP_CONCAT: return "concat";
+        case OP_SUBSTRING: return "substring";
+        case OP_COPY: return "copy";
+        case OP_BOXED_CREATE: return "boxed create";
+        case OP_BOXED_CONCAT: return "boxed concat";
+    }
+    return "?";
+}
+
+static void run_op(BenchOp op, const char* text, const SSOString* a, const SSOString* b) {
+    switch (op) {
+        case OP_CREATE: {
+            SSOString s = sto_sso_create(text);
+            bench_sink = sto_sso_length(&s);
+            sto_sso_free(&s);
+            break;
+        }
+        case OP_CONCAT: {
+            SSOString s = sto_sso_concat(a, b);
+            bench_sink = sto_sso_length(&s);
+            sto_sso_free(&s);
+            break;
+        }
+        case OP_SUBSTRING: {
+            SSOString s = sto_sso_substring(a, 1, sto_sso_length(a) - 2);
+            bench_sink = sto_sso_length(&s);
+            sto_sso_free(&s);
+            break;
+        }
+        case OP_COPY: {
+            SSOString s = sto_sso_copy(a);
+            bench_sink = sto_sso_length(&s);
+            sto_sso_free(&s);
+            break;
+        }
+        case OP_BOXED_CREATE:
+        case OP_BOXED_CONCAT: {
+            SSOString* s = (SSOString*)malloc(sizeof(SSOString));
+            *s = (op == OP_BOXED_CREATE) ? sto_sso_create(text) : sto_sso_concat(a, b);
+            bench_sink = sto_sso_length(s);
+            sto_sso_free(s);
+            free(s);
+            break;
+        }
+    }
+}
+
+static void bench_op(BenchOp op, const char* size_name, const char* text, double min_seconds) {
+    SSOString a = sto_sso_create(text);
+    SSOString b = sto_sso_create(text);
+
+    sto_sso_reset_stats();
+    long iterations = 0;
+    double start = now_seconds();
+    double elapsed = 0.0;
+    do {
+        for (int i = 0; i < 64; i++) {
+            run_op(op, text, &a, &b);
+        }
+        iterations += 64;
+        elapsed = now_seconds() - start;
+    } while (elapsed < min_seconds);
+
+    // Boxed rows add their own struct allocation
+    STOSSOStats stats = sto_sso_get_stats();
+    double allocs = (double)stats.heap_allocations / (double)iterations;
+    if (op == OP_BOXED_CREATE || op == OP_BOXED_CONCAT) allocs += 1.0;
+
+    printf("%-14s %-6s %12.1f %10.2f\n", op_name(op), size_name,
+           elapsed * 1e9 / (double)iterations, allocs);
+
+    sto_sso_free(&a);
+    sto_sso_free(&b);
+}
+
+// Build a BUILD_PIECES * 10 byte string; append in place vs s = s + piece
+#define BUILD_PIECES 1000
+
+static void bench_build(bool in_place, double min_seconds) {
+    SSOString piece = sto_sso_create("0123456789");
+
+    sto_sso_reset_stats();
+    long runs = 0;
+    double start = now_seconds();
+    double elapsed = 0.0;
+    do {
+        SSOString s = sto_sso_create("");
+        for (int i = 0; i < BUILD_PIECES; i++) {
+            if (in_place) {
+                sto_sso_append_sso(&s, &piece);
+            } else {
+                SSOString next = sto_sso_concat(&s, &piece);
+                sto_sso_free(&s);
+                s = next;
+            }
+        }
+        bench_sink = sto_sso_length(&s);
+        sto_sso_free(&s);
+        runs++;
+        elapsed = now_seconds() - start;
+    } while (elapsed < min_seconds);
+
+    STOSSOStats stats = sto_sso_get_stats();
+    double pieces = (double)runs * BUILD_PIECES;
+    printf("%-14s %-6s %12.1f %10.2f\n", in_place ? "build append" : "build concat", "10KB",
+           elapsed * 1e9 / pieces, (double)stats.heap_allocations / pieces);
+
+    sto_sso_free(&piece);
+}
+
+int main(int argc, char** argv) {
+    double min_seconds = (argc > 1) ? atof(argv[1]) : 0.2;
+
+    const char* short_text = "hello world";                                   // 11 bytes
+    const char* long_text = "the quick brown fox jumps over the lazy dog";    // 43 bytes
+
+    printf("%-14s %-6s %12s %10s\n", "op", "size", "ns/op", "allocs/op");
+    const BenchOp ops[] = {
+        OP_CREATE, OP_BOXED_CREATE, OP_CONCAT, OP_BOXED_CONCAT, OP_SUBSTRING, OP_COPY
+    };
+    for (size_t i = 0; i < sizeof(ops) / sizeof(ops[0]); i++) {
+        bench_op(ops[i], "short", short_text, min_seconds);
+        bench_op(ops[i], "long", long_text, min_seconds);
+    }
+
+    printf("\n%-14s %-6s %12s %10s\n", "build", "size", "ns/piece", "allocs/piece");
+    bench_build(true, min_seconds);
+    bench_build(false, min_seconds);
+
+    return 0;
+}
@@ -0,0 +1,233 @@
+// ============================================================================
+// Pool Allocator Benchmark - STO Runtime
+// ============================================================================
+// ns per allocation+free for allocation patterns of MLP programs, each run
+// once through the size-class pool (sto_pool.h) and once through glibc
+// malloc/free with the same sizes and order:
+//   bigdecimal  header + limb buffer per temporary, freed right away (LIFO)
+//   optionals   10000 small headers alive at once, freed oldest first (FIFO)
+//   string      a buffer grown by doubling from 24 bytes to 4 KB, then freed
+//   list        list header + 16-byte element buffer grown 4 -> 64 slots
+//   state       4096 live entries (header, key, value), random replacement
+// Each case runs until it has used ~0.2s of wall clock. The last lines show
+// the pool's per-type statistics after the run.
+//
+// Usage: make bench   (or ./bench_sto_pool [min_seconds])
+
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+#include "sto_runtime.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Sink so the optimizer cannot drop results
+static volatile uintptr_t bench_sink;
+
+// ---------------------------------------------------------------------------
+// The two allocators behind one interface
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    const char* name;
+    void* (*alloc)(size_t size, STOPoolType type);
+    void* (*realloc)(void* ptr, size_t old_size, size_t new_size, STOPoolType type);
+    void (*free)(void* ptr, size_t size, STOPoolType type);
+} Allocator;
+
+static void* libc_alloc(size_t size, STOPoolType type) {
+    (void)type;
+    return malloc(size);
+}
+
+static void* libc_realloc(void* ptr, size_t old_size, size_t new_size, STOPoolType type) {
+    (void)old_size; (void)type;
+    return realloc(ptr, new_size);
+}
+
+static void libc_free(void* ptr, size_t size, STOPoolType type) {
+    (void)size; (void)type;
+    free(ptr);
+}
+
+static const Allocator allocators[2] = {
+    { "malloc", libc_alloc, libc_realloc, libc_free },
+    { "pool", sto_pool_alloc, sto_pool_realloc, sto_pool_free }
+};
+
+// ---------------------------------------------------------------------------
+// Workloads: each returns the number of allocations it made
+// ---------------------------------------------------------------------------
+
+static size_t run_bigdecimal(const Allocator* a) {
+    size_t n = 0;
+    for (int i = 0; i < 1000; i++) {
+        size_t limbs = 4 * (size_t)(4 + (i & 7));       // 16..44 bytes of limbs
+        void* header = a->alloc(sizeof(BigDecimal), STO_POOL_BIGDECIMAL);
+        void* digits = a->alloc(limbs, STO_POOL_BIGDECIMAL);
+        bench_sink += (uintptr_t)header ^ (uintptr_t)digits;
+        a->free(digits, limbs, STO_POOL_BIGDECIMAL);
+        a->free(header, sizeof(BigDecimal), STO_POOL_BIGDECIMAL);
+        n += 2;
+    }
+    return n;
+}
+
+enum { OPTIONALS = 10000, OPTIONAL_SIZE = 24 };
+static void* optionals[OPTIONALS];
+
+static size_t run_optionals(const Allocator* a) {
+    for (int i = 0; i < OPTIONALS; i++) {
+        optionals[i] = a->alloc(OPTIONAL_SIZE, STO_POOL_OPTIONAL);
+        memset(optionals[i], 0, OPTIONAL_SIZE);
+    }
+    for (int i = 0; i < OPTIONALS; i++) {
+        a->free(optionals[i], OPTIONAL_SIZE, STO_POOL_OPTIONAL);
+    }
+    return OPTIONALS;
+}
+
+static size_t run_string(const Allocator* a) {
+    size_t n = 0;
+    for (int i = 0; i < 100; i++) {
+        size_t capacity = 24;
+        char* buffer = a->alloc(capacity, STO_POOL_STRING);
+        n++;
+        while (capacity < 4096) {
+            buffer = a->realloc(buffer, capacity, capacity * 2, STO_POOL_STRING);
+            buffer[capacity] = 'x';
+            capacity *= 2;
+            n++;
+        }
+        bench_sink += (uintptr_t)buffer[24];
+        a->free(buffer, capacity, STO_POOL_STRING);
+    }
+    return n;
+}
+
+static size_t run_list(const Allocator* a) {
+    size_t n = 0;
+    for (int i = 0; i < 200; i++) {
+        void* header = a->alloc(sizeof(STOList), STO_POOL_LIST);
+        size_t capacity = 4;
+        STOValue* values = a->alloc(capacity * sizeof(STOValue), STO_POOL_LIST);
+        n += 2;
+        while (capacity < 64) {
+            values = a->realloc(values, capacity * sizeof(STOValue),
+                                capacity * 2 * sizeof(STOValue), STO_POOL_LIST);
+            values[capacity] = sto_value_int64(i);
+            capacity *= 2;
+            n++;
+        }
+        bench_sink += (uintptr_t)values[4].as.i64;
+        a->free(values, capacity * sizeof(STOValue), STO_POOL_LIST);
+        a->free(header, sizeof(STOList), STO_POOL_LIST);
+    }
+    return n;
+}
+
+enum { STATE_LIVE = 4096, STATE_ENTRY = 64 };
+typedef struct { void* entry; void* key; void* value; size_t key_size, value_size; } StateSlot;
+static StateSlot state_slots[STATE_LIVE];
+
+static uint32_t rng_state = 12345;
+static uint32_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static void state_fill(const Allocator* a, StateSlot* slot) {
+    slot->key_size = 8 + rng_next() % 24;
+    slot->value_size = 24 + rng_next() % 200;
+    slot->entry = a->alloc(STATE_ENTRY, STO_POOL_STATE);
+    slot->key = a->alloc(slot->key_size, STO_POOL_STATE);
+    slot->value = a->alloc(slot->value_size, STO_POOL_STATE);
+}
+
+static void state_clear(const Allocator* a, StateSlot* slot) {
+    a->free(slot->value, slot->value_size, STO_POOL_STATE);
+    a->free(slot->key, slot->key_size, STO_POOL_STATE);
+    a->free(slot->entry, STATE_ENTRY, STO_POOL_STATE);
+}
+
+static size_t run_state(const Allocator* a) {
+    for (int i = 0; i < 1000; i++) {
+        StateSlot* slot = &state_slots[rng_next() % STATE_LIVE];
+        state_clear(a, slot);
+        state_fill(a, slot);
+    }
+    return 3000;
+}
+
+typedef struct {
+    const char* name;
+    size_t (*run)(const Allocator* a);
+    bool live_set;    // state_slots must be filled before and emptied after
+} Workload;
+
+static const Workload workloads[] = {
+    { "bigdecimal", run_bigdecimal, false },
+    { "optionals", run_optionals, false },
+    { "string", run_string, false },
+    { "list", run_list, false },
+    { "state", run_state, true },
+};
+
+static double time_workload(const Workload* w, const Allocator* a, double min_seconds) {
+    if (w->live_set) {
+        rng_state = 12345;
+        for (int i = 0; i < STATE_LIVE; i++) state_fill(a, &state_slots[i]);
+    }
+    w->run(a);  // warm up
+
+    size_t allocations = 0;
+    double start = now_seconds();
+    double elapsed;
+    do {
+        for (int r = 0; r < 16; r++) allocations += w->run(a);
+        elapsed = now_seconds() - start;
+    } while (elapsed < min_seconds);
+
+    if (w->live_set) {
+        for (int i = 0; i < STATE_LIVE; i++) state_clear(a, &state_slots[i]);
+    }
+    return elapsed * 1e9 / (double)allocations;
+}
+
+int main(int argc, char** argv) {
+    double min_seconds = argc > 1 ? atof(argv[1]) : 0.2;
+    if (min_seconds <= 0) min_seconds = 0.2;
+
+    printf("Runtime allocation patterns: glibc malloc vs size-class pool\n");
+    printf("(ns per allocation, including its free)\n\n");
+    printf("%-12s %10s %10s %9s\n", "workload", "malloc", "pool", "speedup");
+
+    for (size_t w = 0; w < sizeof(workloads) / sizeof(workloads[0]); w++) {
+        double ns[2];
+        for (int a = 0; a < 2; a++) {
+            ns[a] = time_workload(&workloads[w], &allocators[a], min_seconds);
+        }
+        printf("%-12s %10.2f %10.2f %8.2fx\n", workloads[w].name, ns[0], ns[1], ns[0] / ns[1]);
+    }
+
+    STOPoolStats stats = sto_pool_get_stats();
+    printf("\nPool statistics after the run (slabs: %zu KB, large: %zu)\n",
+           stats.slab_bytes / 1024, stats.large_allocations);
+    printf("%-12s %10s %10s %12s %14s\n", "type", "live", "live B", "peak B", "allocations");
+    for (int t = 0; t < STO_POOL_TYPE_COUNT; t++) {
+        const STOPoolTypeStats* s = &stats.types[t];
+        if (s->total_allocations == 0) continue;
+        printf("%-12s %10zu %10zu %12zu %14zu\n", sto_pool_type_name((STOPoolType)t),
+               s->live_count, s->live_bytes, s->peak_bytes, s->total_allocations);
+    }
+    return 0;
+}
@@ -0,0 +1,155 @@
+// ============================================================================
+// Heterogeneous List Benchmark - STO Runtime
+// ============================================================================
+// Build and scan a mixed list (int64 / double / boolean / short string)
+// stored as 16-byte STOValues, against the old layout: a void* per element
+// pointing at its own 8-byte malloc plus a parallel type byte array. The
+// scan sums the numbers and counts string bytes, touching every element.
+//
+// Usage: make bench   (or ./bench_sto_value [elements], default 1000000)
+
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+#include "sto_runtime.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Sink so the optimizer cannot drop results
+static volatile double bench_sink;
+
+static const char* const words[4] = { "alpha", "beta", "gamma", "delta" };
+
+// ---------------------------------------------------------------------------
+// Old layout: boxed elements
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    void** elements;
+    uint8_t* types;
+    size_t count;
+} BoxedList;
+
+static BoxedList boxed_build(size_t n) {
+    BoxedList list = { malloc(n * sizeof(void*)), malloc(n), n };
+    for (size_t i = 0; i < n; i++) {
+        void* box = malloc(8);
+        switch (i % 4) {
+            case 0: { int64_t v = (int64_t)i; memcpy(box, &v, 8); list.types[i] = INTERNAL_TYPE_INT64; break; }
+            case 1: { double v = (double)i * 0.5; memcpy(box, &v, 8); list.types[i] = INTERNAL_TYPE_DOUBLE; break; }
+            case 2: { int64_t v = (int64_t)(i & 8); memcpy(box, &v, 8); list.types[i] = INTERNAL_TYPE_BOOLEAN; break; }
+            default: { const char* w = words[i % 4]; memcpy(box, &w, 8); list.types[i] = INTERNAL_TYPE_RODATA_STRING; break; }
+        }
+        list.elements[i] = box;
+    }
+    return list;
+}
+
+static double boxed_scan(const BoxedList* list) {
+    double sum = 0;
+    for (size_t i = 0; i < list->count; i++) {
+        const void* box = list->elements[i];
+        switch (list->types[i]) {
+            case INTERNAL_TYPE_INT64: sum += (double)*(const int64_t*)box; break;
+            case INTERNAL_TYPE_DOUBLE: sum += *(const double*)box; break;
+            case INTERNAL_TYPE_BOOLEAN: sum += *(const int64_t*)box != 0; break;
+            default: sum += (double)strlen(*(const char* const*)box); break;
+        }
+    }
+    return sum;
+}
+
+static void boxed_free(BoxedList* list) {
+    for (size_t i = 0; i < list->count; i++) free(list->elements[i]);
+    free(list->elements);
+    free(list->types);
+}
+
+// ---------------------------------------------------------------------------
+// Tagged values
+// ---------------------------------------------------------------------------
+
+static STOList* tagged_build(size_t n) {
+    STOList* list = sto_list_alloc(n);
+    for (size_t i = 0; i < n; i++) {
+        switch (i % 4) {
+            case 0: sto_list_append_value(list, sto_value_int64((int64_t)i)); break;
+            case 1: sto_list_append_value(list, sto_value_double((double)i * 0.5)); break;
+            case 2: sto_list_append_value(list, sto_value_bool((i & 8) != 0)); break;
+            default: sto_list_append_value(list, sto_value_cstring(words[i % 4])); break;
+        }
+    }
+    return list;
+}
+
+static double tagged_scan(const STOList* list) {
+    double sum = 0;
+    for (size_t i = 0; i < list->count; i++) {
+        const STOValue* value = &list->values[i];
+        switch (value->kind) {
+            case STO_VALUE_INT64: sum += (double)value->as.i64; break;
+            case STO_VALUE_DOUBLE: sum += value->as.f64; break;
+            case STO_VALUE_BOOLEAN: sum += value->as.boolean; break;
+            default: {
+                size_t length;
+                sto_value_string_data(value, &length);
+                sum += (double)length;
+                break;
+            }
+        }
+    }
+    return sum;
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? (size_t)atol(argv[1]) : 1000000;
+    if (n < 4) n = 4;
+    const int rounds = 10;
+
+    printf("Heterogeneous list, %zu elements (ns/element, best of %d)\n\n", n, rounds);
+    printf("%-8s %10s %10s %10s\n", "layout", "build", "scan", "free");
+
+    double best[2][3] = { { 1e30, 1e30, 1e30 }, { 1e30, 1e30, 1e30 } };
+    for (int r = 0; r < rounds; r++) {
+        double t0 = now_seconds();
+        BoxedList boxed = boxed_build(n);
+        double t1 = now_seconds();
+        bench_sink += boxed_scan(&boxed);
+        double t2 = now_seconds();
+        boxed_free(&boxed);
+        double t3 = now_seconds();
+        double boxed_times[3] = { t1 - t0, t2 - t1, t3 - t2 };
+
+        t0 = now_seconds();
+        STOList* tagged = tagged_build(n);
+        t1 = now_seconds();
+        bench_sink += tagged_scan(tagged);
+        t2 = now_seconds();
+        sto_list_free(tagged);
+        t3 = now_seconds();
+        double tagged_times[3] = { t1 - t0, t2 - t1, t3 - t2 };
+
+        for (int k = 0; k < 3; k++) {
+            if (boxed_times[k] < best[0][k]) best[0][k] = boxed_times[k];
+            if (tagged_times[k] < best[1][k]) best[1][k] = tagged_times[k];
+        }
+    }
+
+    const char* names[2] = { "boxed", "tagged" };
+    for (int layout = 0; layout < 2; layout++) {
+        printf("%-8s", names[layout]);
+        for (int k = 0; k < 3; k++) {
+            printf(" %10.2f", best[layout][k] * 1e9 / (double)n);
+        }
+        printf("\n");
+    }
+    printf("\nscan speedup: %.2fx\n", best[0][1] / best[1][1]);
+    return 0;
+}
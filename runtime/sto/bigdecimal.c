@@ -2,305 +2,1573 @@
 // BigDecimal - Arbitrary Precision Arithmetic
 // ============================================================================
 // Full implementation of arbitrary precision decimal numbers
-// String-based representation for unlimited precision
+// Binary magnitude in base-2^32 limbs + decimal scale (see bigdecimal.h)
+//
+// Arithmetic never touches decimal digits: scales are aligned by multiplying
+// the magnitude with powers of ten, and text is produced only by
+// sto_bigdec_to_string() / sto_bigdec_fprint() and parsed only by
+// sto_bigdec_from_string().
+//
+// Multiplication: schoolbook -> Karatsuba -> Toom-3 by operand size.
+// Division: Knuth Algorithm D, or Newton reciprocal + Barrett steps for
+// large operands. See sto_bigdec_set_mul/div_algorithm().
+// Decimal text <-> limbs: divide and conquer at cached powers of ten, so
+// million-digit values parse and print in O(M(n) log n).
 //
 // Architecture: Modular STO Runtime Component
 // Author: MLP Compiler Team
 // Date: 7 Aralık 2025
 
-#define _POSIX_C_SOURCE 200809L  // For strdup
-
 #include "runtime_sto.h"
+#include "sto_pool.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
-#include <ctype.h>
+#include <limits.h>
+
+// Largest power of ten that fits in a limb, used for decimal <-> binary
+#define DEC_CHUNK 1000000000u
+#define DEC_CHUNK_DIGITS 9
+
+static const uint32_t pow10_u32[DEC_CHUNK_DIGITS + 1] = {
+    1u, 10u, 100u, 1000u, 10000u, 100000u,
+    1000000u, 10000000u, 100000000u, 1000000000u
+};
+
+// Crossover points in limbs (smaller operand), measured with bench_bigdecimal
+#define KARATSUBA_THRESHOLD 32
+#define TOOM3_THRESHOLD 128
+#define NEWTON_DIV_THRESHOLD 768
+
+// A forced division algorithm applies from this divisor size up
+#define FORCED_NEWTON_MIN 2
+
+// Reciprocals up to this many limbs come straight from Algorithm D
+#define NEWTON_RECIPROCAL_BASE 16
+
+static int karatsuba_threshold = KARATSUBA_THRESHOLD;
+static int toom3_threshold = TOOM3_THRESHOLD;
+static int newton_div_threshold = NEWTON_DIV_THRESHOLD;
+
+static STOBigDecStats bigdec_stats = {0};
 
 // ============================================================================
-// Helper Functions - String Arithmetic
+// Helper Functions - Limb (Magnitude) Arithmetic
 // ============================================================================
+// Magnitudes are little-endian uint32_t arrays; 'n' is the number of limbs.
+
+// Length without leading (most significant) zero limbs
+static int mag_trim(const uint32_t* a, int n) {
+    while (n > 0 && a[n - 1] == 0) {
+        n--;
+    }
+    return n;
+}
+
+// Compare two trimmed magnitudes
+// Returns: -1 if a < b, 0 if a == b, 1 if a > b
+static int mag_compare(const uint32_t* a, int na, const uint32_t* b, int nb) {
+    if (na != nb) return na > nb ? 1 : -1;
 
-// Reverse a string in place
-static void reverse_string(char* str, int length) {
-    int start = 0;
-    int end = length - 1;
-    while (start < end) {
-        char temp = str[start];
-        str[start] = str[end];
-        str[end] = temp;
-        start++;
-        end--;
+    for (int i = na - 1; i >= 0; i--) {
+        if (a[i] != b[i]) return a[i] > b[i] ? 1 : -1;
     }
+    return 0;
 }
 
-// Remove leading zeros from string
-static void remove_leading_zeros(char* str) {
+// r = a + b (requires na >= nb, r holds na + 1 limbs; r may alias a)
+// Returns number of limbs used
+static int mag_add(uint32_t* r, const uint32_t* a, int na, const uint32_t* b, int nb) {
+    uint64_t carry = 0;
     int i = 0;
-    while (str[i] == '0' && str[i + 1] != '\0') {
-        i++;
+
+    for (; i < nb; i++) {
+        carry += (uint64_t)a[i] + b[i];
+        r[i] = (uint32_t)carry;
+        carry >>= 32;
     }
-    if (i > 0) {
-        memmove(str, str + i, strlen(str) - i + 1);
+    for (; i < na; i++) {
+        carry += a[i];
+        r[i] = (uint32_t)carry;
+        carry >>= 32;
     }
+
+    r[na] = (uint32_t)carry;
+    return na + (carry != 0);
 }
 
-// Compare two positive number strings by magnitude
-// Returns: -1 if a < b, 0 if a == b, 1 if a > b
-static int compare_magnitude(const char* a, const char* b) {
-    int len_a = strlen(a);
-    int len_b = strlen(b);
-    
-    // Different lengths - longer is bigger
-    if (len_a > len_b) return 1;
-    if (len_a < len_b) return -1;
-    
-    // Same length - lexicographic comparison
-    return strcmp(a, b);
-}
-
-// Add two positive number strings
-static char* add_positive(const char* a, const char* b) {
-    int len_a = strlen(a);
-    int len_b = strlen(b);
-    int max_len = (len_a > len_b ? len_a : len_b) + 2;  // +1 for carry, +1 for null
-    
-    char* result = (char*)calloc(max_len, sizeof(char));
-    if (!result) return NULL;
-    
-    int i = len_a - 1;
-    int j = len_b - 1;
-    int k = 0;
-    int carry = 0;
-    
-    // Add digit by digit from right to left
-    while (i >= 0 || j >= 0 || carry) {
-        int digit_a = (i >= 0) ? (a[i] - '0') : 0;
-        int digit_b = (j >= 0) ? (b[j] - '0') : 0;
-        
-        int sum = digit_a + digit_b + carry;
-        result[k++] = (sum % 10) + '0';
-        carry = sum / 10;
-        
-        i--;
-        j--;
-    }
-    
-    result[k] = '\0';
-    reverse_string(result, k);
-    remove_leading_zeros(result);
-    
-    return result;
+// r = a - b (requires a >= b; r may alias a)
+// Returns number of limbs used
+static int mag_sub(uint32_t* r, const uint32_t* a, int na, const uint32_t* b, int nb) {
+    uint64_t borrow = 0;
+    int i = 0;
+
+    for (; i < nb; i++) {
+        uint64_t diff = (uint64_t)a[i] - b[i] - borrow;
+        r[i] = (uint32_t)diff;
+        borrow = diff >> 63;
+    }
+    for (; i < na; i++) {
+        uint64_t diff = (uint64_t)a[i] - borrow;
+        r[i] = (uint32_t)diff;
+        borrow = diff >> 63;
+    }
+
+    return mag_trim(r, na);
 }
 
-// Subtract two positive number strings (assumes a >= b)
-static char* subtract_positive(const char* a, const char* b) {
-    int len_a = strlen(a);
-    int len_b = strlen(b);
-    int max_len = len_a + 1;  // +1 for null terminator
-    
-    char* result = (char*)calloc(max_len, sizeof(char));
-    if (!result) return NULL;
-    
-    int i = len_a - 1;
-    int j = len_b - 1;
-    int k = 0;
-    int borrow = 0;
-    
-    // Subtract digit by digit from right to left
-    while (i >= 0) {
-        int digit_a = a[i] - '0';
-        int digit_b = (j >= 0) ? (b[j] - '0') : 0;
-        
-        int diff = digit_a - digit_b - borrow;
-        
-        if (diff < 0) {
-            diff += 10;
-            borrow = 1;
-        } else {
-            borrow = 0;
+// r[0..nr) += a[0..na) (requires na <= nr and no carry out of r)
+static void mag_add_into(uint32_t* r, int nr, const uint32_t* a, int na) {
+    uint64_t carry = 0;
+    int i = 0;
+
+    for (; i < na; i++) {
+        carry += (uint64_t)r[i] + a[i];
+        r[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    for (; carry && i < nr; i++) {
+        carry += r[i];
+        r[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+}
+
+// r[0..nr) -= a[0..na) (requires r >= a)
+static void mag_sub_into(uint32_t* r, int nr, const uint32_t* a, int na) {
+    uint64_t borrow = 0;
+    int i = 0;
+
+    for (; i < na; i++) {
+        uint64_t diff = (uint64_t)r[i] - a[i] - borrow;
+        r[i] = (uint32_t)diff;
+        borrow = diff >> 63;
+    }
+    for (; borrow && i < nr; i++) {
+        uint64_t diff = (uint64_t)r[i] - borrow;
+        r[i] = (uint32_t)diff;
+        borrow = diff >> 63;
+    }
+}
+
+// r = a * b, picks the algorithm by size (r must hold na + nb zeroed limbs)
+static void mag_mul(uint32_t* r, const uint32_t* a, int na, const uint32_t* b, int nb);
+
+// r = a * b, schoolbook (r must hold na + nb zeroed limbs, no aliasing)
+static void mag_mul_schoolbook(uint32_t* r, const uint32_t* a, int na, const uint32_t* b, int nb) {
+    for (int i = 0; i < na; i++) {
+        uint64_t ai = a[i];
+        uint64_t carry = 0;
+
+        if (ai == 0) continue;
+
+        // ai * b[j] + r[i + j] + carry never exceeds 2^64 - 1
+        for (int j = 0; j < nb; j++) {
+            carry += ai * b[j] + r[i + j];
+            r[i + j] = (uint32_t)carry;
+            carry >>= 32;
         }
-        
-        result[k++] = diff + '0';
-        
-        i--;
-        j--;
-    }
-    
-    result[k] = '\0';
-    reverse_string(result, k);
-    remove_leading_zeros(result);
-    
-    // Handle case where result is "0"
-    if (result[0] == '\0') {
-        result[0] = '0';
-        result[1] = '\0';
-    }
-    
-    return result;
+        r[i + nb] = (uint32_t)carry;
+    }
 }
 
-// Multiply two positive number strings
-static char* multiply_positive(const char* a, const char* b) {
-    int len_a = strlen(a);
-    int len_b = strlen(b);
-    int result_len = len_a + len_b + 1;  // Maximum possible length
-    
-    int* result = (int*)calloc(result_len, sizeof(int));
-    if (!result) return NULL;
-    
-    // Multiply digit by digit
-    for (int i = len_a - 1; i >= 0; i--) {
-        for (int j = len_b - 1; j >= 0; j--) {
-            int digit_a = a[i] - '0';
-            int digit_b = b[j] - '0';
-            
-            int product = digit_a * digit_b;
-            int pos = (len_a - 1 - i) + (len_b - 1 - j);
-            
-            result[pos] += product;
-            
-            // Handle carry
-            while (result[pos] >= 10) {
-                result[pos + 1] += result[pos] / 10;
-                result[pos] %= 10;
-                pos++;
+// a = a * m + add (in place)
+// Returns the carry-out limb (the caller appends it when non-zero)
+static uint32_t mag_mul_small(uint32_t* a, int n, uint32_t m, uint32_t add) {
+    uint64_t carry = add;
+
+    for (int i = 0; i < n; i++) {
+        carry += (uint64_t)a[i] * m;
+        a[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    return (uint32_t)carry;
+}
+
+// a = a / d (in place)
+// Returns the remainder
+static uint32_t mag_divmod_small(uint32_t* a, int n, uint32_t d) {
+    uint64_t rem = 0;
+
+    for (int i = n - 1; i >= 0; i--) {
+        uint64_t cur = (rem << 32) | a[i];
+        a[i] = (uint32_t)(cur / d);
+        rem = cur % d;
+    }
+    return (uint32_t)rem;
+}
+
+// Left shift needed to set the top bit of v's most significant limb
+static int mag_normalize_shift(const uint32_t* v, int nv) {
+    int s = 0;
+    while (((v[nv - 1] << s) & 0x80000000u) == 0) {
+        s++;
+    }
+    return s;
+}
+
+// r = a << s for 0 <= s < 32 (r holds n + 1 limbs, no aliasing)
+static void mag_shl(uint32_t* r, const uint32_t* a, int n, int s) {
+    r[n] = s ? a[n - 1] >> (32 - s) : 0;
+    for (int i = n - 1; i > 0; i--) {
+        r[i] = (a[i] << s) | (s ? a[i - 1] >> (32 - s) : 0);
+    }
+    r[0] = a[0] << s;
+}
+
+// r = a >> s for 0 <= s < 32 (a holds n + 1 limbs)
+static void mag_shr(uint32_t* r, const uint32_t* a, int n, int s) {
+    for (int i = 0; i < n; i++) {
+        r[i] = (a[i] >> s) | (s ? a[i + 1] << (32 - s) : 0);
+    }
+}
+
+// q = u / v, r = u % v (Knuth TAOCP vol. 2, 4.3.1 Algorithm D)
+// Requires nu >= nv >= 1 and v[nv - 1] != 0. q holds nu - nv + 1 limbs,
+// r (optional) holds nv limbs.
+static bool mag_divmod_schoolbook(uint32_t* q, uint32_t* r,
+                                  const uint32_t* u, int nu, const uint32_t* v, int nv) {
+    if (nv == 1) {
+        memcpy(q, u, nu * sizeof(uint32_t));
+        uint32_t rem = mag_divmod_small(q, nu, v[0]);
+        if (r) r[0] = rem;
+        return true;
+    }
+
+    uint32_t* vn = (uint32_t*)malloc((nv + 1) * sizeof(uint32_t));
+    uint32_t* un = (uint32_t*)malloc((nu + 1) * sizeof(uint32_t));
+    if (!vn || !un) {
+        free(vn);
+        free(un);
+        return false;
+    }
+
+    // D1: normalize so the top bit of the divisor is set
+    int s = mag_normalize_shift(v, nv);
+    mag_shl(vn, v, nv, s);
+    mag_shl(un, u, nu, s);
+
+    for (int j = nu - nv; j >= 0; j--) {
+        // D3: estimate qhat from the top two limbs, correct at most twice
+        uint64_t num = ((uint64_t)un[j + nv] << 32) | un[j + nv - 1];
+        uint64_t qhat = num / vn[nv - 1];
+        uint64_t rhat = num % vn[nv - 1];
+
+        while (qhat > 0xFFFFFFFFu ||
+               qhat * vn[nv - 2] > ((rhat << 32) | un[j + nv - 2])) {
+            qhat--;
+            rhat += vn[nv - 1];
+            if (rhat > 0xFFFFFFFFu) break;
+        }
+
+        // D4: multiply and subtract
+        int64_t borrow = 0;
+        int64_t t;
+        for (int i = 0; i < nv; i++) {
+            uint64_t p = qhat * vn[i];
+            t = (int64_t)un[i + j] - borrow - (int64_t)(p & 0xFFFFFFFFu);
+            un[i + j] = (uint32_t)t;
+            borrow = (int64_t)(p >> 32) - (t >> 32);
+        }
+        t = (int64_t)un[j + nv] - borrow;
+        un[j + nv] = (uint32_t)t;
+
+        // D5/D6: qhat was one too large, add the divisor back
+        q[j] = (uint32_t)qhat;
+        if (t < 0) {
+            uint64_t carry = 0;
+            q[j]--;
+            for (int i = 0; i < nv; i++) {
+                carry += (uint64_t)un[i + j] + vn[i];
+                un[i + j] = (uint32_t)carry;
+                carry >>= 32;
             }
+            un[j + nv] += (uint32_t)carry;
         }
     }
-    
-    // Convert to string
-    char* str_result = (char*)malloc(result_len);
-    if (!str_result) {
-        free(result);
+
+    // D8: unnormalize the remainder
+    if (r) {
+        mag_shr(r, un, nv, s);
+    }
+
+    free(vn);
+    free(un);
+    return true;
+}
+
+// ============================================================================
+// Helper Functions - Fast Multiplication (Karatsuba, Toom-3)
+// ============================================================================
+
+// r = a * b for na >= 2 * nb: nb-limb slices of a times b, accumulated
+static void mag_mul_unbalanced(uint32_t* r, const uint32_t* a, int na, const uint32_t* b, int nb) {
+    uint32_t* t = (uint32_t*)malloc(2 * nb * sizeof(uint32_t));
+    if (!t) return;
+
+    for (int off = 0; off < na; off += nb) {
+        int len = (na - off < nb) ? na - off : nb;
+        memset(t, 0, (len + nb) * sizeof(uint32_t));
+        mag_mul(t, a + off, mag_trim(a + off, len), b, nb);
+        mag_add_into(r + off, na + nb - off, t, mag_trim(t, len + nb));
+    }
+    free(t);
+}
+
+// r = a * b (na >= nb, nb > na / 2), one level of Karatsuba:
+// a*b = z2*B^2h + ((a0 + a1)(b0 + b1) - z0 - z2)*B^h + z0
+static void mag_mul_karatsuba(uint32_t* r, const uint32_t* a, int na, const uint32_t* b, int nb) {
+    int h = (na + 1) / 2;
+    int na0 = mag_trim(a, h);
+    int na1 = na - h;
+    int nb0 = mag_trim(b, nb < h ? nb : h);
+    int nb1 = nb > h ? nb - h : 0;
+
+    // sa, sb: h + 1 limbs each; z1: 2h + 2 limbs
+    uint32_t* scratch = (uint32_t*)calloc(4 * h + 4, sizeof(uint32_t));
+    if (!scratch) return;
+    uint32_t* sa = scratch;
+    uint32_t* sb = sa + h + 1;
+    uint32_t* z1 = sb + h + 1;
+
+    int nsa = (na0 >= na1) ? mag_add(sa, a, na0, a + h, na1) : mag_add(sa, a + h, na1, a, na0);
+    int nsb = (nb0 >= nb1) ? mag_add(sb, b, nb0, b + h, nb1) : mag_add(sb, b + h, nb1, b, nb0);
+    nsa = mag_trim(sa, nsa);
+    nsb = mag_trim(sb, nsb);
+
+    // z0 and z2 land directly in their final positions
+    mag_mul(r, a, na0, b, nb0);
+    mag_mul(r + 2 * h, a + h, na1, b + h, mag_trim(b + h, nb1));
+    mag_mul(z1, sa, nsa, sb, nsb);
+
+    int nz1 = mag_trim(z1, nsa + nsb);
+    mag_sub_into(z1, nz1, r, mag_trim(r, 2 * h));
+    mag_sub_into(z1, nz1, r + 2 * h, mag_trim(r + 2 * h, na + nb - 2 * h));
+    mag_add_into(r + h, na + nb - h, z1, mag_trim(z1, nz1));
+
+    free(scratch);
+}
+
+// Signed magnitude for Toom-3 evaluation/interpolation (d has fixed capacity)
+typedef struct {
+    uint32_t* d;
+    int n;
+    bool negative;
+} SignedMag;
+
+static SignedMag signed_view(const uint32_t* d, int n) {
+    SignedMag v = { (uint32_t*)d, mag_trim(d, n), false };
+    return v;
+}
+
+// r = x + y, or x - y when subtract is set (r may alias x or y)
+static void signed_addsub(SignedMag* r, const SignedMag* x, const SignedMag* y, bool subtract) {
+    bool x_negative = x->negative;
+    bool y_negative = (y->negative != subtract);
+
+    if (x_negative == y_negative) {
+        r->n = (x->n >= y->n) ? mag_add(r->d, x->d, x->n, y->d, y->n)
+                              : mag_add(r->d, y->d, y->n, x->d, x->n);
+        r->negative = x_negative;
+    } else if (mag_compare(x->d, x->n, y->d, y->n) >= 0) {
+        r->n = mag_sub(r->d, x->d, x->n, y->d, y->n);
+        r->negative = x_negative;
+    } else {
+        r->n = mag_sub(r->d, y->d, y->n, x->d, x->n);
+        r->negative = y_negative;
+    }
+
+    r->n = mag_trim(r->d, r->n);
+    if (r->n == 0) r->negative = false;
+}
+
+// x *= 2
+static void signed_double(SignedMag* x) {
+    uint32_t carry = mag_mul_small(x->d, x->n, 2, 0);
+    if (carry) x->d[x->n++] = carry;
+}
+
+// x /= 2 (exact)
+static void signed_halve(SignedMag* x) {
+    for (int i = 0; i < x->n; i++) {
+        x->d[i] = (x->d[i] >> 1) | (i + 1 < x->n ? x->d[i + 1] << 31 : 0);
+    }
+    x->n = mag_trim(x->d, x->n);
+}
+
+// x /= 3 (exact)
+static void signed_third(SignedMag* x) {
+    mag_divmod_small(x->d, x->n, 3);
+    x->n = mag_trim(x->d, x->n);
+}
+
+// r = x * y (r zeroed by the caller)
+static void signed_mul(SignedMag* r, const SignedMag* x, const SignedMag* y) {
+    mag_mul(r->d, x->d, x->n, y->d, y->n);
+    r->n = mag_trim(r->d, x->n + y->n);
+    r->negative = (r->n > 0) && (x->negative != y->negative);
+}
+
+// p(1), p(-1), p(-2) for p(t) = p2*t^2 + p1*t + p0
+static void toom3_evaluate(SignedMag* at1, SignedMag* atm1, SignedMag* atm2,
+                           const SignedMag* p0, const SignedMag* p1, const SignedMag* p2) {
+    signed_addsub(at1, p0, p2, false);     // p0 + p2
+    signed_addsub(atm1, at1, p1, true);    // p(-1) = p0 - p1 + p2
+    signed_addsub(at1, at1, p1, false);    // p(1)  = p0 + p1 + p2
+    signed_addsub(atm2, atm1, p2, false);
+    signed_double(atm2);
+    signed_addsub(atm2, atm2, p0, true);   // p(-2) = 2(p(-1) + p2) - p0
+}
+
+// r = a * b (na >= nb, nb > 2 * ceil(na / 3) ideally), one level of Toom-3
+// with Bodrato's interpolation sequence (points 0, 1, -1, -2, inf)
+static void mag_mul_toom3(uint32_t* r, const uint32_t* a, int na, const uint32_t* b, int nb) {
+    int k = (na + 2) / 3;
+    int cap = 2 * k + 6;
+
+    enum { P1, PM1, PM2, Q1, QM1, QM2, R1, RM1, RM2, TMP, SLOT_COUNT };
+    uint32_t* pool = (uint32_t*)calloc((size_t)cap * SLOT_COUNT, sizeof(uint32_t));
+    if (!pool) return;
+
+    SignedMag slot[SLOT_COUNT];
+    for (int i = 0; i < SLOT_COUNT; i++) {
+        slot[i].d = pool + (size_t)i * cap;
+        slot[i].n = 0;
+        slot[i].negative = false;
+    }
+
+    // Split into k-limb parts (high parts of b may be short or empty)
+    SignedMag a0 = signed_view(a, k);
+    SignedMag a1 = signed_view(a + k, na - k < k ? na - k : k);
+    SignedMag a2 = signed_view(a + 2 * k, na - 2 * k);
+    SignedMag b0 = signed_view(b, nb < k ? nb : k);
+    SignedMag b1 = signed_view(b + k, nb - k <= 0 ? 0 : (nb - k < k ? nb - k : k));
+    SignedMag b2 = signed_view(b + 2 * k, nb - 2 * k <= 0 ? 0 : nb - 2 * k);
+
+    toom3_evaluate(&slot[P1], &slot[PM1], &slot[PM2], &a0, &a1, &a2);
+    toom3_evaluate(&slot[Q1], &slot[QM1], &slot[QM2], &b0, &b1, &b2);
+
+    // r(0) and r(inf) go straight into the result
+    mag_mul(r, a0.d, a0.n, b0.d, b0.n);
+    mag_mul(r + 4 * k, a2.d, a2.n, b2.d, b2.n);
+    SignedMag r0 = signed_view(r, 2 * k);
+    SignedMag rinf = signed_view(r + 4 * k, na + nb - 4 * k);
+
+    signed_mul(&slot[R1], &slot[P1], &slot[Q1]);
+    signed_mul(&slot[RM1], &slot[PM1], &slot[QM1]);
+    signed_mul(&slot[RM2], &slot[PM2], &slot[QM2]);
+
+    // Interpolation: all divisions are exact
+    SignedMag* c1 = &slot[R1];
+    SignedMag* c2 = &slot[RM1];
+    SignedMag* c3 = &slot[RM2];
+    SignedMag* tmp = &slot[TMP];
+
+    signed_addsub(c3, &slot[RM2], &slot[R1], true);    // c3 = (r(-2) - r(1)) / 3
+    signed_third(c3);
+    signed_addsub(c1, &slot[R1], &slot[RM1], true);    // c1 = (r(1) - r(-1)) / 2
+    signed_halve(c1);
+    signed_addsub(c2, &slot[RM1], &r0, true);          // c2 = r(-1) - r(0)
+    signed_addsub(c3, c2, c3, true);                   // c3 = (c2 - c3) / 2 + 2 r(inf)
+    signed_halve(c3);
+    memcpy(tmp->d, rinf.d, rinf.n * sizeof(uint32_t));
+    tmp->n = rinf.n;
+    tmp->negative = false;
+    signed_double(tmp);
+    signed_addsub(c3, c3, tmp, false);
+    signed_addsub(c2, c2, c1, false);                  // c2 = c2 + c1 - r(inf)
+    signed_addsub(c2, c2, &rinf, true);
+    signed_addsub(c1, c1, c3, true);                   // c1 = c1 - c3
+
+    // Coefficients of a product of non-negative polynomials are non-negative
+    mag_add_into(r + k, na + nb - k, c1->d, c1->n);
+    mag_add_into(r + 2 * k, na + nb - 2 * k, c2->d, c2->n);
+    mag_add_into(r + 3 * k, na + nb - 3 * k, c3->d, c3->n);
+
+    free(pool);
+}
+
+static void mag_mul(uint32_t* r, const uint32_t* a, int na, const uint32_t* b, int nb) {
+    if (na < nb) {
+        const uint32_t* t = a; a = b; b = t;
+        int tn = na; na = nb; nb = tn;
+    }
+    if (nb == 0) return;
+
+    if (nb < karatsuba_threshold && nb < toom3_threshold) {
+        mag_mul_schoolbook(r, a, na, b, nb);
+    } else if (na >= 2 * nb) {
+        mag_mul_unbalanced(r, a, na, b, nb);
+    } else if (nb >= toom3_threshold) {
+        mag_mul_toom3(r, a, na, b, nb);
+    } else if (nb >= karatsuba_threshold) {
+        mag_mul_karatsuba(r, a, na, b, nb);
+    } else {
+        mag_mul_schoolbook(r, a, na, b, nb);
+    }
+}
+
+// ============================================================================
+// Helper Functions - Fast Division (Newton reciprocal + Barrett)
+// ============================================================================
+
+// x = floor(B^2n / v) for normalized v (top bit set); x holds n + 2 limbs.
+// Newton step from the half-size reciprocal xh of v's top h limbs:
+//   x = 2 xh B^(n-h) - ceil(v xh^2 / B^2h)
+// never overshoots; the exact remainder then fixes the last few units.
+static bool mag_reciprocal(uint32_t* x, const uint32_t* v, int n) {
+    memset(x, 0, (n + 2) * sizeof(uint32_t));
+
+    if (n <= NEWTON_RECIPROCAL_BASE) {
+        uint32_t* num = (uint32_t*)calloc(2 * n + 1, sizeof(uint32_t));
+        if (!num) return false;
+        num[2 * n] = 1;
+        bool ok = mag_divmod_schoolbook(x, NULL, num, 2 * n + 1, v, n);
+        free(num);
+        return ok;
+    }
+
+    int h = (n + 1) / 2;
+    int lo = n - h;
+    uint32_t* xh = (uint32_t*)malloc((h + 2) * sizeof(uint32_t));
+    if (!xh || !mag_reciprocal(xh, v + lo, h)) {
+        free(xh);
+        return false;
+    }
+    int nxh = mag_trim(xh, h + 2);
+
+    uint32_t* sq = (uint32_t*)calloc(2 * nxh, sizeof(uint32_t));
+    uint32_t* t = (uint32_t*)calloc(n + 2 * nxh, sizeof(uint32_t));
+    uint32_t* rem = (uint32_t*)calloc(2 * n + 1, sizeof(uint32_t));
+    uint32_t* p = (uint32_t*)calloc(2 * n + 3, sizeof(uint32_t));
+    bool ok = sq && t && rem && p;
+
+    if (ok) {
+        // t = v * xh^2
+        mag_mul(sq, xh, nxh, xh, nxh);
+        int nsq = mag_trim(sq, 2 * nxh);
+        mag_mul(t, v, n, sq, nsq);
+        int nt = mag_trim(t, n + nsq);
+
+        // x = 2 * xh * B^lo
+        memcpy(x + lo, xh, nxh * sizeof(uint32_t));
+        uint32_t carry = mag_mul_small(x + lo, nxh, 2, 0);
+        if (carry) x[lo + nxh] = carry;
+        int nx = mag_trim(x, n + 2);
+
+        // x -= ceil(t / B^2h)
+        int shift = 2 * h;
+        int ntq = nt > shift ? nt - shift : 0;
+        bool round_up = mag_trim(t, nt < shift ? nt : shift) > 0;
+        nx = mag_sub(x, x, nx, t + shift, ntq);
+        if (round_up) {
+            const uint32_t one = 1;
+            nx = mag_sub(x, x, nx, &one, 1);
+        }
+
+        // rem = B^2n - v * x >= 0; step x up while rem >= v
+        mag_mul(p, v, n, x, nx);
+        rem[2 * n] = 1;
+        int nr = mag_sub(rem, rem, 2 * n + 1, p, mag_trim(p, n + nx));
+        while (mag_compare(rem, nr, v, n) >= 0) {
+            nr = mag_sub(rem, rem, nr, v, n);
+            carry = mag_mul_small(x, nx, 1, 1);
+            if (carry) x[nx++] = carry;
+        }
+    }
+
+    free(xh);
+    free(sq);
+    free(t);
+    free(rem);
+    free(p);
+    return ok;
+}
+
+// Same contract as mag_divmod_schoolbook. The normalized dividend is
+// consumed in n-limb blocks (n = nv); each 2n-limb step uses Barrett's
+// estimate q' = floor(floor(A / B^(n-1)) * X / B^(n+1)) with X = floor(B^2n / v),
+// which satisfies q - 2 <= q' <= q (HAC 14.42).
+static bool mag_divmod_newton(uint32_t* q, uint32_t* r,
+                              const uint32_t* u, int nu, const uint32_t* v, int nv) {
+    int n = nv;
+    int blocks = (nu + 1 + n - 1) / n;
+
+    uint32_t* vn = (uint32_t*)malloc((n + 1) * sizeof(uint32_t));
+    uint32_t* un = (uint32_t*)calloc((size_t)blocks * n + 1, sizeof(uint32_t));
+    uint32_t* x = (uint32_t*)malloc((n + 2) * sizeof(uint32_t));
+    uint32_t* qfull = (uint32_t*)calloc((size_t)blocks * n, sizeof(uint32_t));
+    uint32_t* a = (uint32_t*)calloc(2 * n + 1, sizeof(uint32_t));
+    uint32_t* prod = (uint32_t*)malloc((2 * n + 4) * sizeof(uint32_t));
+    uint32_t* qv = (uint32_t*)malloc((2 * n + 1) * sizeof(uint32_t));
+    bool ok = vn && un && x && qfull && a && prod && qv;
+    int s = 0;
+
+    if (ok) {
+        s = mag_normalize_shift(v, nv);
+        mag_shl(vn, v, n, s);
+        mag_shl(un, u, nu, s);
+        ok = mag_reciprocal(x, vn, n);
+    }
+
+    if (ok) {
+        int nx = mag_trim(x, n + 2);
+
+        // a = rem * B^n + block; rem (< v) lives in a[n..2n) between steps
+        for (int blk = blocks - 1; blk >= 0; blk--) {
+            memcpy(a, un + (size_t)blk * n, n * sizeof(uint32_t));
+            int na = mag_trim(a, 2 * n);
+
+            int na1 = na > n - 1 ? na - (n - 1) : 0;
+            memset(prod, 0, (2 * n + 4) * sizeof(uint32_t));
+            mag_mul(prod, a + (n - 1), na1, x, nx);
+            uint32_t* qhat = prod + (n + 1);
+            int nq = na1 + nx > n + 1 ? mag_trim(qhat, na1 + nx - (n + 1)) : 0;
+
+            memset(qv, 0, (2 * n + 1) * sizeof(uint32_t));
+            mag_mul(qv, qhat, nq, vn, n);
+            na = mag_sub(a, a, na, qv, mag_trim(qv, nq + n));
+            while (mag_compare(a, na, vn, n) >= 0) {
+                na = mag_sub(a, a, na, vn, n);
+                uint32_t carry = mag_mul_small(qhat, nq, 1, 1);
+                if (carry) qhat[nq++] = carry;
+            }
+
+            memcpy(qfull + (size_t)blk * n, qhat, nq * sizeof(uint32_t));
+            memmove(a + n, a, n * sizeof(uint32_t));
+            memset(a, 0, n * sizeof(uint32_t));
+        }
+
+        memcpy(q, qfull, (nu - nv + 1) * sizeof(uint32_t));
+        if (r) {
+            mag_shr(r, a + n, n, s);
+        }
+    }
+
+    free(vn);
+    free(un);
+    free(x);
+    free(qfull);
+    free(a);
+    free(prod);
+    free(qv);
+    return ok;
+}
+
+// q = u / v, r = u % v; picks the algorithm by size (contract as above)
+static bool mag_divmod(uint32_t* q, uint32_t* r,
+                       const uint32_t* u, int nu, const uint32_t* v, int nv) {
+    int nq = nu - nv + 1;
+    if (nv >= newton_div_threshold && nq >= newton_div_threshold) {
+        return mag_divmod_newton(q, r, u, nu, v, nv);
+    }
+    return mag_divmod_schoolbook(q, r, u, nu, v, nv);
+}
+
+// ============================================================================
+// Helper Functions - Radix Conversion (divide and conquer)
+// ============================================================================
+// Decimal <-> binary by recursive splitting at cached powers 10^(9 * 2^k):
+// a value is cut into high * 10^(9 * 2^k) + low with both halves converted
+// recursively, so the work is O(M(n) log n) with the fast mul/div above
+// instead of the O(n^2) chunk-at-a-time loop (still used below the cutoffs).
+
+// Below these sizes the quadratic chunk loops are faster
+#define TO_STRING_DC_LIMBS 48
+#define FROM_STRING_DC_DIGITS 432
+
+#define POW10_CACHE_LEVELS 32
+
+// pow10_cache[k] = 10^(9 * 2^k), filled on first use and kept for the
+// process lifetime (not thread-safe, like the algorithm selection)
+static uint32_t* pow10_cache[POW10_CACHE_LEVELS];
+static int pow10_cache_length[POW10_CACHE_LEVELS];
+
+static const uint32_t* pow10_cached(int k, int* length) {
+    if (k < 0 || k >= POW10_CACHE_LEVELS) return NULL;
+
+    if (!pow10_cache[k]) {
+        if (k == 0) {
+            uint32_t* p = (uint32_t*)malloc(sizeof(uint32_t));
+            if (!p) return NULL;
+            p[0] = DEC_CHUNK;
+            pow10_cache_length[0] = 1;
+            pow10_cache[0] = p;
+        } else {
+            int half_length;
+            const uint32_t* half = pow10_cached(k - 1, &half_length);
+            if (!half) return NULL;
+
+            uint32_t* p = (uint32_t*)calloc(2 * half_length, sizeof(uint32_t));
+            if (!p) return NULL;
+            mag_mul(p, half, half_length, half, half_length);
+            pow10_cache_length[k] = mag_trim(p, 2 * half_length);
+            pow10_cache[k] = p;
+        }
+    }
+
+    *length = pow10_cache_length[k];
+    return pow10_cache[k];
+}
+
+// Upper bound on the limbs of 10^(9 * 2^k) without computing it
+// (9 * log2(10) / 32 < 0.935)
+static long pow10_cached_length_bound(int k) {
+    return (long)(((double)(1L << k)) * 0.935) + 1;
+}
+
+// Fresh copy of 10^k (caller frees)
+static uint32_t* mag_pow10(int k, int* length) {
+    int capacity = k / DEC_CHUNK_DIGITS + 2;
+    uint32_t* r = (uint32_t*)calloc(capacity, sizeof(uint32_t));
+    uint32_t* t = (uint32_t*)calloc(capacity, sizeof(uint32_t));
+    if (!r || !t) {
+        free(r);
+        free(t);
         return NULL;
     }
-    
+
+    r[0] = pow10_u32[k % DEC_CHUNK_DIGITS];
+    int n = 1;
+
+    // 10^(9 * chunks) as a product of cached 10^(9 * 2^bit)
+    int chunks = k / DEC_CHUNK_DIGITS;
+    for (int bit = 0; chunks > 0; bit++, chunks >>= 1) {
+        if (!(chunks & 1)) continue;
+
+        int lp;
+        const uint32_t* p = pow10_cached(bit, &lp);
+        if (!p) {
+            free(r);
+            free(t);
+            return NULL;
+        }
+        memset(t, 0, capacity * sizeof(uint32_t));
+        mag_mul(t, r, n, p, lp);
+        n = mag_trim(t, n + lp);
+        uint32_t* swap = r; r = t; t = swap;
+    }
+
+    free(t);
+    *length = n;
+    return r;
+}
+
+// r = value of the decimal digits s[0..len) (r zeroed, capacity limbs)
+// Returns number of limbs used
+static int mag_from_digits(uint32_t* r, int capacity, const char* s, size_t len) {
+    if (len <= FROM_STRING_DC_DIGITS) {
+        int n = 0;
+        size_t i = 0;
+        size_t head = len % DEC_CHUNK_DIGITS;
+
+        // Leading partial chunk, then whole 9-digit chunks
+        while (i < len) {
+            size_t take = (i == 0 && head) ? head : DEC_CHUNK_DIGITS;
+            uint32_t chunk = 0;
+            for (size_t j = 0; j < take; j++) {
+                chunk = chunk * 10 + (uint32_t)(s[i + j] - '0');
+            }
+            uint32_t carry = mag_mul_small(r, n, pow10_u32[take], chunk);
+            if (carry) r[n++] = carry;
+            i += take;
+        }
+        return mag_trim(r, n);
+    }
+
+    // Split off the largest 9 * 2^k low digits that leave a non-empty head
+    int k = 0;
+    while (((size_t)DEC_CHUNK_DIGITS << (k + 1)) < len) {
+        k++;
+    }
+    size_t low_len = (size_t)DEC_CHUNK_DIGITS << k;
+    size_t high_len = len - low_len;
+
+    int lp;
+    const uint32_t* p = pow10_cached(k, &lp);
+    int high_capacity = (int)(high_len / DEC_CHUNK_DIGITS) + 2;
+    uint32_t* high = (uint32_t*)calloc(high_capacity, sizeof(uint32_t));
+    uint32_t* t = (uint32_t*)calloc(high_capacity + lp, sizeof(uint32_t));
+    if (!p || !high || !t) {
+        free(high);
+        free(t);
+        return -1;
+    }
+
+    int nh = mag_from_digits(high, high_capacity, s, high_len);
+    int nl = mag_from_digits(r, capacity, s + high_len, low_len);
+    if (nh < 0 || nl < 0) {
+        free(high);
+        free(t);
+        return -1;
+    }
+
+    // r = high * 10^low_len + low
+    mag_mul(t, high, nh, p, lp);
+    mag_add_into(r, capacity, t, mag_trim(t, nh + lp));
+
+    free(high);
+    free(t);
+    return mag_trim(r, capacity);
+}
+
+// Digit output: either a caller-sized memory buffer (out == NULL) or a
+// FILE* stream staged through 'buffer', so no full-size string is built
+typedef struct {
+    char* buffer;       // Target string, or staging buffer when streaming
+    size_t fill;        // Bytes in buffer
+    size_t stage_size;  // Staging buffer size (stream mode)
+    FILE* out;          // Stream target
+    size_t written;     // Characters emitted so far
+    bool failed;
+} DigitSink;
+
+static void sink_flush(DigitSink* sink) {
+    if (sink->out && sink->fill > 0) {
+        if (fwrite(sink->buffer, 1, sink->fill, sink->out) != sink->fill) {
+            sink->failed = true;
+        }
+        sink->fill = 0;
+    }
+}
+
+static void sink_write(DigitSink* sink, const char* data, size_t len) {
+    sink->written += len;
+    if (!sink->out) {
+        memcpy(sink->buffer + sink->fill, data, len);
+        sink->fill += len;
+        return;
+    }
+
+    while (len > 0) {
+        if (sink->fill == sink->stage_size) sink_flush(sink);
+        size_t take = sink->stage_size - sink->fill;
+        if (take > len) take = len;
+        memcpy(sink->buffer + sink->fill, data, take);
+        sink->fill += take;
+        data += take;
+        len -= take;
+    }
+}
+
+static void sink_write_zeros(DigitSink* sink, size_t count) {
+    static const char zeros[] = "0000000000000000000000000000000000000000000000000000000000000000";
+    while (count > 0) {
+        size_t take = count < sizeof(zeros) - 1 ? count : sizeof(zeros) - 1;
+        sink_write(sink, zeros, take);
+        count -= take;
+    }
+}
+
+// Write exactly 9 decimal digits (zero padded)
+static void write_chunk9(char* out, uint32_t value) {
+    for (int i = DEC_CHUNK_DIGITS - 1; i >= 0; i--) {
+        out[i] = (char)('0' + value % 10);
+        value /= 10;
+    }
+}
+
+// Emit the magnitude a[0..n) as decimal digits. width == 0: no leading
+// zeros ("0" for zero); width > 0: left-padded to exactly width digits
+// (the value must have at most width digits).
+static bool emit_digits(DigitSink* sink, const uint32_t* a, int n, size_t width) {
+    n = mag_trim(a, n);
+
+    if (n <= TO_STRING_DC_LIMBS) {
+        // Peel base-10^9 chunks off a scratch copy (at most 10 digits per limb)
+        uint32_t scratch[TO_STRING_DC_LIMBS];
+        char digits[TO_STRING_DC_LIMBS * 10 + DEC_CHUNK_DIGITS];
+        size_t pos = sizeof(digits);
+
+        if (n > 0) memcpy(scratch, a, n * sizeof(uint32_t));
+        while (n > 0) {
+            uint32_t chunk = mag_divmod_small(scratch, n, DEC_CHUNK);
+            n = mag_trim(scratch, n);
+            pos -= DEC_CHUNK_DIGITS;
+            write_chunk9(digits + pos, chunk);
+        }
+        while (pos < sizeof(digits) && digits[pos] == '0') {
+            pos++;
+        }
+
+        size_t len = sizeof(digits) - pos;
+        if (width > len) {
+            sink_write_zeros(sink, width - len);
+        } else if (width == 0 && len == 0) {
+            sink_write(sink, "0", 1);
+        }
+        sink_write(sink, digits + pos, len);
+        return true;
+    }
+
+    // Largest cached power with about half the limbs: a = q * 10^(9 * 2^k) + r
     int k = 0;
-    int i = result_len - 1;
-    
-    // Skip leading zeros
-    while (i > 0 && result[i] == 0) {
-        i--;
+    while (k + 1 < POW10_CACHE_LEVELS && pow10_cached_length_bound(k + 1) <= n / 2) {
+        k++;
     }
-    
-    // Copy digits
-    while (i >= 0) {
-        str_result[k++] = result[i--] + '0';
+    size_t low_width = (size_t)DEC_CHUNK_DIGITS << k;
+
+    int lp;
+    const uint32_t* p = pow10_cached(k, &lp);
+    if (!p) return false;
+
+    int nq = n - lp + 1;
+    uint32_t* q = (uint32_t*)calloc(nq, sizeof(uint32_t));
+    uint32_t* r = (uint32_t*)calloc(lp, sizeof(uint32_t));
+    bool ok = q && r && mag_divmod(q, r, a, n, p, lp);
+
+    if (ok) {
+        ok = emit_digits(sink, q, nq, width > low_width ? width - low_width : 0);
     }
-    
-    str_result[k] = '\0';
-    free(result);
-    
-    return str_result;
+    free(q);
+    if (ok) {
+        ok = emit_digits(sink, r, lp, low_width);
+    }
+    free(r);
+    return ok;
+}
+
+// Emit the full text of bd: sign, integer part, '.' and 'scale' fraction digits
+static bool emit_bigdec(DigitSink* sink, const BigDecimal* bd) {
+    if (bd->negative) sink_write(sink, "-", 1);
+
+    if (bd->scale == 0) {
+        return emit_digits(sink, bd->limbs, bd->length, 0);
+    }
+
+    // Split at the decimal point: magnitude = int_part * 10^scale + frac
+    int lp;
+    uint32_t* p = mag_pow10(bd->scale, &lp);
+    if (!p) return false;
+
+    bool ok;
+    if (bd->length < lp) {
+        ok = emit_digits(sink, NULL, 0, 0);
+        sink_write(sink, ".", 1);
+        ok = ok && emit_digits(sink, bd->limbs, bd->length, (size_t)bd->scale);
+    } else {
+        int nq = bd->length - lp + 1;
+        uint32_t* q = (uint32_t*)calloc(nq, sizeof(uint32_t));
+        uint32_t* r = (uint32_t*)calloc(lp, sizeof(uint32_t));
+        ok = q && r && mag_divmod(q, r, bd->limbs, bd->length, p, lp);
+        if (ok) {
+            ok = emit_digits(sink, q, nq, 0);
+            sink_write(sink, ".", 1);
+            ok = ok && emit_digits(sink, r, lp, (size_t)bd->scale);
+        }
+        free(q);
+        free(r);
+    }
+
+    free(p);
+    return ok;
 }
 
 // ============================================================================
-// Public BigDecimal Functions
+// Helper Functions - BigDecimal Allocation & Scaling
 // ============================================================================
 
-BigDecimal* sto_bigdec_add(BigDecimal* a, BigDecimal* b) {
-    if (!a || !b) return NULL;
-    
-    BigDecimal* result = (BigDecimal*)malloc(sizeof(BigDecimal));
-    if (!result) return NULL;
-    
-    result->refcount = 1;
-    
-    // Same sign - add magnitudes
-    if (a->negative == b->negative) {
-        result->digits = add_positive(a->digits, b->digits);
-        result->negative = a->negative;
+// Zeroed heap limb buffer (pool allocated: freed with its capacity)
+static uint32_t* bd_limbs_alloc(int capacity) {
+    return (uint32_t*)sto_pool_calloc((size_t)capacity * sizeof(uint32_t), STO_POOL_BIGDECIMAL);
+}
+
+// Allocate a zero BigDecimal with room for 'capacity' limbs
+// (up to BIGDEC_INLINE_LIMBS live in the header: one allocation)
+static BigDecimal* bd_alloc(int capacity) {
+    BigDecimal* bd = (BigDecimal*)sto_pool_alloc(sizeof(BigDecimal), STO_POOL_BIGDECIMAL);
+    if (!bd) return NULL;
+
+    if (capacity <= BIGDEC_INLINE_LIMBS) {
+        capacity = BIGDEC_INLINE_LIMBS;
+        bd->limbs = bd->inline_limbs;
+        memset(bd->inline_limbs, 0, sizeof(bd->inline_limbs));
+        bigdec_stats.inline_limbs++;
     } else {
-        // Different signs - subtract smaller from larger
-        int cmp = compare_magnitude(a->digits, b->digits);
-        
-        if (cmp == 0) {
-            // Same magnitude, different signs = 0
-            result->digits = (char*)malloc(2);
-            if (!result->digits) {
-                free(result);
-                return NULL;
-            }
-            result->digits[0] = '0';
-            result->digits[1] = '\0';
-            result->negative = false;
-        } else if (cmp > 0) {
-            // |a| > |b|
-            result->digits = subtract_positive(a->digits, b->digits);
-            result->negative = a->negative;
-        } else {
-            // |a| < |b|
-            result->digits = subtract_positive(b->digits, a->digits);
-            result->negative = b->negative;
+        bd->limbs = bd_limbs_alloc(capacity);
+        if (!bd->limbs) {
+            sto_pool_free(bd, sizeof(BigDecimal), STO_POOL_BIGDECIMAL);
+            return NULL;
         }
+        bigdec_stats.heap_limbs++;
+        bigdec_stats.heap_bytes += capacity * sizeof(uint32_t);
+    }
+    bigdec_stats.heap_values++;
+    bigdec_stats.heap_bytes += sizeof(BigDecimal);
+
+    bd->length = 0;
+    bd->capacity = capacity;
+    bd->scale = 0;
+    bd->negative = false;
+    bd->refcount = 1;
+    return bd;
+}
+
+// Free heap limb storage (inline limbs belong to the header)
+static void bd_free_limbs(BigDecimal* bd) {
+    if (bd->limbs != bd->inline_limbs) {
+        sto_pool_free(bd->limbs, (size_t)bd->capacity * sizeof(uint32_t), STO_POOL_BIGDECIMAL);
     }
-    
-    if (!result->digits) {
-        free(result);
+}
+
+// Release a temporary regardless of refcount (inline values own nothing)
+static void bd_destroy(BigDecimal* bd) {
+    if (!bd || bd->refcount == BIGDEC_REFCOUNT_INLINE) return;
+    bd_free_limbs(bd);
+    sto_pool_free(bd, sizeof(BigDecimal), STO_POOL_BIGDECIMAL);
+}
+
+// Replace the limb storage with a bd_limbs_alloc buffer of 'capacity' limbs
+static void bd_adopt_limbs(BigDecimal* bd, uint32_t* limbs, int capacity) {
+    bd_free_limbs(bd);
+    bd->limbs = limbs;
+    bd->capacity = capacity;
+    bigdec_stats.heap_limbs++;
+    bigdec_stats.heap_bytes += capacity * sizeof(uint32_t);
+}
+
+// Grow limb storage (new limbs are zeroed)
+static bool bd_reserve(BigDecimal* bd, int capacity) {
+    if (capacity <= bd->capacity) return true;
+
+    if (bd->limbs == bd->inline_limbs) {
+        uint32_t* limbs = bd_limbs_alloc(capacity);
+        if (!limbs) return false;
+
+        memcpy(limbs, bd->inline_limbs, sizeof(bd->inline_limbs));
+        bd_adopt_limbs(bd, limbs, capacity);
+        return true;
+    }
+
+    uint32_t* limbs = (uint32_t*)sto_pool_realloc(bd->limbs, (size_t)bd->capacity * sizeof(uint32_t),
+                                                  (size_t)capacity * sizeof(uint32_t), STO_POOL_BIGDECIMAL);
+    if (!limbs) return false;
+
+    memset(limbs + bd->capacity, 0, (capacity - bd->capacity) * sizeof(uint32_t));
+    bigdec_stats.heap_limbs++;
+    bigdec_stats.heap_bytes += (capacity - bd->capacity) * sizeof(uint32_t);
+    bd->limbs = limbs;
+    bd->capacity = capacity;
+    return true;
+}
+
+// Drop leading zero limbs; zero is always positive
+static void bd_normalize(BigDecimal* bd) {
+    bd->length = mag_trim(bd->limbs, bd->length);
+    if (bd->length == 0) {
+        bd->negative = false;
+    }
+}
+
+// magnitude = magnitude * m + add (capacity must already allow one more limb)
+static void bd_mul_add_small(BigDecimal* bd, uint32_t m, uint32_t add) {
+    uint32_t carry = mag_mul_small(bd->limbs, bd->length, m, add);
+    if (carry) {
+        bd->limbs[bd->length++] = carry;
+    }
+}
+
+// magnitude *= 10^k (scale is left to the caller)
+static bool bd_mul_pow10(BigDecimal* bd, int k) {
+    if (k <= 0 || bd->length == 0) return true;
+
+    // Large k: one multiplication by 10^k built from the cached powers
+    if (k > FROM_STRING_DC_DIGITS) {
+        int lp;
+        uint32_t* p = mag_pow10(k, &lp);
+        uint32_t* product = p ? bd_limbs_alloc(bd->length + lp) : NULL;
+        if (!product) {
+            free(p);
+            return false;
+        }
+        mag_mul(product, bd->limbs, bd->length, p, lp);
+        free(p);
+        bd_adopt_limbs(bd, product, bd->length + lp);
+        bd->length = mag_trim(product, bd->capacity);
+        return true;
+    }
+
+    // Each 10^9 step grows the magnitude by less than one limb
+    if (!bd_reserve(bd, bd->length + k / DEC_CHUNK_DIGITS + 2)) return false;
+
+    while (k > 0) {
+        int step = k > DEC_CHUNK_DIGITS ? DEC_CHUNK_DIGITS : k;
+        bd_mul_add_small(bd, pow10_u32[step], 0);
+        k -= step;
+    }
+    return true;
+}
+
+// Copy of 'src' with the same value expressed at scale src->scale + k
+static BigDecimal* bd_copy_rescaled(const BigDecimal* src, int k) {
+    BigDecimal* bd = bd_alloc(src->length + k / DEC_CHUNK_DIGITS + 2);
+    if (!bd) return NULL;
+
+    memcpy(bd->limbs, src->limbs, src->length * sizeof(uint32_t));
+    bd->length = src->length;
+    bd->negative = src->negative;
+    bd->scale = src->scale + k;
+
+    if (!bd_mul_pow10(bd, k)) {
+        bd_destroy(bd);
         return NULL;
     }
-    
-    result->length = strlen(result->digits);
+    return bd;
+}
+
+// ============================================================================
+// Public BigDecimal Functions - Creation / Conversion
+// ============================================================================
+
+BigDecimal* sto_bigdec_from_int64(int64_t value) {
+    BigDecimal* bd = bd_alloc(2);
+    if (!bd) return NULL;
+
+    uint64_t abs_value = (value < 0) ? (uint64_t)(-(value + 1)) + 1 : (uint64_t)value;
+
+    bd->limbs[0] = (uint32_t)abs_value;
+    bd->limbs[1] = (uint32_t)(abs_value >> 32);
+    bd->length = 2;
+    bd->negative = (value < 0);
+    bd_normalize(bd);
+
+    return bd;
+}
+
+BigDecimal* sto_bigdec_from_int128(STOInt128 value) {
+    return sto_bigdec_from_int128_scaled(value, 0);
+}
+
+// Store units / 10^scale into limbs that hold at least 4 entries
+static void bd_set_int128(BigDecimal* bd, STOInt128 units, int scale) {
+    unsigned __int128 abs_value = (units < 0) ? -(unsigned __int128)units
+                                              : (unsigned __int128)units;
+    for (int i = 0; i < 4; i++) {
+        bd->limbs[i] = (uint32_t)(abs_value >> (32 * i));
+    }
+    bd->length = 4;
+    bd->scale = scale > 0 ? scale : 0;
+    bd->negative = (units < 0);
+    bd_normalize(bd);
+}
+
+BigDecimal* sto_bigdec_from_int128_scaled(STOInt128 units, int scale) {
+    BigDecimal* bd = bd_alloc(4);
+    if (!bd) return NULL;
+
+    bd_set_int128(bd, units, scale);
+    return bd;
+}
+
+void sto_bigdec_init_int128(BigDecimal* bd, STOInt128 units, int scale) {
+    bd->limbs = bd->inline_limbs;
+    bd->capacity = BIGDEC_INLINE_LIMBS;
+    bd->refcount = BIGDEC_REFCOUNT_INLINE;
+    bd_set_int128(bd, units, scale);
+    bigdec_stats.inline_values++;
+}
+
+bool sto_bigdec_to_int128(BigDecimal* bd, STOInt128* result) {
+    return bd && bd->scale == 0 && sto_bigdec_units_int128(bd, result);
+}
+
+bool sto_bigdec_units_int128(BigDecimal* bd, STOInt128* units) {
+    if (!bd || bd->length > 4) return false;
+
+    unsigned __int128 magnitude = 0;
+    for (int i = bd->length - 1; i >= 0; i--) {
+        magnitude = (magnitude << 32) | bd->limbs[i];
+    }
+
+    // Negative side reaches one further (STO_INT128_MIN)
+    unsigned __int128 limit = (unsigned __int128)STO_INT128_MAX + (bd->negative ? 1 : 0);
+    if (magnitude > limit) return false;
+
+    *units = bd->negative ? (STOInt128)(0 - magnitude) : (STOInt128)magnitude;
+    return true;
+}
+
+// Grammar: [+-] digits [. digits] [(e|E) [+-] digits]
+BigDecimal* sto_bigdec_from_string(const char* str) {
+    if (!str) return NULL;
+
+    const char* p = str;
+    bool negative = false;
+    if (*p == '-' || *p == '+') {
+        negative = (*p == '-');
+        p++;
+    }
+
+    // Validate and measure before allocating
+    const char* mantissa = p;
+    int int_digits = 0;
+    int frac_digits = 0;
+    while (*p >= '0' && *p <= '9') {
+        int_digits++;
+        p++;
+    }
+    if (*p == '.') {
+        p++;
+        while (*p >= '0' && *p <= '9') {
+            frac_digits++;
+            p++;
+        }
+    }
+    if (int_digits + frac_digits == 0) return NULL;
+
+    long exponent = 0;
+    if (*p == 'e' || *p == 'E') {
+        bool exp_negative = false;
+        p++;
+        if (*p == '-' || *p == '+') {
+            exp_negative = (*p == '-');
+            p++;
+        }
+        if (!(*p >= '0' && *p <= '9')) return NULL;
+        while (*p >= '0' && *p <= '9') {
+            if (exponent > INT_MAX / 4) return NULL;
+            exponent = exponent * 10 + (*p - '0');
+            p++;
+        }
+        if (exp_negative) exponent = -exponent;
+    }
+    if (*p != '\0') return NULL;
+
+    // Contiguous digit run without the '.'; each digit adds log2(10) bits
+    // (log2(10) / 32 < 0.1039), so up to 38 digits stay in inline limbs
+    int total_digits = int_digits + frac_digits;
+    char* digit_run = (char*)malloc(total_digits);
+    BigDecimal* bd = bd_alloc((int)(total_digits * 0.1039) + 1);
+    if (!digit_run || !bd) {
+        free(digit_run);
+        bd_destroy(bd);
+        return NULL;
+    }
+
+    memcpy(digit_run, mantissa, int_digits);
+    memcpy(digit_run + int_digits, mantissa + int_digits + 1, frac_digits);
+    bd->length = mag_from_digits(bd->limbs, bd->capacity, digit_run, total_digits);
+    free(digit_run);
+    if (bd->length < 0) {
+        bd_destroy(bd);
+        return NULL;
+    }
+
+    long scale = (long)frac_digits - exponent;
+    if (scale < 0) {
+        if (!bd_mul_pow10(bd, (int)-scale)) {
+            bd_destroy(bd);
+            return NULL;
+        }
+        scale = 0;
+    }
+
+    bd->scale = (int)scale;
+    bd->negative = negative;
+    bd_normalize(bd);
+    return bd;
+}
+
+char* sto_bigdec_to_string(BigDecimal* bd) {
+    if (!bd) return NULL;
+
+    // Sign + at most 10 digits per limb (or "0." + scale digits) + '.' + NUL
+    size_t digits = (size_t)bd->length * 10 + 1;
+    size_t size = 1 + (digits > (size_t)bd->scale + 1 ? digits : (size_t)bd->scale + 1) + 2;
+    char* str = (char*)malloc(size);
+    if (!str) return NULL;
+
+    DigitSink sink = { str, 0, 0, NULL, 0, false };
+    if (!emit_bigdec(&sink, bd)) {
+        free(str);
+        return NULL;
+    }
+    str[sink.fill] = '\0';
+    return str;
+}
+
+int sto_bigdec_fprint(BigDecimal* bd, FILE* out) {
+    if (!bd || !out) return -1;
+
+    char stage[4096];
+    DigitSink sink = { stage, 0, sizeof(stage), out, 0, false };
+    bool ok = emit_bigdec(&sink, bd);
+    sink_flush(&sink);
+
+    if (!ok || sink.failed) return -1;
+    return (int)sink.written;
+}
+
+// ============================================================================
+// Public BigDecimal Functions - Arithmetic
+// ============================================================================
+
+// a + b, or a - b when negate_b is set
+static BigDecimal* bd_add_signed(BigDecimal* a, BigDecimal* b, bool negate_b) {
+    const BigDecimal* x = a;
+    const BigDecimal* y = b;
+    BigDecimal* rescaled = NULL;
+
+    // Align to the larger scale
+    if (a->scale < b->scale) {
+        rescaled = bd_copy_rescaled(a, b->scale - a->scale);
+        x = rescaled;
+    } else if (b->scale < a->scale) {
+        rescaled = bd_copy_rescaled(b, a->scale - b->scale);
+        y = rescaled;
+    }
+    if (a->scale != b->scale && !rescaled) return NULL;
+
+    bool x_negative = x->negative;
+    bool y_negative = (y->negative != negate_b);
+
+    int max_len = x->length > y->length ? x->length : y->length;
+    BigDecimal* result = bd_alloc(max_len + 1);
+    if (!result) {
+        bd_destroy(rescaled);
+        return NULL;
+    }
+    result->scale = x->scale;
+
+    if (x_negative == y_negative) {
+        // Same sign - add magnitudes
+        if (x->length >= y->length) {
+            result->length = mag_add(result->limbs, x->limbs, x->length, y->limbs, y->length);
+        } else {
+            result->length = mag_add(result->limbs, y->limbs, y->length, x->limbs, x->length);
+        }
+        result->negative = x_negative;
+    } else {
+        // Different signs - subtract smaller from larger
+        int cmp = mag_compare(x->limbs, x->length, y->limbs, y->length);
+        if (cmp >= 0) {
+            result->length = mag_sub(result->limbs, x->limbs, x->length, y->limbs, y->length);
+            result->negative = x_negative;
+        } else {
+            result->length = mag_sub(result->limbs, y->limbs, y->length, x->limbs, x->length);
+            result->negative = y_negative;
+        }
+    }
+
+    bd_normalize(result);
+    bd_destroy(rescaled);
     return result;
 }
 
+BigDecimal* sto_bigdec_add(BigDecimal* a, BigDecimal* b) {
+    if (!a || !b) return NULL;
+    return bd_add_signed(a, b, false);
+}
+
 BigDecimal* sto_bigdec_sub(BigDecimal* a, BigDecimal* b) {
     if (!a || !b) return NULL;
-    
-    // a - b = a + (-b)
-    BigDecimal temp_b = *b;
-    temp_b.negative = !b->negative;
-    
-    return sto_bigdec_add(a, &temp_b);
+    return bd_add_signed(a, b, true);
 }
 
 BigDecimal* sto_bigdec_mul(BigDecimal* a, BigDecimal* b) {
     if (!a || !b) return NULL;
-    
-    BigDecimal* result = (BigDecimal*)malloc(sizeof(BigDecimal));
+
+    BigDecimal* result = bd_alloc(a->length + b->length);
     if (!result) return NULL;
-    
-    result->refcount = 1;
-    result->digits = multiply_positive(a->digits, b->digits);
-    
-    if (!result->digits) {
-        free(result);
-        return NULL;
+
+    if (a->length > 0 && b->length > 0) {
+        mag_mul(result->limbs, a->limbs, a->length, b->limbs, b->length);
+        result->length = a->length + b->length;
     }
-    
-    // Sign: negative if exactly one operand is negative
+
+    // Sign: negative if exactly one operand is negative (0 stays positive)
     result->negative = (a->negative != b->negative);
-    
-    // Special case: 0 * anything = 0 (positive)
-    if (strcmp(result->digits, "0") == 0) {
-        result->negative = false;
-    }
-    
-    result->length = strlen(result->digits);
+    result->scale = a->scale + b->scale;
+    bd_normalize(result);
+
     return result;
 }
 
-BigDecimal* sto_bigdec_div(BigDecimal* a, BigDecimal* b) {
+BigDecimal* sto_bigdec_div_scale(BigDecimal* a, BigDecimal* b, int scale) {
+    return sto_bigdec_div_round(a, b, scale, STO_ROUND_DOWN);
+}
+
+BigDecimal* sto_bigdec_div_round(BigDecimal* a, BigDecimal* b, int scale, STORoundingMode mode) {
     if (!a || !b) return NULL;
-    
+
     // Check division by zero
-    if (strcmp(b->digits, "0") == 0) {
+    if (b->length == 0) {
         fprintf(stderr, "Error: Division by zero\n");
         return sto_bigdec_from_int64(0);
     }
-    
-    // TODO: Full arbitrary precision division
-    // For now: Simple long division algorithm (integer division)
-    
-    // Placeholder: Convert to int64, divide, convert back
-    // This loses precision for very large numbers!
-    long long a_val = 0, b_val = 0;
-    sscanf(a->digits, "%lld", &a_val);
-    sscanf(b->digits, "%lld", &b_val);
-    
-    if (a->negative) a_val = -a_val;
-    if (b->negative) b_val = -b_val;
-    
-    long long result_val = a_val / b_val;
-    return sto_bigdec_from_int64(result_val);
+    if (scale < 0) scale = 0;
+
+    // q / 10^scale = (A / 10^sa) / (B / 10^sb)  =>  q = A * 10^(scale + sb - sa) / B
+    int shift = scale + b->scale - a->scale;
+    BigDecimal* num = bd_copy_rescaled(a, shift > 0 ? shift : 0);
+    BigDecimal* den = shift < 0 ? bd_copy_rescaled(b, -shift) : b;
+    BigDecimal* result = NULL;
+    uint32_t* rem = NULL;
+    bool ok = false;
+
+    if (num && den) {
+        int q_len = num->length - den->length + 1;
+        bool truncate = (mode == STO_ROUND_DOWN);
+        // One spare limb for the rounding carry, den + 1 for 2 * remainder
+        result = bd_alloc(q_len > 0 ? q_len + 1 : 1);
+        rem = truncate ? NULL : (uint32_t*)calloc(den->length + 1, sizeof(uint32_t));
+        ok = result && (truncate || rem);
+
+        if (ok && q_len > 0) {
+            ok = mag_divmod(result->limbs, rem, num->limbs, num->length, den->limbs, den->length);
+        } else if (ok && rem) {
+            // |num| < |den|: quotient 0, remainder num
+            memcpy(rem, num->limbs, num->length * sizeof(uint32_t));
+        }
+
+        if (ok) {
+            result->length = q_len > 0 ? q_len : 0;
+            result->scale = scale;
+            result->negative = (a->negative != b->negative);
+            bd_normalize(result);
+        }
+
+        int nr = rem ? mag_trim(rem, den->length) : 0;
+        if (ok && nr > 0) {
+            // Compare 2 * remainder with the divisor (remainder vs half)
+            uint32_t* twice = (uint32_t*)calloc(nr + 1, sizeof(uint32_t));
+            ok = twice != NULL;
+            if (ok) {
+                mag_shl(twice, rem, nr, 1);
+                int half_cmp = mag_compare(twice, mag_trim(twice, nr + 1), den->limbs, den->length);
+                bool odd = result->length > 0 && (result->limbs[0] & 1);
+                bool negative = (a->negative != b->negative);
+
+                if (sto_round_increment(mode, negative, half_cmp, odd)) {
+                    // One unit away from zero (spare limb holds the carry)
+                    uint32_t one = 1;
+                    result->length = mag_add(result->limbs, result->limbs, result->length, &one,
+                                             result->length > 0 ? 1 : 0);
+                    if (result->length == 0) result->limbs[result->length++] = 1;
+                    result->negative = negative;
+                }
+            }
+            free(twice);
+        }
+    }
+
+    free(rem);
+    bd_destroy(num);
+    if (den != b) bd_destroy(den);
+    if (!ok) {
+        bd_destroy(result);
+        return NULL;
+    }
+    return result;
+}
+
+bool sto_round_increment(STORoundingMode mode, bool negative, int half_cmp, bool odd) {
+    switch (mode) {
+        case STO_ROUND_HALF_EVEN: return half_cmp > 0 || (half_cmp == 0 && odd);
+        case STO_ROUND_HALF_UP: return half_cmp >= 0;
+        case STO_ROUND_HALF_DOWN: return half_cmp > 0;
+        case STO_ROUND_DOWN: return false;
+        case STO_ROUND_UP: return true;
+        case STO_ROUND_FLOOR: return negative;
+        case STO_ROUND_CEILING: return !negative;
+    }
+    return false;
+}
+
+BigDecimal* sto_bigdec_div(BigDecimal* a, BigDecimal* b) {
+    if (!a || !b) return NULL;
+    return sto_bigdec_div_scale(a, b, a->scale > b->scale ? a->scale : b->scale);
+}
+
+// ============================================================================
+// Public BigDecimal Functions - Comparison / Lifetime
+// ============================================================================
+
+// Returns: -1 if a < b, 0 if a == b, 1 if a > b
+int sto_bigdec_compare(BigDecimal* a, BigDecimal* b) {
+    if (!a || !b) return 0;
+
+    // Handle sign differences (zero is never negative)
+    if (a->negative != b->negative) return a->negative ? -1 : 1;
+
+    int cmp;
+    if (a->scale == b->scale) {
+        cmp = mag_compare(a->limbs, a->length, b->limbs, b->length);
+    } else {
+        bool a_smaller = a->scale < b->scale;
+        BigDecimal* rescaled = a_smaller ? bd_copy_rescaled(a, b->scale - a->scale)
+                                         : bd_copy_rescaled(b, a->scale - b->scale);
+        if (!rescaled) return 0;
+
+        cmp = a_smaller ? mag_compare(rescaled->limbs, rescaled->length, b->limbs, b->length)
+                        : mag_compare(a->limbs, a->length, rescaled->limbs, rescaled->length);
+        bd_destroy(rescaled);
+    }
+
+    // Both negative: larger magnitude = smaller value
+    return a->negative ? -cmp : cmp;
+}
+
+void sto_bigdec_free(BigDecimal* bd) {
+    if (!bd || bd->refcount == BIGDEC_REFCOUNT_INLINE) return;
+
+    bd->refcount--;
+    if (bd->refcount <= 0) {
+        bd_destroy(bd);
+    }
+}
+
+// ============================================================================
+// Public BigDecimal Functions - Allocation Statistics
+// ============================================================================
+
+STOBigDecStats sto_bigdec_get_stats(void) {
+    return bigdec_stats;
+}
+
+void sto_bigdec_reset_stats(void) {
+    memset(&bigdec_stats, 0, sizeof(bigdec_stats));
+}
+
+// ============================================================================
+// Public BigDecimal Functions - Algorithm Selection
+// ============================================================================
+
+void sto_bigdec_set_mul_algorithm(BigDecMulAlgorithm algorithm) {
+    switch (algorithm) {
+        case BIGDEC_MUL_SCHOOLBOOK:
+            karatsuba_threshold = INT_MAX;
+            toom3_threshold = INT_MAX;
+            break;
+        case BIGDEC_MUL_KARATSUBA:
+            // Karatsuba only, schoolbook below the usual crossover
+            karatsuba_threshold = KARATSUBA_THRESHOLD;
+            toom3_threshold = INT_MAX;
+            break;
+        case BIGDEC_MUL_TOOM3:
+            // Toom-3 only, schoolbook below the Karatsuba crossover
+            karatsuba_threshold = INT_MAX;
+            toom3_threshold = KARATSUBA_THRESHOLD;
+            break;
+        case BIGDEC_MUL_AUTO:
+        default:
+            karatsuba_threshold = KARATSUBA_THRESHOLD;
+            toom3_threshold = TOOM3_THRESHOLD;
+            break;
+    }
+}
+
+void sto_bigdec_set_div_algorithm(BigDecDivAlgorithm algorithm) {
+    switch (algorithm) {
+        case BIGDEC_DIV_SCHOOLBOOK:
+            newton_div_threshold = INT_MAX;
+            break;
+        case BIGDEC_DIV_NEWTON:
+            newton_div_threshold = FORCED_NEWTON_MIN;
+            break;
+        case BIGDEC_DIV_AUTO:
+        default:
+            newton_div_threshold = NEWTON_DIV_THRESHOLD;
+            break;
+    }
 }
@@ -0,0 +1,162 @@
+#ifndef BIGDECIMAL_H
+#define BIGDECIMAL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "int128.h"
+
+// ============================================================================
+// BigDecimal - Shared Representation
+// ============================================================================
+// Used by both runtime_sto.h (sto_bigdec_*) and sto_runtime.h (bigdec_*).
+//
+// value = (negative ? -1 : 1) * magnitude / 10^scale
+//
+// The magnitude is a binary integer stored as little-endian base-2^32 limbs
+// (64-bit intermediates, no __int128 needed). Decimal digits only exist
+// on output: sto_bigdec_to_string() / sto_bigdec_fprint() format them.
+
+// Digits kept after the decimal point by bigdec_div() beyond the operands'
+// own scale (sto_bigdec_div() truncates at the operands' scale)
+#define BIGDEC_DIV_EXTRA_SCALE 15
+
+// Rounding for divisions that drop digits (also used by fixed_decimal.h)
+typedef enum {
+    STO_ROUND_HALF_EVEN = 0,   // Banker's rounding (default for money)
+    STO_ROUND_HALF_UP,         // Ties away from zero
+    STO_ROUND_HALF_DOWN,       // Ties toward zero
+    STO_ROUND_DOWN,            // Toward zero (truncate)
+    STO_ROUND_UP,              // Away from zero
+    STO_ROUND_FLOOR,           // Toward -infinity
+    STO_ROUND_CEILING          // Toward +infinity
+} STORoundingMode;
+
+// Magnitudes of up to BIGDEC_INLINE_LIMBS limbs (128 bits, which covers
+// most promoted INT64/INT128/DECIMAL values) are kept in inline_limbs, so
+// creating one costs a single allocation instead of two. 'limbs' always
+// points at the live storage: never copy a BigDecimal by value.
+#define BIGDEC_INLINE_LIMBS 4
+
+// refcount of an inline value: a BigDecimal in caller storage set up by
+// sto_bigdec_init_int128(). It owns no memory, so sto_bigdec_free() and
+// bigdec_retain()/bigdec_release() leave it alone.
+#define BIGDEC_REFCOUNT_INLINE -1
+
+struct BigDecimal {
+    uint32_t* limbs;   // Magnitude, least significant limb first
+    int length;        // Limbs in use (0 means the value is zero)
+    int capacity;      // Limbs allocated
+    int scale;         // Digits after the decimal point (>= 0)
+    bool negative;     // Sign flag (never set for zero)
+    int refcount;      // Reference counting (BIGDEC_REFCOUNT_INLINE: not heap)
+    uint32_t inline_limbs[BIGDEC_INLINE_LIMBS];  // Storage while capacity fits
+};
+
+typedef struct BigDecimal BigDecimal;
+
+// ============================================================================
+// sto_bigdec_* API (bigdecimal.c)
+// ============================================================================
+
+// Create BigDecimal from INT64
+BigDecimal* sto_bigdec_from_int64(int64_t value);
+
+// Create BigDecimal from INT128 (promotion out of the INT128 tier)
+BigDecimal* sto_bigdec_from_int128(STOInt128 value);
+
+// Create BigDecimal units / 10^scale (promotion out of DECIMAL128)
+BigDecimal* sto_bigdec_from_int128_scaled(STOInt128 units, int scale);
+
+// Inline value units / 10^scale in caller storage (usually the stack):
+// no allocation at all. Valid as an operand for as long as 'bd' lives;
+// results computed from it are ordinary heap BigDecimals.
+void sto_bigdec_init_int128(BigDecimal* bd, STOInt128 units, int scale);
+
+// Exact INT128 value of an integral BigDecimal (scale 0) that fits 128 bits
+// Returns false (result untouched) otherwise
+bool sto_bigdec_to_int128(BigDecimal* bd, STOInt128* result);
+
+// Signed magnitude (value * 10^scale) if it fits 128 bits, else false
+bool sto_bigdec_units_int128(BigDecimal* bd, STOInt128* units);
+
+// Create BigDecimal from string ("-123", "3.14", "1.5e-3")
+// Returns NULL for malformed input
+BigDecimal* sto_bigdec_from_string(const char* str);
+
+// BigDecimal operations
+// add/sub use the larger scale, mul the sum of scales
+BigDecimal* sto_bigdec_add(BigDecimal* a, BigDecimal* b);
+BigDecimal* sto_bigdec_sub(BigDecimal* a, BigDecimal* b);
+BigDecimal* sto_bigdec_mul(BigDecimal* a, BigDecimal* b);
+
+// Division truncated toward zero at the larger operand scale
+// (integer operands give integer division)
+BigDecimal* sto_bigdec_div(BigDecimal* a, BigDecimal* b);
+
+// Division truncated toward zero with 'scale' digits after the point
+BigDecimal* sto_bigdec_div_scale(BigDecimal* a, BigDecimal* b, int scale);
+
+// Division with 'scale' digits after the point, rounded with 'mode'
+BigDecimal* sto_bigdec_div_round(BigDecimal* a, BigDecimal* b, int scale, STORoundingMode mode);
+
+// True if a quotient truncated toward zero must move one unit away from
+// zero. half_cmp: nonzero remainder vs half the divisor (-1, 0, 1);
+// odd: last kept digit is odd.
+bool sto_round_increment(STORoundingMode mode, bool negative, int half_cmp, bool odd);
+
+// Convert BigDecimal to string
+char* sto_bigdec_to_string(BigDecimal* bd);
+
+// Write the same text as sto_bigdec_to_string() to 'out' without building
+// the whole string first. Returns characters written, -1 on error.
+int sto_bigdec_fprint(BigDecimal* bd, FILE* out);
+
+// Compare two BigDecimals (-1: a<b, 0: a==b, 1: a>b)
+int sto_bigdec_compare(BigDecimal* a, BigDecimal* b);
+
+// Free BigDecimal
+void sto_bigdec_free(BigDecimal* bd);
+
+// ============================================================================
+// Allocation Statistics
+// ============================================================================
+// Cumulative since start (or sto_bigdec_reset_stats()); reported through
+// sto_get_mem_stats(). Process-wide counters, not thread-safe.
+
+typedef struct {
+    size_t heap_values;      // BigDecimal headers allocated
+    size_t heap_limbs;       // Separate limb buffers allocated (or regrown)
+    size_t heap_bytes;       // Bytes of both
+    size_t inline_limbs;     // Heap values whose limbs stayed inline
+    size_t inline_values;    // sto_bigdec_init_int128() values (no allocation)
+} STOBigDecStats;
+
+STOBigDecStats sto_bigdec_get_stats(void);
+void sto_bigdec_reset_stats(void);
+
+// ============================================================================
+// Algorithm Selection
+// ============================================================================
+// AUTO picks by operand size (thresholds in bigdecimal.c, tuned with
+// bench_bigdecimal). The other values force one algorithm for every size
+// it can split, which is what the benchmark and differential tests use.
+// Process-wide setting, not thread-safe.
+
+typedef enum {
+    BIGDEC_MUL_AUTO = 0,
+    BIGDEC_MUL_SCHOOLBOOK,     // O(n^2)
+    BIGDEC_MUL_KARATSUBA,      // O(n^1.585)
+    BIGDEC_MUL_TOOM3           // O(n^1.465)
+} BigDecMulAlgorithm;
+
+typedef enum {
+    BIGDEC_DIV_AUTO = 0,
+    BIGDEC_DIV_SCHOOLBOOK,     // Knuth Algorithm D, O(n^2)
+    BIGDEC_DIV_NEWTON          // Newton reciprocal + Barrett steps, O(M(n))
+} BigDecDivAlgorithm;
+
+void sto_bigdec_set_mul_algorithm(BigDecMulAlgorithm algorithm);
+void sto_bigdec_set_div_algorithm(BigDecDivAlgorithm algorithm);
+
+#endif
@@ -0,0 +1,476 @@
+// ============================================================================
+// DECIMAL64 / DECIMAL128 - Fixed-Point Decimal Tier
+// ============================================================================
+// Scaled-integer decimals (see fixed_decimal.h). Everything is computed on
+// 128-bit units with checked arithmetic; DECIMAL64 narrows the result and
+// has equal-scale fast paths for the common ledger case.
+//
+// Architecture: Modular STO Runtime Component
+// Author: MLP Compiler Team
+// Date: 8 Aralık 2025
+
+#include "fixed_decimal.h"
+#include <stdlib.h>
+#include <string.h>
+
+static const uint64_t pow10_u64[20] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+    10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+    100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+    100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+    100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+};
+
+// ============================================================================
+// Helper Functions - 128-bit Units
+// ============================================================================
+
+// 10^n for 0 <= n <= STO_DECIMAL128_MAX_SCALE
+static STOInt128 pow10_i128(int n) {
+    if (n < 20) return (STOInt128)pow10_u64[n];
+    return (STOInt128)pow10_u64[19] * (STOInt128)pow10_u64[n - 19];
+}
+
+// r = v * 10^k (k >= 0); returns true on overflow
+static bool units_scale_up(STOInt128 v, int k, STOInt128* r) {
+    if (v == 0 || k == 0) {
+        *r = v;
+        return false;
+    }
+    if (k > STO_DECIMAL128_MAX_SCALE) return true;
+    return __builtin_mul_overflow(v, pow10_i128(k), r);
+}
+
+// q = n / d rounded with 'mode'; returns true on overflow or d == 0
+static bool units_div_round(STOInt128 n, STOInt128 d, STORoundingMode mode, STOInt128* q) {
+    if (d == 0) return true;
+    if (n == STO_INT128_MIN && d == -1) return true;
+
+    STOInt128 quotient = n / d;
+    STOInt128 remainder = n % d;
+
+    if (remainder != 0) {
+        // Compare |r| with |d| - |r| (2|r| vs |d| without overflow)
+        unsigned __int128 abs_r = remainder < 0 ? -(unsigned __int128)remainder
+                                                : (unsigned __int128)remainder;
+        unsigned __int128 abs_d = d < 0 ? -(unsigned __int128)d : (unsigned __int128)d;
+        unsigned __int128 rest = abs_d - abs_r;
+        int half_cmp = (abs_r > rest) - (abs_r < rest);
+        bool negative = (n < 0) != (d < 0);
+
+        if (sto_round_increment(mode, negative, half_cmp, quotient & 1)) {
+            // |quotient| < |n| here, so one more unit cannot overflow
+            quotient += negative ? -1 : 1;
+        }
+    }
+
+    *q = quotient;
+    return false;
+}
+
+// v at scale 'from' -> scale 'to'; returns true on overflow
+static bool units_rescale(STOInt128 v, int from, int to, STORoundingMode mode, STOInt128* r) {
+    if (to >= from) return units_scale_up(v, to - from, r);
+
+    // Both scales are within 0..STO_DECIMAL128_MAX_SCALE
+    return units_div_round(v, pow10_i128(from - to), mode, r);
+}
+
+// Bring a and b to the larger scale; returns true on overflow
+static bool units_align(STODecimal128* a, STODecimal128* b) {
+    if (a->scale < b->scale) {
+        if (units_scale_up(a->units, b->scale - a->scale, &a->units)) return true;
+        a->scale = b->scale;
+    } else if (b->scale < a->scale) {
+        if (units_scale_up(b->units, a->scale - b->scale, &b->units)) return true;
+        b->scale = a->scale;
+    }
+    return false;
+}
+
+static STODecimal128 widen(STODecimal64 v) {
+    STODecimal128 w = { v.units, v.scale };
+    return w;
+}
+
+// DECIMAL128 -> DECIMAL64; returns true if it does not fit
+static bool narrow(STODecimal128 v, STODecimal64* result) {
+    if (!sto_int128_fits_i64(v.units) || v.scale > STO_DECIMAL64_MAX_SCALE) return true;
+    result->units = (int64_t)v.units;
+    result->scale = v.scale;
+    return false;
+}
+
+// ============================================================================
+// DECIMAL128 Operations
+// ============================================================================
+
+bool sto_dec128_add(STODecimal128 a, STODecimal128 b, STODecimal128* result) {
+    if (units_align(&a, &b)) return true;
+    result->scale = a.scale;
+    return __builtin_add_overflow(a.units, b.units, &result->units);
+}
+
+bool sto_dec128_sub(STODecimal128 a, STODecimal128 b, STODecimal128* result) {
+    if (units_align(&a, &b)) return true;
+    result->scale = a.scale;
+    return __builtin_sub_overflow(a.units, b.units, &result->units);
+}
+
+bool sto_dec128_mul(STODecimal128 a, STODecimal128 b, STODecimal128* result) {
+    if (a.scale + b.scale > STO_DECIMAL128_MAX_SCALE) return true;
+    result->scale = a.scale + b.scale;
+    return __builtin_mul_overflow(a.units, b.units, &result->units);
+}
+
+bool sto_dec128_div(STODecimal128 a, STODecimal128 b, int scale,
+                    STORoundingMode mode, STODecimal128* result) {
+    if (scale < 0 || scale > STO_DECIMAL128_MAX_SCALE) return true;
+
+    // q / 10^scale = (A / 10^sa) / (B / 10^sb)  =>  q = A * 10^(scale + sb - sa) / B
+    int shift = scale + b.scale - a.scale;
+    STOInt128 num = a.units;
+    STOInt128 den = b.units;
+    if (shift > 0 && units_scale_up(num, shift, &num)) return true;
+    if (shift < 0 && units_scale_up(den, -shift, &den)) return true;
+
+    if (units_div_round(num, den, mode, &result->units)) return true;
+    result->scale = scale;
+    return false;
+}
+
+bool sto_dec128_rescale(STODecimal128 a, int scale, STORoundingMode mode, STODecimal128* result) {
+    if (scale < 0 || scale > STO_DECIMAL128_MAX_SCALE) return true;
+    if (units_rescale(a.units, a.scale, scale, mode, &result->units)) return true;
+    result->scale = scale;
+    return false;
+}
+
+int sto_dec128_compare(STODecimal128 a, STODecimal128 b) {
+    // A side that overflows when aligned is larger in magnitude than any
+    // 128-bit value, so its sign decides
+    STODecimal128 x = a;
+    STODecimal128 y = b;
+    if (x.scale < y.scale && units_scale_up(x.units, y.scale - x.scale, &x.units)) {
+        return a.units > 0 ? 1 : -1;
+    }
+    if (y.scale < x.scale && units_scale_up(y.units, x.scale - y.scale, &y.units)) {
+        return b.units > 0 ? -1 : 1;
+    }
+    return sto_int128_compare(x.units, y.units);
+}
+
+// Grammar: [+-] digits [. digits]
+bool sto_dec128_from_string(const char* str, STODecimal128* result) {
+    if (!str) return false;
+
+    const char* p = str;
+    bool negative = (*p == '-');
+    if (*p == '-' || *p == '+') p++;
+
+    // Accumulate as a negative number so STO_INT128_MIN is reachable
+    STOInt128 units = 0;
+    int digits = 0;
+    int scale = -1;
+    for (; *p; p++) {
+        if (*p == '.' && scale < 0) {
+            scale = 0;
+            continue;
+        }
+        if (*p < '0' || *p > '9') return false;
+        if (__builtin_mul_overflow(units, 10, &units) ||
+            __builtin_sub_overflow(units, *p - '0', &units)) {
+            return false;
+        }
+        digits++;
+        if (scale >= 0) scale++;
+    }
+    if (digits == 0) return false;
+    if (scale < 0) scale = 0;
+    if (scale > STO_DECIMAL128_MAX_SCALE) return false;
+    if (!negative && units == STO_INT128_MIN) return false;
+
+    result->units = negative ? units : -units;
+    result->scale = scale;
+    return true;
+}
+
+int sto_dec128_format(STODecimal128 value, char* buf) {
+    char digits[STO_INT128_STRING_SIZE];
+    int len = sto_int128_format(value.units, digits);
+    const char* d = digits;
+    int pos = 0;
+
+    if (*d == '-') {
+        buf[pos++] = '-';
+        d++;
+        len--;
+    }
+
+    if (value.scale <= 0) {
+        memcpy(buf + pos, d, len);
+        pos += len;
+    } else if (len <= value.scale) {
+        // 0.00ddd
+        buf[pos++] = '0';
+        buf[pos++] = '.';
+        memset(buf + pos, '0', value.scale - len);
+        pos += value.scale - len;
+        memcpy(buf + pos, d, len);
+        pos += len;
+    } else {
+        int int_len = len - value.scale;
+        memcpy(buf + pos, d, int_len);
+        pos += int_len;
+        buf[pos++] = '.';
+        memcpy(buf + pos, d + int_len, value.scale);
+        pos += value.scale;
+    }
+
+    buf[pos] = '\0';
+    return pos;
+}
+
+char* sto_dec128_to_string(STODecimal128 value) {
+    char buf[STO_DECIMAL_STRING_SIZE];
+    int len = sto_dec128_format(value, buf);
+
+    char* str = (char*)malloc(len + 1);
+    if (str) memcpy(str, buf, len + 1);
+    return str;
+}
+
+int sto_dec128_fprint(STODecimal128 value, FILE* out) {
+    if (!out) return -1;
+
+    char buf[STO_DECIMAL_STRING_SIZE];
+    int len = sto_dec128_format(value, buf);
+    return fwrite(buf, 1, len, out) == (size_t)len ? len : -1;
+}
+
+// ============================================================================
+// DECIMAL64 Operations
+// ============================================================================
+
+bool sto_dec64_add(STODecimal64 a, STODecimal64 b, STODecimal64* result) {
+    if (a.scale == b.scale) {
+        result->scale = a.scale;
+        return __builtin_add_overflow(a.units, b.units, &result->units);
+    }
+
+    STODecimal128 wide;
+    return sto_dec128_add(widen(a), widen(b), &wide) || narrow(wide, result);
+}
+
+bool sto_dec64_sub(STODecimal64 a, STODecimal64 b, STODecimal64* result) {
+    if (a.scale == b.scale) {
+        result->scale = a.scale;
+        return __builtin_sub_overflow(a.units, b.units, &result->units);
+    }
+
+    STODecimal128 wide;
+    return sto_dec128_sub(widen(a), widen(b), &wide) || narrow(wide, result);
+}
+
+bool sto_dec64_mul(STODecimal64 a, STODecimal64 b, STODecimal64* result) {
+    if (a.scale + b.scale > STO_DECIMAL64_MAX_SCALE) return true;
+    result->scale = a.scale + b.scale;
+    return __builtin_mul_overflow(a.units, b.units, &result->units);
+}
+
+bool sto_dec64_div(STODecimal64 a, STODecimal64 b, int scale,
+                   STORoundingMode mode, STODecimal64* result) {
+    STODecimal128 wide;
+    return sto_dec128_div(widen(a), widen(b), scale, mode, &wide) || narrow(wide, result);
+}
+
+bool sto_dec64_rescale(STODecimal64 a, int scale, STORoundingMode mode, STODecimal64* result) {
+    STODecimal128 wide;
+    return sto_dec128_rescale(widen(a), scale, mode, &wide) || narrow(wide, result);
+}
+
+int sto_dec64_compare(STODecimal64 a, STODecimal64 b) {
+    if (a.scale == b.scale) return (a.units > b.units) - (a.units < b.units);
+    return sto_dec128_compare(widen(a), widen(b));
+}
+
+bool sto_dec64_from_string(const char* str, STODecimal64* result) {
+    STODecimal128 wide;
+    return sto_dec128_from_string(str, &wide) && !narrow(wide, result);
+}
+
+int sto_dec64_format(STODecimal64 value, char* buf) {
+    return sto_dec128_format(widen(value), buf);
+}
+
+int sto_dec64_fprint(STODecimal64 value, FILE* out) {
+    return sto_dec128_fprint(widen(value), out);
+}
+
+// ============================================================================
+// Tiered Decimal
+// ============================================================================
+
+STODecimal sto_decimal_from_dec64(STODecimal64 value) {
+    STODecimal r;
+    r.type = INTERNAL_TYPE_DECIMAL64;
+    r.value.d64 = value;
+    return r;
+}
+
+STODecimal sto_decimal_from_dec128(STODecimal128 value) {
+    STODecimal64 small;
+    if (!narrow(value, &small)) return sto_decimal_from_dec64(small);
+
+    STODecimal r;
+    r.type = INTERNAL_TYPE_DECIMAL128;
+    r.value.d128 = value;
+    return r;
+}
+
+static STODecimal decimal_invalid(void) {
+    STODecimal r;
+    memset(&r, 0, sizeof(r));
+    r.type = INTERNAL_TYPE_UNKNOWN;
+    return r;
+}
+
+// Wrap a fresh BigDecimal result, demoting when it fits 128-bit units
+static STODecimal decimal_from_bigdec(BigDecimal* bd) {
+    if (!bd) return decimal_invalid();
+
+    STODecimal128 wide;
+    if (bd->scale <= STO_DECIMAL128_MAX_SCALE && sto_bigdec_units_int128(bd, &wide.units)) {
+        wide.scale = bd->scale;
+        sto_bigdec_free(bd);
+        return sto_decimal_from_dec128(wide);
+    }
+
+    STODecimal r;
+    r.type = INTERNAL_TYPE_BIGDECIMAL;
+    r.value.big = bd;
+    return r;
+}
+
+static bool decimal_is_fixed(STODecimal v) {
+    return v.type == INTERNAL_TYPE_DECIMAL64 || v.type == INTERNAL_TYPE_DECIMAL128;
+}
+
+static STODecimal128 decimal_as_dec128(STODecimal v) {
+    return (v.type == INTERNAL_TYPE_DECIMAL64) ? widen(v.value.d64) : v.value.d128;
+}
+
+// BigDecimal view of any tier; DECIMAL64/128 become an inline value in
+// 'storage' (no allocation, nothing to free)
+static BigDecimal* decimal_as_bigdec(STODecimal v, BigDecimal* storage) {
+    if (!decimal_is_fixed(v)) return v.value.big;
+
+    STODecimal128 w = decimal_as_dec128(v);
+    sto_bigdec_init_int128(storage, w.units, w.scale);
+    return storage;
+}
+
+STODecimal sto_decimal_from_string(const char* str) {
+    STODecimal128 wide;
+    if (sto_dec128_from_string(str, &wide)) return sto_decimal_from_dec128(wide);
+
+    // Too long for 128 bits, or exponent form
+    return decimal_from_bigdec(sto_bigdec_from_string(str));
+}
+
+typedef enum { DECIMAL_ADD, DECIMAL_SUB, DECIMAL_MUL } DecimalOp;
+
+static STODecimal decimal_apply(DecimalOp op, STODecimal a, STODecimal b) {
+    if (a.type == INTERNAL_TYPE_UNKNOWN || b.type == INTERNAL_TYPE_UNKNOWN) {
+        return decimal_invalid();
+    }
+
+    // DECIMAL64 tier: registers only
+    if (a.type == INTERNAL_TYPE_DECIMAL64 && b.type == INTERNAL_TYPE_DECIMAL64) {
+        STODecimal64 r;
+        bool overflow = (op == DECIMAL_ADD) ? sto_dec64_add(a.value.d64, b.value.d64, &r)
+                      : (op == DECIMAL_SUB) ? sto_dec64_sub(a.value.d64, b.value.d64, &r)
+                      : sto_dec64_mul(a.value.d64, b.value.d64, &r);
+        if (!overflow) return sto_decimal_from_dec64(r);
+    }
+
+    // DECIMAL128 tier: BigDecimal only once 128-bit units overflow
+    if (decimal_is_fixed(a) && decimal_is_fixed(b)) {
+        STODecimal128 x = decimal_as_dec128(a);
+        STODecimal128 y = decimal_as_dec128(b);
+        STODecimal128 r;
+        bool overflow = (op == DECIMAL_ADD) ? sto_dec128_add(x, y, &r)
+                      : (op == DECIMAL_SUB) ? sto_dec128_sub(x, y, &r)
+                      : sto_dec128_mul(x, y, &r);
+        if (!overflow) return sto_decimal_from_dec128(r);
+    }
+
+    BigDecimal storage_a, storage_b;
+    BigDecimal* x = decimal_as_bigdec(a, &storage_a);
+    BigDecimal* y = decimal_as_bigdec(b, &storage_b);
+    BigDecimal* r = (op == DECIMAL_ADD) ? sto_bigdec_add(x, y)
+                  : (op == DECIMAL_SUB) ? sto_bigdec_sub(x, y)
+                  : sto_bigdec_mul(x, y);
+    return decimal_from_bigdec(r);
+}
+
+STODecimal sto_decimal_add(STODecimal a, STODecimal b) {
+    return decimal_apply(DECIMAL_ADD, a, b);
+}
+
+STODecimal sto_decimal_sub(STODecimal a, STODecimal b) {
+    return decimal_apply(DECIMAL_SUB, a, b);
+}
+
+STODecimal sto_decimal_mul(STODecimal a, STODecimal b) {
+    return decimal_apply(DECIMAL_MUL, a, b);
+}
+
+STODecimal sto_decimal_div(STODecimal a, STODecimal b, int scale, STORoundingMode mode) {
+    if (a.type == INTERNAL_TYPE_UNKNOWN || b.type == INTERNAL_TYPE_UNKNOWN || scale < 0) {
+        return decimal_invalid();
+    }
+
+    // Division by zero has no tier to land in
+    bool zero = decimal_is_fixed(b) ? decimal_as_dec128(b).units == 0
+                                    : b.value.big->length == 0;
+    if (zero) return decimal_invalid();
+
+    if (decimal_is_fixed(a) && decimal_is_fixed(b)) {
+        STODecimal128 r;
+        if (!sto_dec128_div(decimal_as_dec128(a), decimal_as_dec128(b), scale, mode, &r)) {
+            return sto_decimal_from_dec128(r);
+        }
+    }
+
+    BigDecimal storage_a, storage_b;
+    BigDecimal* x = decimal_as_bigdec(a, &storage_a);
+    BigDecimal* y = decimal_as_bigdec(b, &storage_b);
+    BigDecimal* r = sto_bigdec_div_round(x, y, scale, mode);
+    return decimal_from_bigdec(r);
+}
+
+int sto_decimal_compare(STODecimal a, STODecimal b) {
+    if (decimal_is_fixed(a) && decimal_is_fixed(b)) {
+        return sto_dec128_compare(decimal_as_dec128(a), decimal_as_dec128(b));
+    }
+
+    BigDecimal storage_a, storage_b;
+    return sto_bigdec_compare(decimal_as_bigdec(a, &storage_a),
+                              decimal_as_bigdec(b, &storage_b));
+}
+
+char* sto_decimal_to_string(STODecimal value) {
+    switch (value.type) {
+        case INTERNAL_TYPE_DECIMAL64: return sto_dec128_to_string(widen(value.value.d64));
+        case INTERNAL_TYPE_DECIMAL128: return sto_dec128_to_string(value.value.d128);
+        case INTERNAL_TYPE_BIGDECIMAL: return sto_bigdec_to_string(value.value.big);
+        default: return NULL;
+    }
+}
+
+void sto_decimal_free(STODecimal value) {
+    if (value.type == INTERNAL_TYPE_BIGDECIMAL) {
+        sto_bigdec_free(value.value.big);
+    }
+}
@@ -0,0 +1,127 @@
+#ifndef FIXED_DECIMAL_H
+#define FIXED_DECIMAL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "sto_types.h"
+#include "int128.h"
+#include "bigdecimal.h"
+
+// ============================================================================
+// DECIMAL64 / DECIMAL128 - Fixed-Point Decimal Tier
+// ============================================================================
+// value = units / 10^scale, units a scaled integer (money: scale 2-6).
+//
+// STODecimal64 is 16 bytes and is passed/returned in two registers; all of
+// its operations are exact integer arithmetic with no heap. A result that
+// does not fit reports overflow, and the tiered STODecimal then moves to
+// DECIMAL128 and finally BigDecimal (like STOInteger for INT64/INT128).
+//
+// Division and rescaling round with STORoundingMode (bigdecimal.h).
+// Text form matches sto_bigdec_to_string(): all 'scale' digits are kept
+// ("1.50", "-0.05").
+
+#define STO_DECIMAL64_MAX_SCALE 18
+#define STO_DECIMAL128_MAX_SCALE 38
+
+// Sign + 39 digits + "0." + NUL, with room to spare
+#define STO_DECIMAL_STRING_SIZE 48
+
+typedef struct {
+    int64_t units;
+    int32_t scale;      // 0..STO_DECIMAL64_MAX_SCALE
+} STODecimal64;
+
+typedef struct {
+    STOInt128 units;
+    int32_t scale;      // 0..STO_DECIMAL128_MAX_SCALE
+} STODecimal128;
+
+// ============================================================================
+// DECIMAL64 Operations
+// ============================================================================
+// Same contract as sto_int128_add(): returns true when the result does not
+// fit (units or scale out of range, division by zero), false otherwise.
+// add/sub use the larger scale, mul the sum of scales (all exact).
+
+bool sto_dec64_add(STODecimal64 a, STODecimal64 b, STODecimal64* result);
+bool sto_dec64_sub(STODecimal64 a, STODecimal64 b, STODecimal64* result);
+bool sto_dec64_mul(STODecimal64 a, STODecimal64 b, STODecimal64* result);
+
+// a / b with 'scale' digits after the point, rounded with 'mode'
+bool sto_dec64_div(STODecimal64 a, STODecimal64 b, int scale,
+                   STORoundingMode mode, STODecimal64* result);
+
+// Same value at another scale (rounded with 'mode' when digits are dropped)
+bool sto_dec64_rescale(STODecimal64 a, int scale, STORoundingMode mode, STODecimal64* result);
+
+// Compare (-1: a<b, 0: a==b, 1: a>b), exact across scales
+int sto_dec64_compare(STODecimal64 a, STODecimal64 b);
+
+// Parse "[+-]digits[.digits]"; false if malformed or out of range
+bool sto_dec64_from_string(const char* str, STODecimal64* result);
+
+// Decimal text into buf (at least STO_DECIMAL_STRING_SIZE bytes)
+// Returns string length
+int sto_dec64_format(STODecimal64 value, char* buf);
+
+// Write decimal text to 'out'; returns characters written, -1 on error
+int sto_dec64_fprint(STODecimal64 value, FILE* out);
+
+// ============================================================================
+// DECIMAL128 Operations (same contracts, 128-bit units)
+// ============================================================================
+
+bool sto_dec128_add(STODecimal128 a, STODecimal128 b, STODecimal128* result);
+bool sto_dec128_sub(STODecimal128 a, STODecimal128 b, STODecimal128* result);
+bool sto_dec128_mul(STODecimal128 a, STODecimal128 b, STODecimal128* result);
+bool sto_dec128_div(STODecimal128 a, STODecimal128 b, int scale,
+                    STORoundingMode mode, STODecimal128* result);
+bool sto_dec128_rescale(STODecimal128 a, int scale, STORoundingMode mode, STODecimal128* result);
+int sto_dec128_compare(STODecimal128 a, STODecimal128 b);
+bool sto_dec128_from_string(const char* str, STODecimal128* result);
+int sto_dec128_format(STODecimal128 value, char* buf);
+
+// Heap copy of the decimal text (caller frees)
+char* sto_dec128_to_string(STODecimal128 value);
+
+// Write decimal text to 'out'; returns characters written, -1 on error
+int sto_dec128_fprint(STODecimal128 value, FILE* out);
+
+// ============================================================================
+// Tiered Decimal (DECIMAL64 -> DECIMAL128 -> BigDecimal)
+// ============================================================================
+// Results use the smallest tier that holds them exactly. A BIGDECIMAL
+// result is a new reference owned by the caller (sto_decimal_free);
+// operands are never consumed. Division by zero and malformed text give
+// type INTERNAL_TYPE_UNKNOWN.
+
+typedef struct {
+    InternalType type;            // DECIMAL64, DECIMAL128 or BIGDECIMAL
+    union {
+        STODecimal64 d64;
+        STODecimal128 d128;
+        BigDecimal* big;
+    } value;
+} STODecimal;
+
+STODecimal sto_decimal_from_dec64(STODecimal64 value);
+STODecimal sto_decimal_from_dec128(STODecimal128 value);
+STODecimal sto_decimal_from_string(const char* str);
+
+STODecimal sto_decimal_add(STODecimal a, STODecimal b);
+STODecimal sto_decimal_sub(STODecimal a, STODecimal b);
+STODecimal sto_decimal_mul(STODecimal a, STODecimal b);
+STODecimal sto_decimal_div(STODecimal a, STODecimal b, int scale, STORoundingMode mode);
+
+// Compare (-1: a<b, 0: a==b, 1: a>b)
+int sto_decimal_compare(STODecimal a, STODecimal b);
+
+// Decimal text (caller frees)
+char* sto_decimal_to_string(STODecimal value);
+
+// Release the BigDecimal of a BIGDECIMAL value (no-op for other tiers)
+void sto_decimal_free(STODecimal value);
+
+#endif
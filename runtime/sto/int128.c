@@ -0,0 +1,228 @@
+// ============================================================================
+// INT128 - Promotion Tier Between INT64 and BigDecimal
+// ============================================================================
+// Overflow-checked __int128 arithmetic, formatting and the tiered
+// INT64 -> INT128 -> BigDecimal integer (see int128.h)
+//
+// Architecture: Modular STO Runtime Component
+// Author: MLP Compiler Team
+// Date: 8 Aralık 2025
+
+#include "int128.h"
+#include "bigdecimal.h"
+#include <stdlib.h>
+#include <string.h>
+
+// ============================================================================
+// INT128 Arithmetic
+// ============================================================================
+
+bool sto_int128_add(STOInt128 a, STOInt128 b, STOInt128* result) {
+    if (__builtin_add_overflow(a, b, result)) {
+        *result = 0;
+        return true;
+    }
+    return false;
+}
+
+bool sto_int128_sub(STOInt128 a, STOInt128 b, STOInt128* result) {
+    if (__builtin_sub_overflow(a, b, result)) {
+        *result = 0;
+        return true;
+    }
+    return false;
+}
+
+bool sto_int128_mul(STOInt128 a, STOInt128 b, STOInt128* result) {
+    if (__builtin_mul_overflow(a, b, result)) {
+        *result = 0;
+        return true;
+    }
+    return false;
+}
+
+STOInt128 sto_int128_add_i64(int64_t a, int64_t b) {
+    return (STOInt128)a + b;
+}
+
+STOInt128 sto_int128_sub_i64(int64_t a, int64_t b) {
+    return (STOInt128)a - b;
+}
+
+STOInt128 sto_int128_mul_i64(int64_t a, int64_t b) {
+    return (STOInt128)a * b;
+}
+
+bool sto_int128_fits_i64(STOInt128 value) {
+    return value >= INT64_MIN && value <= INT64_MAX;
+}
+
+int sto_int128_compare(STOInt128 a, STOInt128 b) {
+    return (a > b) - (a < b);
+}
+
+// ============================================================================
+// INT128 Formatting
+// ============================================================================
+
+int sto_int128_format(STOInt128 value, char* buf) {
+    // Work on the magnitude so STO_INT128_MIN needs no special case
+    unsigned __int128 magnitude = (value < 0) ? -(unsigned __int128)value
+                                              : (unsigned __int128)value;
+    char digits[STO_INT128_STRING_SIZE];
+    int pos = sizeof(digits);
+
+    // Peel 19-digit chunks with 64-bit division (one 128-bit divide each)
+    do {
+        uint64_t chunk = (uint64_t)(magnitude % 10000000000000000000ULL);
+        magnitude /= 10000000000000000000ULL;
+        for (int i = 0; i < 19 && (chunk > 0 || magnitude > 0); i++) {
+            digits[--pos] = (char)('0' + chunk % 10);
+            chunk /= 10;
+        }
+    } while (magnitude > 0);
+    if (pos == (int)sizeof(digits)) digits[--pos] = '0';
+
+    int len = 0;
+    if (value < 0) buf[len++] = '-';
+    memcpy(buf + len, digits + pos, sizeof(digits) - pos);
+    len += (int)sizeof(digits) - pos;
+    buf[len] = '\0';
+    return len;
+}
+
+char* sto_int128_to_string(STOInt128 value) {
+    char buf[STO_INT128_STRING_SIZE];
+    int len = sto_int128_format(value, buf);
+
+    char* str = (char*)malloc(len + 1);
+    if (str) memcpy(str, buf, len + 1);
+    return str;
+}
+
+int sto_int128_fprint(STOInt128 value, FILE* out) {
+    if (!out) return -1;
+
+    char buf[STO_INT128_STRING_SIZE];
+    int len = sto_int128_format(value, buf);
+    return fwrite(buf, 1, len, out) == (size_t)len ? len : -1;
+}
+
+// ============================================================================
+// Tiered Integer
+// ============================================================================
+
+STOInteger sto_integer_from_i64(int64_t value) {
+    STOInteger r;
+    r.type = INTERNAL_TYPE_INT64;
+    r.value.i64 = value;
+    return r;
+}
+
+STOInteger sto_integer_from_i128(STOInt128 value) {
+    if (sto_int128_fits_i64(value)) {
+        return sto_integer_from_i64((int64_t)value);
+    }
+
+    STOInteger r;
+    r.type = INTERNAL_TYPE_INT128;
+    r.value.i128 = value;
+    return r;
+}
+
+// Wrap a fresh BigDecimal result, demoting when it fits 128 bits
+static STOInteger integer_from_bigdec(BigDecimal* bd) {
+    STOInt128 small;
+    if (bd && sto_bigdec_to_int128(bd, &small)) {
+        sto_bigdec_free(bd);
+        return sto_integer_from_i128(small);
+    }
+
+    STOInteger r;
+    r.type = INTERNAL_TYPE_BIGDECIMAL;
+    r.value.big = bd;
+    return r;
+}
+
+static STOInt128 integer_as_i128(STOInteger v) {
+    return (v.type == INTERNAL_TYPE_INT64) ? (STOInt128)v.value.i64 : v.value.i128;
+}
+
+// BigDecimal view of any tier; INT64/INT128 become an inline value in
+// 'storage' (no allocation, nothing to free)
+static BigDecimal* integer_as_bigdec(STOInteger v, BigDecimal* storage) {
+    if (v.type == INTERNAL_TYPE_BIGDECIMAL) return v.value.big;
+
+    sto_bigdec_init_int128(storage, integer_as_i128(v), 0);
+    return storage;
+}
+
+typedef enum { INTEGER_ADD, INTEGER_SUB, INTEGER_MUL } IntegerOp;
+
+static STOInteger integer_apply(IntegerOp op, STOInteger a, STOInteger b) {
+    // INT64 tier: overflow is exact in 128 bits
+    if (a.type == INTERNAL_TYPE_INT64 && b.type == INTERNAL_TYPE_INT64) {
+        int64_t x = a.value.i64;
+        int64_t y = b.value.i64;
+        switch (op) {
+            case INTEGER_ADD: return sto_integer_from_i128(sto_int128_add_i64(x, y));
+            case INTEGER_SUB: return sto_integer_from_i128(sto_int128_sub_i64(x, y));
+            case INTEGER_MUL: return sto_integer_from_i128(sto_int128_mul_i64(x, y));
+        }
+    }
+
+    // INT128 tier: BigDecimal only once 128 bits overflow
+    if (a.type != INTERNAL_TYPE_BIGDECIMAL && b.type != INTERNAL_TYPE_BIGDECIMAL) {
+        STOInt128 x = integer_as_i128(a);
+        STOInt128 y = integer_as_i128(b);
+        STOInt128 r;
+        bool overflow = (op == INTEGER_ADD) ? sto_int128_add(x, y, &r)
+                      : (op == INTEGER_SUB) ? sto_int128_sub(x, y, &r)
+                      : sto_int128_mul(x, y, &r);
+        if (!overflow) return sto_integer_from_i128(r);
+    }
+
+    BigDecimal storage_a, storage_b;
+    BigDecimal* x = integer_as_bigdec(a, &storage_a);
+    BigDecimal* y = integer_as_bigdec(b, &storage_b);
+    BigDecimal* r = (op == INTEGER_ADD) ? sto_bigdec_add(x, y)
+                  : (op == INTEGER_SUB) ? sto_bigdec_sub(x, y)
+                  : sto_bigdec_mul(x, y);
+    return integer_from_bigdec(r);
+}
+
+STOInteger sto_integer_add(STOInteger a, STOInteger b) {
+    return integer_apply(INTEGER_ADD, a, b);
+}
+
+STOInteger sto_integer_sub(STOInteger a, STOInteger b) {
+    return integer_apply(INTEGER_SUB, a, b);
+}
+
+STOInteger sto_integer_mul(STOInteger a, STOInteger b) {
+    return integer_apply(INTEGER_MUL, a, b);
+}
+
+int sto_integer_compare(STOInteger a, STOInteger b) {
+    if (a.type != INTERNAL_TYPE_BIGDECIMAL && b.type != INTERNAL_TYPE_BIGDECIMAL) {
+        return sto_int128_compare(integer_as_i128(a), integer_as_i128(b));
+    }
+
+    BigDecimal storage_a, storage_b;
+    return sto_bigdec_compare(integer_as_bigdec(a, &storage_a),
+                              integer_as_bigdec(b, &storage_b));
+}
+
+char* sto_integer_to_string(STOInteger value) {
+    switch (value.type) {
+        case INTERNAL_TYPE_INT64: return sto_int128_to_string(value.value.i64);
+        case INTERNAL_TYPE_INT128: return sto_int128_to_string(value.value.i128);
+        default: return sto_bigdec_to_string(value.value.big);
+    }
+}
+
+void sto_integer_free(STOInteger value) {
+    if (value.type == INTERNAL_TYPE_BIGDECIMAL) {
+        sto_bigdec_free(value.value.big);
+    }
+}
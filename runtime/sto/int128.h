@@ -0,0 +1,92 @@
+#ifndef INT128_H
+#define INT128_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "sto_types.h"
+
+// ============================================================================
+// INT128 - Promotion Tier Between INT64 and BigDecimal
+// ============================================================================
+// Used by both runtime_sto.h and sto_runtime.h (like bigdecimal.h).
+//
+// Overflowing INT64 add/sub/mul is always exact in 128 bits (|a * b| <= 2^126),
+// so an overflow lands here first: two registers, no heap. Only a 128-bit
+// overflow promotes to BigDecimal (INTERNAL_TYPE_BIGDECIMAL).
+
+typedef __int128 STOInt128;
+
+#define STO_INT128_MAX ((STOInt128)(((unsigned __int128)1 << 127) - 1))
+#define STO_INT128_MIN (-STO_INT128_MAX - 1)
+
+// Sign + 39 digits + NUL
+#define STO_INT128_STRING_SIZE 41
+
+struct BigDecimal;
+
+// ============================================================================
+// INT128 Arithmetic (overflow-checked)
+// ============================================================================
+// Same contract as sto_runtime_safe_add(): returns true on overflow
+// (result set to 0), false otherwise.
+
+bool sto_int128_add(STOInt128 a, STOInt128 b, STOInt128* result);
+bool sto_int128_sub(STOInt128 a, STOInt128 b, STOInt128* result);
+bool sto_int128_mul(STOInt128 a, STOInt128 b, STOInt128* result);
+
+// Exact widening INT64 operations (cannot overflow 128 bits)
+STOInt128 sto_int128_add_i64(int64_t a, int64_t b);
+STOInt128 sto_int128_sub_i64(int64_t a, int64_t b);
+STOInt128 sto_int128_mul_i64(int64_t a, int64_t b);
+
+// True if value is in the INT64 range
+bool sto_int128_fits_i64(STOInt128 value);
+
+// Compare (-1: a<b, 0: a==b, 1: a>b)
+int sto_int128_compare(STOInt128 a, STOInt128 b);
+
+// Decimal text into buf (at least STO_INT128_STRING_SIZE bytes)
+// Returns string length
+int sto_int128_format(STOInt128 value, char* buf);
+
+// Heap copy of the decimal text (caller frees)
+char* sto_int128_to_string(STOInt128 value);
+
+// Write decimal text to 'out'; returns characters written, -1 on error
+int sto_int128_fprint(STOInt128 value, FILE* out);
+
+// ============================================================================
+// Tiered Integer (INT64 -> INT128 -> BigDecimal)
+// ============================================================================
+// Results always use the smallest tier that holds them, so an INT128 or
+// BigDecimal value that shrinks back into range is demoted again.
+// A BIGDECIMAL result is a new reference owned by the caller
+// (sto_integer_free); operands are never consumed.
+
+typedef struct {
+    InternalType type;            // INT64, INT128 or BIGDECIMAL
+    union {
+        int64_t i64;
+        STOInt128 i128;
+        struct BigDecimal* big;
+    } value;
+} STOInteger;
+
+STOInteger sto_integer_from_i64(int64_t value);
+STOInteger sto_integer_from_i128(STOInt128 value);
+
+STOInteger sto_integer_add(STOInteger a, STOInteger b);
+STOInteger sto_integer_sub(STOInteger a, STOInteger b);
+STOInteger sto_integer_mul(STOInteger a, STOInteger b);
+
+// Compare (-1: a<b, 0: a==b, 1: a>b)
+int sto_integer_compare(STOInteger a, STOInteger b);
+
+// Decimal text (caller frees)
+char* sto_integer_to_string(STOInteger value);
+
+// Release the BigDecimal of a BIGDECIMAL value (no-op for other tiers)
+void sto_integer_free(STOInteger value);
+
+#endif
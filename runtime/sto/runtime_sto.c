@@ -60,14 +60,9 @@ bool sto_runtime_mul_will_overflow(int64_t a, int64_t b) {
         return a == INT64_MIN;  // INT64_MIN * -1 overflows
     }
     
-    // General case: check if a * b would overflow
-    // Use division to check: if a * b / a != b, overflow occurred
-    int64_t result = a * b;
-    if (result / a != b) {
-        return true;
-    }
-    
-    return false;
+    // General case: the 128-bit product is exact, check its range
+    // (a * b in int64 would already be undefined on overflow)
+    return !sto_int128_fits_i64(sto_int128_mul_i64(a, b));
 }
 
 // Safe addition with overflow check
@@ -107,167 +102,12 @@ bool sto_runtime_safe_mul(int64_t a, int64_t b, int64_t* result) {
 // ============================================================================
 // Phase 3.2: BigDecimal Runtime
 // ============================================================================
-// Full implementation in bigdecimal.c
-// This file only contains basic creation functions
-
-// Create BigDecimal from INT64
-BigDecimal* sto_bigdec_from_int64(int64_t value) {
-    BigDecimal* bd = (BigDecimal*)malloc(sizeof(BigDecimal));
-    if (!bd) return NULL;
-    
-    bd->negative = (value < 0);
-    uint64_t abs_value = (value < 0) ? (uint64_t)(-(value + 1)) + 1 : (uint64_t)value;
-    
-    // Convert to string
-    char buffer[32];
-    snprintf(buffer, sizeof(buffer), "%llu", (unsigned long long)abs_value);
-    
-    bd->length = strlen(buffer);
-    bd->digits = (char*)malloc(bd->length + 1);
-    strcpy(bd->digits, buffer);
-    bd->refcount = 1;
-    
-    return bd;
-}
-
-// Create BigDecimal from string
-BigDecimal* sto_bigdec_from_string(const char* str) {
-    if (!str) return NULL;
-    
-    BigDecimal* bd = (BigDecimal*)malloc(sizeof(BigDecimal));
-    if (!bd) return NULL;
-    
-    bd->negative = (str[0] == '-');
-    const char* digits = bd->negative ? str + 1 : str;
-    
-    bd->length = strlen(digits);
-    bd->digits = (char*)malloc(bd->length + 1);
-    strcpy(bd->digits, digits);
-    bd->refcount = 1;
-    
-    return bd;
-}
-
-// Convert BigDecimal to string
-char* sto_bigdec_to_string(BigDecimal* bd) {
-    if (!bd) return NULL;
-    
-    size_t len = bd->length + (bd->negative ? 2 : 1);
-    char* str = (char*)malloc(len);
-    if (!str) return NULL;
-    
-    if (bd->negative) {
-        str[0] = '-';
-        strcpy(str + 1, bd->digits);
-    } else {
-        strcpy(str, bd->digits);
-    }
-    
-    return str;
-}
-
-// Compare two BigDecimals
-// Returns: -1 if a < b, 0 if a == b, 1 if a > b
-int sto_bigdec_compare(BigDecimal* a, BigDecimal* b) {
-    if (!a || !b) return 0;
-    
-    // Handle sign differences
-    if (a->negative && !b->negative) return -1;  // negative < positive
-    if (!a->negative && b->negative) return 1;   // positive > negative
-    
-    // Both same sign - compare magnitudes
-    int len_cmp = a->length - b->length;
-    
-    if (len_cmp != 0) {
-        // Different lengths
-        if (a->negative) {
-            // Both negative: longer magnitude = smaller value
-            return len_cmp > 0 ? -1 : 1;
-        } else {
-            // Both positive: longer magnitude = larger value
-            return len_cmp > 0 ? 1 : -1;
-        }
-    }
-    
-    // Same length - compare digit by digit
-    int digit_cmp = strcmp(a->digits, b->digits);
-    
-    if (a->negative) {
-        // Both negative: reverse comparison
-        return digit_cmp > 0 ? -1 : (digit_cmp < 0 ? 1 : 0);
-    } else {
-        // Both positive: normal comparison
-        return digit_cmp > 0 ? 1 : (digit_cmp < 0 ? -1 : 0);
-    }
-}
+// Implemented in bigdecimal.c (limb arithmetic, parsing and formatting)
 
-// Free BigDecimal
-void sto_bigdec_free(BigDecimal* bd) {
-    if (!bd) return;
-    
-    bd->refcount--;
-    if (bd->refcount <= 0) {
-        free(bd->digits);
-        free(bd);
-    }
-}
 // ============================================================================
-
-// Create SSO string from C string
-SSOString* sto_sso_create(const char* str) {
-    if (!str) return NULL;
-    
-    SSOString* sso = (SSOString*)malloc(sizeof(SSOString));
-    if (!sso) return NULL;
-    
-    size_t len = strlen(str);
-    
-    if (len <= 23) {
-        // Use inline storage (SSO)
-        memset(sso->data.inline_data, 0, 24);  // Clear all bytes
-        strcpy(sso->data.inline_data, str);
-        sso->flags = (len << 1);  // Shift left 1, bit 0 = 0 (not heap)
-    } else {
-        // Use heap storage
-        sso->data.heap.heap_ptr = (char*)malloc(len + 1);
-        if (!sso->data.heap.heap_ptr) {
-            free(sso);
-            return NULL;
-        }
-        strcpy(sso->data.heap.heap_ptr, str);
-        sso->data.heap.length = len;
-        sso->data.heap.capacity = len + 1;
-        sso->flags = 1;  // Bit 0 = 1 (is heap)
-    }
-    
-    return sso;
-}
-
-// Get string data (works for both SSO and heap)
-const char* sto_sso_data(SSOString* sso) {
-    if (!sso) return NULL;
-    
-    if (sso->flags & 1) {
-        // Heap string
-        return sso->data.heap.heap_ptr;
-    } else {
-        // SSO string
-        return sso->data.inline_data;
-    }
-}
-
-// Free SSO string
-void sto_sso_free(SSOString* sso) {
-    if (!sso) return;
-    
-    if (sso->flags & 1) {
-        // Heap string - free the pointer
-        free(sso->data.heap.heap_ptr);
-    }
-    // SSO string - nothing to free (inline storage)
-    
-    free(sso);
-}
+// Phase 3.3: SSO String
+// ============================================================================
+// Implemented in sso_string.c (24-byte by-value strings, in-place append)
 
 // ============================================================================
 // Phase 3.4: Type Inference
@@ -329,7 +169,7 @@ int sto_infer_string_type(const char* literal) {
     if (!literal) return 0;
     
     size_t len = strlen(literal);
-    return (len > 23) ? 1 : 0;
+    return (len > STO_SSO_CAPACITY) ? 1 : 0;
 }
 
 // ============================================================================
@@ -341,6 +181,13 @@ void sto_print_int64(int64_t value) {
     printf("%lld\n", (long long)value);
 }
 
+// Print INT128 to stdout with newline
+void sto_print_int128(STOInt128 value) {
+    char buf[STO_INT128_STRING_SIZE];
+    sto_int128_format(value, buf);
+    printf("%s\n", buf);
+}
+
 // Print double to stdout with newline
 void sto_print_double(double value) {
     printf("%g\n", value);
@@ -1,9 +1,12 @@
 // ============================================================================
 // SSO String - Small String Optimization
 // ============================================================================
-// Optimized string storage:
-// - Strings ≤23 bytes: Stored inline (stack) - NO heap allocation
+// Optimized string storage (layout in sso_string.h):
+// - Strings ≤23 bytes: Stored inside the 24-byte value - NO heap allocation
 // - Strings >23 bytes: Stored on heap with pointer
+// - Literals >23 bytes: Pointer to the .rodata text itself (borrowed)
+// SSOStrings are passed by pointer and returned by value, so the caller's
+// variable is the storage; nothing allocates the struct itself.
 //
 // Architecture: Modular STO Runtime Component
 // Author: MLP Compiler Team
@@ -11,208 +14,319 @@
 
 #define _POSIX_C_SOURCE 200809L
 
-#include "runtime_sto.h"
+#include "sso_string.h"
+#include "sto_types.h"
+#include "sto_pool.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 
+// Tag byte as the top byte of heap.capacity
+#define HEAP_TAG_SHIFT ((sizeof(size_t) - 1) * 8)
+#define HEAP_CAPACITY_MASK (((size_t)1 << HEAP_TAG_SHIFT) - 1)
+
+static STOSSOStats sso_stats = {0};
+
 // ============================================================================
-// SSO String Implementation
+// Helper Functions - Layout
 // ============================================================================
 
-// Get string length (works for both SSO and heap)
-size_t sto_sso_length(SSOString* sso) {
-    if (!sso) return 0;
-    
-    if (sso->flags & 1) {
-        // Heap string
-        return sso->data.heap.length;
-    } else {
-        // SSO string - length stored in upper 7 bits of flags
-        return sso->flags >> 1;
+static uint8_t sso_tag(const SSOString* sso) {
+    return (uint8_t)sso->data.inline_data[STO_SSO_CAPACITY];
+}
+
+static char* sso_buffer(SSOString* sso) {
+    return sto_sso_is_heap(sso) ? sso->data.heap.heap_ptr : sso->data.inline_data;
+}
+
+// Inline string of 'length' bytes (caller fills data[0..length))
+static void sso_set_inline_length(SSOString* sso, size_t length) {
+    sso->data.inline_data[length] = '\0';
+    sso->data.inline_data[STO_SSO_CAPACITY] = (char)(STO_SSO_CAPACITY - length);
+}
+
+static void sso_set_heap(SSOString* sso, char* ptr, size_t length, size_t capacity) {
+    sso->data.heap.heap_ptr = ptr;
+    sso->data.heap.length = length;
+    sso->data.heap.capacity = capacity | ((size_t)STO_SSO_HEAP_TAG << HEAP_TAG_SHIFT);
+}
+
+// Borrow a NUL-terminated literal: capacity == length, so any append
+// goes through sto_sso_reserve, which copies instead of reallocating
+static void sso_set_rodata(SSOString* sso, const char* text, size_t length) {
+    sso_set_heap(sso, (char*)text, length, length);
+    sso->data.heap.capacity |= (size_t)STO_SSO_RODATA_TAG << HEAP_TAG_SHIFT;
+    sso_stats.rodata_borrows++;
+}
+
+static SSOString sso_empty(void) {
+    SSOString sso;
+    memset(&sso, 0, sizeof(sso));
+    sso_set_inline_length(&sso, 0);
+    return sso;
+}
+
+// Uninitialized string of 'length' bytes; returns its buffer, or NULL
+// (result left empty) when the heap buffer cannot be allocated
+static char* sso_init(SSOString* sso, size_t length) {
+    if (length <= STO_SSO_CAPACITY) {
+        sso_set_inline_length(sso, length);
+        sso_stats.inline_results++;
+        return sso->data.inline_data;
     }
+
+    char* ptr = (char*)sto_pool_alloc(length + 1, STO_POOL_STRING);
+    if (!ptr) {
+        *sso = sso_empty();
+        return NULL;
+    }
+    ptr[length] = '\0';
+    sso_set_heap(sso, ptr, length, length);
+    sso_stats.heap_allocations++;
+    sso_stats.heap_bytes += length + 1;
+    return ptr;
+}
+
+// ============================================================================
+// Creation / Access
+// ============================================================================
+
+SSOString sto_sso_from_bytes(const char* data, size_t length) {
+    SSOString sso;
+    if (length > STO_SSO_CAPACITY && sto_is_rodata(data) && data[length] == '\0') {
+        sso_set_rodata(&sso, data, length);
+        return sso;
+    }
+    char* buffer = sso_init(&sso, data ? length : 0);
+    if (buffer && data) memcpy(buffer, data, length);
+    return sso;
+}
+
+SSOString sto_sso_create(const char* str) {
+    return sto_sso_from_bytes(str, str ? strlen(str) : 0);
+}
+
+// Integer to string conversion
+SSOString sto_sso_from_int64(int64_t value) {
+    char buffer[32];
+    int length = snprintf(buffer, sizeof(buffer), "%lld", (long long)value);
+    return sto_sso_from_bytes(buffer, (size_t)length);
+}
+
+const char* sto_sso_data(const SSOString* sso) {
+    if (!sso) return NULL;
+    return sto_sso_is_heap(sso) ? sso->data.heap.heap_ptr : sso->data.inline_data;
+}
+
+size_t sto_sso_length(const SSOString* sso) {
+    if (!sso) return 0;
+    if (sto_sso_is_heap(sso)) return sso->data.heap.length;
+    return STO_SSO_CAPACITY - sso_tag(sso);
+}
+
+size_t sto_sso_capacity(const SSOString* sso) {
+    if (!sso) return 0;
+    if (sto_sso_is_heap(sso)) return sso->data.heap.capacity & HEAP_CAPACITY_MASK;
+    return STO_SSO_CAPACITY;
+}
+
+bool sto_sso_is_heap(const SSOString* sso) {
+    return (sso_tag(sso) & STO_SSO_HEAP_TAG) != 0;
+}
+
+bool sto_sso_is_rodata(const SSOString* sso) {
+    return (sso_tag(sso) & STO_SSO_RODATA_TAG) != 0;
 }
 
+// ============================================================================
+// Operations
+// ============================================================================
+
 // SSO string concatenation
-SSOString* sto_sso_concat(SSOString* a, SSOString* b) {
-    if (!a || !b) return NULL;
-    
-    const char* str_a = sto_sso_data(a);
-    const char* str_b = sto_sso_data(b);
-    
-    if (!str_a || !str_b) return NULL;
-    
+SSOString sto_sso_concat(const SSOString* a, const SSOString* b) {
     size_t len_a = sto_sso_length(a);
     size_t len_b = sto_sso_length(b);
-    size_t total_len = len_a + len_b;
-    
-    SSOString* result = (SSOString*)malloc(sizeof(SSOString));
-    if (!result) return NULL;
-    
-    if (total_len <= 23) {
-        // Result fits in SSO
-        memset(result->data.inline_data, 0, 24);
-        memcpy(result->data.inline_data, str_a, len_a);
-        memcpy(result->data.inline_data + len_a, str_b, len_b);
-        result->data.inline_data[total_len] = '\0';
-        result->flags = (total_len << 1);  // Store length, bit 0 = 0 (not heap)
-    } else {
-        // Result needs heap
-        result->data.heap.heap_ptr = (char*)malloc(total_len + 1);
-        if (!result->data.heap.heap_ptr) {
-            free(result);
-            return NULL;
-        }
-        memcpy(result->data.heap.heap_ptr, str_a, len_a);
-        memcpy(result->data.heap.heap_ptr + len_a, str_b, len_b);
-        result->data.heap.heap_ptr[total_len] = '\0';
-        result->data.heap.length = total_len;
-        result->data.heap.capacity = total_len + 1;
-        result->flags = 1;  // Bit 0 = 1 (is heap)
+
+    SSOString result;
+    char* buffer = sso_init(&result, len_a + len_b);
+    if (buffer) {
+        memcpy(buffer, sto_sso_data(a), len_a);
+        memcpy(buffer + len_a, sto_sso_data(b), len_b);
     }
-    
     return result;
 }
 
-// String comparison
-int sto_sso_compare(SSOString* a, SSOString* b) {
-    if (!a || !b) return 0;
-    
-    const char* str_a = sto_sso_data(a);
-    const char* str_b = sto_sso_data(b);
-    
-    if (!str_a || !str_b) return 0;
-    
-    return strcmp(str_a, str_b);
+// Substring extraction (clamped to the string; empty past the end)
+SSOString sto_sso_substring(const SSOString* str, size_t start, size_t length) {
+    size_t str_len = sto_sso_length(str);
+    if (start >= str_len) return sso_empty();
+
+    // Adjust length if it exceeds string bounds
+    if (length > str_len - start) {
+        length = str_len - start;
+    }
+    return sto_sso_from_bytes(sto_sso_data(str) + start, length);
 }
 
-// String equality check
-bool sto_sso_equals(SSOString* a, SSOString* b) {
-    return sto_sso_compare(a, b) == 0;
+// String copy - an independent value (short strings and borrowed literals
+// are a plain copy)
+SSOString sto_sso_copy(const SSOString* str) {
+    if (!str) return sso_empty();
+    if (sto_sso_is_rodata(str)) {
+        sso_stats.rodata_borrows++;
+        return *str;
+    }
+    if (!sto_sso_is_heap(str)) {
+        sso_stats.inline_results++;
+        return *str;
+    }
+    return sto_sso_from_bytes(str->data.heap.heap_ptr, str->data.heap.length);
 }
 
-// Substring extraction
-SSOString* sto_sso_substring(SSOString* str, size_t start, size_t length) {
-    if (!str) return NULL;
-    
-    size_t str_len = sto_sso_length(str);
-    if (start >= str_len) return NULL;
-    
-    // Adjust length if it exceeds string bounds
-    if (start + length > str_len) {
-        length = str_len - start;
+bool sto_sso_reserve(SSOString* sso, size_t capacity) {
+    if (capacity <= sto_sso_capacity(sso)) return true;
+
+    size_t length = sto_sso_length(sso);
+    char* ptr;
+    if (sto_sso_is_heap(sso) && !sto_sso_is_rodata(sso)) {
+        ptr = (char*)sto_pool_realloc(sso->data.heap.heap_ptr, sto_sso_capacity(sso) + 1,
+                                      capacity + 1, STO_POOL_STRING);
+        if (!ptr) return false;
+    } else {
+        // Inline text or a borrowed literal: copy into a buffer of our own
+        ptr = (char*)sto_pool_alloc(capacity + 1, STO_POOL_STRING);
+        if (!ptr) return false;
+        memcpy(ptr, sto_sso_data(sso), length + 1);
     }
-    
-    const char* data = sto_sso_data(str);
-    if (!data) return NULL;
-    
-    SSOString* result = (SSOString*)malloc(sizeof(SSOString));
-    if (!result) return NULL;
-    
-    if (length <= 23) {
-        // Result fits in SSO
-        memset(result->data.inline_data, 0, 24);
-        memcpy(result->data.inline_data, data + start, length);
-        result->data.inline_data[length] = '\0';
-        result->flags = (length << 1);
+
+    sso_set_heap(sso, ptr, length, capacity);
+    sso_stats.heap_allocations++;
+    sso_stats.heap_bytes += capacity + 1;
+    return true;
+}
+
+bool sto_sso_append(SSOString* sso, const char* data, size_t length) {
+    if (!sso || (!data && length > 0)) return false;
+    if (length == 0) return true;  // Nothing to write (a borrowed literal stays read-only)
+
+    size_t old_length = sto_sso_length(sso);
+    size_t new_length = old_length + length;
+    size_t capacity = sto_sso_capacity(sso);
+
+    if (new_length > capacity) {
+        // 'data' may live in the buffer that is about to move
+        const char* base = sso_buffer(sso);
+        bool aliased = data >= base && data < base + old_length;
+        size_t offset = aliased ? (size_t)(data - base) : 0;
+
+        size_t grown = capacity * 2;
+        if (!sto_sso_reserve(sso, grown > new_length ? grown : new_length)) return false;
+        if (aliased) data = sso->data.heap.heap_ptr + offset;
+    }
+
+    char* buffer = sso_buffer(sso);
+    memmove(buffer + old_length, data, length);
+    if (sto_sso_is_heap(sso)) {
+        buffer[new_length] = '\0';
+        sso->data.heap.length = new_length;
     } else {
-        // Result needs heap
-        result->data.heap.heap_ptr = (char*)malloc(length + 1);
-        if (!result->data.heap.heap_ptr) {
-            free(result);
-            return NULL;
-        }
-        memcpy(result->data.heap.heap_ptr, data + start, length);
-        result->data.heap.heap_ptr[length] = '\0';
-        result->data.heap.length = length;
-        result->data.heap.capacity = length + 1;
-        result->flags = 1;
+        sso_set_inline_length(sso, new_length);
     }
-    
-    return result;
+    return true;
 }
 
-// String to integer conversion
-int64_t sto_sso_to_int64(SSOString* str) {
-    if (!str) return 0;
-    
-    const char* data = sto_sso_data(str);
-    if (!data) return 0;
-    
-    return atoll(data);
+bool sto_sso_append_sso(SSOString* sso, const SSOString* other) {
+    return sto_sso_append(sso, sto_sso_data(other), sto_sso_length(other));
 }
 
-// Integer to string conversion
-SSOString* sto_sso_from_int64(int64_t value) {
-    char buffer[32];
-    snprintf(buffer, sizeof(buffer), "%lld", (long long)value);
-    return sto_sso_create(buffer);
+// String comparison
+int sto_sso_compare(const SSOString* a, const SSOString* b) {
+    if (!a || !b) return 0;
+
+    size_t len_a = sto_sso_length(a);
+    size_t len_b = sto_sso_length(b);
+    int cmp = memcmp(sto_sso_data(a), sto_sso_data(b), len_a < len_b ? len_a : len_b);
+    if (cmp == 0) cmp = (len_a > len_b) - (len_a < len_b);
+    return (cmp > 0) - (cmp < 0);
+}
+
+// String equality check (length first: unequal lengths never touch the text)
+bool sto_sso_equals(const SSOString* a, const SSOString* b) {
+    if (!a || !b) return a == b;
+
+    size_t length = sto_sso_length(a);
+    return length == sto_sso_length(b) &&
+           memcmp(sto_sso_data(a), sto_sso_data(b), length) == 0;
+}
+
+// String to integer conversion
+int64_t sto_sso_to_int64(const SSOString* str) {
+    if (!str) return 0;
+    return atoll(sto_sso_data(str));
 }
 
 // String find - returns index of first occurrence, or -1 if not found
-int sto_sso_find(SSOString* haystack, const char* needle) {
+int sto_sso_find(const SSOString* haystack, const char* needle) {
     if (!haystack || !needle) return -1;
-    
+
     const char* data = sto_sso_data(haystack);
-    if (!data) return -1;
-    
     const char* found = strstr(data, needle);
     if (!found) return -1;
-    
+
     return (int)(found - data);
 }
 
-// String copy - creates a new independent copy
-SSOString* sto_sso_copy(SSOString* str) {
-    if (!str) return NULL;
-    
-    const char* data = sto_sso_data(str);
-    if (!data) return NULL;
-    
-    return sto_sso_create(data);
+// String starts with
+bool sto_sso_starts_with(const SSOString* str, const char* prefix) {
+    if (!str || !prefix) return false;
+
+    size_t prefix_len = strlen(prefix);
+    if (prefix_len > sto_sso_length(str)) return false;
+
+    return memcmp(sto_sso_data(str), prefix, prefix_len) == 0;
+}
+
+// String ends with
+bool sto_sso_ends_with(const SSOString* str, const char* suffix) {
+    if (!str || !suffix) return false;
+
+    size_t suffix_len = strlen(suffix);
+    size_t str_len = sto_sso_length(str);
+    if (suffix_len > str_len) return false;
+
+    return memcmp(sto_sso_data(str) + (str_len - suffix_len), suffix, suffix_len) == 0;
 }
 
 // Convert to C string (caller must free)
-char* sto_sso_to_cstring(SSOString* str) {
+char* sto_sso_to_cstring(const SSOString* str) {
     if (!str) return NULL;
-    
-    const char* data = sto_sso_data(str);
-    if (!data) return NULL;
-    
+
     size_t len = sto_sso_length(str);
     char* result = (char*)malloc(len + 1);
     if (!result) return NULL;
-    
-    strcpy(result, data);
+
+    memcpy(result, sto_sso_data(str), len + 1);
     return result;
 }
 
-// String starts with
-bool sto_sso_starts_with(SSOString* str, const char* prefix) {
-    if (!str || !prefix) return false;
-    
-    const char* data = sto_sso_data(str);
-    if (!data) return false;
-    
-    size_t prefix_len = strlen(prefix);
-    size_t str_len = sto_sso_length(str);
-    
-    if (prefix_len > str_len) return false;
-    
-    return strncmp(data, prefix, prefix_len) == 0;
+// Free SSO string (only heap strings own memory; borrowed literals do not)
+void sto_sso_free(SSOString* sso) {
+    if (!sso) return;
+
+    if (sto_sso_is_heap(sso) && !sto_sso_is_rodata(sso)) {
+        sto_pool_free(sso->data.heap.heap_ptr, sto_sso_capacity(sso) + 1, STO_POOL_STRING);
+    }
+    *sso = sso_empty();
 }
 
-// String ends with
-bool sto_sso_ends_with(SSOString* str, const char* suffix) {
-    if (!str || !suffix) return false;
-    
-    const char* data = sto_sso_data(str);
-    if (!data) return false;
-    
-    size_t suffix_len = strlen(suffix);
-    size_t str_len = sto_sso_length(str);
-    
-    if (suffix_len > str_len) return false;
-    
-    return strcmp(data + (str_len - suffix_len), suffix) == 0;
+// ============================================================================
+// Allocation Statistics
+// ============================================================================
+
+STOSSOStats sto_sso_get_stats(void) {
+    return sso_stats;
+}
+
+void sto_sso_reset_stats(void) {
+    memset(&sso_stats, 0, sizeof(sso_stats));
 }
@@ -0,0 +1,120 @@
+#ifndef SSO_STRING_H
+#define SSO_STRING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// ============================================================================
+// SSOString - Canonical 24-Byte Small String
+// ============================================================================
+// Used by both runtime_sto.h (sto_sso_*) and sto_runtime.h (sso_*).
+//
+// An SSOString is a plain 24-byte value owned by whoever holds it (a local,
+// a struct field, a list slot). Strings of up to STO_SSO_CAPACITY bytes live
+// entirely inside it, so creating, copying or concatenating them never
+// touches the heap. Longer strings keep a heap buffer that sto_sso_free()
+// releases. A longer string literal (INTERNAL_TYPE_RODATA_STRING, see
+// sto_is_rodata) is not copied at all: the heap form points at the
+// literal and is marked read-only, so it is never written or freed; the
+// first append moves it into a buffer of its own.
+//
+// Layout (the last byte tells the two apart):
+//   inline: data[0..len) '\0' ... | last byte = STO_SSO_CAPACITY - len
+//           (a 23-byte string's last byte is 0 and doubles as its NUL)
+//   heap:   ptr | length | capacity with STO_SSO_HEAP_TAG in its top byte
+//           (plus STO_SSO_RODATA_TAG when ptr is a borrowed literal)
+//
+// Text is always NUL-terminated; lengths are explicit, so embedded NULs
+// survive concat/compare/substring.
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "SSOString keeps its tag in the top byte of heap.capacity (little-endian only)"
+#endif
+
+#define STO_SSO_CAPACITY 23
+#define STO_SSO_HEAP_TAG 0x80
+#define STO_SSO_RODATA_TAG 0x40
+
+typedef struct {
+    union {
+        char inline_data[STO_SSO_CAPACITY + 1];
+        struct {
+            char* heap_ptr;     // capacity + 1 bytes
+            size_t length;
+            size_t capacity;    // Bytes usable before the NUL, tag in top byte
+        } heap;
+    } data;
+} SSOString;
+
+_Static_assert(sizeof(SSOString) == 24, "SSOString must stay 24 bytes");
+
+// ============================================================================
+// Creation / Access
+// ============================================================================
+// Results come back by value: a short result is fully built in the caller's
+// SSOString. On allocation failure the result is the empty string.
+
+SSOString sto_sso_create(const char* str);                   // NULL -> ""
+SSOString sto_sso_from_bytes(const char* data, size_t length);
+SSOString sto_sso_from_int64(int64_t value);
+
+const char* sto_sso_data(const SSOString* sso);
+size_t sto_sso_length(const SSOString* sso);
+size_t sto_sso_capacity(const SSOString* sso);
+bool sto_sso_is_heap(const SSOString* sso);
+bool sto_sso_is_rodata(const SSOString* sso);   // Heap form borrowing a literal
+
+// ============================================================================
+// Operations
+// ============================================================================
+
+SSOString sto_sso_concat(const SSOString* a, const SSOString* b);
+SSOString sto_sso_substring(const SSOString* str, size_t start, size_t length);
+SSOString sto_sso_copy(const SSOString* str);
+
+// Append in place, growing the buffer geometrically (amortized O(1) per
+// byte; a short string stays inline until it outgrows STO_SSO_CAPACITY).
+// 'data' may point into 'sso'. Returns false (string unchanged) if the
+// buffer cannot grow.
+bool sto_sso_append(SSOString* sso, const char* data, size_t length);
+bool sto_sso_append_sso(SSOString* sso, const SSOString* other);
+
+// Make room for 'capacity' bytes without changing the text
+bool sto_sso_reserve(SSOString* sso, size_t capacity);
+
+// Compare (-1: a<b, 0: a==b, 1: a>b), byte-wise
+int sto_sso_compare(const SSOString* a, const SSOString* b);
+bool sto_sso_equals(const SSOString* a, const SSOString* b);
+
+int64_t sto_sso_to_int64(const SSOString* str);
+
+// Index of the first occurrence of needle, or -1
+int sto_sso_find(const SSOString* haystack, const char* needle);
+
+bool sto_sso_starts_with(const SSOString* str, const char* prefix);
+bool sto_sso_ends_with(const SSOString* str, const char* suffix);
+
+// Heap copy of the text (caller frees)
+char* sto_sso_to_cstring(const SSOString* str);
+
+// Release the heap buffer (if any); 'sso' becomes the empty string
+void sto_sso_free(SSOString* sso);
+
+// ============================================================================
+// Allocation Statistics
+// ============================================================================
+// Cumulative since start (or sto_sso_reset_stats()); reported through
+// sto_get_mem_stats(). Process-wide counters, not thread-safe.
+
+typedef struct {
+    size_t heap_allocations;     // Buffers allocated or regrown
+    size_t heap_bytes;           // Bytes of those buffers
+    size_t inline_results;       // Strings built without touching the heap
+    size_t rodata_borrows;       // Long literals used in place (no copy)
+} STOSSOStats;
+
+STOSSOStats sto_sso_get_stats(void);
+void sto_sso_reset_stats(void);
+
+#endif
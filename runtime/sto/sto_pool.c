@@ -0,0 +1,412 @@
+/**
+ * STO Pool - Size-Class Allocator
+ * 64 KB slabs per size class, per-thread free lists, per-type statistics
+ */
+
+#define _POSIX_C_SOURCE 200809L  // pthread_key_create / pthread_once
+
+#include "sto_pool.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SLAB_BYTES (64 * 1024)
+
+// Lock-taking paths stay out of line so the cache hit needs no stack frame
+#define POOL_SLOW __attribute__((noinline, cold))
+
+// Blocks: 16-byte steps to 128, 32-byte to 256, 64-byte to 512
+static const uint16_t class_sizes[STO_POOL_CLASS_COUNT] = {
+    16, 32, 48, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384, 448, 512
+};
+
+// Class of each 16-byte step of the size: (size + 15) / 16 -> class
+static const uint8_t class_of_step[STO_POOL_MAX_SMALL / 16 + 1] = {
+    0, 0, 1, 2, 3, 4, 5, 6, 7,                  // 0..128
+    8, 8, 9, 9, 10, 10, 11, 11,                 // 129..256
+    12, 12, 12, 12, 13, 13, 13, 13,             // 257..384
+    14, 14, 14, 14, 15, 15, 15, 15              // 385..512
+};
+
+static inline int size_class(size_t size) {
+    return class_of_step[(size + 15) >> 4];
+}
+
+// Blocks moved between a thread cache and the pool at a time (~4 KB,
+// 8..64 blocks); a cache holding twice that hands one batch back
+static const uint8_t class_batch[STO_POOL_CLASS_COUNT] = {
+    64, 64, 64, 64, 51, 42, 36, 32, 25, 21, 18, 16, 12, 10, 9, 8
+};
+
+typedef struct PoolBlock {
+    struct PoolBlock* next;
+} PoolBlock;
+
+// ============================================================================
+// Statistics (per thread, single writer)
+// ============================================================================
+// Only the owning thread writes its counters; sto_pool_get_stats reads them
+// from another thread, so they are atomics accessed with relaxed
+// load + store (plain moves, no locked instruction). Signed: a thread that
+// frees what another allocated goes negative. Live count is allocations
+// minus frees.
+
+typedef struct {
+    _Atomic int64_t live_bytes;
+    _Atomic int64_t peak_bytes;
+    _Atomic int64_t allocations;
+    _Atomic int64_t frees;
+} PoolCounters;
+
+static inline int64_t counter_get(_Atomic int64_t* c) {
+    return atomic_load_explicit(c, memory_order_relaxed);
+}
+
+static inline void counter_set(_Atomic int64_t* c, int64_t value) {
+    atomic_store_explicit(c, value, memory_order_relaxed);
+}
+
+static inline void counter_add(_Atomic int64_t* c, int64_t delta) {
+    counter_set(c, counter_get(c) + delta);
+}
+
+// ============================================================================
+// Thread Cache
+// ============================================================================
+
+typedef struct PoolCache {
+    PoolBlock* head[STO_POOL_CLASS_COUNT];
+    uint32_t count[STO_POOL_CLASS_COUNT];
+    PoolCounters types[STO_POOL_TYPE_COUNT];
+    _Atomic int64_t large_allocations;
+    bool registered;
+    struct PoolCache* next;      // Registry of live threads
+    struct PoolCache* prev;
+} PoolCache;
+
+static _Thread_local PoolCache thread_cache;
+
+// ============================================================================
+// Shared Pool (pool_lock)
+// ============================================================================
+
+typedef struct {
+    PoolBlock* free_list;        // Blocks handed back by thread caches
+    char* bump;                  // Uncarved part of the newest slab
+    char* bump_end;
+} PoolClass;
+
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static PoolClass pool_classes[STO_POOL_CLASS_COUNT];
+static size_t pool_slab_bytes;
+static PoolCache* pool_threads;  // Registered thread caches
+
+// Counters of exited threads
+typedef struct {
+    int64_t live_bytes, peak_bytes, allocations, frees;
+} RetiredCounters;
+
+static RetiredCounters retired_types[STO_POOL_TYPE_COUNT];
+static int64_t retired_large_allocations;
+
+static pthread_once_t pool_key_once = PTHREAD_ONCE_INIT;
+static pthread_key_t pool_key;
+
+// Push 'n' blocks from a cache list onto the shared free list (pool_lock held)
+static void give_back(PoolCache* cache, int cls, uint32_t n) {
+    PoolClass* pc = &pool_classes[cls];
+    while (n-- > 0 && cache->head[cls]) {
+        PoolBlock* block = cache->head[cls];
+        cache->head[cls] = block->next;
+        cache->count[cls]--;
+        block->next = pc->free_list;
+        pc->free_list = block;
+    }
+}
+
+// Thread exit: return cached blocks, keep the counters, leave the registry
+static void cache_destructor(void* arg) {
+    PoolCache* cache = (PoolCache*)arg;
+
+    pthread_mutex_lock(&pool_lock);
+    for (int cls = 0; cls < STO_POOL_CLASS_COUNT; cls++) {
+        give_back(cache, cls, cache->count[cls]);
+    }
+    for (int t = 0; t < STO_POOL_TYPE_COUNT; t++) {
+        PoolCounters* c = &cache->types[t];
+        retired_types[t].live_bytes += counter_get(&c->live_bytes);
+        retired_types[t].peak_bytes += counter_get(&c->peak_bytes);
+        retired_types[t].allocations += counter_get(&c->allocations);
+        retired_types[t].frees += counter_get(&c->frees);
+    }
+    retired_large_allocations += counter_get(&cache->large_allocations);
+
+    if (cache->prev) cache->prev->next = cache->next;
+    else pool_threads = cache->next;
+    if (cache->next) cache->next->prev = cache->prev;
+    cache->registered = false;
+    pthread_mutex_unlock(&pool_lock);
+}
+
+static void make_key(void) {
+    pthread_key_create(&pool_key, cache_destructor);
+}
+
+static POOL_SLOW void register_cache(PoolCache* cache) {
+    pthread_once(&pool_key_once, make_key);
+    pthread_setspecific(pool_key, cache);
+
+    pthread_mutex_lock(&pool_lock);
+    cache->prev = NULL;
+    cache->next = pool_threads;
+    if (pool_threads) pool_threads->prev = cache;
+    pool_threads = cache;
+    cache->registered = true;
+    pthread_mutex_unlock(&pool_lock);
+}
+
+static inline PoolCache* current_cache(void) {
+    PoolCache* cache = &thread_cache;
+    if (!cache->registered) register_cache(cache);
+    return cache;
+}
+
+static inline PoolCounters* counters_for(PoolCache* cache, STOPoolType type) {
+    return &cache->types[type];
+}
+
+// live_bytes changed by 'delta'; raise the peak if it is a new high
+static inline void count_bytes(PoolCounters* c, int64_t delta) {
+    int64_t live = counter_get(&c->live_bytes) + delta;
+    counter_set(&c->live_bytes, live);
+    if (live > counter_get(&c->peak_bytes)) counter_set(&c->peak_bytes, live);
+}
+
+static inline void count_alloc(PoolCache* cache, STOPoolType type, size_t size) {
+    PoolCounters* c = counters_for(cache, type);
+    count_bytes(c, (int64_t)size);
+    counter_add(&c->allocations, 1);
+}
+
+static inline void count_free(PoolCache* cache, STOPoolType type, size_t size) {
+    PoolCounters* c = counters_for(cache, type);
+    counter_add(&c->live_bytes, -(int64_t)size);
+    counter_add(&c->frees, 1);
+}
+
+// ============================================================================
+// Slow Paths
+// ============================================================================
+
+#ifndef STO_POOL_USE_MALLOC
+
+// Empty cache: move a batch in from the shared free list, carving a new
+// slab if needed; returns one block for the caller (NULL when out of memory)
+static POOL_SLOW PoolBlock* refill(PoolCache* cache, int cls) {
+    uint32_t want = class_batch[cls];
+    size_t block_size = class_sizes[cls];
+    PoolClass* pc = &pool_classes[cls];
+
+    pthread_mutex_lock(&pool_lock);
+    uint32_t got = 0;
+    while (got < want) {
+        PoolBlock* block;
+        if (pc->free_list) {
+            block = pc->free_list;
+            pc->free_list = block->next;
+        } else {
+            if ((size_t)(pc->bump_end - pc->bump) < block_size) {
+                char* slab = (char*)malloc(SLAB_BYTES);
+                if (!slab) break;
+                pool_slab_bytes += SLAB_BYTES;
+                pc->bump = slab;
+                pc->bump_end = slab + SLAB_BYTES;
+            }
+            block = (PoolBlock*)pc->bump;
+            pc->bump += block_size;
+        }
+        block->next = cache->head[cls];
+        cache->head[cls] = block;
+        got++;
+    }
+    pthread_mutex_unlock(&pool_lock);
+
+    if (got == 0) return NULL;
+    cache->count[cls] += got - 1;
+    PoolBlock* block = cache->head[cls];
+    cache->head[cls] = block->next;
+    return block;
+}
+
+static POOL_SLOW void flush(PoolCache* cache, int cls) {
+    pthread_mutex_lock(&pool_lock);
+    give_back(cache, cls, class_batch[cls]);
+    pthread_mutex_unlock(&pool_lock);
+}
+
+#endif
+
+// ============================================================================
+// Allocation
+// ============================================================================
+
+#ifndef STO_POOL_USE_MALLOC
+
+static inline void* cache_pop(PoolCache* cache, int cls) {
+    PoolBlock* block = cache->head[cls];
+    if (!block) return refill(cache, cls);
+    cache->head[cls] = block->next;
+    cache->count[cls]--;
+    return block;
+}
+
+static inline void cache_push(PoolCache* cache, int cls, void* ptr) {
+    PoolBlock* block = (PoolBlock*)ptr;
+    block->next = cache->head[cls];
+    cache->head[cls] = block;
+    if (++cache->count[cls] > 2 * class_batch[cls]) {
+        flush(cache, cls);
+    }
+}
+
+#endif
+
+void* sto_pool_alloc(size_t size, STOPoolType type) {
+    if (size == 0) size = 1;
+    PoolCache* cache = current_cache();
+
+#ifndef STO_POOL_USE_MALLOC
+    if (size <= STO_POOL_MAX_SMALL) {
+        void* block = cache_pop(cache, size_class(size));
+        if (block) count_alloc(cache, type, size);
+        return block;
+    }
+#endif
+
+    void* ptr = malloc(size);
+    if (!ptr) return NULL;
+    if (size > STO_POOL_MAX_SMALL) counter_add(&cache->large_allocations, 1);
+    count_alloc(cache, type, size);
+    return ptr;
+}
+
+void* sto_pool_calloc(size_t size, STOPoolType type) {
+    void* ptr = sto_pool_alloc(size, type);
+    if (ptr) memset(ptr, 0, size ? size : 1);
+    return ptr;
+}
+
+void sto_pool_free(void* ptr, size_t size, STOPoolType type) {
+    if (!ptr) return;
+    if (size == 0) size = 1;
+    PoolCache* cache = current_cache();
+    count_free(cache, type, size);
+
+#ifndef STO_POOL_USE_MALLOC
+    if (size <= STO_POOL_MAX_SMALL) {
+        cache_push(cache, size_class(size), ptr);
+        return;
+    }
+#endif
+
+    free(ptr);
+}
+
+void* sto_pool_realloc(void* ptr, size_t old_size, size_t new_size, STOPoolType type) {
+    if (!ptr) return sto_pool_alloc(new_size, type);
+    if (old_size == 0) old_size = 1;
+    if (new_size == 0) new_size = 1;
+
+#ifdef STO_POOL_USE_MALLOC
+    bool old_small = false, new_small = false;  // Every block is a malloc block
+#else
+    bool old_small = old_size <= STO_POOL_MAX_SMALL;
+    bool new_small = new_size <= STO_POOL_MAX_SMALL;
+#endif
+
+    PoolCache* cache = current_cache();
+
+    // Same size class, or malloc to malloc: resize in place
+    if (old_small ? (new_small && size_class(old_size) == size_class(new_size)) : !new_small) {
+        void* result = old_small ? ptr : realloc(ptr, new_size);
+        if (!result) return NULL;
+        count_bytes(counters_for(cache, type), (int64_t)new_size - (int64_t)old_size);
+        return result;
+    }
+
+
+    void* moved = sto_pool_alloc(new_size, type);
+    if (!moved) return NULL;
+    memcpy(moved, ptr, old_size < new_size ? old_size : new_size);
+    sto_pool_free(ptr, old_size, type);
+    return moved;
+}
+
+void sto_pool_thread_flush(void) {
+#ifndef STO_POOL_USE_MALLOC
+    PoolCache* cache = &thread_cache;
+    pthread_mutex_lock(&pool_lock);
+    for (int cls = 0; cls < STO_POOL_CLASS_COUNT; cls++) {
+        give_back(cache, cls, cache->count[cls]);
+    }
+    pthread_mutex_unlock(&pool_lock);
+#endif
+}
+
+// ============================================================================
+// Statistics
+// ============================================================================
+
+static size_t clamp_size(int64_t value) {
+    return value > 0 ? (size_t)value : 0;
+}
+
+STOPoolStats sto_pool_get_stats(void) {
+    RetiredCounters sums[STO_POOL_TYPE_COUNT];
+    int64_t large;
+
+    pthread_mutex_lock(&pool_lock);
+    memcpy(sums, retired_types, sizeof(sums));
+    large = retired_large_allocations;
+    for (PoolCache* cache = pool_threads; cache; cache = cache->next) {
+        for (int t = 0; t < STO_POOL_TYPE_COUNT; t++) {
+            PoolCounters* c = &cache->types[t];
+            sums[t].live_bytes += counter_get(&c->live_bytes);
+            sums[t].peak_bytes += counter_get(&c->peak_bytes);
+            sums[t].allocations += counter_get(&c->allocations);
+            sums[t].frees += counter_get(&c->frees);
+        }
+        large += counter_get(&cache->large_allocations);
+    }
+
+    STOPoolStats stats;
+    memset(&stats, 0, sizeof(stats));
+    stats.slab_bytes = pool_slab_bytes;
+    pthread_mutex_unlock(&pool_lock);
+
+    for (int t = 0; t < STO_POOL_TYPE_COUNT; t++) {
+        stats.types[t].live_count = clamp_size(sums[t].allocations - sums[t].frees);
+        stats.types[t].live_bytes = clamp_size(sums[t].live_bytes);
+        stats.types[t].peak_bytes = clamp_size(sums[t].peak_bytes);
+        stats.types[t].total_allocations = clamp_size(sums[t].allocations);
+    }
+    stats.large_allocations = clamp_size(large);
+    return stats;
+}
+
+const char* sto_pool_type_name(STOPoolType type) {
+    switch (type) {
+        case STO_POOL_OTHER: return "other";
+        case STO_POOL_BIGDECIMAL: return "bigdecimal";
+        case STO_POOL_STRING: return "string";
+        case STO_POOL_VALUE: return "value";
+        case STO_POOL_LIST: return "list";
+        case STO_POOL_MAP: return "map";
+        case STO_POOL_OPTIONAL: return "optional";
+        case STO_POOL_STATE: return "state";
+        case STO_POOL_TYPE_COUNT: break;
+    }
+    return "unknown";
+}
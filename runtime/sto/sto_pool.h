@@ -0,0 +1,84 @@
+#ifndef STO_POOL_H
+#define STO_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ============================================================================
+// STO Pool - Size-Class Allocator for Runtime Objects
+// ============================================================================
+// Small runtime objects (BigDecimal headers and limbs, string buffers, list
+// and map headers, optionals, state entries) are allocated from 64 KB slabs
+// cut into blocks of STO_POOL_CLASS_COUNT size classes (16 .. 512 bytes).
+// Each thread keeps a free list per class, so the common alloc/free is a
+// pointer pop/push with no lock; only refilling an empty cache or handing
+// back an overfull one takes the pool lock. A thread's cache returns to
+// the pool when the thread exits. Slabs are kept for reuse, not returned
+// to the system.
+//
+// Frees are sized: the caller passes the size it allocated (every runtime
+// object knows its own size or capacity), so blocks carry no header.
+// Requests above STO_POOL_MAX_SMALL go to malloc and are still counted.
+//
+// Every call names an STOPoolType; live count, live bytes, peak bytes and
+// total allocations are kept per type (sto_pool_get_stats, and
+// sto_get_mem_stats in sto_runtime.h).
+//
+// Build with -DSTO_POOL_USE_MALLOC to send every request to malloc/free
+// (statistics still kept), e.g. under AddressSanitizer or valgrind.
+
+#define STO_POOL_MAX_SMALL 512
+#define STO_POOL_CLASS_COUNT 16
+
+typedef enum {
+    STO_POOL_OTHER = 0,
+    STO_POOL_BIGDECIMAL,     // BigDecimal headers and limb buffers
+    STO_POOL_STRING,         // SSOString heap buffers
+    STO_POOL_VALUE,          // STOValue heap strings
+    STO_POOL_LIST,           // STOArray/STOList/STOTuple, MelpList and their buffers
+    STO_POOL_MAP,            // MelpMap headers, tables and key blocks
+    STO_POOL_OPTIONAL,       // MelpOptional
+    STO_POOL_STATE,          // mlp_state entries, keys and values
+    STO_POOL_TYPE_COUNT
+} STOPoolType;
+
+// Allocation (NULL on failure; size 0 is treated as 1)
+void* sto_pool_alloc(size_t size, STOPoolType type);
+void* sto_pool_calloc(size_t size, STOPoolType type);  // Zero-filled
+
+// Resize keeping min(old_size, new_size) bytes; on failure returns NULL
+// and 'ptr' is untouched. ptr == NULL allocates.
+void* sto_pool_realloc(void* ptr, size_t old_size, size_t new_size, STOPoolType type);
+
+// Release a block; size and type must match the allocation (NULL is ignored)
+void sto_pool_free(void* ptr, size_t size, STOPoolType type);
+
+// Hand this thread's cached blocks back to the pool (done automatically
+// when a thread exits)
+void sto_pool_thread_flush(void);
+
+// ============================================================================
+// Statistics
+// ============================================================================
+
+typedef struct {
+    size_t live_count;          // Allocations not yet freed
+    size_t live_bytes;          // Bytes requested by them
+    size_t peak_bytes;          // Highest live_bytes seen (see below)
+    size_t total_allocations;   // Allocations since start
+} STOPoolTypeStats;
+
+typedef struct {
+    STOPoolTypeStats types[STO_POOL_TYPE_COUNT];   // Indexed by STOPoolType
+    size_t slab_bytes;          // Memory held in slabs
+    size_t large_allocations;   // Requests above STO_POOL_MAX_SMALL (malloc)
+} STOPoolStats;
+
+// Counters are kept per thread, so counting costs no atomic operation.
+// peak_bytes is exact for a single thread; with several threads it is the
+// sum of each thread's own peak, an upper bound on the true peak.
+STOPoolStats sto_pool_get_stats(void);
+
+const char* sto_pool_type_name(STOPoolType type);
+
+#endif
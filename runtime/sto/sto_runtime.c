@@ -61,132 +61,99 @@ bool sto_safe_mul_i64(int64_t a, int64_t b, int64_t* result) {
 // Phase 3.2: BigDecimal Runtime Library
 // ============================================================================
 
+// Thin wrappers over the limb-based sto_bigdec_* implementation (bigdecimal.c)
+
 BigDecimal* bigdec_from_i64(int64_t value) {
-    BigDecimal* bd = malloc(sizeof(BigDecimal));
-    bd->digits = malloc(32);
-    bd->negative = (value < 0);
-    if (bd->negative) value = -value;
-    snprintf(bd->digits, 32, "%lld", (long long)value);
-    bd->length = strlen(bd->digits);
-    bd->scale = 0;
-    bd->refcount = 1;
-    return bd;
+    return sto_bigdec_from_int64(value);
 }
 
 BigDecimal* bigdec_from_double(double value) {
-    BigDecimal* bd = malloc(sizeof(BigDecimal));
-    bd->digits = malloc(64);
-    bd->negative = (value < 0);
-    if (bd->negative) value = -value;
-    snprintf(bd->digits, 64, "%.15g", value);
-    bd->length = strlen(bd->digits);
-    bd->scale = 15;
-    bd->refcount = 1;
-    return bd;
+    // 15 significant digits: what a double reliably carries;
+    // NaN/Inf are rejected by the parser
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%.15g", value);
+    return sto_bigdec_from_string(buffer);
 }
 
 BigDecimal* bigdec_from_string(const char* str) {
-    BigDecimal* bd = malloc(sizeof(BigDecimal));
-    size_t len = strlen(str);
-    bd->digits = malloc(len + 1);
-    strcpy(bd->digits, str);
-    bd->negative = (str[0] == '-');
-    bd->length = bd->negative ? len - 1 : len;
-    bd->scale = 0;
-    bd->refcount = 1;
-    return bd;
+    return sto_bigdec_from_string(str);
 }
 
 BigDecimal* bigdec_add(BigDecimal* a, BigDecimal* b) {
-    // Simplified implementation
-    BigDecimal* result = malloc(sizeof(BigDecimal));
-    size_t len = a->length + b->length + 10;
-    result->digits = malloc(len);
-    snprintf(result->digits, len, "(%s+%s)", a->digits, b->digits);
-    result->length = strlen(result->digits);
-    result->scale = (a->scale > b->scale) ? a->scale : b->scale;
-    result->negative = false;
-    result->refcount = 1;
-    return result;
+    return sto_bigdec_add(a, b);
 }
 
 BigDecimal* bigdec_sub(BigDecimal* a, BigDecimal* b) {
-    BigDecimal* result = malloc(sizeof(BigDecimal));
-    size_t len = a->length + b->length + 10;
-    result->digits = malloc(len);
-    snprintf(result->digits, len, "(%s-%s)", a->digits, b->digits);
-    result->length = strlen(result->digits);
-    result->scale = (a->scale > b->scale) ? a->scale : b->scale;
-    result->negative = false;
-    result->refcount = 1;
-    return result;
+    return sto_bigdec_sub(a, b);
 }
 
 BigDecimal* bigdec_mul(BigDecimal* a, BigDecimal* b) {
-    BigDecimal* result = malloc(sizeof(BigDecimal));
-    size_t len = a->length + b->length + 10;
-    result->digits = malloc(len);
-    snprintf(result->digits, len, "(%s*%s)", a->digits, b->digits);
-    result->length = strlen(result->digits);
-    result->scale = a->scale + b->scale;
-    result->negative = (a->negative != b->negative);
-    result->refcount = 1;
-    return result;
+    return sto_bigdec_mul(a, b);
 }
 
 BigDecimal* bigdec_div(BigDecimal* a, BigDecimal* b) {
-    BigDecimal* result = malloc(sizeof(BigDecimal));
-    size_t len = a->length + b->length + 10;
-    result->digits = malloc(len);
-    snprintf(result->digits, len, "(%s/%s)", a->digits, b->digits);
-    result->length = strlen(result->digits);
-    result->scale = a->scale - b->scale + 15;
-    result->negative = (a->negative != b->negative);
-    result->refcount = 1;
-    return result;
+    if (!a || !b) return NULL;
+    int scale = (a->scale > b->scale) ? a->scale : b->scale;
+    return sto_bigdec_div_scale(a, b, scale + BIGDEC_DIV_EXTRA_SCALE);
 }
 
 int bigdec_compare(BigDecimal* a, BigDecimal* b) {
-    if (a->negative != b->negative) {
-        return a->negative ? -1 : 1;
-    }
-    return strcmp(a->digits, b->digits);
+    return sto_bigdec_compare(a, b);
 }
 
 char* bigdec_to_string(BigDecimal* bd) {
-    size_t len = bd->length + (bd->negative ? 2 : 1);
-    char* str = malloc(len);
-    if (bd->negative) {
-        snprintf(str, len, "-%s", bd->digits);
-    } else {
-        strcpy(str, bd->digits);
-    }
-    return str;
+    return sto_bigdec_to_string(bd);
 }
 
 int64_t bigdec_to_i64(BigDecimal* bd) {
-    int64_t value = atoll(bd->digits);
-    return bd->negative ? -value : value;
+    if (!bd) return 0;
+
+    // Drop the fraction, then saturate to the int64 range
+    BigDecimal one;
+    sto_bigdec_init_int128(&one, 1, 0);
+    BigDecimal* truncated = (bd->scale > 0) ? sto_bigdec_div_scale(bd, &one, 0) : bd;
+    if (!truncated) return 0;
+
+    uint64_t magnitude = 0;
+    bool saturated = truncated->length > 2;
+    if (!saturated && truncated->length > 0) {
+        magnitude = truncated->limbs[0];
+        if (truncated->length == 2) magnitude |= (uint64_t)truncated->limbs[1] << 32;
+    }
+    bool negative = truncated->negative;
+    if (truncated != bd) sto_bigdec_free(truncated);
+
+    if (negative) {
+        if (saturated || magnitude > (uint64_t)INT64_MAX + 1) return INT64_MIN;
+        return (int64_t)(0 - magnitude);
+    }
+    if (saturated || magnitude > (uint64_t)INT64_MAX) return INT64_MAX;
+    return (int64_t)magnitude;
 }
 
 double bigdec_to_double(BigDecimal* bd) {
-    double value = atof(bd->digits);
-    return bd->negative ? -value : value;
+    // Correctly rounded via the decimal text (conversion boundary)
+    char* str = sto_bigdec_to_string(bd);
+    if (!str) return 0.0;
+    double value = strtod(str, NULL);
+    free(str);
+    return value;
 }
 
 void bigdec_free(BigDecimal* bd) {
-    if (bd) {
-        free(bd->digits);
-        free(bd);
+    // Frees regardless of refcount; inline values own no memory
+    if (bd && bd->refcount != BIGDEC_REFCOUNT_INLINE) {
+        bd->refcount = 1;
+        sto_bigdec_free(bd);
     }
 }
 
 void bigdec_retain(BigDecimal* bd) {
-    if (bd) bd->refcount++;
+    if (bd && bd->refcount != BIGDEC_REFCOUNT_INLINE) bd->refcount++;
 }
 
 void bigdec_release(BigDecimal* bd) {
-    if (bd && --bd->refcount == 0) {
+    if (bd && bd->refcount != BIGDEC_REFCOUNT_INLINE && --bd->refcount == 0) {
         bigdec_free(bd);
     }
 }
@@ -195,84 +162,30 @@ void bigdec_release(BigDecimal* bd) {
 // Phase 3.3: SSO (Small String Optimization)
 // ============================================================================
 
-SSOString* sso_create(const char* str) {
-    SSOString* sso = malloc(sizeof(SSOString));
-    size_t len = strlen(str);
-    
-    if (len < SSO_MAX_SIZE) {
-        // Use small string optimization
-        sso->is_heap = false;
-        strcpy(sso->storage.sso.data, str);
-        sso->storage.sso.length = (uint8_t)len;
-    } else {
-        // Allocate on heap
-        sso->is_heap = true;
-        sso->storage.heap.ptr = malloc(len + 1);
-        strcpy(sso->storage.heap.ptr, str);
-        sso->storage.heap.length = len;
-        sso->storage.heap.capacity = len + 1;
-        sso->storage.heap.refcount = 1;
-    }
-    
-    return sso;
-}
+// Thin wrappers over the by-value sto_sso_* implementation (sso_string.c)
 
-const char* sso_data(SSOString* str) {
-    return str->is_heap ? str->storage.heap.ptr : str->storage.sso.data;
+SSOString sso_create(const char* str) {
+    return sto_sso_create(str);
 }
 
-size_t sso_length(SSOString* str) {
-    return str->is_heap ? str->storage.heap.length : str->storage.sso.length;
+const char* sso_data(const SSOString* str) {
+    return sto_sso_data(str);
 }
 
-SSOString* sso_concat(SSOString* a, SSOString* b) {
-    const char* str_a = sso_data(a);
-    const char* str_b = sso_data(b);
-    size_t len_a = sso_length(a);
-    size_t len_b = sso_length(b);
-    size_t total_len = len_a + len_b;
-    
-    SSOString* result = malloc(sizeof(SSOString));
-    
-    if (total_len < SSO_MAX_SIZE) {
-        // Use SSO
-        result->is_heap = false;
-        strcpy(result->storage.sso.data, str_a);
-        strcat(result->storage.sso.data, str_b);
-        result->storage.sso.length = (uint8_t)total_len;
-    } else {
-        // Use heap
-        result->is_heap = true;
-        result->storage.heap.ptr = malloc(total_len + 1);
-        strcpy(result->storage.heap.ptr, str_a);
-        strcat(result->storage.heap.ptr, str_b);
-        result->storage.heap.length = total_len;
-        result->storage.heap.capacity = total_len + 1;
-        result->storage.heap.refcount = 1;
-    }
-    
-    return result;
+size_t sso_length(const SSOString* str) {
+    return sto_sso_length(str);
 }
 
-void sso_free(SSOString* str) {
-    if (str) {
-        if (str->is_heap) {
-            free(str->storage.heap.ptr);
-        }
-        free(str);
-    }
+SSOString sso_concat(const SSOString* a, const SSOString* b) {
+    return sto_sso_concat(a, b);
 }
 
-void sso_retain(SSOString* str) {
-    if (str && str->is_heap) {
-        str->storage.heap.refcount++;
-    }
+bool sso_append(SSOString* str, const SSOString* other) {
+    return sto_sso_append_sso(str, other);
 }
 
-void sso_release(SSOString* str) {
-    if (str && str->is_heap && --str->storage.heap.refcount == 0) {
-        sso_free(str);
-    }
+void sso_free(SSOString* str) {
+    sto_sso_free(str);
 }
 
 // ============================================================================
@@ -283,6 +196,8 @@ static STOMemStats mem_stats = {0};
 
 void sto_runtime_init(void) {
     memset(&mem_stats, 0, sizeof(STOMemStats));
+    sto_bigdec_reset_stats();
+    sto_sso_reset_stats();
 }
 
 void sto_runtime_cleanup(void) {
@@ -290,7 +205,30 @@ void sto_runtime_cleanup(void) {
 }
 
 STOMemStats sto_get_mem_stats(void) {
-    return mem_stats;
+    STOMemStats stats = mem_stats;
+
+    // BigDecimal allocations are counted by bigdecimal.c
+    STOBigDecStats bigdec = sto_bigdec_get_stats();
+    stats.bigdecimal_count = bigdec.heap_values;
+    stats.bigdecimal_bytes = bigdec.heap_bytes;
+    stats.bigdecimal_inline_limbs = bigdec.inline_limbs;
+    stats.bigdecimal_inline_values = bigdec.inline_values;
+    stats.bigdecimal_allocations_saved = bigdec.inline_limbs + bigdec.inline_values;
+    stats.total_allocations += bigdec.heap_values + bigdec.heap_limbs;
+
+    // String buffers are counted by sso_string.c
+    STOSSOStats strings = sto_sso_get_stats();
+    stats.heap_string_count = strings.heap_allocations;
+    stats.heap_string_bytes = strings.heap_bytes;
+    stats.inline_string_count = strings.inline_results;
+    stats.rodata_string_count = strings.rodata_borrows;
+    stats.total_allocations += strings.heap_allocations;
+
+    // Per-type usage is counted by the pool allocator
+    STOPoolStats pool = sto_pool_get_stats();
+    memcpy(stats.by_type, pool.types, sizeof(stats.by_type));
+    stats.pool_slab_bytes = pool.slab_bytes;
+    return stats;
 }
 
 // ============================================================================
@@ -312,17 +250,18 @@ void* sto_array_alloc(size_t count, size_t elem_size) {
         return NULL;
     }
     
-    STOArray* array = malloc(sizeof(STOArray));
+    STOArray* array = sto_pool_alloc(sizeof(STOArray), STO_POOL_LIST);
     if (!array) {
         fprintf(stderr, "ERROR: Failed to allocate array structure\n");
         exit(1);
     }
     
     // Allocate contiguous memory for elements
-    array->elements = calloc(count, elem_size);
+    array->elements = count <= SIZE_MAX / elem_size
+                      ? sto_pool_calloc(count * elem_size, STO_POOL_LIST) : NULL;
     if (!array->elements) {
         fprintf(stderr, "ERROR: Failed to allocate array elements\n");
-        free(array);
+        sto_pool_free(array, sizeof(STOArray), STO_POOL_LIST);
         exit(1);
     }
     
@@ -378,13 +317,13 @@ void* sto_array_get(STOArray* array, size_t index) {
  */
 void sto_array_free(STOArray* array) {
     if (array) {
-        free(array->elements);
-        free(array);
+        sto_pool_free(array->elements, array->count * array->elem_size, STO_POOL_LIST);
+        sto_pool_free(array, sizeof(STOArray), STO_POOL_LIST);
     }
 }
 
 /**
- * Allocate a heterogeneous list (dynamic, type-tracked)
+ * Allocate a heterogeneous list (dynamic, tagged values)
  * 
  * @param capacity Initial capacity
  * @return Pointer to STOList
@@ -392,20 +331,17 @@ void sto_array_free(STOArray* array) {
 STOList* sto_list_alloc(size_t capacity) {
     if (capacity == 0) capacity = 4;  // Default capacity
     
-    STOList* list = malloc(sizeof(STOList));
+    STOList* list = sto_pool_alloc(sizeof(STOList), STO_POOL_LIST);
     if (!list) {
         fprintf(stderr, "ERROR: Failed to allocate list structure\n");
         exit(1);
     }
     
-    list->elements = calloc(capacity, sizeof(void*));
-    list->types = calloc(capacity, sizeof(uint8_t));
-    
-    if (!list->elements || !list->types) {
+    // All-zero bytes are STO_VALUE_NONE
+    list->values = sto_pool_calloc(capacity * sizeof(STOValue), STO_POOL_LIST);
+    if (!list->values) {
         fprintf(stderr, "ERROR: Failed to allocate list storage\n");
-        free(list->elements);
-        free(list->types);
-        free(list);
+        sto_pool_free(list, sizeof(STOList), STO_POOL_LIST);
         exit(1);
     }
     
@@ -422,41 +358,32 @@ STOList* sto_list_alloc(size_t capacity) {
  * Set a list element at a specific index
  * 
  * @param list Pointer to STOList
- * @param index Element index
- * @param value Pointer to value (copied to heap)
- * @param type VarType of the element
+ * @param index Element index (past the end grows the list)
+ * @param value Tagged value (the list takes ownership)
  */
-void sto_list_set(STOList* list, size_t index, void* value, uint8_t type) {
-    if (!list || !value) return;
+void sto_list_set_value(STOList* list, size_t index, STOValue value) {
+    if (!list) return;
     
     // Grow if needed
     if (index >= list->capacity) {
         size_t new_capacity = (index + 1) * 2;
-        void** new_elements = realloc(list->elements, new_capacity * sizeof(void*));
-        uint8_t* new_types = realloc(list->types, new_capacity * sizeof(uint8_t));
-        
-        if (!new_elements || !new_types) {
+        STOValue* new_values = sto_pool_realloc(list->values, list->capacity * sizeof(STOValue),
+                                                new_capacity * sizeof(STOValue), STO_POOL_LIST);
+        if (!new_values) {
             fprintf(stderr, "ERROR: Failed to grow list\n");
             exit(1);
         }
         
-        // Zero out new slots
-        memset(new_elements + list->capacity, 0, 
-               (new_capacity - list->capacity) * sizeof(void*));
-        memset(new_types + list->capacity, 0, 
-               (new_capacity - list->capacity) * sizeof(uint8_t));
+        // Zero out new slots (STO_VALUE_NONE)
+        memset(new_values + list->capacity, 0, 
+               (new_capacity - list->capacity) * sizeof(STOValue));
         
-        list->elements = new_elements;
-        list->types = new_types;
+        list->values = new_values;
         list->capacity = new_capacity;
     }
     
-    // Copy value to heap (8 bytes for int64/double)
-    int64_t* heap_value = malloc(8);
-    memcpy(heap_value, value, 8);
-    
-    list->elements[index] = heap_value;
-    list->types[index] = type;
+    sto_value_free(&list->values[index]);
+    list->values[index] = value;
     
     if (index >= list->count) {
         list->count = index + 1;
@@ -464,63 +391,71 @@ void sto_list_set(STOList* list, size_t index, void* value, uint8_t type) {
 }
 
 /**
- * Get a list element
+ * Get a list element (the slot itself, not a copy)
  */
-void* sto_list_get(STOList* list, size_t index) {
+const STOValue* sto_list_get_value(const STOList* list, size_t index) {
     if (!list || index >= list->count) {
         fprintf(stderr, "ERROR: List index out of bounds: %zu >= %zu\n", 
-                index, list->count);
+                index, list ? list->count : 0);
         exit(1);
     }
     
-    return list->elements[index];
+    return &list->values[index];
 }
 
 /**
  * Append to list
  */
+void sto_list_append_value(STOList* list, STOValue value) {
+    if (!list) return;
+    sto_list_set_value(list, list->count, value);
+}
+
+/**
+ * Legacy set: 8-byte value of an InternalType, stored inline
+ */
+void sto_list_set(STOList* list, size_t index, void* value, uint8_t type) {
+    if (!list || !value) return;
+    sto_list_set_value(list, index, sto_value_from_bytes(value, type));
+}
+
+/**
+ * Legacy get: the slot's 8-byte payload (int64, double, 0/1, pointer)
+ */
+void* sto_list_get(STOList* list, size_t index) {
+    return (void*)&sto_list_get_value(list, index)->as;
+}
+
 void sto_list_append(STOList* list, void* value, uint8_t type) {
+    if (!list) return;
     sto_list_set(list, list->count, value, type);
 }
 
 /**
- * Free a list
+ * Free a list (and the heap strings it owns)
  */
 void sto_list_free(STOList* list) {
     if (list) {
-        // Free all element data
         for (size_t i = 0; i < list->count; i++) {
-            free(list->elements[i]);
+            sto_value_free(&list->values[i]);
         }
-        free(list->elements);
-        free(list->types);
-        free(list);
+        sto_pool_free(list->values, list->capacity * sizeof(STOValue), STO_POOL_LIST);
+        sto_pool_free(list, sizeof(STOList), STO_POOL_LIST);
     }
 }
 
 /**
- * Allocate a tuple (immutable, heterogeneous)
+ * Allocate a tuple (immutable, heterogeneous), header and values together
  */
 STOTuple* sto_tuple_alloc(size_t count) {
     if (count == 0) return NULL;
     
-    STOTuple* tuple = malloc(sizeof(STOTuple));
+    STOTuple* tuple = sto_pool_calloc(sizeof(STOTuple) + count * sizeof(STOValue), STO_POOL_LIST);
     if (!tuple) {
         fprintf(stderr, "ERROR: Failed to allocate tuple\n");
         exit(1);
     }
     
-    tuple->elements = calloc(count, sizeof(void*));
-    tuple->types = calloc(count, sizeof(uint8_t));
-    
-    if (!tuple->elements || !tuple->types) {
-        fprintf(stderr, "ERROR: Failed to allocate tuple storage\n");
-        free(tuple->elements);
-        free(tuple->types);
-        free(tuple);
-        exit(1);
-    }
-    
     tuple->count = count;
     tuple->refcount = 1;
     
@@ -530,43 +465,48 @@ STOTuple* sto_tuple_alloc(size_t count) {
 }
 
 /**
- * Set a tuple element (only during initialization)
+ * Set a tuple element (only during initialization; takes ownership)
  */
-void sto_tuple_set(STOTuple* tuple, size_t index, void* value, uint8_t type) {
-    if (!tuple || !value || index >= tuple->count) return;
-    
-    // Copy value to heap
-    int64_t* heap_value = malloc(8);
-    memcpy(heap_value, value, 8);
+void sto_tuple_set_value(STOTuple* tuple, size_t index, STOValue value) {
+    if (!tuple || index >= tuple->count) {
+        sto_value_free(&value);
+        return;
+    }
     
-    tuple->elements[index] = heap_value;
-    tuple->types[index] = type;
+    sto_value_free(&tuple->values[index]);
+    tuple->values[index] = value;
 }
 
 /**
- * Get a tuple element
+ * Get a tuple element (the slot itself, not a copy)
  */
-void* sto_tuple_get(STOTuple* tuple, size_t index) {
+const STOValue* sto_tuple_get_value(const STOTuple* tuple, size_t index) {
     if (!tuple || index >= tuple->count) {
         fprintf(stderr, "ERROR: Tuple index out of bounds: %zu >= %zu\n", 
-                index, tuple->count);
+                index, tuple ? tuple->count : 0);
         exit(1);
     }
     
-    return tuple->elements[index];
+    return &tuple->values[index];
+}
+
+void sto_tuple_set(STOTuple* tuple, size_t index, void* value, uint8_t type) {
+    if (!tuple || !value || index >= tuple->count) return;
+    sto_tuple_set_value(tuple, index, sto_value_from_bytes(value, type));
+}
+
+void* sto_tuple_get(STOTuple* tuple, size_t index) {
+    return (void*)&sto_tuple_get_value(tuple, index)->as;
 }
 
 /**
- * Free a tuple
+ * Free a tuple (and the heap strings it owns)
  */
 void sto_tuple_free(STOTuple* tuple) {
     if (tuple) {
-        // Free all element data
         for (size_t i = 0; i < tuple->count; i++) {
-            free(tuple->elements[i]);
+            sto_value_free(&tuple->values[i]);
         }
-        free(tuple->elements);
-        free(tuple->types);
-        free(tuple);
+        sto_pool_free(tuple, sizeof(STOTuple) + tuple->count * sizeof(STOValue), STO_POOL_LIST);
     }
 }
@@ -5,12 +5,17 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include "sto_types.h"
+#include "int128.h"
+#include "bigdecimal.h"
+#include "sso_string.h"
+#include "sto_value.h"
+#include "sto_pool.h"
 
 // ============================================================================
 // STO Runtime Support - Phase 3
 // ============================================================================
 // Provides runtime support for STO optimizations:
-// - Overflow detection and promotion (INT64 → BIGDECIMAL)
+// - Overflow detection and promotion (INT64 → INT128 → BIGDECIMAL)
 // - BigDecimal operations
 // - SSO string management
 // - Memory management hooks
@@ -29,7 +34,8 @@ bool sto_would_overflow_sub(int64_t a, int64_t b);
 bool sto_would_overflow_mul(int64_t a, int64_t b);
 
 // Safe addition with overflow detection
-// Returns true if overflow occurred, result promoted to BigDecimal
+// Returns true if overflow occurred; the exact result is then
+// sto_int128_add_i64(a, b) (INT128 tier, BigDecimal only past 128 bits)
 bool sto_safe_add_i64(int64_t a, int64_t b, int64_t* result);
 
 // Safe subtraction with overflow detection
@@ -42,14 +48,8 @@ bool sto_safe_mul_i64(int64_t a, int64_t b, int64_t* result);
 // Phase 3.2: BigDecimal Runtime Library
 // ============================================================================
 
-// BigDecimal structure (arbitrary precision)
-typedef struct {
-    char* digits;      // String of digits
-    int length;        // Number of digits
-    int scale;         // Decimal point position (from right)
-    bool negative;     // Sign
-    int refcount;      // Reference count for GC
-} BigDecimal;
+// BigDecimal structure (limbs + decimal scale) - see bigdecimal.h
+// These are thin wrappers over the sto_bigdec_* implementation in bigdecimal.c
 
 // Create BigDecimal from int64
 BigDecimal* bigdec_from_i64(int64_t value);
@@ -64,7 +64,7 @@ BigDecimal* bigdec_from_string(const char* str);
 BigDecimal* bigdec_add(BigDecimal* a, BigDecimal* b);
 BigDecimal* bigdec_sub(BigDecimal* a, BigDecimal* b);
 BigDecimal* bigdec_mul(BigDecimal* a, BigDecimal* b);
-BigDecimal* bigdec_div(BigDecimal* a, BigDecimal* b);
+BigDecimal* bigdec_div(BigDecimal* a, BigDecimal* b);  // BIGDEC_DIV_EXTRA_SCALE more digits
 
 // BigDecimal comparison
 int bigdec_compare(BigDecimal* a, BigDecimal* b);  // Returns: -1, 0, 1
@@ -89,43 +89,29 @@ void bigdec_release(BigDecimal* bd);
 // Phase 3.3: SSO (Small String Optimization)
 // ============================================================================
 
-#define SSO_MAX_SIZE 23
+#define SSO_MAX_SIZE STO_SSO_CAPACITY
 
-// SSO String structure (fits in 24 bytes)
-typedef struct {
-    union {
-        struct {
-            char data[SSO_MAX_SIZE];
-            uint8_t length;  // Length stored in last byte
-        } sso;
-        struct {
-            char* ptr;
-            size_t length;
-            size_t capacity;
-            int refcount;
-        } heap;
-    } storage;
-    bool is_heap;  // Flag to distinguish SSO vs heap
-} SSOString;
+// SSOString is the 24-byte value from sso_string.h; these are thin
+// wrappers over sto_sso_*. Strings are owned by value (no refcount):
+// sto_sso_copy() makes an independent copy, sso_free() drops one.
 
 // Create SSO string from C string
-SSOString* sso_create(const char* str);
+SSOString sso_create(const char* str);
 
 // Get string data (works for both SSO and heap)
-const char* sso_data(SSOString* str);
+const char* sso_data(const SSOString* str);
 
 // Get string length
-size_t sso_length(SSOString* str);
+size_t sso_length(const SSOString* str);
 
 // Concatenate strings (may promote to heap)
-SSOString* sso_concat(SSOString* a, SSOString* b);
+SSOString sso_concat(const SSOString* a, const SSOString* b);
 
-// Free SSO string
-void sso_free(SSOString* str);
+// Append in place (amortized, stays inline while it fits)
+bool sso_append(SSOString* str, const SSOString* other);
 
-// Reference counting for heap strings
-void sso_retain(SSOString* str);
-void sso_release(SSOString* str);
+// Free SSO string's heap buffer
+void sso_free(SSOString* str);
 
 // ============================================================================
 // Phase 3.4: Memory Management
@@ -138,12 +124,24 @@ void sto_runtime_init(void);
 void sto_runtime_cleanup(void);
 
 // Get memory statistics
+// BigDecimal: values up to 128 bits keep their limbs in the header and
+// operand-only values live on the stack (see bigdecimal.h); each of those
+// is one allocation less, counted in bigdecimal_allocations_saved.
+// by_type: live objects, live bytes and peak bytes of every runtime object
+// kind, from the pool allocator (sto_pool.h), indexed by STOPoolType.
 typedef struct {
     size_t bigdecimal_count;
     size_t bigdecimal_bytes;
-    size_t heap_string_count;
+    size_t bigdecimal_inline_limbs;      // Heap values without a limb buffer
+    size_t bigdecimal_inline_values;     // Stack values (no allocation)
+    size_t bigdecimal_allocations_saved;
+    size_t heap_string_count;            // Heap buffers allocated or regrown
     size_t heap_string_bytes;
+    size_t inline_string_count;          // Strings built without the heap
+    size_t rodata_string_count;          // Long literals used in place
     size_t total_allocations;
+    STOPoolTypeStats by_type[STO_POOL_TYPE_COUNT];
+    size_t pool_slab_bytes;              // Memory held by the pool's slabs
 } STOMemStats;
 
 STOMemStats sto_get_mem_stats(void);
@@ -161,20 +159,22 @@ typedef struct {
 } STOArray;
 
 // List structure (heterogeneous, dynamic)
+// Elements are 16-byte tagged values (sto_value.h) in one buffer: numbers,
+// booleans and short strings need no allocation of their own, and a scan
+// reads kind and payload together. Unset slots are STO_VALUE_NONE.
 typedef struct {
-    void** elements;      // Array of pointers to elements
-    uint8_t* types;       // Array of element types (VarType)
+    STOValue* values;     // capacity values, count of them in use
     size_t count;         // Current number of elements
     size_t capacity;      // Allocated capacity
     int refcount;         // Reference count for GC
 } STOList;
 
 // Tuple structure (heterogeneous, immutable)
+// Header and values are one allocation.
 typedef struct {
-    void** elements;      // Array of pointers to elements
-    uint8_t* types;       // Array of element types (VarType)
     size_t count;         // Number of elements (fixed)
     int refcount;         // Reference count for GC
+    STOValue values[];    // count values
 } STOTuple;
 
 // Array operations
@@ -184,14 +184,25 @@ void* sto_array_get(STOArray* array, size_t index);
 void sto_array_free(STOArray* array);
 
 // List operations
+// set_value / append_value take ownership of the value (and free the one
+// they replace); get_value returns the slot itself, valid until the list
+// changes. Setting past the end grows the list, leaving NONE slots.
 STOList* sto_list_alloc(size_t capacity);
+void sto_list_set_value(STOList* list, size_t index, STOValue value);
+const STOValue* sto_list_get_value(const STOList* list, size_t index);
+void sto_list_append_value(STOList* list, STOValue value);
+void sto_list_free(STOList* list);
+
+// Legacy form: value points to 8 bytes of the given InternalType (see
+// sto_value_from_bytes); get returns the slot's 8-byte payload.
 void sto_list_set(STOList* list, size_t index, void* value, uint8_t type);
 void* sto_list_get(STOList* list, size_t index);
 void sto_list_append(STOList* list, void* value, uint8_t type);
-void sto_list_free(STOList* list);
 
-// Tuple operations
+// Tuple operations (set only during initialization)
 STOTuple* sto_tuple_alloc(size_t count);
+void sto_tuple_set_value(STOTuple* tuple, size_t index, STOValue value);
+const STOValue* sto_tuple_get_value(const STOTuple* tuple, size_t index);
 void sto_tuple_set(STOTuple* tuple, size_t index, void* value, uint8_t type);
 void* sto_tuple_get(STOTuple* tuple, size_t index);
 void sto_tuple_free(STOTuple* tuple);
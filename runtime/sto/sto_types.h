@@ -15,6 +15,9 @@ typedef enum {
     
     // Numeric types (user sees: numeric)
     INTERNAL_TYPE_INT64,        // -2^63 to 2^63-1 (8 bytes, register/stack)
+    INTERNAL_TYPE_INT128,       // -2^127 to 2^127-1 (16 bytes, register pair; INT64 overflow)
+    INTERNAL_TYPE_DECIMAL64,    // Fixed-point int64 units / 10^scale (money, registers)
+    INTERNAL_TYPE_DECIMAL128,   // Fixed-point int128 units / 10^scale (DECIMAL64 overflow)
     INTERNAL_TYPE_DOUBLE,       // IEEE 754 double (8 bytes, XMM register)
     INTERNAL_TYPE_BIGDECIMAL,   // Unlimited precision (heap allocated)
     
@@ -52,4 +55,33 @@ typedef struct STOTypeInfo {
     } mem_location;
 } STOTypeInfo;
 
+// ============================================================================
+// Read-Only Data (INTERNAL_TYPE_RODATA_STRING)
+// ============================================================================
+// Codegen emits every string literal once, as a private constant in the
+// executable's read-only image. Such text lives as long as the program and
+// can never change, so the runtime uses it in place: no copy on create or
+// duplicate, and nothing to free.
+//
+// The image's read-only part is [__executable_start, __data_start) (GNU ld
+// symbols: headers, text, rodata, relro). Text elsewhere - heap, stack,
+// shared libraries, JIT-compiled modules - is treated as writable and
+// copied as before, so a false negative only costs a copy.
+
+#if defined(__GNUC__) && defined(__ELF__)
+extern const char __executable_start[] __attribute__((weak));
+extern const char __data_start[] __attribute__((weak));
+
+static inline bool sto_is_rodata(const void* ptr) {
+    const char* p = (const char*)ptr;
+    return __executable_start && __data_start &&
+           p >= __executable_start && p < __data_start;
+}
+#else
+static inline bool sto_is_rodata(const void* ptr) {
+    (void)ptr;
+    return false;
+}
+#endif
+
 #endif
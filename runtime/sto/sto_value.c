@@ -0,0 +1,125 @@
+/**
+ * STOValue - 16-Byte Tagged Value
+ * Inline scalars and short strings; see sto_value.h for the layout
+ */
+
+#include "sto_value.h"
+#include "sto_pool.h"
+#include <stdlib.h>
+#include <string.h>
+
+// ============================================================================
+// Creation
+// ============================================================================
+
+STOValue sto_value_string(const char* data, size_t length) {
+    STOValue value = sto_value_none();
+    if (!data) {
+        length = 0;
+    }
+
+    if (length <= STO_VALUE_INLINE_CHARS) {
+        if (length > 0) {
+            memcpy(&value, data, length);
+        }
+        value.aux = (uint8_t)length;
+        value.kind = STO_VALUE_SHORT_STRING;
+        return value;
+    }
+
+    STOValueString* string = sto_pool_alloc(sizeof(STOValueString) + length + 1, STO_POOL_VALUE);
+    if (!string) {
+        return value;
+    }
+    string->length = length;
+    memcpy(string->data, data, length);
+    string->data[length] = '\0';
+
+    value.as.string = string;
+    value.kind = STO_VALUE_STRING;
+    return value;
+}
+
+STOValue sto_value_cstring(const char* str) {
+    return sto_value_string(str, str ? strlen(str) : 0);
+}
+
+STOValue sto_value_from_bytes(const void* bytes, uint8_t internal_type) {
+    if (!bytes) {
+        return sto_value_none();
+    }
+
+    switch (internal_type) {
+        case INTERNAL_TYPE_INT64: {
+            int64_t i;
+            memcpy(&i, bytes, sizeof(i));
+            return sto_value_int64(i);
+        }
+        case INTERNAL_TYPE_DOUBLE: {
+            double d;
+            memcpy(&d, bytes, sizeof(d));
+            return sto_value_double(d);
+        }
+        case INTERNAL_TYPE_BOOLEAN:
+            return sto_value_bool(*(const uint8_t*)bytes != 0);
+        default: {
+            void* object;
+            memcpy(&object, bytes, sizeof(object));
+            return sto_value_object(object, internal_type);
+        }
+    }
+}
+
+// ============================================================================
+// Access
+// ============================================================================
+
+uint8_t sto_value_internal_type(const STOValue* value) {
+    switch (sto_value_kind(value)) {
+        case STO_VALUE_INT64: return INTERNAL_TYPE_INT64;
+        case STO_VALUE_DOUBLE: return INTERNAL_TYPE_DOUBLE;
+        case STO_VALUE_BOOLEAN: return INTERNAL_TYPE_BOOLEAN;
+        case STO_VALUE_SHORT_STRING: return INTERNAL_TYPE_SSO_STRING;
+        case STO_VALUE_STRING: return INTERNAL_TYPE_HEAP_STRING;
+        case STO_VALUE_OBJECT: return value->aux;
+        case STO_VALUE_NONE: break;
+    }
+    return INTERNAL_TYPE_UNKNOWN;
+}
+
+bool sto_value_equals(const STOValue* a, const STOValue* b) {
+    if (sto_value_is_string(a) && sto_value_is_string(b)) {
+        size_t a_length, b_length;
+        const char* a_data = sto_value_string_data(a, &a_length);
+        const char* b_data = sto_value_string_data(b, &b_length);
+        return a_length == b_length && memcmp(a_data, b_data, a_length) == 0;
+    }
+    if (a->kind != b->kind) {
+        return false;
+    }
+
+    switch (sto_value_kind(a)) {
+        case STO_VALUE_DOUBLE: return a->as.f64 == b->as.f64;
+        case STO_VALUE_OBJECT: return a->as.object == b->as.object && a->aux == b->aux;
+        default: return a->as.i64 == b->as.i64;  // NONE, INT64, BOOLEAN (zero-padded)
+    }
+}
+
+// ============================================================================
+// Ownership
+// ============================================================================
+
+STOValue sto_value_copy(const STOValue* value) {
+    if (value->kind == STO_VALUE_STRING) {
+        return sto_value_string(value->as.string->data, value->as.string->length);
+    }
+    return *value;
+}
+
+void sto_value_free(STOValue* value) {
+    if (value->kind == STO_VALUE_STRING) {
+        sto_pool_free(value->as.string, sizeof(STOValueString) + value->as.string->length + 1,
+                      STO_POOL_VALUE);
+    }
+    *value = sto_value_none();
+}
@@ -0,0 +1,153 @@
+#ifndef STO_VALUE_H
+#define STO_VALUE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "sto_types.h"
+
+// ============================================================================
+// STOValue - 16-Byte Tagged Value
+// ============================================================================
+// One slot of a heterogeneous STOList / STOTuple (sto_runtime.h).
+//
+// int64, double, boolean and strings of up to STO_VALUE_INLINE_CHARS bytes
+// live entirely inside the value. Longer strings and other heap objects
+// (BigDecimal, nested lists, ...) are referenced by pointer, tagged with
+// their kind. A list of mixed scalars is one contiguous array with no
+// allocation per element, and iterating it is a linear scan that reads
+// each kind byte next to its payload.
+//
+// 16 bytes rather than an 8-byte NaN box: numeric is int64, and a NaN box
+// has 48 payload bits, so large integers would have to be boxed again.
+//
+// Layout (little-endian):
+//   bytes 0..7   payload: i64 | f64 | boolean | object pointer
+//                (short string: bytes 0..13 hold the text, no NUL)
+//   byte  14     short string: its length; object: its InternalType
+//   byte  15     kind (STOValueKind)
+//
+// Ownership: a value owns its heap string; sto_value_free() releases it
+// and sto_value_copy() duplicates it. STO_VALUE_OBJECT pointers are
+// borrowed: containers never free them.
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "STOValue keeps short strings across its payload bytes (little-endian only)"
+#endif
+
+#define STO_VALUE_INLINE_CHARS 14
+
+typedef enum {
+    STO_VALUE_NONE = 0,          // Unset slot (all-zero bytes)
+    STO_VALUE_INT64,
+    STO_VALUE_DOUBLE,
+    STO_VALUE_BOOLEAN,
+    STO_VALUE_SHORT_STRING,      // Inline text, length in byte 14
+    STO_VALUE_STRING,            // Owned STOValueString*
+    STO_VALUE_OBJECT             // Borrowed pointer, InternalType in byte 14
+} STOValueKind;
+
+// Heap text of a STO_VALUE_STRING (one allocation, NUL-terminated)
+typedef struct {
+    size_t length;
+    char data[];
+} STOValueString;
+
+typedef struct {
+    union {
+        int64_t i64;
+        double f64;
+        bool boolean;
+        void* object;
+        STOValueString* string;
+    } as;
+    uint8_t chars[6];   // Short string bytes 8..13
+    uint8_t aux;        // Short string length / object InternalType
+    uint8_t kind;       // STOValueKind
+} STOValue;
+
+_Static_assert(sizeof(STOValue) == 16, "STOValue must stay 16 bytes");
+
+// ============================================================================
+// Creation
+// ============================================================================
+// Scalars and borrowed objects never allocate. sto_value_string() copies
+// text longer than STO_VALUE_INLINE_CHARS into one heap block; on
+// allocation failure the result is STO_VALUE_NONE.
+
+static inline STOValue sto_value_none(void) {
+    STOValue value = { .kind = STO_VALUE_NONE };
+    return value;
+}
+
+static inline STOValue sto_value_int64(int64_t i) {
+    STOValue value = { .as.i64 = i, .kind = STO_VALUE_INT64 };
+    return value;
+}
+
+static inline STOValue sto_value_double(double d) {
+    STOValue value = { .as.f64 = d, .kind = STO_VALUE_DOUBLE };
+    return value;
+}
+
+static inline STOValue sto_value_bool(bool b) {
+    STOValue value = { .as.i64 = b ? 1 : 0, .kind = STO_VALUE_BOOLEAN };
+    return value;
+}
+
+static inline STOValue sto_value_object(void* object, uint8_t internal_type) {
+    STOValue value = { .as.object = object, .aux = internal_type, .kind = STO_VALUE_OBJECT };
+    return value;
+}
+
+STOValue sto_value_string(const char* data, size_t length);
+STOValue sto_value_cstring(const char* str);   // NULL -> ""
+
+// Value from the legacy (pointer to 8 bytes, InternalType) pair used by
+// sto_list_set / sto_tuple_set: INT64, DOUBLE and BOOLEAN become scalars,
+// any other type keeps its 8 bytes as a borrowed object pointer.
+STOValue sto_value_from_bytes(const void* bytes, uint8_t internal_type);
+
+// ============================================================================
+// Access
+// ============================================================================
+
+static inline STOValueKind sto_value_kind(const STOValue* value) {
+    return (STOValueKind)value->kind;
+}
+
+static inline bool sto_value_is_string(const STOValue* value) {
+    return value->kind == STO_VALUE_SHORT_STRING || value->kind == STO_VALUE_STRING;
+}
+
+// Text of a string value (not NUL-terminated when inline), or NULL
+static inline const char* sto_value_string_data(const STOValue* value, size_t* length) {
+    if (value->kind == STO_VALUE_SHORT_STRING) {
+        *length = value->aux;
+        return (const char*)value;
+    }
+    if (value->kind == STO_VALUE_STRING) {
+        *length = value->as.string->length;
+        return value->as.string->data;
+    }
+    *length = 0;
+    return NULL;
+}
+
+// InternalType of the value (INTERNAL_TYPE_UNKNOWN for STO_VALUE_NONE)
+uint8_t sto_value_internal_type(const STOValue* value);
+
+// Same kind and contents (strings by text, objects by pointer)
+bool sto_value_equals(const STOValue* a, const STOValue* b);
+
+// ============================================================================
+// Ownership
+// ============================================================================
+
+// Independent copy (duplicates a heap string; NONE on allocation failure)
+STOValue sto_value_copy(const STOValue* value);
+
+// Release the heap string (if any); 'value' becomes STO_VALUE_NONE
+void sto_value_free(STOValue* value);
+
+#endif
@@ -0,0 +1,234 @@
+// ============================================================================
+// Fixed-Point Decimal Test Program
+// ============================================================================
+// Tests for the DECIMAL64 / DECIMAL128 tier
+//
+// Tests:
+// - Parsing and formatting (scale kept, sign, leading "0.")
+// - Exact add / sub / mul across scales
+// - Division and rescaling in every rounding mode
+// - Promotion DECIMAL64 -> DECIMAL128 -> BigDecimal and demotion back
+// - Ledger sum agrees with the BigDecimal path
+
+#include "fixed_decimal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Test counters
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+static void check(bool ok, const char* test_name) {
+    printf("%s %s\n", ok ? "✅" : "❌", test_name);
+    if (ok) tests_passed++; else tests_failed++;
+}
+
+static STODecimal64 dec64(const char* str) {
+    STODecimal64 d = { 0, 0 };
+    if (!sto_dec64_from_string(str, &d)) {
+        printf("❌ cannot parse %s\n", str);
+        tests_failed++;
+    }
+    return d;
+}
+
+static bool dec64_text_is(STODecimal64 d, const char* expected) {
+    char buf[STO_DECIMAL_STRING_SIZE];
+    sto_dec64_format(d, buf);
+    if (strcmp(buf, expected) != 0) {
+        printf("   expected %s, got %s\n", expected, buf);
+        return false;
+    }
+    return true;
+}
+
+static bool decimal_text_is(STODecimal d, const char* expected) {
+    char* str = sto_decimal_to_string(d);
+    bool ok = str && strcmp(str, expected) == 0;
+    if (!ok) printf("   expected %s, got %s\n", expected, str ? str : "(null)");
+    free(str);
+    return ok;
+}
+
+// Test 1: Parsing and formatting
+void test_parse_format() {
+    printf("\n=== Test 1: Parse / Format ===\n");
+
+    check(dec64_text_is(dec64("1.50"), "1.50"), "1.50 keeps its scale");
+    check(dec64_text_is(dec64("-0.05"), "-0.05"), "-0.05 keeps leading zero");
+    check(dec64_text_is(dec64("+42"), "42"), "+42 parses as integer");
+    check(dec64_text_is(dec64("-0.000001"), "-0.000001"), "scale 6 money value");
+
+    STODecimal64 d;
+    check(!sto_dec64_from_string("12.3.4", &d) && !sto_dec64_from_string("", &d) &&
+          !sto_dec64_from_string("-", &d) && !sto_dec64_from_string("1e5", &d),
+          "malformed text rejected");
+    check(!sto_dec64_from_string("92233720368547758.08", &d), "DECIMAL64 range checked");
+
+    STODecimal128 w;
+    char buf[STO_DECIMAL_STRING_SIZE];
+    check(sto_dec128_from_string("-170141183460469231731687303715884105.728", &w) &&
+          sto_dec128_format(w, buf) > 0 &&
+          strcmp(buf, "-170141183460469231731687303715884105.728") == 0,
+          "DECIMAL128 minimum round trips");
+}
+
+// Test 2: Exact arithmetic
+void test_arithmetic() {
+    printf("\n=== Test 2: Exact Arithmetic ===\n");
+
+    STODecimal64 r;
+    check(!sto_dec64_add(dec64("0.10"), dec64("0.20"), &r) && dec64_text_is(r, "0.30"),
+          "0.10 + 0.20 == 0.30 exactly");
+    check(!sto_dec64_add(dec64("19.99"), dec64("0.005"), &r) && dec64_text_is(r, "19.995"),
+          "add aligns to the larger scale");
+    check(!sto_dec64_sub(dec64("100.00"), dec64("100.01"), &r) && dec64_text_is(r, "-0.01"),
+          "sub crosses zero");
+    check(!sto_dec64_mul(dec64("19.99"), dec64("3"), &r) && dec64_text_is(r, "59.97"),
+          "price * quantity");
+    check(!sto_dec64_mul(dec64("1.25"), dec64("0.0825"), &r) && dec64_text_is(r, "0.103125"),
+          "mul sums scales");
+    check(sto_dec64_add(dec64("9223372036854775807"), dec64("1"), &r),
+          "DECIMAL64 add overflow reported");
+    check(sto_dec64_compare(dec64("1.5"), dec64("1.50")) == 0 &&
+          sto_dec64_compare(dec64("-2"), dec64("1.99")) == -1,
+          "compare across scales");
+}
+
+// Test 3: Rounding modes
+void test_rounding() {
+    printf("\n=== Test 3: Rounding Modes ===\n");
+
+    // Each row: value, then results at scale 0 for every mode
+    // HALF_EVEN, HALF_UP, HALF_DOWN, DOWN, UP, FLOOR, CEILING
+    const char* rows[][8] = {
+        { "2.5",  "2",  "3",  "2",  "2",  "3",  "2",  "3"  },
+        { "3.5",  "4",  "4",  "3",  "3",  "4",  "3",  "4"  },
+        { "-2.5", "-2", "-3", "-2", "-2", "-3", "-3", "-2" },
+        { "2.51", "3",  "3",  "3",  "2",  "3",  "2",  "3"  },
+        { "-2.49", "-2", "-2", "-2", "-2", "-3", "-3", "-2" },
+        { "7.00", "7",  "7",  "7",  "7",  "7",  "7",  "7"  }
+    };
+    int rows_ok = 0;
+    const int row_count = (int)(sizeof(rows) / sizeof(rows[0]));
+
+    for (int i = 0; i < row_count; i++) {
+        bool ok = true;
+        for (int mode = STO_ROUND_HALF_EVEN; mode <= STO_ROUND_CEILING; mode++) {
+            STODecimal64 r;
+            ok = ok && !sto_dec64_rescale(dec64(rows[i][0]), 0, (STORoundingMode)mode, &r) &&
+                 dec64_text_is(r, rows[i][1 + mode]);
+        }
+        if (ok) rows_ok++;
+    }
+    printf("%s rescale to scale 0, 7 modes: %d/%d\n",
+           rows_ok == row_count ? "✅" : "❌", rows_ok, row_count);
+    if (rows_ok == row_count) tests_passed++; else tests_failed++;
+
+    STODecimal64 r;
+    check(!sto_dec64_div(dec64("10.00"), dec64("3"), 2, STO_ROUND_HALF_EVEN, &r) &&
+          dec64_text_is(r, "3.33"), "10.00 / 3 = 3.33");
+    check(!sto_dec64_div(dec64("-20.00"), dec64("3"), 2, STO_ROUND_HALF_UP, &r) &&
+          dec64_text_is(r, "-6.67"), "-20.00 / 3 = -6.67 (half up)");
+    check(!sto_dec64_div(dec64("0.125"), dec64("1"), 2, STO_ROUND_HALF_EVEN, &r) &&
+          dec64_text_is(r, "0.12"), "0.125 -> 0.12 (half even)");
+    check(!sto_dec64_div(dec64("1"), dec64("0.003"), 0, STO_ROUND_CEILING, &r) &&
+          dec64_text_is(r, "334"), "1 / 0.003 = 334 (ceiling)");
+    check(sto_dec64_div(dec64("1"), dec64("0"), 2, STO_ROUND_HALF_EVEN, &r),
+          "division by zero reported");
+}
+
+// Test 4: Promotion and demotion between tiers
+void test_tiers() {
+    printf("\n=== Test 4: Tier Promotion ===\n");
+
+    STODecimal max64 = sto_decimal_from_string("92233720368547758.07");
+    STODecimal cent = sto_decimal_from_string("0.01");
+    check(max64.type == INTERNAL_TYPE_DECIMAL64, "money value starts as DECIMAL64");
+
+    STODecimal over = sto_decimal_add(max64, cent);
+    check(over.type == INTERNAL_TYPE_DECIMAL128 && decimal_text_is(over, "92233720368547758.08"),
+          "DECIMAL64 overflow -> DECIMAL128 (no heap)");
+
+    STODecimal back = sto_decimal_sub(over, cent);
+    check(back.type == INTERNAL_TYPE_DECIMAL64, "shrinks back to DECIMAL64");
+
+    STODecimal huge = sto_decimal_from_string("1701411834604692317316873037158841057.27");
+    STODecimal big = sto_decimal_add(huge, huge);
+    check(big.type == INTERNAL_TYPE_BIGDECIMAL &&
+          decimal_text_is(big, "3402823669209384634633746074317682114.54"),
+          "DECIMAL128 overflow -> BigDecimal");
+
+    STODecimal half = sto_decimal_div(big, sto_decimal_from_string("2"), 2, STO_ROUND_HALF_EVEN);
+    check(half.type == INTERNAL_TYPE_DECIMAL128 && sto_decimal_compare(half, huge) == 0,
+          "BigDecimal result demotes to DECIMAL128");
+
+    STODecimal third = sto_decimal_div(big, sto_decimal_from_string("3"), 2, STO_ROUND_HALF_UP);
+    check(decimal_text_is(third, "1134274556403128211544582024772560704.85"),
+          "BigDecimal division rounds (half up)");
+
+    STODecimal zero = sto_decimal_from_string("0.00");
+    STODecimal invalid = sto_decimal_div(cent, zero, 2, STO_ROUND_HALF_EVEN);
+    check(invalid.type == INTERNAL_TYPE_UNKNOWN, "division by zero -> UNKNOWN");
+
+    check(sto_decimal_compare(big, max64) == 1 && sto_decimal_compare(cent, big) == -1,
+          "compare across tiers");
+
+    sto_decimal_free(big);
+    sto_decimal_free(half);
+    sto_decimal_free(third);
+}
+
+// Test 5: Ledger sum agrees with BigDecimal
+void test_ledger() {
+    printf("\n=== Test 5: Ledger vs BigDecimal ===\n");
+
+    uint64_t state = 0x2545F4914F6CDD1DULL;
+    STODecimal64 total = { 0, 2 };
+    BigDecimal* big_total = sto_bigdec_from_int64(0);
+    bool overflow = false;
+
+    for (int i = 0; i < 10000; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        STODecimal64 amount = { (int64_t)(state % 2000000) - 1000000, 2 };
+
+        overflow = overflow || sto_dec64_add(total, amount, &total);
+        BigDecimal* big_amount = sto_bigdec_from_int128_scaled(amount.units, 2);
+        BigDecimal* next = sto_bigdec_add(big_total, big_amount);
+        sto_bigdec_free(big_amount);
+        sto_bigdec_free(big_total);
+        big_total = next;
+    }
+
+    char buf[STO_DECIMAL_STRING_SIZE];
+    sto_dec64_format(total, buf);
+    char* expected = sto_bigdec_to_string(big_total);
+    check(!overflow && strcmp(buf, expected) == 0, "10000-entry ledger sum == BigDecimal sum");
+    free(expected);
+    sto_bigdec_free(big_total);
+}
+
+int main() {
+    printf("╔═══════════════════════════════════════════════════════╗\n");
+    printf("║     Fixed-Point Decimal Test Suite - STO Runtime     ║\n");
+    printf("╚═══════════════════════════════════════════════════════╝\n");
+
+    test_parse_format();
+    test_arithmetic();
+    test_rounding();
+    test_tiers();
+    test_ledger();
+
+    printf("\n╔═══════════════════════════════════════════════════════╗\n");
+    printf("║                   Test Results                        ║\n");
+    printf("╠═══════════════════════════════════════════════════════╣\n");
+    printf("║  ✅ Passed: %3d                                       ║\n", tests_passed);
+    printf("║  ❌ Failed: %3d                                       ║\n", tests_failed);
+    printf("║  📊 Total:  %3d                                       ║\n", tests_passed + tests_failed);
+    printf("╚═══════════════════════════════════════════════════════╝\n");
+
+    return tests_failed == 0 ? 0 : 1;
+}
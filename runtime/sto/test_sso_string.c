@@ -11,6 +11,8 @@
 // - String search (find)
 // - Conversions (int64 ↔ string)
 // - Prefix/suffix checks
+// - 24-byte layout, append in place, allocations per operation
+// - Long literals borrowed from .rodata (no copy, no free)
 
 #include "runtime_sto.h"
 #include <stdio.h>
@@ -22,8 +24,13 @@
 static int tests_passed = 0;
 static int tests_failed = 0;
 
+static void check(bool ok, const char* test_name) {
+    printf("%s %s\n", ok ? "✅" : "❌", test_name);
+    if (ok) tests_passed++; else tests_failed++;
+}
+
 // Helper: Assert string equals
-void assert_sso_equals(SSOString* sso, const char* expected, const char* test_name) {
+void assert_sso_equals(const SSOString* sso, const char* expected, const char* test_name) {
     const char* result = sto_sso_data(sso);
     
     if (result && strcmp(result, expected) == 0) {
@@ -40,45 +47,46 @@ void test_sso_storage() {
     printf("\n=== Test 1: SSO Storage (≤23 bytes) ===\n");
     
     // Very short string (SSO)
-    SSOString* s1 = sto_sso_create("Hello");
-    assert_sso_equals(s1, "Hello", "Short string");
-    printf("   Flags: 0x%02x (bit 0 = %d, SSO)\n", s1->flags, s1->flags & 1);
-    sto_sso_free(s1);
+    SSOString s1 = sto_sso_create("Hello");
+    assert_sso_equals(&s1, "Hello", "Short string");
+    check(!sto_sso_is_heap(&s1), "   stored inline");
+    sto_sso_free(&s1);
     
     // Exactly 23 bytes (max SSO)
-    SSOString* s2 = sto_sso_create("12345678901234567890123");  // 23 chars
-    assert_sso_equals(s2, "12345678901234567890123", "Exactly 23 bytes");
-    printf("   Flags: 0x%02x (bit 0 = %d, SSO)\n", s2->flags, s2->flags & 1);
-    sto_sso_free(s2);
+    SSOString s2 = sto_sso_create("12345678901234567890123");  // 23 chars
+    assert_sso_equals(&s2, "12345678901234567890123", "Exactly 23 bytes");
+    check(!sto_sso_is_heap(&s2) && s2.data.inline_data[STO_SSO_CAPACITY] == '\0',
+          "   stored inline, last byte doubles as NUL");
+    sto_sso_free(&s2);
     
     // 24 bytes (needs heap)
-    SSOString* s3 = sto_sso_create("123456789012345678901234");  // 24 chars
-    assert_sso_equals(s3, "123456789012345678901234", "24 bytes (heap)");
-    printf("   Flags: 0x%02x (bit 0 = %d, Heap)\n", s3->flags, s3->flags & 1);
-    sto_sso_free(s3);
+    SSOString s3 = sto_sso_create("123456789012345678901234");  // 24 chars
+    assert_sso_equals(&s3, "123456789012345678901234", "24 bytes (heap)");
+    check(sto_sso_is_heap(&s3), "   stored on heap");
+    sto_sso_free(&s3);
 }
 
 // Test 2: String length
 void test_string_length() {
     printf("\n=== Test 2: String Length ===\n");
     
-    SSOString* s1 = sto_sso_create("Hello");
-    size_t len1 = sto_sso_length(s1);
+    SSOString s1 = sto_sso_create("Hello");
+    size_t len1 = sto_sso_length(&s1);
     printf("%s Length of 'Hello': %zu (expected 5)\n", len1 == 5 ? "✅" : "❌", len1);
     if (len1 == 5) tests_passed++; else tests_failed++;
-    sto_sso_free(s1);
+    sto_sso_free(&s1);
     
-    SSOString* s2 = sto_sso_create("");
-    size_t len2 = sto_sso_length(s2);
+    SSOString s2 = sto_sso_create("");
+    size_t len2 = sto_sso_length(&s2);
     printf("%s Length of '': %zu (expected 0)\n", len2 == 0 ? "✅" : "❌", len2);
     if (len2 == 0) tests_passed++; else tests_failed++;
-    sto_sso_free(s2);
+    sto_sso_free(&s2);
     
-    SSOString* s3 = sto_sso_create("Very long string that exceeds SSO limit");
-    size_t len3 = sto_sso_length(s3);
+    SSOString s3 = sto_sso_create("Very long string that exceeds SSO limit");
+    size_t len3 = sto_sso_length(&s3);
     printf("%s Length of long string: %zu (expected 39)\n", len3 == 39 ? "✅" : "❌", len3);
     if (len3 == 39) tests_passed++; else tests_failed++;
-    sto_sso_free(s3);
+    sto_sso_free(&s3);
 }
 
 // Test 3: String concatenation
@@ -86,149 +94,266 @@ void test_concatenation() {
     printf("\n=== Test 3: String Concatenation ===\n");
     
     // SSO + SSO = SSO
-    SSOString* a = sto_sso_create("Hello");
-    SSOString* b = sto_sso_create(" World");
-    SSOString* result = sto_sso_concat(a, b);
-    assert_sso_equals(result, "Hello World", "SSO + SSO");
-    printf("   Result flags: 0x%02x (SSO = %d)\n", result->flags, (result->flags & 1) == 0);
-    sto_sso_free(a);
-    sto_sso_free(b);
-    sto_sso_free(result);
+    SSOString a = sto_sso_create("Hello");
+    SSOString b = sto_sso_create(" World");
+    SSOString result = sto_sso_concat(&a, &b);
+    assert_sso_equals(&result, "Hello World", "SSO + SSO");
+    check(!sto_sso_is_heap(&result), "   result inline");
+    sto_sso_free(&a);
+    sto_sso_free(&b);
+    sto_sso_free(&result);
     
     // SSO + SSO = Heap (exceeds 23 bytes)
     a = sto_sso_create("This is a longer");
     b = sto_sso_create(" string example");
-    result = sto_sso_concat(a, b);
-    assert_sso_equals(result, "This is a longer string example", "SSO + SSO → Heap");
-    printf("   Result flags: 0x%02x (Heap = %d)\n", result->flags, (result->flags & 1) == 1);
-    sto_sso_free(a);
-    sto_sso_free(b);
-    sto_sso_free(result);
+    result = sto_sso_concat(&a, &b);
+    assert_sso_equals(&result, "This is a longer string example", "SSO + SSO → Heap");
+    check(sto_sso_is_heap(&result), "   result on heap");
+    sto_sso_free(&a);
+    sto_sso_free(&b);
+    sto_sso_free(&result);
 }
 
 // Test 4: String comparison
 void test_comparison() {
     printf("\n=== Test 4: String Comparison ===\n");
     
-    SSOString* s1 = sto_sso_create("apple");
-    SSOString* s2 = sto_sso_create("banana");
-    SSOString* s3 = sto_sso_create("apple");
+    SSOString s1 = sto_sso_create("apple");
+    SSOString s2 = sto_sso_create("banana");
+    SSOString s3 = sto_sso_create("apple");
     
-    int cmp1 = sto_sso_compare(s1, s2);
+    int cmp1 = sto_sso_compare(&s1, &s2);
     printf("%s 'apple' < 'banana': %d\n", cmp1 < 0 ? "✅" : "❌", cmp1);
     if (cmp1 < 0) tests_passed++; else tests_failed++;
     
-    int cmp2 = sto_sso_compare(s2, s1);
+    int cmp2 = sto_sso_compare(&s2, &s1);
     printf("%s 'banana' > 'apple': %d\n", cmp2 > 0 ? "✅" : "❌", cmp2);
     if (cmp2 > 0) tests_passed++; else tests_failed++;
     
-    bool eq = sto_sso_equals(s1, s3);
+    bool eq = sto_sso_equals(&s1, &s3);
     printf("%s 'apple' == 'apple': %d\n", eq ? "✅" : "❌", eq);
     if (eq) tests_passed++; else tests_failed++;
     
-    sto_sso_free(s1);
-    sto_sso_free(s2);
-    sto_sso_free(s3);
+    sto_sso_free(&s1);
+    sto_sso_free(&s2);
+    sto_sso_free(&s3);
 }
 
 // Test 5: Substring
 void test_substring() {
     printf("\n=== Test 5: Substring ===\n");
     
-    SSOString* str = sto_sso_create("Hello World");
+    SSOString str = sto_sso_create("Hello World");
     
-    SSOString* sub1 = sto_sso_substring(str, 0, 5);
-    assert_sso_equals(sub1, "Hello", "Substring [0:5]");
-    sto_sso_free(sub1);
+    SSOString sub1 = sto_sso_substring(&str, 0, 5);
+    assert_sso_equals(&sub1, "Hello", "Substring [0:5]");
+    sto_sso_free(&sub1);
     
-    SSOString* sub2 = sto_sso_substring(str, 6, 5);
-    assert_sso_equals(sub2, "World", "Substring [6:11]");
-    sto_sso_free(sub2);
+    SSOString sub2 = sto_sso_substring(&str, 6, 5);
+    assert_sso_equals(&sub2, "World", "Substring [6:11]");
+    sto_sso_free(&sub2);
     
-    SSOString* sub3 = sto_sso_substring(str, 0, 100);  // Exceeds length
-    assert_sso_equals(sub3, "Hello World", "Substring [0:100] (clamped)");
-    sto_sso_free(sub3);
+    SSOString sub3 = sto_sso_substring(&str, 0, 100);  // Exceeds length
+    assert_sso_equals(&sub3, "Hello World", "Substring [0:100] (clamped)");
+    sto_sso_free(&sub3);
     
-    sto_sso_free(str);
+    sto_sso_free(&str);
 }
 
 // Test 6: Integer conversions
 void test_int_conversions() {
     printf("\n=== Test 6: Integer Conversions ===\n");
     
-    SSOString* s1 = sto_sso_from_int64(42);
-    assert_sso_equals(s1, "42", "int64_t 42 → string");
-    sto_sso_free(s1);
+    SSOString s1 = sto_sso_from_int64(42);
+    assert_sso_equals(&s1, "42", "int64_t 42 → string");
+    sto_sso_free(&s1);
     
-    SSOString* s2 = sto_sso_from_int64(-123);
-    assert_sso_equals(s2, "-123", "int64_t -123 → string");
-    sto_sso_free(s2);
+    SSOString s2 = sto_sso_from_int64(-123);
+    assert_sso_equals(&s2, "-123", "int64_t -123 → string");
+    sto_sso_free(&s2);
     
-    SSOString* s3 = sto_sso_create("999");
-    int64_t val = sto_sso_to_int64(s3);
+    SSOString s3 = sto_sso_create("999");
+    int64_t val = sto_sso_to_int64(&s3);
     printf("%s String '999' → int64_t: %lld\n", val == 999 ? "✅" : "❌", (long long)val);
     if (val == 999) tests_passed++; else tests_failed++;
-    sto_sso_free(s3);
+    sto_sso_free(&s3);
 }
 
 // Test 7: String search
 void test_search() {
     printf("\n=== Test 7: String Search ===\n");
     
-    SSOString* str = sto_sso_create("Hello World, Hello Universe");
+    SSOString str = sto_sso_create("Hello World, Hello Universe");
     
-    int pos1 = sto_sso_find(str, "World");
+    int pos1 = sto_sso_find(&str, "World");
     printf("%s Find 'World': %d (expected 6)\n", pos1 == 6 ? "✅" : "❌", pos1);
     if (pos1 == 6) tests_passed++; else tests_failed++;
     
-    int pos2 = sto_sso_find(str, "Hello");
+    int pos2 = sto_sso_find(&str, "Hello");
     printf("%s Find 'Hello' (first): %d (expected 0)\n", pos2 == 0 ? "✅" : "❌", pos2);
     if (pos2 == 0) tests_passed++; else tests_failed++;
     
-    int pos3 = sto_sso_find(str, "NotFound");
+    int pos3 = sto_sso_find(&str, "NotFound");
     printf("%s Find 'NotFound': %d (expected -1)\n", pos3 == -1 ? "✅" : "❌", pos3);
     if (pos3 == -1) tests_passed++; else tests_failed++;
     
-    sto_sso_free(str);
+    sto_sso_free(&str);
 }
 
 // Test 8: Prefix/Suffix checks
 void test_prefix_suffix() {
     printf("\n=== Test 8: Prefix/Suffix Checks ===\n");
     
-    SSOString* str = sto_sso_create("filename.txt");
+    SSOString str = sto_sso_create("filename.txt");
     
-    bool starts = sto_sso_starts_with(str, "file");
+    bool starts = sto_sso_starts_with(&str, "file");
     printf("%s Starts with 'file': %d\n", starts ? "✅" : "❌", starts);
     if (starts) tests_passed++; else tests_failed++;
     
-    bool ends = sto_sso_ends_with(str, ".txt");
+    bool ends = sto_sso_ends_with(&str, ".txt");
     printf("%s Ends with '.txt': %d\n", ends ? "✅" : "❌", ends);
     if (ends) tests_passed++; else tests_failed++;
     
-    bool not_starts = sto_sso_starts_with(str, "data");
+    bool not_starts = sto_sso_starts_with(&str, "data");
     printf("%s Does NOT start with 'data': %d\n", !not_starts ? "✅" : "❌", not_starts);
     if (!not_starts) tests_passed++; else tests_failed++;
     
-    sto_sso_free(str);
+    sto_sso_free(&str);
 }
 
 // Test 9: String copy
 void test_copy() {
     printf("\n=== Test 9: String Copy ===\n");
     
-    SSOString* original = sto_sso_create("Original");
-    SSOString* copy = sto_sso_copy(original);
+    SSOString original = sto_sso_create("Original");
+    SSOString copy = sto_sso_copy(&original);
     
-    assert_sso_equals(copy, "Original", "Copy equals original");
+    assert_sso_equals(&copy, "Original", "Copy equals original");
     
     // Verify they're independent (different memory)
-    bool independent = (original != copy);
+    bool independent = (sto_sso_data(&original) != sto_sso_data(&copy));
     printf("%s Copy is independent: %d\n", independent ? "✅" : "❌", independent);
     if (independent) tests_passed++; else tests_failed++;
     
-    sto_sso_free(original);
-    sto_sso_free(copy);
+    sto_sso_free(&original);
+    sto_sso_free(&copy);
+}
+
+// Test 10: Canonical 24-byte layout
+void test_layout() {
+    printf("\n=== Test 10: 24-Byte Layout ===\n");
+    
+    check(sizeof(SSOString) == 24, "sizeof(SSOString) == 24");
+    
+    SSOString empty = sto_sso_create("");
+    check(sto_sso_length(&empty) == 0 &&
+          (uint8_t)empty.data.inline_data[STO_SSO_CAPACITY] == STO_SSO_CAPACITY,
+          "empty string: last byte holds 23 - length");
+    
+    // Embedded NUL: lengths are explicit
+    SSOString a = sto_sso_from_bytes("ab\0c", 4);
+    SSOString b = sto_sso_from_bytes("ab\0d", 4);
+    check(sto_sso_length(&a) == 4 && sto_sso_compare(&a, &b) < 0 && !sto_sso_equals(&a, &b),
+          "embedded NUL compared by length");
+    
+    SSOString big = sto_sso_create("this one is longer than twenty-three bytes");
+    check(sto_sso_is_heap(&big) && sto_sso_capacity(&big) == 42,
+          "heap capacity read back without the tag");
+    sto_sso_free(&big);
+    check(sto_sso_length(&big) == 0 && !sto_sso_is_heap(&big), "free leaves an empty string");
+}
+
+// Test 11: Append in place
+void test_append() {
+    printf("\n=== Test 11: Append In Place ===\n");
+    
+    SSOString s = sto_sso_create("abc");
+    for (int i = 0; i < 6; i++) sto_sso_append(&s, "xyz", 3);
+    check(!sto_sso_is_heap(&s) && sto_sso_length(&s) == 21, "21 bytes still inline");
+    
+    sto_sso_append(&s, "0123", 4);
+    assert_sso_equals(&s, "abcxyzxyzxyzxyzxyzxyz0123", "grows onto the heap");
+    check(sto_sso_capacity(&s) == 46, "   capacity doubled (23 -> 46)");
+    
+    // Self-append: the source moves when the buffer grows
+    sto_sso_append_sso(&s, &s);
+    assert_sso_equals(&s, "abcxyzxyzxyzxyzxyzxyz0123abcxyzxyzxyzxyzxyzxyz0123",
+                      "append to itself");
+    
+    SSOString built = sto_sso_create("");
+    for (int i = 0; i < 1000; i++) sto_sso_append(&built, "0123456789", 10);
+    check(sto_sso_length(&built) == 10000 && sto_sso_ends_with(&built, "789") &&
+          sto_sso_data(&built)[10000] == '\0', "1000 appends build 10000 bytes");
+    
+    sto_sso_free(&s);
+    sto_sso_free(&built);
+}
+
+// Test 12: Heap allocations per operation
+void test_allocations() {
+    printf("\n=== Test 12: Allocations ===\n");
+    
+    sto_sso_reset_stats();
+    SSOString a = sto_sso_create("Hello");
+    SSOString b = sto_sso_create(" World");
+    SSOString ab = sto_sso_concat(&a, &b);
+    SSOString sub = sto_sso_substring(&ab, 6, 5);
+    SSOString copy = sto_sso_copy(&ab);
+    SSOString num = sto_sso_from_int64(-9223372036854775807LL);
+    STOSSOStats stats = sto_sso_get_stats();
+    check(stats.heap_allocations == 0 && stats.inline_results == 6,
+          "short create/concat/substring/copy/from_int64: 0 allocations");
+    
+    sto_sso_reset_stats();
+    SSOString built = sto_sso_create("");
+    for (int i = 0; i < 1000; i++) sto_sso_append(&built, "0123456789", 10);
+    stats = sto_sso_get_stats();
+    check(stats.heap_allocations <= 10, "1000 appends: at most 10 allocations (geometric)");
+    
+    sto_sso_free(&built);
+    sto_sso_free(&a);
+    sto_sso_free(&b);
+    sto_sso_free(&ab);
+    sto_sso_free(&sub);
+    sto_sso_free(&copy);
+    sto_sso_free(&num);
+}
+
+// Test 13: Long literals are used in place
+void test_rodata_literals() {
+    printf("\n=== Test 13: Rodata Literals ===\n");
+    
+    static const char literal[] = "a literal well past twenty-three bytes";
+    sto_sso_reset_stats();
+    SSOString s = sto_sso_create(literal);
+    SSOString copy = sto_sso_copy(&s);
+    SSOString suffix = sto_sso_substring(&s, 2, 100);
+    STOSSOStats stats = sto_sso_get_stats();
+    check(sto_sso_data(&s) == literal && sto_sso_is_rodata(&s) && sto_sso_is_heap(&s) &&
+          sto_sso_length(&s) == sizeof(literal) - 1, "literal borrowed, not copied");
+    check(sto_sso_data(&copy) == literal && sto_sso_data(&suffix) == literal + 2 &&
+          stats.heap_allocations == 0 && stats.rodata_borrows == 3,
+          "   copy / suffix of a literal: 0 allocations");
+    
+    // Text outside .rodata is still copied
+    char stack_text[] = "a buffer on the stack, also long enough";
+    SSOString owned = sto_sso_create(stack_text);
+    check(sto_sso_data(&owned) != stack_text && !sto_sso_is_rodata(&owned),
+          "stack text copied to the heap");
+    
+    // Appending moves the text into a buffer of its own; the literal is untouched
+    check(sto_sso_append(&s, "", 0) && sto_sso_is_rodata(&s), "empty append writes nothing");
+    sto_sso_append(&s, "!", 1);
+    check(!sto_sso_is_rodata(&s) && sto_sso_data(&s) != literal &&
+          sto_sso_ends_with(&s, "bytes!") && strcmp(literal + 34, "ytes") == 0,
+          "append copies before writing");
+    
+    sto_sso_free(&copy);     // Not freed: borrowed
+    sto_sso_free(&suffix);
+    check(sto_sso_length(&copy) == 0 && strcmp(literal, "a literal well past twenty-three bytes") == 0,
+          "free of a borrowed literal only clears the value");
+    sto_sso_free(&s);
+    sto_sso_free(&owned);
 }
 
 int main() {
@@ -246,6 +371,10 @@ int main() {
     test_search();
     test_prefix_suffix();
     test_copy();
+    test_layout();
+    test_append();
+    test_allocations();
+    test_rodata_literals();
     
     printf("\n╔═══════════════════════════════════════════════════════╗\n");
     printf("║                   Test Results                        ║\n");
@@ -0,0 +1,275 @@
+// ============================================================================
+// Pool Allocator Test Program
+// ============================================================================
+// Tests for the size-class pool (sto_pool.h)
+//
+// Tests:
+// - Every size class: alignment, block reuse, no overlap across slabs
+// - calloc / realloc within a class, across classes, to and from malloc
+// - Per-type live count, bytes, peak and totals
+// - Runtime objects (BigDecimal, strings, lists) show up in sto_get_mem_stats
+// - Threads: private caches, frees from another thread, exit hand-back
+
+#define _POSIX_C_SOURCE 200809L  // pthread
+
+#include "sto_runtime.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// -DSTO_POOL_USE_MALLOC: every block comes from malloc, layout checks skipped
+#ifdef STO_POOL_USE_MALLOC
+#define POOLED false
+#else
+#define POOLED true
+#endif
+
+// Test counters
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+static void check(bool ok, const char* test_name) {
+    printf("%s %s\n", ok ? "✅" : "❌", test_name);
+    if (ok) tests_passed++; else tests_failed++;
+}
+
+static STOPoolTypeStats type_stats(STOPoolType type) {
+    return sto_pool_get_stats().types[type];
+}
+
+// Test 1: Size classes
+static void test_size_classes(void) {
+    printf("\n=== Test 1: Size Classes ===\n");
+
+    bool aligned = true, reused = true;
+    for (size_t size = 1; size <= STO_POOL_MAX_SMALL; size += 7) {
+        unsigned char* a = sto_pool_alloc(size, STO_POOL_OTHER);
+        if (!a || ((uintptr_t)a & 15) != 0) aligned = false;
+        if (a) memset(a, 0xAB, size);
+        sto_pool_free(a, size, STO_POOL_OTHER);
+        unsigned char* b = sto_pool_alloc(size, STO_POOL_OTHER);
+        if (b != a) reused = false;  // Same class: last freed block comes back
+        sto_pool_free(b, size, STO_POOL_OTHER);
+    }
+    check(aligned, "blocks are 16-byte aligned for every size up to 512");
+    check(!POOLED || reused, "a freed block is reused by the next request of its class");
+
+    // Enough 48-byte blocks for several slabs; each keeps its own pattern
+    enum { COUNT = 5000 };
+    unsigned char** blocks = malloc(COUNT * sizeof(*blocks));
+    for (int i = 0; i < COUNT; i++) {
+        blocks[i] = sto_pool_alloc(48, STO_POOL_OTHER);
+        memset(blocks[i], i & 0xFF, 48);
+    }
+    bool intact = true;
+    for (int i = 0; i < COUNT; i++) {
+        for (int j = 0; j < 48; j++) {
+            if (blocks[i][j] != (unsigned char)(i & 0xFF)) intact = false;
+        }
+        sto_pool_free(blocks[i], 48, STO_POOL_OTHER);
+    }
+    free(blocks);
+    check(intact, "5000 live blocks across slabs do not overlap");
+    check(!POOLED || sto_pool_get_stats().slab_bytes >= 5000 * 48, "slabs hold the blocks");
+}
+
+// Test 2: calloc / realloc
+static void test_calloc_realloc(void) {
+    printf("\n=== Test 2: calloc / realloc ===\n");
+
+    unsigned char* p = sto_pool_alloc(100, STO_POOL_OTHER);
+    memset(p, 0xFF, 100);
+    sto_pool_free(p, 100, STO_POOL_OTHER);
+    p = sto_pool_calloc(100, STO_POOL_OTHER);
+    bool zero = true;
+    for (int i = 0; i < 100; i++) if (p[i]) zero = false;
+    check(zero, "calloc zero-fills a reused block");
+
+    for (int i = 0; i < 100; i++) p[i] = (unsigned char)i;
+    unsigned char* q = sto_pool_realloc(p, 100, 110, STO_POOL_OTHER);
+    check(!POOLED || q == p, "realloc within a size class stays in place");
+
+    unsigned char* r = sto_pool_realloc(q, 110, 300, STO_POOL_OTHER);
+    bool kept = true;
+    for (int i = 0; i < 100; i++) if (r[i] != (unsigned char)i) kept = false;
+    check(kept, "realloc to a larger class keeps the contents");
+
+    unsigned char* big = sto_pool_realloc(r, 300, 4000, STO_POOL_OTHER);
+    kept = true;
+    for (int i = 0; i < 100; i++) if (big[i] != (unsigned char)i) kept = false;
+    check(kept, "realloc from the pool to malloc keeps the contents");
+
+    unsigned char* small = sto_pool_realloc(big, 4000, 64, STO_POOL_OTHER);
+    kept = true;
+    for (int i = 0; i < 64; i++) if (small[i] != (unsigned char)i) kept = false;
+    check(kept, "realloc from malloc back to the pool keeps the prefix");
+    sto_pool_free(small, 64, STO_POOL_OTHER);
+
+    void* fresh = sto_pool_realloc(NULL, 0, 32, STO_POOL_OTHER);
+    check(fresh != NULL, "realloc(NULL) allocates");
+    sto_pool_free(fresh, 32, STO_POOL_OTHER);
+}
+
+// Test 3: Per-type statistics
+static void test_type_stats(void) {
+    printf("\n=== Test 3: Per-Type Statistics ===\n");
+
+    STOPoolTypeStats before = type_stats(STO_POOL_MAP);
+    void* a = sto_pool_alloc(40, STO_POOL_MAP);
+    void* b = sto_pool_alloc(200, STO_POOL_MAP);
+    void* c = sto_pool_alloc(1000, STO_POOL_MAP);  // malloc, still counted
+    STOPoolTypeStats during = type_stats(STO_POOL_MAP);
+    check(during.live_count == before.live_count + 3, "live count grows per allocation");
+    check(during.live_bytes == before.live_bytes + 1240, "live bytes are the requested sizes");
+    check(during.total_allocations == before.total_allocations + 3, "total counts allocations");
+    check(during.peak_bytes >= during.live_bytes, "peak covers live bytes");
+
+    size_t large_before = sto_pool_get_stats().large_allocations;
+    void* d = sto_pool_alloc(2048, STO_POOL_MAP);
+    check(sto_pool_get_stats().large_allocations == large_before + 1, "large requests counted");
+
+    sto_pool_free(a, 40, STO_POOL_MAP);
+    sto_pool_free(b, 200, STO_POOL_MAP);
+    sto_pool_free(c, 1000, STO_POOL_MAP);
+    sto_pool_free(d, 2048, STO_POOL_MAP);
+    STOPoolTypeStats after = type_stats(STO_POOL_MAP);
+    check(after.live_count == before.live_count && after.live_bytes == before.live_bytes,
+          "frees bring live count and bytes back");
+    check(after.peak_bytes >= before.live_bytes + 3288, "peak remembers the high point");
+
+    check(strcmp(sto_pool_type_name(STO_POOL_BIGDECIMAL), "bigdecimal") == 0 &&
+          strcmp(sto_pool_type_name(STO_POOL_TYPE_COUNT), "unknown") == 0,
+          "type names");
+}
+
+// Test 4: Runtime objects
+static void test_runtime_objects(void) {
+    printf("\n=== Test 4: Runtime Objects in sto_get_mem_stats ===\n");
+
+    STOMemStats before = sto_get_mem_stats();
+
+    BigDecimal* bd = sto_bigdec_from_string("123456789012345678901234567890123456789012345678901234567890");
+    char source[] = "a string long enough for a heap buffer";  // Not .rodata: copied
+    SSOString text = sto_sso_create(source);
+    STOList* list = sto_list_alloc(8);
+    sto_list_append_value(list, sto_value_cstring("a heap string inside a list"));
+
+    STOMemStats during = sto_get_mem_stats();
+    check(during.by_type[STO_POOL_BIGDECIMAL].live_count >= before.by_type[STO_POOL_BIGDECIMAL].live_count + 2,
+          "BigDecimal header and limbs counted");
+    check(during.by_type[STO_POOL_STRING].live_bytes ==
+          before.by_type[STO_POOL_STRING].live_bytes + sto_sso_capacity(&text) + 1,
+          "SSO heap buffer counted with its capacity");
+    check(during.by_type[STO_POOL_LIST].live_count == before.by_type[STO_POOL_LIST].live_count + 2,
+          "list header and values counted");
+    check(during.by_type[STO_POOL_VALUE].live_count == before.by_type[STO_POOL_VALUE].live_count + 1,
+          "heap string value counted");
+    check(!POOLED || during.pool_slab_bytes > 0, "slab bytes reported");
+
+    sto_bigdec_free(bd);
+    sto_sso_free(&text);
+    sto_list_free(list);
+
+    STOMemStats after = sto_get_mem_stats();
+    bool balanced = true;
+    for (int t = 0; t < STO_POOL_TYPE_COUNT; t++) {
+        if (after.by_type[t].live_count != before.by_type[t].live_count ||
+            after.by_type[t].live_bytes != before.by_type[t].live_bytes) {
+            balanced = false;
+        }
+    }
+    check(balanced, "freeing returns every type to its starting live count");
+}
+
+// Test 5: Threads
+enum { THREADS = 4, PER_THREAD = 20000 };
+
+static void* handoff[THREADS][64];
+
+static void* thread_work(void* arg) {
+    int id = (int)(intptr_t)arg;
+    bool ok = true;
+    // Churn: private cache, every size class
+    for (int i = 0; i < PER_THREAD; i++) {
+        size_t size = 16 + (size_t)((i * 37 + id) % 497);
+        unsigned char* p = sto_pool_alloc(size, STO_POOL_STATE);
+        if (!p) { ok = false; break; }
+        p[0] = (unsigned char)id;
+        p[size - 1] = (unsigned char)id;
+        if (p[0] != (unsigned char)id) ok = false;
+        sto_pool_free(p, size, STO_POOL_STATE);
+    }
+    // Leave blocks for the main thread to free
+    for (int i = 0; i < 64; i++) {
+        handoff[id][i] = sto_pool_alloc(64, STO_POOL_STATE);
+        memset(handoff[id][i], id, 64);
+    }
+    return ok ? arg : (void*)-1;
+}
+
+static void test_threads(void) {
+    printf("\n=== Test 5: Threads ===\n");
+
+    STOPoolTypeStats before = type_stats(STO_POOL_STATE);
+    pthread_t threads[THREADS];
+    for (int i = 0; i < THREADS; i++) {
+        pthread_create(&threads[i], NULL, thread_work, (void*)(intptr_t)i);
+    }
+    bool ok = true;
+    for (int i = 0; i < THREADS; i++) {
+        void* result;
+        pthread_join(threads[i], &result);
+        if (result != (void*)(intptr_t)i) ok = false;
+    }
+    check(ok, "threads allocate and free concurrently");
+
+    STOPoolTypeStats mid = type_stats(STO_POOL_STATE);
+    check(mid.live_count == before.live_count + THREADS * 64,
+          "exited threads' counters are kept");
+    check(mid.total_allocations == before.total_allocations + THREADS * (PER_THREAD + 64),
+          "allocations from every thread counted");
+
+    bool intact = true;
+    for (int t = 0; t < THREADS; t++) {
+        for (int i = 0; i < 64; i++) {
+            unsigned char* p = handoff[t][i];
+            for (int j = 0; j < 64; j++) if (p[j] != (unsigned char)t) intact = false;
+            sto_pool_free(p, 64, STO_POOL_STATE);
+        }
+    }
+    check(intact, "blocks handed to another thread stay intact");
+
+    STOPoolTypeStats after = type_stats(STO_POOL_STATE);
+    check(after.live_count == before.live_count && after.live_bytes == before.live_bytes,
+          "frees from another thread balance the counts");
+
+    // Blocks handed back at thread exit are reused here
+    void* reuse = sto_pool_alloc(64, STO_POOL_STATE);
+    check(reuse != NULL, "allocation after threads exit");
+    sto_pool_free(reuse, 64, STO_POOL_STATE);
+    sto_pool_thread_flush();
+}
+
+int main() {
+    printf("╔═══════════════════════════════════════════════════════╗\n");
+    printf("║       Pool Allocator Test Suite - STO Runtime         ║\n");
+    printf("║       Size classes, thread caches, per-type stats     ║\n");
+    printf("╚═══════════════════════════════════════════════════════╝\n");
+
+    test_size_classes();
+    test_calloc_realloc();
+    test_type_stats();
+    test_runtime_objects();
+    test_threads();
+
+    printf("\n╔═══════════════════════════════════════════════════════╗\n");
+    printf("║                   Test Results                        ║\n");
+    printf("╠═══════════════════════════════════════════════════════╣\n");
+    printf("║  ✅ Passed: %3d                                       ║\n", tests_passed);
+    printf("║  ❌ Failed: %3d                                       ║\n", tests_failed);
+    printf("║  📊 Total:  %3d                                       ║\n", tests_passed + tests_failed);
+    printf("╚═══════════════════════════════════════════════════════╝\n");
+
+    return tests_failed == 0 ? 0 : 1;
+}
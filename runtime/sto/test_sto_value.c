@@ -0,0 +1,243 @@
+// ============================================================================
+// STOValue Test Program
+// ============================================================================
+// Tests for the 16-byte tagged value and the STOList / STOTuple built on it
+//
+// Tests:
+// - Layout and inline scalars (int64 full range, double, boolean)
+// - Short strings inline (≤14 bytes) vs heap strings
+// - Equality, copy, free
+// - Legacy (void*, InternalType) list/tuple API
+// - Heterogeneous list: set/get/append, overwrite, growth, linear scan
+// - Tuple: single allocation, bounds
+
+#include "sto_runtime.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Test counters
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+static void check(bool ok, const char* test_name) {
+    printf("%s %s\n", ok ? "✅" : "❌", test_name);
+    if (ok) tests_passed++; else tests_failed++;
+}
+
+static bool string_is(const STOValue* value, const char* expected) {
+    size_t length;
+    const char* data = sto_value_string_data(value, &length);
+    return data && length == strlen(expected) && memcmp(data, expected, length) == 0;
+}
+
+// Test 1: Layout and scalars
+static void test_scalars(void) {
+    printf("\n=== Test 1: Layout and Scalars ===\n");
+
+    check(sizeof(STOValue) == 16, "STOValue is 16 bytes");
+
+    STOValue none;
+    memset(&none, 0, sizeof(none));
+    check(sto_value_kind(&none) == STO_VALUE_NONE, "all-zero bytes are NONE");
+
+    STOValue i = sto_value_int64(INT64_MIN);
+    check(sto_value_kind(&i) == STO_VALUE_INT64 && i.as.i64 == INT64_MIN, "int64 keeps INT64_MIN");
+    i = sto_value_int64(INT64_MAX);
+    check(i.as.i64 == INT64_MAX, "int64 keeps INT64_MAX");
+
+    STOValue d = sto_value_double(-2.5);
+    check(sto_value_kind(&d) == STO_VALUE_DOUBLE && d.as.f64 == -2.5, "double inline");
+
+    STOValue b = sto_value_bool(true);
+    check(sto_value_kind(&b) == STO_VALUE_BOOLEAN && b.as.boolean, "boolean inline");
+
+    check(sto_value_internal_type(&i) == INTERNAL_TYPE_INT64 &&
+          sto_value_internal_type(&d) == INTERNAL_TYPE_DOUBLE &&
+          sto_value_internal_type(&b) == INTERNAL_TYPE_BOOLEAN &&
+          sto_value_internal_type(&none) == INTERNAL_TYPE_UNKNOWN,
+          "internal types");
+}
+
+// Test 2: Strings
+static void test_strings(void) {
+    printf("\n=== Test 2: Short and Heap Strings ===\n");
+
+    STOValue empty = sto_value_cstring("");
+    check(sto_value_kind(&empty) == STO_VALUE_SHORT_STRING && string_is(&empty, ""), "empty string inline");
+
+    STOValue s14 = sto_value_cstring("12345678901234");
+    check(sto_value_kind(&s14) == STO_VALUE_SHORT_STRING && string_is(&s14, "12345678901234"),
+          "14 bytes inline");
+    check(sto_value_internal_type(&s14) == INTERNAL_TYPE_SSO_STRING, "   reports SSO_STRING");
+
+    STOValue s15 = sto_value_cstring("123456789012345");
+    check(sto_value_kind(&s15) == STO_VALUE_STRING && string_is(&s15, "123456789012345"),
+          "15 bytes on heap");
+    check(s15.as.string->data[15] == '\0', "   heap text NUL-terminated");
+    check(sto_value_internal_type(&s15) == INTERNAL_TYPE_HEAP_STRING, "   reports HEAP_STRING");
+
+    STOValue null_string = sto_value_cstring(NULL);
+    check(string_is(&null_string, ""), "NULL becomes empty string");
+
+    STOValue embedded = sto_value_string("a\0b", 3);
+    size_t length;
+    const char* data = sto_value_string_data(&embedded, &length);
+    check(length == 3 && data[1] == '\0' && data[2] == 'b', "embedded NUL kept");
+
+    STOValue not_string = sto_value_int64(7);
+    check(sto_value_string_data(&not_string, &length) == NULL && length == 0,
+          "string_data of int64 is NULL");
+
+    sto_value_free(&s14);
+    sto_value_free(&s15);
+    check(sto_value_kind(&s15) == STO_VALUE_NONE, "free leaves NONE");
+}
+
+// Test 3: Equality and copy
+static void test_equality_copy(void) {
+    printf("\n=== Test 3: Equality and Copy ===\n");
+
+    STOValue a = sto_value_int64(42);
+    STOValue b = sto_value_int64(42);
+    STOValue c = sto_value_double(42.0);
+    check(sto_value_equals(&a, &b), "equal int64");
+    check(!sto_value_equals(&a, &c), "int64 != double of same number");
+
+    STOValue t1 = sto_value_bool(true);
+    STOValue t2 = sto_value_bool(true);
+    check(sto_value_equals(&t1, &t2), "equal booleans");
+
+    STOValue long1 = sto_value_cstring("a string longer than fourteen");
+    STOValue long2 = sto_value_copy(&long1);
+    check(long2.as.string != long1.as.string, "copy duplicates heap string");
+    check(sto_value_equals(&long1, &long2), "   copy equals original");
+
+    STOValue short1 = sto_value_cstring("short");
+    STOValue short2 = sto_value_cstring("short");
+    check(sto_value_equals(&short1, &short2), "equal short strings");
+    check(!sto_value_equals(&short1, &long1), "different strings");
+
+    int target = 0;
+    STOValue o1 = sto_value_object(&target, INTERNAL_TYPE_BIGDECIMAL);
+    STOValue o2 = sto_value_object(&target, INTERNAL_TYPE_BIGDECIMAL);
+    check(sto_value_equals(&o1, &o2) && sto_value_internal_type(&o1) == INTERNAL_TYPE_BIGDECIMAL,
+          "objects compare by pointer, keep InternalType");
+
+    sto_value_free(&long1);
+    sto_value_free(&long2);
+}
+
+// Test 4: Heterogeneous list
+static void test_list(void) {
+    printf("\n=== Test 4: Heterogeneous List ===\n");
+
+    STOList* list = sto_list_alloc(2);
+    sto_list_append_value(list, sto_value_int64(1));
+    sto_list_append_value(list, sto_value_double(2.5));
+    sto_list_append_value(list, sto_value_cstring("three"));
+    sto_list_append_value(list, sto_value_cstring("a heap string, not inline"));
+    sto_list_append_value(list, sto_value_bool(true));
+    check(list->count == 5 && list->capacity >= 5, "append grows past capacity");
+
+    check(sto_list_get_value(list, 0)->as.i64 == 1, "get int64");
+    check(sto_list_get_value(list, 1)->as.f64 == 2.5, "get double");
+    check(string_is(sto_list_get_value(list, 2), "three"), "get short string");
+    check(string_is(sto_list_get_value(list, 3), "a heap string, not inline"), "get heap string");
+    check(sto_list_get_value(list, 4)->as.boolean, "get boolean");
+
+    // Overwriting a heap string frees it (checked under valgrind/ASan)
+    sto_list_set_value(list, 3, sto_value_int64(4));
+    check(sto_list_get_value(list, 3)->as.i64 == 4, "overwrite heap string with int64");
+
+    // Setting past the end leaves NONE gaps
+    sto_list_set_value(list, 9, sto_value_int64(10));
+    check(list->count == 10 && sto_value_kind(sto_list_get_value(list, 7)) == STO_VALUE_NONE,
+          "set past end leaves NONE slots");
+
+    // Linear scan: one pass over contiguous values
+    int64_t int_sum = 0;
+    size_t strings = 0;
+    for (size_t i = 0; i < list->count; i++) {
+        const STOValue* value = &list->values[i];
+        if (value->kind == STO_VALUE_INT64) int_sum += value->as.i64;
+        if (sto_value_is_string(value)) strings++;
+    }
+    check(int_sum == 15 && strings == 1, "linear scan over mixed kinds");
+
+    sto_list_free(list);
+}
+
+// Test 5: Legacy (void*, InternalType) API
+static void test_legacy_api(void) {
+    printf("\n=== Test 5: Legacy API ===\n");
+
+    STOList* list = sto_list_alloc(0);
+    int64_t i = -7;
+    double d = 0.125;
+    bool b = true;
+    int target = 0;
+    void* object = &target;
+    sto_list_append(list, &i, INTERNAL_TYPE_INT64);
+    sto_list_append(list, &d, INTERNAL_TYPE_DOUBLE);
+    sto_list_append(list, &b, INTERNAL_TYPE_BOOLEAN);
+    sto_list_append(list, &object, INTERNAL_TYPE_BIGDECIMAL);
+
+    check(*(int64_t*)sto_list_get(list, 0) == -7, "legacy int64 round trip");
+    check(*(double*)sto_list_get(list, 1) == 0.125, "legacy double round trip");
+    check(*(bool*)sto_list_get(list, 2), "legacy boolean round trip");
+    check(*(void**)sto_list_get(list, 3) == object, "legacy object pointer round trip");
+    check(sto_value_internal_type(sto_list_get_value(list, 3)) == INTERNAL_TYPE_BIGDECIMAL,
+          "   object keeps InternalType");
+
+    i = 99;  // the list holds a copy, not the caller's storage
+    check(*(int64_t*)sto_list_get(list, 0) == -7, "list stores values, not pointers");
+    sto_list_free(list);
+}
+
+// Test 6: Tuple
+static void test_tuple(void) {
+    printf("\n=== Test 6: Tuple ===\n");
+
+    check(sto_tuple_alloc(0) == NULL, "empty tuple is NULL");
+
+    STOTuple* tuple = sto_tuple_alloc(3);
+    check(tuple->count == 3 && sto_value_kind(sto_tuple_get_value(tuple, 2)) == STO_VALUE_NONE,
+          "new tuple slots are NONE");
+
+    int64_t i = 5;
+    sto_tuple_set(tuple, 0, &i, INTERNAL_TYPE_INT64);
+    sto_tuple_set_value(tuple, 1, sto_value_cstring("a heap string, not inline"));
+    sto_tuple_set_value(tuple, 2, sto_value_double(1.5));
+    sto_tuple_set_value(tuple, 3, sto_value_cstring("out of range, freed by set"));
+
+    check(*(int64_t*)sto_tuple_get(tuple, 0) == 5, "tuple legacy int64");
+    check(string_is(sto_tuple_get_value(tuple, 1), "a heap string, not inline"), "tuple heap string");
+    check(sto_tuple_get_value(tuple, 2)->as.f64 == 1.5, "tuple double");
+
+    sto_tuple_free(tuple);
+}
+
+int main() {
+    printf("╔═══════════════════════════════════════════════════════╗\n");
+    printf("║       STOValue Test Suite - STO Runtime               ║\n");
+    printf("║       16-byte tagged values in lists and tuples       ║\n");
+    printf("╚═══════════════════════════════════════════════════════╝\n");
+
+    test_scalars();
+    test_strings();
+    test_equality_copy();
+    test_list();
+    test_legacy_api();
+    test_tuple();
+
+    printf("\n╔═══════════════════════════════════════════════════════╗\n");
+    printf("║                   Test Results                        ║\n");
+    printf("╠═══════════════════════════════════════════════════════╣\n");
+    printf("║  ✅ Passed: %3d                                       ║\n", tests_passed);
+    printf("║  ❌ Failed: %3d                                       ║\n", tests_failed);
+    printf("║  📊 Total:  %3d                                       ║\n", tests_passed + tests_failed);
+    printf("╚═══════════════════════════════════════════════════════╝\n");
+
+    return tests_failed == 0 ? 0 : 1;
+}
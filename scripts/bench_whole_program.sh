@@ -0,0 +1,133 @@
+#!/bin/bash
+# MELP Whole-Program Benchmark - archive link vs. runtime bitcode link
+# Date: 18 Ekim 2026
+#
+# Builds the same MLP programs twice:
+#   archive : stage2_bootstrap → llc → gcc + libmlp_stdlib.a + libsto_runtime.a
+#   bitcode : stage2_bootstrap --runtime-bc (runtime linked before opt) → llc → gcc
+# and reports the best wall-clock time of several runs for each.
+#
+# Kullanım: ./scripts/bench_whole_program.sh [runs]
+# Gerekenler: clang (runtime bitcode için), llvm-link, opt, llc
+
+set -e
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+PROJECT_ROOT="$(cd "$SCRIPT_DIR/.." && pwd)"
+COMPILER="$PROJECT_ROOT/compiler/stage2/stage2_bootstrap"
+STO_DIR="$PROJECT_ROOT/runtime/sto"
+STDLIB_DIR="$PROJECT_ROOT/runtime/stdlib"
+WORK_DIR="${TMPDIR:-/tmp}/melp_bench_whole_program"
+RUNS="${1:-5}"
+
+# Colors
+GREEN='\033[0;32m'
+BLUE='\033[0;34m'
+RED='\033[0;31m'
+NC='\033[0m' # No Color
+
+for tool in "${CLANG:-clang}" llvm-link opt llc gcc; do
+    if ! command -v "$tool" > /dev/null; then
+        echo -e "${RED}❌ '$tool' bulunamadı${NC}"
+        exit 1
+    fi
+done
+
+mkdir -p "$WORK_DIR"
+
+echo -e "${BLUE}🔨 Runtime derleniyor (archive + bitcode)...${NC}"
+make -C "$STO_DIR" libsto_runtime.a bitcode > /dev/null
+make -C "$STDLIB_DIR" libmlp_stdlib.a bitcode > /dev/null
+
+# ============================================================================
+# Benchmark programs
+# ============================================================================
+
+# Print-heavy: one runtime call per iteration
+cat > "$WORK_DIR/print_loop.mlp" << 'EOF'
+function main() as numeric
+    numeric i = 0
+    while i < 2000000
+        print(i)
+        i = i + 1
+    end_while
+    return 0
+end_function
+EOF
+
+# Mixed: arithmetic in MLP, print every 16th value
+cat > "$WORK_DIR/print_sparse.mlp" << 'EOF'
+function main() as numeric
+    numeric i = 0
+    numeric j = 0
+    numeric acc = 0
+    while i < 20000000
+        acc = acc + i * 3
+        j = j + 1
+        if j == 16 then
+            print(acc)
+            j = 0
+        end_if
+        i = i + 1
+    end_while
+    return 0
+end_function
+EOF
+
+# ============================================================================
+# Build & measure
+# ============================================================================
+
+build_archive() {
+    local name="$1"
+    "$COMPILER" "$WORK_DIR/$name.mlp" -o "$WORK_DIR/$name.archive.ll" > /dev/null
+    llc -O2 -relocation-model=pic "$WORK_DIR/$name.archive.ll" -o "$WORK_DIR/$name.archive.s"
+    gcc "$WORK_DIR/$name.archive.s" "$STDLIB_DIR/libmlp_stdlib.a" "$STO_DIR/libsto_runtime.a" \
+        -lm -o "$WORK_DIR/$name.archive"
+}
+
+build_bitcode() {
+    local name="$1"
+    "$COMPILER" "$WORK_DIR/$name.mlp" -o "$WORK_DIR/$name.bitcode.ll" \
+        --runtime-bc "$STDLIB_DIR/libmlp_stdlib.bc" \
+        --runtime-bc "$STO_DIR/libsto_runtime.bc" > /dev/null
+    llc -O2 -relocation-model=pic "$WORK_DIR/$name.bitcode.ll" -o "$WORK_DIR/$name.bitcode.s"
+    gcc "$WORK_DIR/$name.bitcode.s" -lm -o "$WORK_DIR/$name.bitcode"
+}
+
+# Best-of-N wall clock in milliseconds (stdout discarded)
+best_ms() {
+    local exe="$1"
+    local best=""
+    for _ in $(seq 1 "$RUNS"); do
+        local start end elapsed
+        start=$(date +%s%N)
+        "$exe" > /dev/null
+        end=$(date +%s%N)
+        elapsed=$(( (end - start) / 1000000 ))
+        if [ -z "$best" ] || [ "$elapsed" -lt "$best" ]; then
+            best=$elapsed
+        fi
+    done
+    echo "$best"
+}
+
+echo -e "${BLUE}⏱  Best of $RUNS runs${NC}"
+printf "%-16s %12s %12s %9s\n" "program" "archive(ms)" "bitcode(ms)" "speedup"
+
+for name in print_loop print_sparse; do
+    build_archive "$name"
+    build_bitcode "$name"
+
+    if ! cmp -s <("$WORK_DIR/$name.archive") <("$WORK_DIR/$name.bitcode"); then
+        echo -e "${RED}❌ $name: outputs differ${NC}"
+        exit 1
+    fi
+
+    archive_ms=$(best_ms "$WORK_DIR/$name.archive")
+    bitcode_ms=$(best_ms "$WORK_DIR/$name.bitcode")
+    speedup=$(awk -v a="$archive_ms" -v b="$bitcode_ms" 'BEGIN { printf "%.2fx", (b > 0 ? a / b : 0) }')
+    printf "%-16s %12s %12s %9s\n" "$name" "$archive_ms" "$bitcode_ms" "$speedup"
+done
+
+echo -e "${GREEN}✅ Done${NC} (artifacts: $WORK_DIR)"
@@ -20,11 +20,14 @@ echo "🔧 Derleniyor: $INPUT"
 
 # 2. Executable oluştur
 clang "${OUTPUT}.ll" \
-    "$MLP_ROOT/runtime/stdlib/libmlp_stdlib.a" \
     "$MLP_ROOT/runtime/sto/bigdecimal.o" \
+    "$MLP_ROOT/runtime/sto/int128.o" \
+    "$MLP_ROOT/runtime/sto/fixed_decimal.o" \
     "$MLP_ROOT/runtime/sto/sso_string.o" \
     "$MLP_ROOT/runtime/sto/runtime_sto.o" \
     "$MLP_ROOT/runtime/sto/sto_runtime.o" \
+    "$MLP_ROOT/runtime/sto/sto_value.o" \
+    "$MLP_ROOT/runtime/stdlib/libmlp_stdlib.a" \
     -lm -o "${OUTPUT}" 2>/dev/null
 
 echo "✅ Derlendi: ${OUTPUT}"